@@ -0,0 +1,66 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2016, Advanced Micro Devices, Inc
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_GEMM_UKR_VARIANTS_H
+#define BLIS_GEMM_UKR_VARIANTS_H
+
+// The gemm micro-kernel variants for Haswell-class cores. The micro-kernel
+// selected in bli_kernel.h is the default; when a gemm context is
+// initialized for a particular problem, the variant that best fits the
+// shape and storage of C is used instead. Each entry gives the kernel name,
+// MC, KC, NC, MR, NR, and whether the kernel prefers contiguous rows of C.
+
+#define BLIS_SGEMM_UKERNEL_VARIANTS( var ) \
+        var( bli_sgemm_asm_6x16, 144, 256, 4080,  6, 16, 1 ) \
+        var( bli_sgemm_asm_4x24, 256, 256, 4080,  4, 24, 1 ) \
+        var( bli_sgemm_asm_16x6, 144, 256, 4080, 16,  6, 0 ) \
+        var( bli_sgemm_asm_24x4, 264, 128, 4080, 24,  4, 0 )
+
+#define BLIS_DGEMM_UKERNEL_VARIANTS( var ) \
+        var( bli_dgemm_asm_6x8,   72, 256, 4080,  6,  8, 1 ) \
+        var( bli_dgemm_asm_4x12, 152, 160, 4080,  4, 12, 1 ) \
+        var( bli_dgemm_asm_8x6,   72, 256, 4080,  8,  6, 0 ) \
+        var( bli_dgemm_asm_12x4,  96, 192, 4080, 12,  4, 0 )
+
+#define BLIS_CGEMM_UKERNEL_VARIANTS( var ) \
+        var( bli_cgemm_asm_3x8,  144, 256, 4080,  3,  8, 1 ) \
+        var( bli_cgemm_asm_8x3,  144, 256, 4080,  8,  3, 0 )
+
+#define BLIS_ZGEMM_UKERNEL_VARIANTS( var ) \
+        var( bli_zgemm_asm_3x4,   72, 256, 4080,  3,  4, 1 ) \
+        var( bli_zgemm_asm_4x3,   72, 256, 4080,  4,  3, 0 )
+
+#endif
+
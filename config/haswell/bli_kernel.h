@@ -36,6 +36,9 @@
 #ifndef BLIS_KERNEL_H
 #define BLIS_KERNEL_H
 
+// Two 256-bit FMA units per core.
+#define BLIS_SIMD_FMA_PER_CYCLE          2
+
 
 // -- LEVEL-3 MICRO-KERNEL CONSTANTS AND DEFINITIONS ---------------------------
 
@@ -163,6 +166,43 @@
 #endif
 
 
+// -- gemm micro-kernel variants --
+
+// All of the gemm micro-kernels compiled for this configuration, with their
+// blocksizes (see bli_gemm_ukr_variants.h). The zen configuration compiles
+// the same kernels and shares this list.
+
+#include "bli_gemm_ukr_variants.h"
+
+
+// -- gemmsup kernels --
+
+#define BLIS_SGEMMSUP_KERNEL       bli_sgemmsup_opt_16x4
+#define BLIS_DGEMMSUP_KERNEL       bli_dgemmsup_opt_8x4
+
+// The largest m, n and k for which gemmsup beats the blocked algorithm.
+#define BLIS_SGEMMSUP_MAX          64
+#define BLIS_DGEMMSUP_MAX          64
+
+// The largest square size for which the tiny kernels beat the gemmsup
+// kernels above.
+#define BLIS_SGEMMTINY_MAX         12
+#define BLIS_DGEMMTINY_MAX          5
+
+
+// -- level-3 cost model --
+
+// Per-core rates of the micro-kernels and packing at about 3.5 GHz, and the
+// overheads of a call, of starting a thread and of a barrier (see
+// bli_l3_model.h). Run test/tune to calibrate them for a particular machine.
+
+#define BLIS_DEFAULT_MODEL_GFLOPS_S   100.0
+#define BLIS_DEFAULT_MODEL_GFLOPS_D    50.0
+#define BLIS_DEFAULT_MODEL_GFLOPS_C    95.0
+#define BLIS_DEFAULT_MODEL_GFLOPS_Z    48.0
+#define BLIS_DEFAULT_MODEL_PACK_GBPS    8.0
+#define BLIS_DEFAULT_MODEL_CALL_US      2.0
+#define BLIS_DEFAULT_MODEL_BARRIER_US   0.3
 
 
 // -- LEVEL-2 KERNEL CONSTANTS -------------------------------------------------
@@ -212,6 +252,18 @@
 
 // -- invertv --
 
+// -- rotmv --
+#define BLIS_SROTMV_KERNEL         bli_srotmv_opt_var1
+#define BLIS_DROTMV_KERNEL         bli_drotmv_opt_var1
+#define BLIS_CROTMV_KERNEL         bli_crotmv_opt_var1
+#define BLIS_ZROTMV_KERNEL         bli_zrotmv_opt_var1
+
+// -- rotv --
+#define BLIS_SROTV_KERNEL          bli_srotv_opt_var1
+#define BLIS_DROTV_KERNEL          bli_drotv_opt_var1
+#define BLIS_CROTV_KERNEL          bli_crotv_opt_var1
+#define BLIS_ZROTV_KERNEL          bli_zrotv_opt_var1
+
 // -- scal2v --
 
 // -- scalv --
@@ -42,6 +42,7 @@
 
 #define BLIS_SIMD_SIZE                   64
 #define BLIS_SIMD_NUM_REGISTERS          32
+#define BLIS_SIMD_FMA_PER_CYCLE          2
 
 #include <hbwmalloc.h>
 
@@ -0,0 +1 @@
+../haswell/bli_gemm_ukr_variants.h
\ No newline at end of file
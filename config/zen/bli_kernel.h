@@ -154,6 +154,27 @@
 #define BLIS_ZGEMM_UKERNEL_PREFERS_CONTIG_ROWS
 #endif
 
+// -- gemm micro-kernel variants --
+
+// The same micro-kernels as in the haswell configuration, whose list of
+// variants (and their blocksizes) we share.
+
+#include "bli_gemm_ukr_variants.h"
+
+// -- gemmsup kernels --
+
+#define BLIS_SGEMMSUP_KERNEL       bli_sgemmsup_opt_16x4
+#define BLIS_DGEMMSUP_KERNEL       bli_dgemmsup_opt_8x4
+
+// The largest m, n and k for which gemmsup beats the blocked algorithm.
+#define BLIS_SGEMMSUP_MAX          64
+#define BLIS_DGEMMSUP_MAX          64
+
+// The largest square size for which the tiny kernels beat the gemmsup
+// kernels above.
+#define BLIS_SGEMMTINY_MAX         12
+#define BLIS_DGEMMTINY_MAX          5
+
 // -- trsm-related --
 
 #define BLIS_STRSM_L_UKERNEL   bli_strsm_l_int_6x16
@@ -249,6 +270,18 @@ gint_t bli_gemm_small_matrix
 
 // -- invertv --
 
+// -- rotmv --
+#define BLIS_SROTMV_KERNEL         bli_srotmv_opt_var1
+#define BLIS_DROTMV_KERNEL         bli_drotmv_opt_var1
+#define BLIS_CROTMV_KERNEL         bli_crotmv_opt_var1
+#define BLIS_ZROTMV_KERNEL         bli_zrotmv_opt_var1
+
+// -- rotv --
+#define BLIS_SROTV_KERNEL          bli_srotv_opt_var1
+#define BLIS_DROTV_KERNEL          bli_drotv_opt_var1
+#define BLIS_CROTV_KERNEL          bli_crotv_opt_var1
+#define BLIS_ZROTV_KERNEL          bli_zrotv_opt_var1
+
 // -- scal2v --
 
 // -- scalv --
@@ -153,6 +153,39 @@ void PASTEMAC(opname,_check) \
 GENFRONT( invertv )
 
 
+#undef  GENFRONT
+#define GENFRONT( opname ) \
+\
+void PASTEMAC(opname,_check) \
+     ( \
+       obj_t*  h, \
+       obj_t*  x, \
+       obj_t*  y  \
+     ) \
+{ \
+	bli_l1v_rotm_check( h, x, y ); \
+}
+
+GENFRONT( rotmv )
+
+
+#undef  GENFRONT
+#define GENFRONT( opname ) \
+\
+void PASTEMAC(opname,_check) \
+     ( \
+       obj_t*  c, \
+       obj_t*  s, \
+       obj_t*  x, \
+       obj_t*  y  \
+     ) \
+{ \
+	bli_l1v_rot_check( c, s, x, y ); \
+}
+
+GENFRONT( rotv )
+
+
 #undef  GENFRONT
 #define GENFRONT( opname ) \
 \
@@ -532,3 +565,111 @@ void bli_l1v_xi_check
 	bli_check_error_code( e_val );
 }
 
+void bli_l1v_rotm_check
+     (
+       obj_t*  h,
+       obj_t*  x,
+       obj_t*  y 
+     )
+{
+	err_t e_val;
+
+	// Check object datatypes.
+
+	e_val = bli_check_floating_object( x );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_consistent_object_datatypes( x, y );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_real_proj_of( x, h );
+	bli_check_error_code( e_val );
+
+	// Check object dimensions.
+
+	e_val = bli_check_vector_object( h );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_vector_dim_equals( h, 5 );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_vector_object( x );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_vector_object( y );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_equal_vector_lengths( x, y );
+	bli_check_error_code( e_val );
+
+	// Check object buffers (for non-NULLness).
+
+	e_val = bli_check_object_buffer( h );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( x );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( y );
+	bli_check_error_code( e_val );
+}
+
+void bli_l1v_rot_check
+     (
+       obj_t*  c,
+       obj_t*  s,
+       obj_t*  x,
+       obj_t*  y 
+     )
+{
+	err_t e_val;
+
+	// Check object datatypes.
+
+	e_val = bli_check_noninteger_object( c );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_real_valued_object( c );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_noninteger_object( s );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_floating_object( x );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_floating_object( y );
+	bli_check_error_code( e_val );
+
+	// Check object dimensions.
+
+	e_val = bli_check_scalar_object( c );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_scalar_object( s );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_vector_object( x );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_vector_object( y );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_equal_vector_lengths( x, y );
+	bli_check_error_code( e_val );
+
+	// Check object buffers (for non-NULLness).
+
+	e_val = bli_check_object_buffer( c );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( s );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( x );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( y );
+	bli_check_error_code( e_val );
+}
+
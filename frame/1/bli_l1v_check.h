@@ -131,6 +131,33 @@ void PASTEMAC(opname,_check) \
 GENTPROT( invertv )
 
 
+#undef  GENTPROT
+#define GENTPROT( opname ) \
+\
+void PASTEMAC(opname,_check) \
+     ( \
+       obj_t*  h, \
+       obj_t*  x, \
+       obj_t*  y  \
+     );
+
+GENTPROT( rotmv )
+
+
+#undef  GENTPROT
+#define GENTPROT( opname ) \
+\
+void PASTEMAC(opname,_check) \
+     ( \
+       obj_t*  c, \
+       obj_t*  s, \
+       obj_t*  x, \
+       obj_t*  y  \
+     );
+
+GENTPROT( rotv )
+
+
 #undef  GENTPROT
 #define GENTPROT( opname ) \
 \
@@ -214,3 +241,18 @@ void bli_l1v_xi_check
        obj_t*  index
      );
 
+void bli_l1v_rotm_check
+     (
+       obj_t*  h,
+       obj_t*  x,
+       obj_t*  y
+     );
+
+void bli_l1v_rot_check
+     (
+       obj_t*  c,
+       obj_t*  s,
+       obj_t*  x,
+       obj_t*  y
+     );
+
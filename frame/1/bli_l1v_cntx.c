@@ -60,6 +60,8 @@ GENFRONT( copyv,   BLIS_COPYV_KER )
 GENFRONT( dotv,    BLIS_DOTV_KER )
 GENFRONT( dotxv,   BLIS_DOTXV_KER )
 GENFRONT( invertv, BLIS_INVERTV_KER )
+GENFRONT( rotmv,   BLIS_ROTMV_KER )
+GENFRONT( rotv,    BLIS_ROTV_KER )
 GENFRONT( setv,    BLIS_SETV_KER )
 GENFRONT( subv,    BLIS_SUBV_KER )
 GENFRONT( swapv,   BLIS_SWAPV_KER )
@@ -51,6 +51,8 @@ GENPROT( copyv )
 GENPROT( dotv )
 GENPROT( dotxv )
 GENPROT( invertv )
+GENPROT( rotmv )
+GENPROT( rotv )
 GENPROT( scalv )
 GENPROT( scal2v )
 GENPROT( setv )
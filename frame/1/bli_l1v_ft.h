@@ -161,6 +161,39 @@ typedef void (*PASTECH2(ch,opname,tsuf)) \
 
 INSERT_GENTDEF( invertv )
 
+// rotmv
+
+#undef  GENTDEFR
+#define GENTDEFR( ctype, ctype_r, ch, chr, opname, tsuf ) \
+\
+typedef void (*PASTECH2(ch,opname,tsuf)) \
+     ( \
+       dim_t             n, \
+       ctype_r* restrict h, \
+       ctype*   restrict x, inc_t incx, \
+       ctype*   restrict y, inc_t incy, \
+       cntx_t*           cntx  \
+     );
+
+INSERT_GENTDEFR( rotmv )
+
+// rotv
+
+#undef  GENTDEFR
+#define GENTDEFR( ctype, ctype_r, ch, chr, opname, tsuf ) \
+\
+typedef void (*PASTECH2(ch,opname,tsuf)) \
+     ( \
+       dim_t             n, \
+       ctype_r* restrict c, \
+       ctype*   restrict s, \
+       ctype*   restrict x, inc_t incx, \
+       ctype*   restrict y, inc_t incy, \
+       cntx_t*           cntx  \
+     );
+
+INSERT_GENTDEFR( rotv )
+
 // scalv, setv
 
 #undef  GENTDEF
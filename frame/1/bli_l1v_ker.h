@@ -151,6 +151,37 @@ void PASTEMAC(ch,opname) \
 INSERT_GENTPROT_BASIC( invertv_ker_name )
 
 
+#undef  GENTPROTR
+#define GENTPROTR( ctype, ctype_r, ch, chr, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t             n, \
+       ctype_r* restrict h, \
+       ctype*   restrict x, inc_t incx, \
+       ctype*   restrict y, inc_t incy, \
+       cntx_t*           cntx  \
+     ); \
+
+INSERT_GENTPROTR_BASIC( rotmv_ker_name )
+
+
+#undef  GENTPROTR
+#define GENTPROTR( ctype, ctype_r, ch, chr, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t             n, \
+       ctype_r* restrict c, \
+       ctype*   restrict s, \
+       ctype*   restrict x, inc_t incx, \
+       ctype*   restrict y, inc_t incy, \
+       cntx_t*           cntx  \
+     ); \
+
+INSERT_GENTPROTR_BASIC( rotv_ker_name )
+
+
 #undef  GENTPROT
 #define GENTPROT( ctype, ch, opname ) \
 \
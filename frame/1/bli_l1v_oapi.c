@@ -375,6 +375,114 @@ void PASTEMAC(opname,EX_SUF) \
 GENFRONT( invertv )
 
 
+#undef  GENFRONT
+#define GENFRONT( opname ) \
+\
+void PASTEMAC(opname,EX_SUF) \
+     ( \
+       obj_t*  h, \
+       obj_t*  x, \
+       obj_t*  y  \
+       BLIS_OAPI_CNTX_PARAM  \
+     ) \
+{ \
+	BLIS_OAPI_CNTX_DECL \
+\
+	num_t     dt        = bli_obj_datatype( *x ); \
+	num_t     dt_r      = bli_obj_datatype_proj_to_real( *x ); \
+\
+	dim_t     n         = bli_obj_vector_dim( *x ); \
+	void*     buf_x     = bli_obj_buffer_at_off( *x ); \
+	inc_t     inc_x     = bli_obj_vector_inc( *x ); \
+	void*     buf_y     = bli_obj_buffer_at_off( *y ); \
+	inc_t     inc_y     = bli_obj_vector_inc( *y ); \
+\
+	double    h_mem[ 5 ]; \
+	void*     buf_h     = h_mem; \
+\
+	obj_t     h_local; \
+\
+	if ( bli_error_checking_is_enabled() ) \
+	    PASTEMAC(opname,_check)( h, x, y ); \
+\
+	/* The kernel expects the five parameters to be contiguous, so copy
+	   them to a local buffer (which is large enough for either precision). */ \
+	bli_obj_create_with_attached_buffer( dt_r, 5, 1, buf_h, 1, 5, &h_local ); \
+	bli_copyv( h, &h_local ); \
+\
+	/* Invoke the void pointer-based function. */ \
+	bli_call_ft_7 \
+	( \
+	   dt, \
+	   opname, \
+	   n, \
+	   buf_h, \
+	   buf_x, inc_x, \
+	   buf_y, inc_y, \
+	   cntx  \
+	); \
+}
+
+GENFRONT( rotmv )
+
+
+#undef  GENFRONT
+#define GENFRONT( opname ) \
+\
+void PASTEMAC(opname,EX_SUF) \
+     ( \
+       obj_t*  c, \
+       obj_t*  s, \
+       obj_t*  x, \
+       obj_t*  y  \
+       BLIS_OAPI_CNTX_PARAM  \
+     ) \
+{ \
+	BLIS_OAPI_CNTX_DECL \
+\
+	num_t     dt        = bli_obj_datatype( *x ); \
+	num_t     dt_r      = bli_obj_datatype_proj_to_real( *x ); \
+\
+	dim_t     n         = bli_obj_vector_dim( *x ); \
+	void*     buf_x     = bli_obj_buffer_at_off( *x ); \
+	inc_t     inc_x     = bli_obj_vector_inc( *x ); \
+	void*     buf_y     = bli_obj_buffer_at_off( *y ); \
+	inc_t     inc_y     = bli_obj_vector_inc( *y ); \
+\
+	void*     buf_c; \
+	void*     buf_s; \
+\
+	obj_t     c_local; \
+	obj_t     s_local; \
+\
+	if ( bli_error_checking_is_enabled() ) \
+	    PASTEMAC(opname,_check)( c, s, x, y ); \
+\
+	/* Create local copy-casts of scalars. Note that c is always real. */ \
+	bli_obj_scalar_init_detached_copy_of( dt_r, BLIS_NO_CONJUGATE, \
+	                                      c, &c_local ); \
+	bli_obj_scalar_init_detached_copy_of( dt, BLIS_NO_CONJUGATE, \
+	                                      s, &s_local ); \
+	buf_c = bli_obj_buffer_for_1x1( dt_r, c_local ); \
+	buf_s = bli_obj_buffer_for_1x1( dt, s_local ); \
+\
+	/* Invoke the void pointer-based function. */ \
+	bli_call_ft_8 \
+	( \
+	   dt, \
+	   opname, \
+	   n, \
+	   buf_c, \
+	   buf_s, \
+	   buf_x, inc_x, \
+	   buf_y, inc_y, \
+	   cntx  \
+	); \
+}
+
+GENFRONT( rotv )
+
+
 #undef  GENFRONT
 #define GENFRONT( opname ) \
 \
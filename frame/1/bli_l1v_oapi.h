@@ -137,6 +137,35 @@ void PASTEMAC(opname,EX_SUF) \
 GENTPROT( invertv )
 
 
+#undef  GENTPROT
+#define GENTPROT( opname ) \
+\
+void PASTEMAC(opname,EX_SUF) \
+     ( \
+       obj_t*  h, \
+       obj_t*  x, \
+       obj_t*  y  \
+       BLIS_OAPI_CNTX_PARAM  \
+     ); 
+
+GENTPROT( rotmv )
+
+
+#undef  GENTPROT
+#define GENTPROT( opname ) \
+\
+void PASTEMAC(opname,EX_SUF) \
+     ( \
+       obj_t*  c, \
+       obj_t*  s, \
+       obj_t*  x, \
+       obj_t*  y  \
+       BLIS_OAPI_CNTX_PARAM  \
+     ); 
+
+GENTPROT( rotv )
+
+
 #undef  GENTPROT
 #define GENTPROT( opname ) \
 \
@@ -52,6 +52,11 @@ void PASTEMAC(ch,opname) \
 { \
 	const num_t dt = PASTEMAC(ch,type); \
 	cntx_t*     cntx_p; \
+\
+	vrec_t*     vrec = bli_verbose_begin_l1v \
+	( \
+	  MKSTR(opname), dt, ( ( char[] ){ bli_verbose_conj_ch( conjx ), '\0' } ), n, incx, incy \
+	); \
 \
 	bli_cntx_init_local_if( opname, cntx, cntx_p ); \
 \
@@ -67,6 +72,8 @@ void PASTEMAC(ch,opname) \
 	); \
 \
 	bli_cntx_finalize_local_if( opname, cntx ); \
+\
+	bli_verbose_end( vrec ); \
 }
 
 INSERT_GENTFUNC_BASIC( addv,  BLIS_ADDV_KER )
@@ -87,6 +94,11 @@ void PASTEMAC(ch,opname) \
 { \
 	const num_t dt = PASTEMAC(ch,type); \
 	cntx_t*     cntx_p; \
+\
+	vrec_t*     vrec = bli_verbose_begin_l1v \
+	( \
+	  MKSTR(opname), dt, ( ( char[] ){ '\0' } ), n, incx, 0 \
+	); \
 \
 	bli_cntx_init_local_if( opname, cntx, cntx_p ); \
 \
@@ -101,6 +113,8 @@ void PASTEMAC(ch,opname) \
 	); \
 \
 	bli_cntx_finalize_local_if( opname, cntx ); \
+\
+	bli_verbose_end( vrec ); \
 }
 
 INSERT_GENTFUNC_BASIC( amaxv, BLIS_AMAXV_KER )
@@ -122,6 +136,11 @@ void PASTEMAC(ch,opname) \
 { \
 	const num_t dt = PASTEMAC(ch,type); \
 	cntx_t*     cntx_p; \
+\
+	vrec_t*     vrec = bli_verbose_begin_l1v \
+	( \
+	  MKSTR(opname), dt, ( ( char[] ){ bli_verbose_conj_ch( conjx ), '\0' } ), n, incx, incy \
+	); \
 \
 	bli_cntx_init_local_if( opname, cntx, cntx_p ); \
 \
@@ -139,6 +158,8 @@ void PASTEMAC(ch,opname) \
 	); \
 \
 	bli_cntx_finalize_local_if( opname, cntx ); \
+\
+	bli_verbose_end( vrec ); \
 }
 
 INSERT_GENTFUNC_BASIC( axpbyv,  BLIS_AXPBYV_KER )
@@ -159,6 +180,11 @@ void PASTEMAC(ch,opname) \
 { \
 	const num_t dt = PASTEMAC(ch,type); \
 	cntx_t*     cntx_p; \
+\
+	vrec_t*     vrec = bli_verbose_begin_l1v \
+	( \
+	  MKSTR(opname), dt, ( ( char[] ){ bli_verbose_conj_ch( conjx ), '\0' } ), n, incx, incy \
+	); \
 \
 	bli_cntx_init_local_if( opname, cntx, cntx_p ); \
 \
@@ -175,6 +201,8 @@ void PASTEMAC(ch,opname) \
 	); \
 \
 	bli_cntx_finalize_local_if( opname, cntx ); \
+\
+	bli_verbose_end( vrec ); \
 }
 
 INSERT_GENTFUNC_BASIC( axpyv,  BLIS_AXPYV_KER )
@@ -197,6 +225,11 @@ void PASTEMAC(ch,opname) \
 { \
 	const num_t dt = PASTEMAC(ch,type); \
 	cntx_t*     cntx_p; \
+\
+	vrec_t*     vrec = bli_verbose_begin_l1v \
+	( \
+	  MKSTR(opname), dt, ( ( char[] ){ bli_verbose_conj_ch( conjx ), bli_verbose_conj_ch( conjy ), '\0' } ), n, incx, incy \
+	); \
 \
 	bli_cntx_init_local_if( opname, cntx, cntx_p ); \
 \
@@ -214,6 +247,8 @@ void PASTEMAC(ch,opname) \
 	); \
 \
 	bli_cntx_finalize_local_if( opname, cntx ); \
+\
+	bli_verbose_end( vrec ); \
 }
 
 INSERT_GENTFUNC_BASIC( dotv, BLIS_DOTV_KER )
@@ -237,6 +272,11 @@ void PASTEMAC(ch,opname) \
 { \
 	const num_t dt = PASTEMAC(ch,type); \
 	cntx_t*     cntx_p; \
+\
+	vrec_t*     vrec = bli_verbose_begin_l1v \
+	( \
+	  MKSTR(opname), dt, ( ( char[] ){ bli_verbose_conj_ch( conjx ), bli_verbose_conj_ch( conjy ), '\0' } ), n, incx, incy \
+	); \
 \
 	bli_cntx_init_local_if( opname, cntx, cntx_p ); \
 \
@@ -256,6 +296,8 @@ void PASTEMAC(ch,opname) \
 	); \
 \
 	bli_cntx_finalize_local_if( opname, cntx ); \
+\
+	bli_verbose_end( vrec ); \
 }
 
 INSERT_GENTFUNC_BASIC( dotxv, BLIS_DOTXV_KER )
@@ -273,6 +315,11 @@ void PASTEMAC(ch,opname) \
 { \
 	const num_t dt = PASTEMAC(ch,type); \
 	cntx_t*     cntx_p; \
+\
+	vrec_t*     vrec = bli_verbose_begin_l1v \
+	( \
+	  MKSTR(opname), dt, ( ( char[] ){ '\0' } ), n, incx, 0 \
+	); \
 \
 	bli_cntx_init_local_if( opname, cntx, cntx_p ); \
 \
@@ -286,11 +333,97 @@ void PASTEMAC(ch,opname) \
 	); \
 \
 	bli_cntx_finalize_local_if( opname, cntx ); \
+\
+	bli_verbose_end( vrec ); \
 }
 
 INSERT_GENTFUNC_BASIC( invertv, BLIS_INVERTV_KER )
 
 
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, kerid ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t    n, \
+       ctype_r* h, \
+       ctype*   x, inc_t incx, \
+       ctype*   y, inc_t incy, \
+       cntx_t*  cntx  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+	cntx_t*     cntx_p; \
+\
+	vrec_t*     vrec = bli_verbose_begin_l1v \
+	( \
+	  MKSTR(opname), dt, ( ( char[] ){ '\0' } ), n, incx, incy \
+	); \
+\
+	bli_cntx_init_local_if( opname, cntx, cntx_p ); \
+\
+	PASTECH2(ch,opname,_ft) f = bli_cntx_get_l1v_ker_dt( dt, kerid, cntx_p ); \
+\
+	f \
+	( \
+	   n, \
+	   h, \
+	   x, incx, \
+	   y, incy, \
+	   cntx_p  \
+	); \
+\
+	bli_cntx_finalize_local_if( opname, cntx ); \
+\
+	bli_verbose_end( vrec ); \
+}
+
+INSERT_GENTFUNCR_BASIC( rotmv, BLIS_ROTMV_KER )
+
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, kerid ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t    n, \
+       ctype_r* c, \
+       ctype*   s, \
+       ctype*   x, inc_t incx, \
+       ctype*   y, inc_t incy, \
+       cntx_t*  cntx  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+	cntx_t*     cntx_p; \
+\
+	vrec_t*     vrec = bli_verbose_begin_l1v \
+	( \
+	  MKSTR(opname), dt, ( ( char[] ){ '\0' } ), n, incx, incy \
+	); \
+\
+	bli_cntx_init_local_if( opname, cntx, cntx_p ); \
+\
+	PASTECH2(ch,opname,_ft) f = bli_cntx_get_l1v_ker_dt( dt, kerid, cntx_p ); \
+\
+	f \
+	( \
+	   n, \
+	   c, \
+	   s, \
+	   x, incx, \
+	   y, incy, \
+	   cntx_p  \
+	); \
+\
+	bli_cntx_finalize_local_if( opname, cntx ); \
+\
+	bli_verbose_end( vrec ); \
+}
+
+INSERT_GENTFUNCR_BASIC( rotv, BLIS_ROTV_KER )
+
+
 #undef  GENTFUNC
 #define GENTFUNC( ctype, ch, opname, kerid ) \
 \
@@ -305,6 +438,11 @@ void PASTEMAC(ch,opname) \
 { \
 	const num_t dt = PASTEMAC(ch,type); \
 	cntx_t*     cntx_p; \
+\
+	vrec_t*     vrec = bli_verbose_begin_l1v \
+	( \
+	  MKSTR(opname), dt, ( ( char[] ){ bli_verbose_conj_ch( conjalpha ), '\0' } ), n, incx, 0 \
+	); \
 \
 	bli_cntx_init_local_if( opname, cntx, cntx_p ); \
 \
@@ -320,6 +458,8 @@ void PASTEMAC(ch,opname) \
 	); \
 \
 	bli_cntx_finalize_local_if( opname, cntx ); \
+\
+	bli_verbose_end( vrec ); \
 }
 
 INSERT_GENTFUNC_BASIC( scalv,  BLIS_SCALV_KER )
@@ -339,6 +479,11 @@ void PASTEMAC(ch,opname) \
 { \
 	const num_t dt = PASTEMAC(ch,type); \
 	cntx_t*     cntx_p; \
+\
+	vrec_t*     vrec = bli_verbose_begin_l1v \
+	( \
+	  MKSTR(opname), dt, ( ( char[] ){ '\0' } ), n, incx, incy \
+	); \
 \
 	bli_cntx_init_local_if( opname, cntx, cntx_p ); \
 \
@@ -353,6 +498,8 @@ void PASTEMAC(ch,opname) \
 	); \
 \
 	bli_cntx_finalize_local_if( opname, cntx ); \
+\
+	bli_verbose_end( vrec ); \
 }
 
 INSERT_GENTFUNC_BASIC( swapv, BLIS_SWAPV_KER )
@@ -372,6 +519,11 @@ void PASTEMAC(ch,opname) \
 { \
 	const num_t dt = PASTEMAC(ch,type); \
 	cntx_t*     cntx_p; \
+\
+	vrec_t*     vrec = bli_verbose_begin_l1v \
+	( \
+	  MKSTR(opname), dt, ( ( char[] ){ bli_verbose_conj_ch( conjx ), '\0' } ), n, incx, incy \
+	); \
 \
 	bli_cntx_init_local_if( opname, cntx, cntx_p ); \
 \
@@ -388,6 +540,8 @@ void PASTEMAC(ch,opname) \
 	); \
 \
 	bli_cntx_finalize_local_if( opname, cntx ); \
+\
+	bli_verbose_end( vrec ); \
 }
 
 INSERT_GENTFUNC_BASIC( xpbyv,  BLIS_XPBYV_KER )
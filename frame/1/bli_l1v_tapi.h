@@ -61,6 +61,12 @@
 #undef  invertv_ker_name
 #define invertv_ker_name    invertv
 
+#undef  rotmv_ker_name
+#define rotmv_ker_name      rotmv
+
+#undef  rotv_ker_name
+#define rotv_ker_name       rotv
+
 #undef  scalv_ker_name
 #define scalv_ker_name      scalv
 
@@ -58,6 +58,12 @@
 #undef  invertv_ker_name
 #define invertv_ker_name   invertv_ref
 
+#undef  rotmv_ker_name
+#define rotmv_ker_name     rotmv_ref
+
+#undef  rotv_ker_name
+#define rotv_ker_name      rotv_ref
+
 #undef  scalv_ker_name
 #define scalv_ker_name     scalv_ref
 
@@ -0,0 +1,117 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// [ x^T ] := H [ x^T ]
+// [ y^T ]      [ y^T ]
+//
+// where the real 2x2 matrix H is encoded in h[0:4] as in the BLAS ?rotm
+// routines: h[0] is the flag and h[1:4] hold h11, h21, h12, h22.
+//   flag = -1: H = [ h11 h12; h21 h22 ]
+//   flag =  0: H = [ 1   h12; h21 1   ]
+//   flag =  1: H = [ h11 1  ; -1  h22 ]
+//   flag = -2: H = I
+// In the complex domain, H is applied to the real and imaginary parts
+// alike.
+//
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       dim_t             n, \
+       ctype_r* restrict h, \
+       ctype*   restrict x, inc_t incx, \
+       ctype*   restrict y, inc_t incy, \
+       cntx_t*           cntx  \
+     ) \
+{ \
+	ctype* restrict chi1; \
+	ctype* restrict psi1; \
+	ctype_r         flag; \
+	ctype_r         h11, h21, h12, h22; \
+	ctype           chi1_new; \
+	ctype           psi1_new; \
+	dim_t           i; \
+\
+	if ( bli_zero_dim1( n ) ) return; \
+\
+	flag = h[0]; \
+\
+	/* If H is the identity, return. */ \
+	if ( flag == -2 ) return; \
+\
+	if      ( flag < 0 )  { h11 = h[1]; h21 = h[2]; h12 = h[3]; h22 = h[4]; } \
+	else if ( flag == 0 ) { h11 = 1;    h21 = h[2]; h12 = h[3]; h22 = 1;    } \
+	else                  { h11 = h[1]; h21 = -1;   h12 = 1;    h22 = h[4]; } \
+\
+	chi1 = x; \
+	psi1 = y; \
+\
+	if ( incx == 1 && incy == 1 ) \
+	{ \
+		for ( i = 0; i < n; ++i ) \
+		{ \
+			PASTEMAC3(chr,ch,ch,scal2s)( h11, chi1[i], chi1_new ); \
+			PASTEMAC3(chr,ch,ch,axpys)( h12, psi1[i], chi1_new ); \
+			PASTEMAC3(chr,ch,ch,scal2s)( h22, psi1[i], psi1_new ); \
+			PASTEMAC3(chr,ch,ch,axpys)( h21, chi1[i], psi1_new ); \
+\
+			PASTEMAC(ch,copys)( chi1_new, chi1[i] ); \
+			PASTEMAC(ch,copys)( psi1_new, psi1[i] ); \
+		} \
+	} \
+	else \
+	{ \
+		for ( i = 0; i < n; ++i ) \
+		{ \
+			PASTEMAC3(chr,ch,ch,scal2s)( h11, *chi1, chi1_new ); \
+			PASTEMAC3(chr,ch,ch,axpys)( h12, *psi1, chi1_new ); \
+			PASTEMAC3(chr,ch,ch,scal2s)( h22, *psi1, psi1_new ); \
+			PASTEMAC3(chr,ch,ch,axpys)( h21, *chi1, psi1_new ); \
+\
+			PASTEMAC(ch,copys)( chi1_new, *chi1 ); \
+			PASTEMAC(ch,copys)( psi1_new, *psi1 ); \
+\
+			chi1 += incx; \
+			psi1 += incy; \
+		} \
+	} \
+}
+
+INSERT_GENTFUNCR_BASIC0( rotmv_ref )
+
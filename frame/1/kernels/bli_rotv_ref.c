@@ -0,0 +1,114 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// x := c * x + s * y
+// y := c * y - conj(s) * x
+//
+// where c is real. When s is also real, this is the plane rotation applied
+// by the BLAS ?rot routines (including csrot and zdrot).
+//
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       dim_t             n, \
+       ctype_r* restrict c, \
+       ctype*   restrict s, \
+       ctype*   restrict x, inc_t incx, \
+       ctype*   restrict y, inc_t incy, \
+       cntx_t*           cntx  \
+     ) \
+{ \
+	ctype* restrict chi1; \
+	ctype* restrict psi1; \
+	ctype_r         gamma; \
+	ctype           sigma; \
+	ctype           sigma_conj; \
+	ctype           minus_sigma_conj; \
+	ctype           chi1_new; \
+	ctype           psi1_new; \
+	dim_t           i; \
+\
+	if ( bli_zero_dim1( n ) ) return; \
+\
+	gamma = *c; \
+	PASTEMAC(ch,copys)( *s, sigma ); \
+\
+	/* If the rotation is the identity, return. */ \
+	if ( PASTEMAC(chr,eq1)( gamma ) && PASTEMAC(ch,eq0)( sigma ) ) return; \
+\
+	PASTEMAC(ch,copycjs)( BLIS_CONJUGATE, sigma, sigma_conj ); \
+	PASTEMAC(ch,neg2s)( sigma_conj, minus_sigma_conj ); \
+\
+	chi1 = x; \
+	psi1 = y; \
+\
+	if ( incx == 1 && incy == 1 ) \
+	{ \
+		for ( i = 0; i < n; ++i ) \
+		{ \
+			PASTEMAC3(chr,ch,ch,scal2s)( gamma, chi1[i], chi1_new ); \
+			PASTEMAC(ch,axpys)( sigma, psi1[i], chi1_new ); \
+			PASTEMAC3(chr,ch,ch,scal2s)( gamma, psi1[i], psi1_new ); \
+			PASTEMAC(ch,axpys)( minus_sigma_conj, chi1[i], psi1_new ); \
+\
+			PASTEMAC(ch,copys)( chi1_new, chi1[i] ); \
+			PASTEMAC(ch,copys)( psi1_new, psi1[i] ); \
+		} \
+	} \
+	else \
+	{ \
+		for ( i = 0; i < n; ++i ) \
+		{ \
+			PASTEMAC3(chr,ch,ch,scal2s)( gamma, *chi1, chi1_new ); \
+			PASTEMAC(ch,axpys)( sigma, *psi1, chi1_new ); \
+			PASTEMAC3(chr,ch,ch,scal2s)( gamma, *psi1, psi1_new ); \
+			PASTEMAC(ch,axpys)( minus_sigma_conj, *chi1, psi1_new ); \
+\
+			PASTEMAC(ch,copys)( chi1_new, *chi1 ); \
+			PASTEMAC(ch,copys)( psi1_new, *psi1 ); \
+\
+			chi1 += incx; \
+			psi1 += incy; \
+		} \
+	} \
+}
+
+INSERT_GENTFUNCR_BASIC0( rotv_ref )
+
@@ -53,4 +53,5 @@
 
 // Other
 #include "bli_scalm.h"
+#include "bli_rotseq.h"
 
@@ -76,6 +76,7 @@ void bli_packm_thrinfo_init
 	  ocomm, ocomm_id,
 	  n_way, work_id,
 	  FALSE,
+	  NULL,
 	  sub_node
 	);
 }
@@ -0,0 +1,239 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// The L2 cache size to assume if it was not detected, and the fraction of
+// it that the columns of a panel in flight may occupy.
+#define BLIS_ROTSEQ_L2_DEF       ( 256 * 1024 )
+#define BLIS_ROTSEQ_L2_FRAC      2
+
+// Panels have at least this many rows (so that each kernel call does a
+// reasonable amount of work), and a multiple of it when possible.
+#define BLIS_ROTSEQ_MB_MIN       32
+
+// Each thread is given at least this many element updates.
+#ifndef BLIS_ROTSEQ_MT_MIN_ELEMS
+#define BLIS_ROTSEQ_MT_MIN_ELEMS ( 1024 * 1024 )
+#endif
+
+typedef struct
+{
+	dim_t   m;
+	dim_t   n;
+	dim_t   k;
+	dim_t   mb;
+	void*   c;
+	void*   s;
+	inc_t   ldg;
+	void*   a;
+	inc_t   rs_a;
+	inc_t   cs_a;
+	cntx_t* cntx;
+} rotseq_params_t;
+
+
+// Choose the number of rows in a panel so that the 2k+1 columns touched
+// by the wavefront at any one time fit in part of the L2 cache.
+static dim_t bli_rotseq_panel_rows( dim_t m, dim_t k, siz_t elem_size )
+{
+	cacheinfo_t l2;
+	siz_t       l2_size = BLIS_ROTSEQ_L2_DEF;
+	dim_t       mb;
+
+	if ( bli_cache_query( 2, &l2 ) && l2.size > 0 ) l2_size = l2.size;
+
+	mb = l2_size / BLIS_ROTSEQ_L2_FRAC / ( ( 2 * k + 1 ) * elem_size );
+	mb = bli_max( BLIS_ROTSEQ_MB_MIN, mb - mb % BLIS_ROTSEQ_MB_MIN );
+
+	return bli_min( m, mb );
+}
+
+static dim_t bli_rotseq_nthread( dim_t m, dim_t n, dim_t k, dim_t mb )
+{
+#ifdef BLIS_ENABLE_MULTITHREADING
+	dim_t n_panels = ( m + mb - 1 ) / mb;
+	dim_t n_elem   = m * n * k;
+
+	return bli_max( 1, bli_min( bli_min( bli_env_read_nthread(), n_panels ),
+	                            n_elem / BLIS_ROTSEQ_MT_MIN_ELEMS ) );
+#else
+	return 1;
+#endif
+}
+
+
+// Apply all k waves to an mp x n panel in wavefront order. At step t,
+// rotation j of wave p is applied for every p with j = t - 2p in range.
+// Rotation j of wave p must follow rotations j-1 and j+1 of wave p-1 and
+// rotation j-1 of wave p, all of which are applied at earlier steps, and
+// the rotations of any one step act on disjoint pairs of columns.
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, varname ) \
+\
+static void PASTEMAC(ch,varname) \
+     ( \
+       dim_t    mp, \
+       dim_t    n, \
+       dim_t    k, \
+       ctype_r* c, \
+       ctype*   s, inc_t ldg, \
+       ctype*   a, inc_t rs_a, inc_t cs_a, \
+       PASTECH(ch,rotv_ft) kfp_rv, \
+       cntx_t*  cntx  \
+     ) \
+{ \
+	dim_t n_steps = ( n - 1 ) + 2 * ( k - 1 ); \
+	dim_t t, p, p_lo, p_hi, j; \
+\
+	for ( t = 0; t < n_steps; ++t ) \
+	{ \
+		p_lo = ( t > n - 2 ? ( t - ( n - 2 ) + 1 ) / 2 : 0 ); \
+		p_hi = bli_min( k - 1, t / 2 ); \
+\
+		for ( p = p_lo; p <= p_hi; ++p ) \
+		{ \
+			j = t - 2 * p; \
+\
+			kfp_rv \
+			( \
+			  mp, \
+			  c + j + p*ldg, \
+			  s + j + p*ldg, \
+			  a + ( j     )*cs_a, rs_a, \
+			  a + ( j + 1 )*cs_a, rs_a, \
+			  cntx  \
+			); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNCR_BASIC0( rotseq_panel )
+
+
+// Thread tid applies the rotations to a contiguous range of panels.
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, varname ) \
+\
+static void PASTEMAC(ch,varname)( dim_t tid, dim_t nt, void* params_v ) \
+{ \
+	const num_t      dt       = PASTEMAC(ch,type); \
+\
+	rotseq_params_t* params   = params_v; \
+	dim_t            m        = params->m; \
+	dim_t            mb       = params->mb; \
+	ctype*           a        = params->a; \
+	inc_t            rs_a     = params->rs_a; \
+	dim_t            n_panels = ( m + mb - 1 ) / mb; \
+	dim_t            ip, ip0, ip1; \
+\
+	PASTECH(ch,rotv_ft) kfp_rv = bli_cntx_get_l1v_ker_dt( dt, BLIS_ROTV_KER, params->cntx ); \
+\
+	ip0 = ( tid     * n_panels ) / nt; \
+	ip1 = ( ( tid + 1 ) * n_panels ) / nt; \
+\
+	for ( ip = ip0; ip < ip1; ++ip ) \
+	{ \
+		dim_t i0 = ip * mb; \
+\
+		PASTEMAC(ch,rotseq_panel) \
+		( \
+		  bli_min( mb, m - i0 ), \
+		  params->n, \
+		  params->k, \
+		  params->c, \
+		  params->s, params->ldg, \
+		  a + i0*rs_a, rs_a, params->cs_a, \
+		  kfp_rv, \
+		  params->cntx  \
+		); \
+	} \
+}
+
+INSERT_GENTFUNCR_BASIC0( rotseq_thread )
+
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       side_t   side, \
+       dim_t    m, \
+       dim_t    n, \
+       dim_t    k, \
+       ctype_r* c, \
+       ctype*   s, inc_t ldg, \
+       ctype*   a, inc_t rs_a, inc_t cs_a, \
+       cntx_t*  cntx  \
+     ) \
+{ \
+	rotseq_params_t params; \
+	cntx_t*         cntx_p; \
+\
+	/* Rotating the rows of A is the same as rotating the columns of A^T. */ \
+	if ( bli_is_left( side ) ) \
+	{ \
+		bli_swap_dims( m, n ); \
+		bli_swap_incs( rs_a, cs_a ); \
+	} \
+\
+	if ( bli_zero_dim1( m ) || n < 2 || k < 1 ) return; \
+\
+	/* Initialize a local context if the given context is NULL. */ \
+	bli_cntx_init_local_if( rotv, cntx, cntx_p ); \
+\
+	params.m    = m; \
+	params.n    = n; \
+	params.k    = k; \
+	params.mb   = bli_rotseq_panel_rows( m, k, sizeof( ctype ) ); \
+	params.c    = c; \
+	params.s    = s; \
+	params.ldg  = ldg; \
+	params.a    = a; \
+	params.rs_a = rs_a; \
+	params.cs_a = cs_a; \
+	params.cntx = cntx_p; \
+\
+	bli_thread_launch( bli_rotseq_nthread( m, n, k, params.mb ), \
+	                   PASTEMAC(ch,rotseq_thread), &params ); \
+\
+	/* Finalize the local context if it was initialized here. */ \
+	bli_cntx_finalize_local_if( rotv, cntx ); \
+}
+
+INSERT_GENTFUNCR_BASIC0( rotseq )
+
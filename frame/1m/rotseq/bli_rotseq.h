@@ -0,0 +1,78 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+//
+// Apply a sequence of plane rotations to a matrix.
+//
+// With side = BLIS_RIGHT, the m x n matrix A is updated with k waves of
+// n-1 rotations each. Rotation j of wave p acts on columns j and j+1 as
+// rotv does:
+//
+//   a_j     := c * a_j     + s       * a_{j+1}
+//   a_{j+1} := c * a_{j+1} - conj(s) * a_j
+//
+// where c = c[ j + p*ldg ] and s = s[ j + p*ldg ]. The waves are applied
+// in order, and the rotations within a wave by increasing j. With side =
+// BLIS_LEFT, the same rotations act on rows j and j+1 of A instead.
+//
+// Rather than sweeping all of A once per wave, the rows are split into
+// panels that are small enough for about 2k of their columns to stay in
+// the L2 cache, and the rotations are applied to each panel in wavefront
+// order: wave p trails wave p-1 by two columns, so every column is loaded
+// once per panel instead of once per wave. Panels are processed in
+// parallel when multithreading is enabled and the problem is large
+// enough. The rotated vectors should be unit-stride (columns of a
+// column-stored A for BLIS_RIGHT, rows of a row-stored A for BLIS_LEFT)
+// for the rotv kernel to be vectorized.
+//
+
+#undef  GENTPROTR
+#define GENTPROTR( ctype, ctype_r, ch, chr, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       side_t   side, \
+       dim_t    m, \
+       dim_t    n, \
+       dim_t    k, \
+       ctype_r* c, \
+       ctype*   s, inc_t ldg, \
+       ctype*   a, inc_t rs_a, inc_t cs_a, \
+       cntx_t*  cntx  \
+     );
+
+INSERT_GENTPROTR_BASIC( rotseq )
+
@@ -56,3 +56,6 @@
 #include "bli_syr2.h"
 #include "bli_trmv.h"
 #include "bli_trsv.h"
+
+// Banded and packed matrices
+#include "bli_bpm.h"
@@ -57,12 +57,24 @@ void PASTEMAC(ch,opname) \
 { \
 	cntx_t* cntx_p; \
 	dim_t   m_y, n_x; \
+\
+	/* Log the call, if enabled. */ \
+	vrec_t* vrec = bli_verbose_begin_l2 \
+	( \
+	  MKSTR(opname), PASTEMAC(ch,type), \
+	  ( ( char[] ){ bli_verbose_trans_ch( transa ), bli_verbose_conj_ch( conjx ), '\0' } ), \
+	  m, n, rs_a, cs_a, incx, incy \
+	); \
 \
 	/* Determine the dimensions of y and x. */ \
 	bli_set_dims_with_trans( transa, m, n, m_y, n_x ); \
 \
 	/* If y has zero elements, return early. */ \
-	if ( bli_zero_dim1( m_y ) ) return; \
+	if ( bli_zero_dim1( m_y ) ) \
+	{ \
+		bli_verbose_end( vrec ); \
+		return; \
+	} \
 \
 	/* Initialize a local context if the given context is NULL. */ \
 	bli_cntx_init_local_if( opname, cntx, cntx_p ); \
@@ -79,6 +91,7 @@ void PASTEMAC(ch,opname) \
 		  y, incy, \
 		  cntx_p  \
 		); \
+		bli_verbose_end( vrec ); \
 		return; \
 	} \
 \
@@ -114,6 +127,8 @@ void PASTEMAC(ch,opname) \
 \
 	/* Finalize the context if it was initialized locally. */ \
 	bli_cntx_finalize_local_if( opname, cntx ); \
+\
+	bli_verbose_end( vrec ); \
 }
 
 INSERT_GENTFUNC_BASIC3( gemv, gemv, gemv_unf_var1, gemv_unf_var2 )
@@ -136,9 +151,21 @@ void PASTEMAC(ch,opname) \
      ) \
 { \
 	cntx_t* cntx_p; \
+\
+	/* Log the call, if enabled. */ \
+	vrec_t* vrec = bli_verbose_begin_l2 \
+	( \
+	  MKSTR(opname), PASTEMAC(ch,type), \
+	  ( ( char[] ){ bli_verbose_conj_ch( conjx ), bli_verbose_conj_ch( conjy ), '\0' } ), \
+	  m, n, rs_a, cs_a, incx, incy \
+	); \
 \
 	/* If x or y has zero elements, or if alpha is zero, return early. */ \
-	if ( bli_zero_dim2( m, n ) || PASTEMAC(ch,eq0)( *alpha ) ) return; \
+	if ( bli_zero_dim2( m, n ) || PASTEMAC(ch,eq0)( *alpha ) ) \
+	{ \
+		bli_verbose_end( vrec ); \
+		return; \
+	} \
 \
 	/* Initialize a local context if the given context is NULL. */ \
 	bli_cntx_init_local_if( opname, cntx, cntx_p ); \
@@ -166,6 +193,8 @@ void PASTEMAC(ch,opname) \
 \
 	/* Finalize the context if it was initialized locally. */ \
 	bli_cntx_finalize_local_if( opname, cntx ); \
+\
+	bli_verbose_end( vrec ); \
 }
 
 INSERT_GENTFUNC_BASIC3( ger, ger, ger_unb_var1, ger_unb_var2 )
@@ -189,6 +218,14 @@ void PASTEMAC(ch,opname) \
      ) \
 { \
 	cntx_t* cntx_p; \
+\
+	/* Log the call, if enabled. */ \
+	vrec_t* vrec = bli_verbose_begin_l2 \
+	( \
+	  MKSTR(opname), PASTEMAC(ch,type), \
+	  ( ( char[] ){ bli_verbose_uplo_ch( uploa ), bli_verbose_conj_ch( conja ), bli_verbose_conj_ch( conjx ), '\0' } ), \
+	  m, m, rs_a, cs_a, incx, incy \
+	); \
 \
 	/* Initialize a local context if the given context is NULL. */ \
 	bli_cntx_init_local_if( opname, cntx, cntx_p ); \
@@ -205,6 +242,7 @@ void PASTEMAC(ch,opname) \
 		  y, incy, \
 		  cntx_p  \
 		); \
+		bli_verbose_end( vrec ); \
 		return; \
 	} \
 \
@@ -241,6 +279,8 @@ void PASTEMAC(ch,opname) \
 \
 	/* Finalize the context if it was initialized locally. */ \
 	bli_cntx_finalize_local_if( opname, cntx ); \
+\
+	bli_verbose_end( vrec ); \
 }
 
 INSERT_GENTFUNC_BASIC4( hemv, hemv, BLIS_CONJUGATE,    hemv_unf_var1, hemv_unf_var3 )
@@ -263,9 +303,21 @@ void PASTEMAC(ch,opname) \
 { \
 	cntx_t* cntx_p; \
 	ctype   alpha_local; \
+\
+	/* Log the call, if enabled. */ \
+	vrec_t* vrec = bli_verbose_begin_l2 \
+	( \
+	  MKSTR(opname), PASTEMAC(ch,type), \
+	  ( ( char[] ){ bli_verbose_uplo_ch( uploa ), bli_verbose_conj_ch( conjx ), '\0' } ), \
+	  m, m, rs_a, cs_a, incx, 0 \
+	); \
 \
 	/* If x has zero elements, or if alpha is zero, return early. */ \
-	if ( bli_zero_dim1( m ) || PASTEMAC(chr,eq0)( *alpha ) ) return; \
+	if ( bli_zero_dim1( m ) || PASTEMAC(chr,eq0)( *alpha ) ) \
+	{ \
+		bli_verbose_end( vrec ); \
+		return; \
+	} \
 \
 	/* Make a local copy of alpha, cast into the complex domain. This
 	   allows us to use the same underlying her variants to implement
@@ -305,6 +357,8 @@ void PASTEMAC(ch,opname) \
 \
 	/* Finalize the context if it was initialized locally. */ \
 	bli_cntx_finalize_local_if( opname, cntx ); \
+\
+	bli_verbose_end( vrec ); \
 }
 
 INSERT_GENTFUNCR_BASIC4( her, her, BLIS_CONJUGATE, her_unb_var1, her_unb_var2 )
@@ -325,9 +379,21 @@ void PASTEMAC(ch,opname) \
      ) \
 { \
 	cntx_t* cntx_p; \
+\
+	/* Log the call, if enabled. */ \
+	vrec_t* vrec = bli_verbose_begin_l2 \
+	( \
+	  MKSTR(opname), PASTEMAC(ch,type), \
+	  ( ( char[] ){ bli_verbose_uplo_ch( uploa ), bli_verbose_conj_ch( conjx ), '\0' } ), \
+	  m, m, rs_a, cs_a, incx, 0 \
+	); \
 \
 	/* If x has zero elements, or if alpha is zero, return early. */ \
-	if ( bli_zero_dim1( m ) || PASTEMAC(ch,eq0)( *alpha ) ) return; \
+	if ( bli_zero_dim1( m ) || PASTEMAC(ch,eq0)( *alpha ) ) \
+	{ \
+		bli_verbose_end( vrec ); \
+		return; \
+	} \
 \
 	/* Initialize a local context if the given context is NULL. */ \
 	bli_cntx_init_local_if( opname, cntx, cntx_p ); \
@@ -362,6 +428,8 @@ void PASTEMAC(ch,opname) \
 \
 	/* Finalize the context if it was initialized locally. */ \
 	bli_cntx_finalize_local_if( opname, cntx ); \
+\
+	bli_verbose_end( vrec ); \
 }
 
 INSERT_GENTFUNC_BASIC4( syr, her, BLIS_NO_CONJUGATE, her_unb_var1, her_unb_var2 )
@@ -384,9 +452,21 @@ void PASTEMAC(ch,opname) \
      ) \
 { \
 	cntx_t* cntx_p; \
+\
+	/* Log the call, if enabled. */ \
+	vrec_t* vrec = bli_verbose_begin_l2 \
+	( \
+	  MKSTR(opname), PASTEMAC(ch,type), \
+	  ( ( char[] ){ bli_verbose_uplo_ch( uploa ), bli_verbose_conj_ch( conjx ), bli_verbose_conj_ch( conjy ), '\0' } ), \
+	  m, m, rs_a, cs_a, incx, incy \
+	); \
 \
 	/* If x has zero elements, or if alpha is zero, return early. */ \
-	if ( bli_zero_dim1( m ) || PASTEMAC(ch,eq0)( *alpha ) ) return; \
+	if ( bli_zero_dim1( m ) || PASTEMAC(ch,eq0)( *alpha ) ) \
+	{ \
+		bli_verbose_end( vrec ); \
+		return; \
+	} \
 \
 	/* Initialize a local context if the given context is NULL. */ \
 	bli_cntx_init_local_if( opname, cntx, cntx_p ); \
@@ -423,6 +503,8 @@ void PASTEMAC(ch,opname) \
 \
 	/* Finalize the context if it was initialized locally. */ \
 	bli_cntx_finalize_local_if( opname, cntx ); \
+\
+	bli_verbose_end( vrec ); \
 }
 
 INSERT_GENTFUNC_BASIC4( her2, her2, BLIS_CONJUGATE,    her2_unf_var1, her2_unf_var4 )
@@ -445,12 +527,24 @@ void PASTEMAC(ch,opname) \
      ) \
 { \
 	cntx_t* cntx_p; \
+\
+	/* Log the call, if enabled. */ \
+	vrec_t* vrec = bli_verbose_begin_l2 \
+	( \
+	  MKSTR(opname), PASTEMAC(ch,type), \
+	  ( ( char[] ){ bli_verbose_uplo_ch( uploa ), bli_verbose_trans_ch( transa ), bli_verbose_diag_ch( diaga ), '\0' } ), \
+	  m, m, rs_a, cs_a, incx, 0 \
+	); \
 \
 	/* Initialize a local context if the given context is NULL. */ \
 	bli_cntx_init_local_if( opname, cntx, cntx_p ); \
 \
 	/* If x has zero elements, return early. */ \
-	if ( bli_zero_dim1( m ) ) return; \
+	if ( bli_zero_dim1( m ) ) \
+	{ \
+		bli_verbose_end( vrec ); \
+		return; \
+	} \
 \
 	/* If alpha is zero, set x to zero and return early. */ \
 	if ( PASTEMAC(ch,eq0)( *alpha ) ) \
@@ -463,6 +557,7 @@ void PASTEMAC(ch,opname) \
 		  x, incx, \
 		  cntx_p  \
 		); \
+		bli_verbose_end( vrec ); \
 		return; \
 	} \
 \
@@ -496,6 +591,8 @@ void PASTEMAC(ch,opname) \
 \
 	/* Finalize the context if it was initialized locally. */ \
 	bli_cntx_finalize_local_if( opname, cntx ); \
+\
+	bli_verbose_end( vrec ); \
 }
 
 INSERT_GENTFUNC_BASIC3( trmv, trmv, trmv_unf_var1, trmv_unf_var2 )
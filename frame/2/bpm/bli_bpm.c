@@ -0,0 +1,1385 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// Below this many stored elements per thread, the banded and packed
+// operations are not worth splitting across threads.
+#ifndef BLIS_BPM_MT_MIN_ELEMS
+#define BLIS_BPM_MT_MIN_ELEMS 65536
+#endif
+
+// Column segments shorter than this are computed with inline loops, since
+// the cost of a kernel call would dominate.
+#define BLIS_BPM_KER_MIN_LEN  8
+
+// Parameters shared by the threads of an operation.
+// The private accumulator of a thread in multithreaded hemv, which spans
+// the elements [z0,z1) of y.
+typedef struct
+{
+	mem_t   mem;
+	dim_t   z0;
+	dim_t   z1;
+} bpm_acc_t;
+
+typedef struct
+{
+	uplo_t  uplo;
+	trans_t trans;
+	diag_t  diag;
+	conj_t  conjh;
+	void*   alpha;
+	void*   beta;
+	bpm_t*  a;
+	void*   x;
+	inc_t   incx;
+	void*   y;
+	inc_t   incy;
+	void*   w;
+	cntx_t* cntx;
+	dim_t   n_threads;
+	bpm_acc_t* acc;
+} bpm_params_t;
+
+
+void bli_bpm_init_band( void* buf, dim_t m, dim_t n, dim_t kl, dim_t ku, inc_t lda, bpm_t* a )
+{
+	a->buf = buf;
+	a->m   = m;
+	a->n   = n;
+	a->kl  = kl;
+	a->ku  = ku;
+	a->lda = lda;
+}
+
+void bli_bpm_init_packed( void* buf, uplo_t uplo, dim_t n, bpm_t* a )
+{
+	a->buf = buf;
+	a->m   = n;
+	a->n   = n;
+	a->kl  = ( bli_is_lower( uplo ) ? bli_max( n - 1, 0 ) : 0 );
+	a->ku  = ( bli_is_lower( uplo ) ? 0 : bli_max( n - 1, 0 ) );
+	a->lda = 0;
+}
+
+
+void bli_bpm_cntx_init( cntx_t* cntx )
+{
+	// Perform basic setup on the context.
+	bli_cntx_obj_create( cntx );
+
+	// Initialize the context with the kernels employed by the banded and
+	// packed operations.
+	bli_axpyf_cntx_init( cntx );
+	bli_dotxf_cntx_init( cntx );
+	bli_axpy2v_cntx_init( cntx );
+	bli_dotaxpyv_cntx_init( cntx );
+	bli_dotxaxpyf_cntx_init( cntx );
+
+	bli_axpyv_cntx_init( cntx );
+	bli_dotxv_cntx_init( cntx );
+	bli_scalv_cntx_init( cntx );
+	bli_setv_cntx_init( cntx );
+
+	// Set the fusing factors, which determine how many columns are handed
+	// to each level-1f kernel call.
+	bli_gks_cntx_set_blkszs( BLIS_NAT, 3,
+	                         BLIS_AF, BLIS_AF,
+	                         BLIS_DF, BLIS_DF,
+	                         BLIS_XF, BLIS_XF,
+	                         cntx );
+}
+
+void bli_bpm_cntx_finalize( cntx_t* cntx )
+{
+	// Free the context and all memory allocated to it.
+	bli_cntx_obj_free( cntx );
+}
+
+
+// Return the number of elements in row idx (if by_rows is TRUE) or column
+// idx of the logical band (kl,ku) of an m x n matrix.
+static dim_t bli_bpm_count( bool_t by_rows, dim_t m, dim_t n, dim_t kl, dim_t ku, dim_t idx )
+{
+	dim_t lo, hi;
+
+	if ( by_rows ) { lo = bli_max( 0, idx - kl ); hi = bli_min( n, idx + ku + 1 ); }
+	else           { lo = bli_max( 0, idx - ku ); hi = bli_min( m, idx + kl + 1 ); }
+
+	return bli_max( 0, hi - lo );
+}
+
+// Choose the number of threads for an operation on the stored band of a.
+// The count comes from BLIS_NUM_THREADS (or OMP_NUM_THREADS), but each
+// thread must receive at least BLIS_BPM_MT_MIN_ELEMS elements.
+static dim_t bli_bpm_nthread( bpm_t* a )
+{
+#ifdef BLIS_ENABLE_MULTITHREADING
+	dim_t n_elem;
+
+	if ( bli_bpm_is_packed( a ) ) n_elem = ( a->n * ( a->n + 1 ) ) / 2;
+	else                          n_elem = a->n * ( a->kl + a->ku + 1 );
+
+	return bli_max( 1, bli_min( bli_env_read_nthread(),
+	                            n_elem / BLIS_BPM_MT_MIN_ELEMS ) );
+#else
+	return 1;
+#endif
+}
+
+// Split the rows (if by_rows is TRUE) or columns of an m x n matrix into
+// nt contiguous ranges holding roughly equal numbers of elements of the
+// logical band (kl,ku), and return the range [*start,*end) of thread tid.
+// The ranges of all threads cover every row (column) exactly once.
+static void bli_bpm_partition( bool_t by_rows, dim_t m, dim_t n, dim_t kl, dim_t ku,
+                               dim_t tid, dim_t nt, dim_t* start, dim_t* end )
+{
+	dim_t len   = ( by_rows ? m : n );
+	dim_t total = 0;
+	dim_t lo_t, hi_t, acc, idx;
+
+	*start = 0;
+	*end   = len;
+
+	if ( nt == 1 ) return;
+
+	for ( idx = 0; idx < len; ++idx )
+		total += bli_bpm_count( by_rows, m, n, kl, ku, idx );
+
+	lo_t = ( total * tid       ) / nt;
+	hi_t = ( total * ( tid + 1 ) ) / nt;
+
+	*start = len;
+
+	for ( idx = 0, acc = 0; idx < len; ++idx )
+	{
+		if ( *start == len && lo_t <= acc ) *start = idx;
+		if ( tid < nt - 1  && hi_t <= acc ) { *end = idx; break; }
+
+		acc += bli_bpm_count( by_rows, m, n, kl, ku, idx );
+	}
+
+	if ( *end < *start ) *start = *end;
+}
+
+
+// Helpers for a single column segment of A:
+//   axpy_col: y := y + alpha_chi * conja(a1)
+//   dot_col:  psi := psi + alpha * conja(a1)^T x1
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+static void PASTEMAC(ch,varname) \
+     ( \
+       conj_t  conja, \
+       dim_t   len, \
+       ctype*  alpha_chi, \
+       ctype*  a1, \
+       ctype*  y1, inc_t incy, \
+       PASTECH(ch,axpyv_ft) kfp_av, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	dim_t i; \
+\
+	if ( len <= 0 ) return; \
+\
+	if ( BLIS_BPM_KER_MIN_LEN <= len ) \
+	{ \
+		kfp_av( conja, len, alpha_chi, a1, 1, y1, incy, cntx ); \
+	} \
+	else if ( bli_is_conj( conja ) ) \
+	{ \
+		for ( i = 0; i < len; ++i ) \
+			PASTEMAC(ch,axpyjs)( *alpha_chi, a1[ i ], y1[ i*incy ] ); \
+	} \
+	else \
+	{ \
+		for ( i = 0; i < len; ++i ) \
+			PASTEMAC(ch,axpys)( *alpha_chi, a1[ i ], y1[ i*incy ] ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( bpm_axpy_col )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+static void PASTEMAC(ch,varname) \
+     ( \
+       conj_t  conja, \
+       dim_t   len, \
+       ctype*  alpha, \
+       ctype*  a1, \
+       ctype*  x1, inc_t incx, \
+       ctype*  psi, \
+       PASTECH(ch,dotxv_ft) kfp_dv, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	ctype* one = PASTEMAC(ch,1); \
+	ctype  rho; \
+	dim_t  i; \
+\
+	if ( len <= 0 ) return; \
+\
+	if ( BLIS_BPM_KER_MIN_LEN <= len ) \
+	{ \
+		kfp_dv( conja, BLIS_NO_CONJUGATE, len, alpha, a1, 1, x1, incx, one, psi, cntx ); \
+		return; \
+	} \
+\
+	PASTEMAC(ch,set0s)( rho ); \
+\
+	if ( bli_is_conj( conja ) ) \
+	{ \
+		for ( i = 0; i < len; ++i ) \
+			PASTEMAC(ch,dotjs)( a1[ i ], x1[ i*incx ], rho ); \
+	} \
+	else \
+	{ \
+		for ( i = 0; i < len; ++i ) \
+			PASTEMAC(ch,dots)( a1[ i ], x1[ i*incx ], rho ); \
+	} \
+\
+	PASTEMAC(ch,axpys)( *alpha, rho, *psi ); \
+}
+
+INSERT_GENTFUNC_BASIC0( bpm_dot_col )
+
+
+// The two sweeps over the part of A in rows [r0,r1) and columns [c0,c1)
+// that lies within the logical band (kl,ku), which must be contained in
+// the stored band of A. Vector elements are indexed by row and column of
+// A from the given base pointers.
+//   bpm_n: y[r0:r1] := y[r0:r1] + alpha * conja(A) * x[c0:c1]
+//   bpm_t: y[c0:c1] := y[c0:c1] + alpha * conja(A)^T * x[r0:r1]
+// In band storage, stepping one column to the right and one row down
+// moves lda-1 elements through the buffer, so the rows shared by a block
+// of adjacent columns form a matrix with unit row stride and column
+// stride lda-1, which we hand to the axpyf or dotxf kernel. What remains
+// of each column is handled with axpyv or dotxv. In packed storage, each
+// column is handled on its own.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+static void PASTEMAC(ch,varname) \
+     ( \
+       conj_t  conja, \
+       bpm_t*  a, \
+       dim_t   kl, \
+       dim_t   ku, \
+       dim_t   r0, \
+       dim_t   r1, \
+       dim_t   c0, \
+       dim_t   c1, \
+       ctype*  alpha, \
+       ctype*  x, inc_t incx, \
+       ctype*  y, inc_t incy, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	const num_t dt    = PASTEMAC(ch,type); \
+\
+	ctype*      a_buf = a->buf; \
+	dim_t       b_fuse, f; \
+	dim_t       j, p, jj; \
+	dim_t       lo, hi, l, h; \
+	ctype       alpha_chi; \
+\
+	PASTECH(ch,axpyf_ft) kfp_af = bli_cntx_get_l1f_ker_dt( dt, BLIS_AXPYF_KER, cntx ); \
+	PASTECH(ch,axpyv_ft) kfp_av = bli_cntx_get_l1v_ker_dt( dt, BLIS_AXPYV_KER, cntx ); \
+\
+	/* A narrow band never fills a kernel call, so sweep it directly. */ \
+	if ( !bli_bpm_is_packed( a ) && kl + ku + 1 < BLIS_BPM_KER_MIN_LEN ) \
+	{ \
+		for ( jj = c0; jj < c1; ++jj ) \
+		{ \
+			ctype* a1; \
+			dim_t  i; \
+\
+			l = bli_max( r0, jj - ku ); \
+			h = bli_min( r1, jj + kl + 1 ); \
+\
+			if ( h <= l ) continue; \
+\
+			a1 = a_buf + bli_bpm_offset( a, l, jj ) - l; \
+\
+			PASTEMAC(ch,scal2s)( *alpha, x[ jj*incx ], alpha_chi ); \
+\
+			if ( bli_is_conj( conja ) ) \
+			{ \
+				for ( i = l; i < h; ++i ) \
+					PASTEMAC(ch,axpyjs)( alpha_chi, a1[ i ], y[ i*incy ] ); \
+			} \
+			else \
+			{ \
+				for ( i = l; i < h; ++i ) \
+					PASTEMAC(ch,axpys)( alpha_chi, a1[ i ], y[ i*incy ] ); \
+			} \
+		} \
+		return; \
+	} \
+\
+	if ( bli_bpm_is_packed( a ) ) b_fuse = 1; \
+	else                          b_fuse = bli_cntx_get_blksz_def_dt( dt, BLIS_AF, cntx ); \
+\
+	for ( j = c0; j < c1; j += f ) \
+	{ \
+		f  = bli_min( b_fuse, c1 - j ); \
+\
+		/* Identify the rows that are shared by all f columns. */ \
+		lo = bli_max( r0, j + f - 1 - ku ); \
+		hi = bli_min( r1, j + kl + 1 ); \
+\
+		if ( 1 < f && BLIS_BPM_KER_MIN_LEN <= hi - lo ) \
+		{ \
+			kfp_af \
+			( \
+			  conja, \
+			  BLIS_NO_CONJUGATE, \
+			  hi - lo, \
+			  f, \
+			  alpha, \
+			  a_buf + bli_bpm_offset( a, lo, j ), 1, a->lda - 1, \
+			  x + j*incx, incx, \
+			  y + lo*incy, incy, \
+			  cntx  \
+			); \
+		} \
+		else \
+		{ \
+			lo = hi = r1; \
+		} \
+\
+		/* Handle the remaining rows of each column. */ \
+		for ( p = 0; p < f; ++p ) \
+		{ \
+			jj = j + p; \
+			l  = bli_max( r0, jj - ku ); \
+			h  = bli_min( r1, jj + kl + 1 ); \
+\
+			if ( h <= l ) continue; \
+\
+			PASTEMAC(ch,scal2s)( *alpha, x[ jj*incx ], alpha_chi ); \
+\
+			PASTEMAC(ch,bpm_axpy_col) \
+			( \
+			  conja, \
+			  bli_min( h, lo ) - l, \
+			  &alpha_chi, \
+			  a_buf + bli_bpm_offset( a, l, jj ), \
+			  y + l*incy, incy, \
+			  kfp_av, \
+			  cntx  \
+			); \
+			if ( hi < h ) \
+			PASTEMAC(ch,bpm_axpy_col) \
+			( \
+			  conja, \
+			  h - bli_max( l, hi ), \
+			  &alpha_chi, \
+			  a_buf + bli_bpm_offset( a, bli_max( l, hi ), jj ), \
+			  y + bli_max( l, hi )*incy, incy, \
+			  kfp_av, \
+			  cntx  \
+			); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( bpm_n )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+static void PASTEMAC(ch,varname) \
+     ( \
+       conj_t  conja, \
+       bpm_t*  a, \
+       dim_t   kl, \
+       dim_t   ku, \
+       dim_t   r0, \
+       dim_t   r1, \
+       dim_t   c0, \
+       dim_t   c1, \
+       ctype*  alpha, \
+       ctype*  x, inc_t incx, \
+       ctype*  y, inc_t incy, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	const num_t dt    = PASTEMAC(ch,type); \
+\
+	ctype*      one   = PASTEMAC(ch,1); \
+	ctype*      a_buf = a->buf; \
+	dim_t       b_fuse, f; \
+	dim_t       j, p, jj; \
+	dim_t       lo, hi, l, h; \
+\
+	PASTECH(ch,dotxf_ft) kfp_df = bli_cntx_get_l1f_ker_dt( dt, BLIS_DOTXF_KER, cntx ); \
+	PASTECH(ch,dotxv_ft) kfp_dv = bli_cntx_get_l1v_ker_dt( dt, BLIS_DOTXV_KER, cntx ); \
+\
+	/* A narrow band never fills a kernel call, so sweep it directly. */ \
+	if ( !bli_bpm_is_packed( a ) && kl + ku + 1 < BLIS_BPM_KER_MIN_LEN ) \
+	{ \
+		for ( jj = c0; jj < c1; ++jj ) \
+		{ \
+			ctype* a1; \
+			ctype  rho; \
+			dim_t  i; \
+\
+			l = bli_max( r0, jj - ku ); \
+			h = bli_min( r1, jj + kl + 1 ); \
+\
+			if ( h <= l ) continue; \
+\
+			a1 = a_buf + bli_bpm_offset( a, l, jj ) - l; \
+\
+			PASTEMAC(ch,set0s)( rho ); \
+\
+			if ( bli_is_conj( conja ) ) \
+			{ \
+				for ( i = l; i < h; ++i ) \
+					PASTEMAC(ch,dotjs)( a1[ i ], x[ i*incx ], rho ); \
+			} \
+			else \
+			{ \
+				for ( i = l; i < h; ++i ) \
+					PASTEMAC(ch,dots)( a1[ i ], x[ i*incx ], rho ); \
+			} \
+\
+			PASTEMAC(ch,axpys)( *alpha, rho, y[ jj*incy ] ); \
+		} \
+		return; \
+	} \
+\
+	if ( bli_bpm_is_packed( a ) ) b_fuse = 1; \
+	else                          b_fuse = bli_cntx_get_blksz_def_dt( dt, BLIS_DF, cntx ); \
+\
+	for ( j = c0; j < c1; j += f ) \
+	{ \
+		f  = bli_min( b_fuse, c1 - j ); \
+\
+		/* Identify the rows that are shared by all f columns. */ \
+		lo = bli_max( r0, j + f - 1 - ku ); \
+		hi = bli_min( r1, j + kl + 1 ); \
+\
+		if ( 1 < f && BLIS_BPM_KER_MIN_LEN <= hi - lo ) \
+		{ \
+			kfp_df \
+			( \
+			  conja, \
+			  BLIS_NO_CONJUGATE, \
+			  hi - lo, \
+			  f, \
+			  alpha, \
+			  a_buf + bli_bpm_offset( a, lo, j ), 1, a->lda - 1, \
+			  x + lo*incx, incx, \
+			  one, \
+			  y + j*incy, incy, \
+			  cntx  \
+			); \
+		} \
+		else \
+		{ \
+			lo = hi = r1; \
+		} \
+\
+		/* Handle the remaining rows of each column. */ \
+		for ( p = 0; p < f; ++p ) \
+		{ \
+			jj = j + p; \
+			l  = bli_max( r0, jj - ku ); \
+			h  = bli_min( r1, jj + kl + 1 ); \
+\
+			if ( h <= l ) continue; \
+\
+			PASTEMAC(ch,bpm_dot_col) \
+			( \
+			  conja, \
+			  bli_min( h, lo ) - l, \
+			  alpha, \
+			  a_buf + bli_bpm_offset( a, l, jj ), \
+			  x + l*incx, incx, \
+			  y + jj*incy, \
+			  kfp_dv, \
+			  cntx  \
+			); \
+			if ( hi < h ) \
+			PASTEMAC(ch,bpm_dot_col) \
+			( \
+			  conja, \
+			  h - bli_max( l, hi ), \
+			  alpha, \
+			  a_buf + bli_bpm_offset( a, bli_max( l, hi ), jj ), \
+			  x + bli_max( l, hi )*incx, incx, \
+			  y + jj*incy, \
+			  kfp_dv, \
+			  cntx  \
+			); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( bpm_t )
+
+
+// The symmetric sweep over columns [c0,c1) of the logical band (kl,ku),
+// which must be strictly upper (kl < 0) or strictly lower (ku < 0):
+//   z := z + alpha * A * x + alpha * conjh(A)^T * x
+// where z points to element z0 of the output vector. Each element of A is
+// read once: blocks of columns go to the dotxaxpyf kernel, and the rest
+// of each column to dotaxpyv.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+static void PASTEMAC(ch,varname) \
+     ( \
+       conj_t  conjh, \
+       bpm_t*  a, \
+       dim_t   kl, \
+       dim_t   ku, \
+       dim_t   c0, \
+       dim_t   c1, \
+       ctype*  alpha, \
+       ctype*  x, inc_t incx, \
+       ctype*  z, dim_t z0, inc_t incz, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	const num_t dt    = PASTEMAC(ch,type); \
+\
+	ctype*      one   = PASTEMAC(ch,1); \
+	ctype*      a_buf = a->buf; \
+	dim_t       m     = a->m; \
+	dim_t       b_fuse, f; \
+	dim_t       i, j, p, jj; \
+	dim_t       lo, hi, l, h; \
+	ctype       alpha_chi, rho; \
+\
+	PASTECH(ch,dotxaxpyf_ft) kfp_xf = bli_cntx_get_l1f_ker_dt( dt, BLIS_DOTXAXPYF_KER, cntx ); \
+	PASTECH(ch,dotaxpyv_ft)  kfp_vf = bli_cntx_get_l1f_ker_dt( dt, BLIS_DOTAXPYV_KER, cntx ); \
+\
+	if ( bli_bpm_is_packed( a ) ) b_fuse = 1; \
+	else                          b_fuse = bli_cntx_get_blksz_def_dt( dt, BLIS_XF, cntx ); \
+\
+	for ( j = c0; j < c1; j += f ) \
+	{ \
+		f  = bli_min( b_fuse, c1 - j ); \
+\
+		/* Identify the rows that are shared by all f columns. */ \
+		lo = bli_max( 0, j + f - 1 - ku ); \
+		hi = bli_min( m, j + kl + 1 ); \
+\
+		if ( 1 < f && BLIS_BPM_KER_MIN_LEN <= hi - lo ) \
+		{ \
+			kfp_xf \
+			( \
+			  conjh, \
+			  BLIS_NO_CONJUGATE, \
+			  BLIS_NO_CONJUGATE, \
+			  BLIS_NO_CONJUGATE, \
+			  hi - lo, \
+			  f, \
+			  alpha, \
+			  a_buf + bli_bpm_offset( a, lo, j ), 1, a->lda - 1, \
+			  x + lo*incx, incx, \
+			  x + j*incx, incx, \
+			  one, \
+			  z + ( j - z0 )*incz, incz, \
+			  z + ( lo - z0 )*incz, incz, \
+			  cntx  \
+			); \
+		} \
+		else \
+		{ \
+			lo = hi = m; \
+		} \
+\
+		/* Handle the remaining rows of each column. */ \
+		for ( p = 0; p < f; ++p ) \
+		{ \
+			dim_t  seg_l[ 2 ], seg_h[ 2 ], s; \
+			ctype* a1; \
+\
+			jj = j + p; \
+			l  = bli_max( 0, jj - ku ); \
+			h  = bli_min( m, jj + kl + 1 ); \
+\
+			seg_l[ 0 ] = l;                  seg_h[ 0 ] = bli_min( h, lo ); \
+			seg_l[ 1 ] = bli_max( l, hi );   seg_h[ 1 ] = h; \
+\
+			PASTEMAC(ch,scal2s)( *alpha, x[ jj*incx ], alpha_chi ); \
+\
+			for ( s = 0; s < 2; ++s ) \
+			{ \
+				dim_t len = seg_h[ s ] - seg_l[ s ]; \
+\
+				if ( len <= 0 ) continue; \
+\
+				a1 = a_buf + bli_bpm_offset( a, seg_l[ s ], jj ); \
+\
+				if ( BLIS_BPM_KER_MIN_LEN <= len ) \
+				{ \
+					kfp_vf \
+					( \
+					  conjh, \
+					  BLIS_NO_CONJUGATE, \
+					  BLIS_NO_CONJUGATE, \
+					  len, \
+					  &alpha_chi, \
+					  a1, 1, \
+					  x + seg_l[ s ]*incx, incx, \
+					  &rho, \
+					  z + ( seg_l[ s ] - z0 )*incz, incz, \
+					  cntx  \
+					); \
+				} \
+				else \
+				{ \
+					PASTEMAC(ch,set0s)( rho ); \
+\
+					for ( i = 0; i < len; ++i ) \
+					{ \
+						ctype* chi   = x + ( seg_l[ s ] + i )*incx; \
+						ctype* zeta  = z + ( seg_l[ s ] + i - z0 )*incz; \
+\
+						if ( bli_is_conj( conjh ) ) { PASTEMAC(ch,dotjs)( a1[ i ], *chi, rho ); } \
+						else                        { PASTEMAC(ch,dots)( a1[ i ], *chi, rho ); } \
+\
+						PASTEMAC(ch,axpys)( alpha_chi, a1[ i ], *zeta ); \
+					} \
+				} \
+\
+				PASTEMAC(ch,axpys)( *alpha, rho, z[ ( jj - z0 )*incz ] ); \
+			} \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( bpm_nt )
+
+
+// y[i0:i1] := beta * y[i0:i1], where a zero beta overwrites y.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+static void PASTEMAC(ch,varname) \
+     ( \
+       dim_t   n, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	if ( n <= 0 ) return; \
+\
+	if ( PASTEMAC(ch,eq0)( *beta ) ) \
+	{ \
+		PASTECH(ch,setv_ft) kfp_sv = bli_cntx_get_l1v_ker_dt( dt, BLIS_SETV_KER, cntx ); \
+\
+		kfp_sv( BLIS_NO_CONJUGATE, n, PASTEMAC(ch,0), y, incy, cntx ); \
+	} \
+	else if ( !PASTEMAC(ch,eq1)( *beta ) ) \
+	{ \
+		PASTECH(ch,scalv_ft) kfp_cv = bli_cntx_get_l1v_ker_dt( dt, BLIS_SCALV_KER, cntx ); \
+\
+		kfp_cv( BLIS_NO_CONJUGATE, n, beta, y, incy, cntx ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( bpm_scal_beta )
+
+
+//
+// Define the thread bodies of the operations.
+//
+
+// gemv: thread tid computes the rows (no transpose) or columns (transpose)
+// of A, and therefore the elements of y, that the partition assigns to it.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+static void PASTEMAC(ch,varname)( dim_t tid, dim_t nt, void* params_v ) \
+{ \
+	bpm_params_t* params = params_v; \
+	bpm_t*        a      = params->a; \
+	ctype*        alpha  = params->alpha; \
+	ctype*        x      = params->x; \
+	ctype*        y      = params->y; \
+	inc_t         incx   = params->incx; \
+	inc_t         incy   = params->incy; \
+	cntx_t*       cntx   = params->cntx; \
+	conj_t        conja  = bli_extract_conj( params->trans ); \
+	bool_t        notr   = bli_does_notrans( params->trans ); \
+	dim_t         i0, i1; \
+\
+	bli_bpm_partition( notr, a->m, a->n, a->kl, a->ku, tid, nt, &i0, &i1 ); \
+\
+	PASTEMAC(ch,bpm_scal_beta)( i1 - i0, params->beta, y + i0*incy, incy, cntx ); \
+\
+	if ( PASTEMAC(ch,eq0)( *alpha ) ) return; \
+\
+	if ( notr ) \
+		PASTEMAC(ch,bpm_n) \
+		( \
+		  conja, a, a->kl, a->ku, \
+		  i0, i1, bli_max( 0, i0 - a->kl ), bli_min( a->n, i1 + a->ku ), \
+		  alpha, x, incx, y, incy, cntx \
+		); \
+	else \
+		PASTEMAC(ch,bpm_t) \
+		( \
+		  conja, a, a->kl, a->ku, \
+		  bli_max( 0, i0 - a->ku ), bli_min( a->m, i1 + a->kl ), i0, i1, \
+		  alpha, x, incx, y, incy, cntx \
+		); \
+}
+
+INSERT_GENTFUNC_BASIC0( gemv_bpm_thread )
+
+
+// hemv: every element of the strict triangle of A contributes to two
+// elements of y, so thread tid sweeps the columns [j0,j1) that the
+// partition assigns to it just once and accumulates into z, which spans
+// the rows [z0,z1) that those columns touch. With a single thread, z is y
+// itself. Otherwise, z is private to the thread, and the caller adds it
+// to y once all threads are done.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+static void PASTEMAC(ch,varname)( dim_t tid, dim_t nt, void* params_v ) \
+{ \
+	bpm_params_t* params = params_v; \
+	bpm_t*        a      = params->a; \
+	ctype*        alpha  = params->alpha; \
+	ctype*        x      = params->x; \
+	inc_t         incx   = params->incx; \
+	cntx_t*       cntx   = params->cntx; \
+	conj_t        conjh  = params->conjh; \
+	ctype*        a_buf  = a->buf; \
+	dim_t         n      = a->n; \
+	dim_t         kl_s, ku_s; \
+	dim_t         j0, j1, z0, z1, j; \
+	ctype*        z; \
+	inc_t         incz; \
+	ctype         alpha11, alpha11_chi1; \
+\
+	bli_bpm_partition( FALSE, n, n, a->kl, a->ku, tid, nt, &j0, &j1 ); \
+\
+	/* Describe the strictly upper or lower part of the stored triangle,
+	   and the rows of y that columns [j0,j1) of it touch. */ \
+	if ( bli_is_upper( params->uplo ) ) \
+	{ \
+		kl_s = -1; ku_s = a->ku; \
+		z0 = bli_max( 0, j0 - ku_s ); z1 = j1; \
+	} \
+	else \
+	{ \
+		kl_s = a->kl; ku_s = -1; \
+		z0 = j0; z1 = bli_min( n, j1 + kl_s ); \
+	} \
+\
+	if ( nt == 1 ) \
+	{ \
+		z    = params->y; \
+		incz = params->incy; \
+		z0   = 0; \
+\
+		PASTEMAC(ch,bpm_scal_beta)( n, params->beta, z, incz, cntx ); \
+	} \
+	else \
+	{ \
+		bpm_acc_t* acc = &params->acc[ tid ]; \
+\
+		bli_membrk_acquire_v( bli_memsys_global_membrk(), \
+		                      bli_max( z1 - z0, 1 ) * sizeof( ctype ), \
+		                      &acc->mem ); \
+\
+		z    = bli_mem_buffer( &acc->mem ); \
+		incz = 1; \
+\
+		for ( j = 0; j < z1 - z0; ++j ) PASTEMAC(ch,set0s)( z[ j ] ); \
+\
+		params->n_threads = nt; \
+		acc->z0           = z0; \
+		acc->z1           = z1; \
+	} \
+\
+	if ( PASTEMAC(ch,eq0)( *alpha ) ) return; \
+\
+	PASTEMAC(ch,bpm_nt) \
+	( \
+	  conjh, a, kl_s, ku_s, j0, j1, \
+	  alpha, x, incx, z, z0, incz, cntx \
+	); \
+\
+	for ( j = j0; j < j1; ++j ) \
+	{ \
+		PASTEMAC(ch,copys)( a_buf[ bli_bpm_offset( a, j, j ) ], alpha11 ); \
+		if ( bli_is_conj( conjh ) ) { PASTEMAC(ch,seti0s)( alpha11 ); } \
+\
+		PASTEMAC(ch,scal2s)( *alpha, x[ j*incx ], alpha11_chi1 ); \
+		PASTEMAC(ch,axpys)( alpha11, alpha11_chi1, z[ ( j - z0 )*incz ] ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( hemv_bpm_thread )
+
+
+// trmv: x has been copied to w. Thread tid computes the rows (no transpose)
+// or columns (transpose) of A that the partition assigns to it, reading w
+// and writing the corresponding elements of x.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+static void PASTEMAC(ch,varname)( dim_t tid, dim_t nt, void* params_v ) \
+{ \
+	bpm_params_t* params = params_v; \
+	bpm_t*        a      = params->a; \
+	ctype*        one    = PASTEMAC(ch,1); \
+	ctype*        x      = params->x; \
+	ctype*        w      = params->w; \
+	inc_t         incx   = params->incx; \
+	cntx_t*       cntx   = params->cntx; \
+	conj_t        conja  = bli_extract_conj( params->trans ); \
+	bool_t        notr   = bli_does_notrans( params->trans ); \
+	ctype*        a_buf  = a->buf; \
+	dim_t         n      = a->n; \
+	dim_t         kl_s, ku_s; \
+	dim_t         i0, i1, i; \
+	ctype         alpha11; \
+\
+	bli_bpm_partition( notr, n, n, a->kl, a->ku, tid, nt, &i0, &i1 ); \
+\
+	/* x := diag(A) * w */ \
+	for ( i = i0; i < i1; ++i ) \
+	{ \
+		if ( bli_is_unit_diag( params->diag ) ) \
+		{ \
+			PASTEMAC(ch,copys)( w[ i ], x[ i*incx ] ); \
+		} \
+		else \
+		{ \
+			PASTEMAC(ch,copycjs)( conja, a_buf[ bli_bpm_offset( a, i, i ) ], alpha11 ); \
+			PASTEMAC(ch,scal2s)( alpha11, w[ i ], x[ i*incx ] ); \
+		} \
+	} \
+\
+	/* Describe the strictly upper or lower part of the stored triangle. */ \
+	if ( bli_is_upper( params->uplo ) ) { kl_s = -1; ku_s = a->ku; } \
+	else                                { kl_s = a->kl; ku_s = -1; } \
+\
+	if ( notr ) \
+		PASTEMAC(ch,bpm_n) \
+		( \
+		  conja, a, kl_s, ku_s, \
+		  i0, i1, bli_max( 0, i0 - kl_s ), bli_min( n, i1 + ku_s ), \
+		  one, w, 1, x, incx, cntx \
+		); \
+	else \
+		PASTEMAC(ch,bpm_t) \
+		( \
+		  conja, a, kl_s, ku_s, \
+		  bli_max( 0, i0 - ku_s ), bli_min( n, i1 + kl_s ), i0, i1, \
+		  one, w, 1, x, incx, cntx \
+		); \
+}
+
+INSERT_GENTFUNC_BASIC0( trmv_bpm_thread )
+
+
+// her: thread tid updates the columns of the stored triangle that the
+// partition assigns to it. her2 passes y as well.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+static void PASTEMAC(ch,varname)( dim_t tid, dim_t nt, void* params_v ) \
+{ \
+	const num_t   dt     = PASTEMAC(ch,type); \
+\
+	bpm_params_t* params = params_v; \
+	bpm_t*        a      = params->a; \
+	ctype*        alpha  = params->alpha; \
+	ctype*        x      = params->x; \
+	ctype*        y      = params->y; \
+	inc_t         incx   = params->incx; \
+	inc_t         incy   = params->incy; \
+	cntx_t*       cntx   = params->cntx; \
+	conj_t        conjh  = params->conjh; \
+	ctype*        a_buf  = a->buf; \
+	dim_t         n      = a->n; \
+	ctype*        a1; \
+	dim_t         j0, j1, j, l, h; \
+	ctype         alpha_x, alpha_y, alpha_c; \
+\
+	PASTECH(ch,axpyv_ft)  kfp_av = bli_cntx_get_l1v_ker_dt( dt, BLIS_AXPYV_KER, cntx ); \
+	PASTECH(ch,axpy2v_ft) kfp_2v = bli_cntx_get_l1f_ker_dt( dt, BLIS_AXPY2V_KER, cntx ); \
+\
+	bli_bpm_partition( FALSE, n, n, a->kl, a->ku, tid, nt, &j0, &j1 ); \
+\
+	PASTEMAC(ch,copycjs)( conjh, *alpha, alpha_c ); \
+\
+	for ( j = j0; j < j1; ++j ) \
+	{ \
+		l = bli_max( 0, j - a->ku ); \
+		h = bli_min( n, j + a->kl + 1 ); \
+\
+		a1 = a_buf + bli_bpm_offset( a, l, j ); \
+\
+		if ( y == NULL ) \
+		{ \
+			/* a1 := a1 + alpha * x[l:h] * conjh(x[j]) */ \
+			PASTEMAC(ch,copycjs)( conjh, x[ j*incx ], alpha_x ); \
+			PASTEMAC(ch,scals)( *alpha, alpha_x ); \
+\
+			kfp_av( BLIS_NO_CONJUGATE, h - l, &alpha_x, x + l*incx, incx, a1, 1, cntx ); \
+		} \
+		else \
+		{ \
+			/* a1 := a1 +        alpha  * x[l:h] * conjh(y[j])
+			            + conjh(alpha) * y[l:h] * conjh(x[j]) */ \
+			PASTEMAC(ch,copycjs)( conjh, y[ j*incy ], alpha_x ); \
+			PASTEMAC(ch,scals)( *alpha, alpha_x ); \
+			PASTEMAC(ch,copycjs)( conjh, x[ j*incx ], alpha_y ); \
+			PASTEMAC(ch,scals)( alpha_c, alpha_y ); \
+\
+			kfp_2v \
+			( \
+			  BLIS_NO_CONJUGATE, \
+			  BLIS_NO_CONJUGATE, \
+			  h - l, \
+			  &alpha_x, \
+			  &alpha_y, \
+			  x + l*incx, incx, \
+			  y + l*incy, incy, \
+			  a1, 1, \
+			  cntx  \
+			); \
+		} \
+\
+		/* The diagonal of a Hermitian matrix is real. */ \
+		if ( bli_is_conj( conjh ) ) \
+			PASTEMAC(ch,seti0s)( a_buf[ bli_bpm_offset( a, j, j ) ] ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( her_bpm_thread )
+
+
+
+//
+// Define BLAS-like interfaces with typed operands.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       ctype*  alpha, \
+       bpm_t*  a, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	bpm_params_t params; \
+	cntx_t*      cntx_p; \
+\
+	if ( bli_zero_dim1( bli_does_notrans( transa ) ? a->m : a->n ) ) return; \
+\
+	/* Initialize a local context if the given context is NULL. */ \
+	bli_cntx_init_local_if( bpm, cntx, cntx_p ); \
+\
+	params.trans = transa; \
+	params.alpha = alpha; \
+	params.beta  = beta; \
+	params.a     = a; \
+	params.x     = x; \
+	params.incx  = incx; \
+	params.y     = y; \
+	params.incy  = incy; \
+	params.cntx  = cntx_p; \
+\
+	bli_thread_launch( bli_bpm_nthread( a ), PASTEMAC2(ch,opname,_thread), &params ); \
+\
+	/* Finalize the local context if it was initialized here. */ \
+	bli_cntx_finalize_local_if( bpm, cntx ); \
+}
+
+INSERT_GENTFUNC_BASIC0( gemv_bpm )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       uplo_t  uploa, \
+       conj_t  conjh, \
+       ctype*  alpha, \
+       bpm_t*  a, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	const num_t  dt = PASTEMAC(ch,type); \
+\
+	bpm_params_t params; \
+	mem_t        acc_mem; \
+	cntx_t*      cntx_p; \
+	dim_t        nt, t; \
+\
+	if ( bli_zero_dim1( a->n ) ) return; \
+\
+	/* Initialize a local context if the given context is NULL. */ \
+	bli_cntx_init_local_if( bpm, cntx, cntx_p ); \
+\
+	params.uplo  = uploa; \
+	params.conjh = conjh; \
+	params.alpha = alpha; \
+	params.beta  = beta; \
+	params.a     = a; \
+	params.x     = x; \
+	params.incx  = incx; \
+	params.y     = y; \
+	params.incy  = incy; \
+	params.cntx  = cntx_p; \
+\
+	/* Reserve room for the accumulators of the threads. */ \
+	nt                = bli_bpm_nthread( a ); \
+	params.n_threads  = 0; \
+	bli_membrk_acquire_v( bli_memsys_global_membrk(), \
+	                      nt * sizeof( bpm_acc_t ), &acc_mem ); \
+	params.acc        = bli_mem_buffer( &acc_mem ); \
+\
+	bli_thread_launch( nt, PASTEMAC2(ch,opname,_thread), &params ); \
+\
+	/* If more than one thread ran, y has not been touched yet, so scale
+	   it and add the partial results of the threads to it. */ \
+	if ( 0 < params.n_threads ) \
+	{ \
+		PASTECH(ch,axpyv_ft) kfp_av = bli_cntx_get_l1v_ker_dt( dt, BLIS_AXPYV_KER, cntx_p ); \
+\
+		PASTEMAC(ch,bpm_scal_beta)( a->n, beta, y, incy, cntx_p ); \
+\
+		for ( t = 0; t < params.n_threads; ++t ) \
+		{ \
+			bpm_acc_t* acc = &params.acc[ t ]; \
+\
+			kfp_av \
+			( \
+			  BLIS_NO_CONJUGATE, \
+			  acc->z1 - acc->z0, \
+			  PASTEMAC(ch,1), \
+			  bli_mem_buffer( &acc->mem ), 1, \
+			  y + acc->z0*incy, incy, \
+			  cntx_p  \
+			); \
+\
+			bli_membrk_release( &acc->mem ); \
+		} \
+	} \
+\
+	bli_membrk_release( &acc_mem ); \
+\
+	/* Finalize the local context if it was initialized here. */ \
+	bli_cntx_finalize_local_if( bpm, cntx ); \
+}
+
+INSERT_GENTFUNC_BASIC0( hemv_bpm )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       uplo_t  uploa, \
+       trans_t transa, \
+       diag_t  diaga, \
+       bpm_t*  a, \
+       ctype*  x, inc_t incx, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	bpm_params_t params; \
+	mem_t        w_mem; \
+	cntx_t*      cntx_p; \
+	ctype*       w; \
+	dim_t        i; \
+\
+	if ( bli_zero_dim1( a->n ) ) return; \
+\
+	/* Initialize a local context if the given context is NULL. */ \
+	bli_cntx_init_local_if( bpm, cntx, cntx_p ); \
+\
+	/* Every element of x depends on others, so read from a copy of x
+	   while the threads overwrite it. */ \
+	bli_membrk_acquire_v( bli_memsys_global_membrk(), \
+	                      a->n * sizeof( ctype ), &w_mem ); \
+	w = bli_mem_buffer( &w_mem ); \
+\
+	for ( i = 0; i < a->n; ++i ) \
+		PASTEMAC(ch,copys)( x[ i*incx ], w[ i ] ); \
+\
+	params.uplo  = uploa; \
+	params.trans = transa; \
+	params.diag  = diaga; \
+	params.a     = a; \
+	params.x     = x; \
+	params.incx  = incx; \
+	params.w     = w; \
+	params.cntx  = cntx_p; \
+\
+	bli_thread_launch( bli_bpm_nthread( a ), PASTEMAC2(ch,opname,_thread), &params ); \
+\
+	bli_membrk_release( &w_mem ); \
+\
+	/* Finalize the local context if it was initialized here. */ \
+	bli_cntx_finalize_local_if( bpm, cntx ); \
+}
+
+INSERT_GENTFUNC_BASIC0( trmv_bpm )
+
+
+// trsv proceeds by blocked substitution over blocks of b consecutive
+// elements of x, where b is the fusing factor of the kernel in use. The
+// diagonal block is solved one element at a time. Without a transpose,
+// the solved block is then eliminated from the rest of x with a single
+// bpm_n sweep (axpyf); with a transpose, the contributions of the solved
+// part of x to the next block are first gathered with a bpm_t sweep
+// (dotxf). The substitution is inherently sequential, so trsv does not
+// use multiple threads.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       uplo_t  uploa, \
+       trans_t transa, \
+       diag_t  diaga, \
+       bpm_t*  a, \
+       ctype*  x, inc_t incx, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	const num_t dt        = PASTEMAC(ch,type); \
+\
+	ctype*      minus_one = PASTEMAC(ch,m1); \
+	ctype*      a_buf     = a->buf; \
+	dim_t       n         = a->n; \
+	conj_t      conja     = bli_extract_conj( transa ); \
+	bool_t      notr      = bli_does_notrans( transa ); \
+	bool_t      backward; \
+	cntx_t*     cntx_p; \
+	dim_t       kl_s, ku_s; \
+	dim_t       b, f, iter, q; \
+	dim_t       j, j0, j1, l, h; \
+	ctype       alpha; \
+\
+	if ( bli_zero_dim1( n ) ) return; \
+\
+	/* Initialize a local context if the given context is NULL. */ \
+	bli_cntx_init_local_if( bpm, cntx, cntx_p ); \
+\
+	b = bli_cntx_get_blksz_def_dt( dt, ( notr ? BLIS_AF : BLIS_DF ), cntx_p ); \
+\
+	PASTECH(ch,axpyv_ft) kfp_av = bli_cntx_get_l1v_ker_dt( dt, BLIS_AXPYV_KER, cntx_p ); \
+	PASTECH(ch,dotxv_ft) kfp_dv = bli_cntx_get_l1v_ker_dt( dt, BLIS_DOTXV_KER, cntx_p ); \
+\
+	/* A narrow band never fills a kernel call, so solve it in one block. */ \
+	if ( !bli_bpm_is_packed( a ) && a->kl + a->ku + 1 < BLIS_BPM_KER_MIN_LEN ) b = n; \
+\
+	/* Describe the strictly upper or lower part of the stored triangle. */ \
+	if ( bli_is_upper( uploa ) ) { kl_s = -1; ku_s = a->ku; } \
+	else                         { kl_s = a->kl; ku_s = -1; } \
+\
+	/* Solve from the bottom up if transa(A) is upper triangular. */ \
+	backward = ( bli_is_upper( uploa ) ? notr : !notr ); \
+\
+	for ( iter = 0; iter < n; iter += f ) \
+	{ \
+		f  = bli_min( b, n - iter ); \
+		j0 = ( backward ? n - iter - f : iter ); \
+		j1 = j0 + f; \
+\
+		/* x[j0:j1] := x[j0:j1] - A(solved,j0:j1)^T * x[solved] */ \
+		if ( !notr ) \
+			PASTEMAC(ch,bpm_t) \
+			( \
+			  conja, a, kl_s, ku_s, \
+			  ( backward ? j1 : 0 ), ( backward ? n : j0 ), j0, j1, \
+			  minus_one, x, incx, x, incx, cntx_p \
+			); \
+\
+		/* Solve the diagonal block. */ \
+		for ( q = 0; q < f; ++q ) \
+		{ \
+			j = ( backward ? j1 - 1 - q : j0 + q ); \
+			l = bli_max( j0, j - ku_s ); \
+			h = bli_min( j1, j + kl_s + 1 ); \
+\
+			/* x[j] := x[j] - A(l:h,j)^T * x[l:h] */ \
+			if ( !notr && l < h ) \
+				PASTEMAC(ch,bpm_dot_col) \
+				( \
+				  conja, h - l, minus_one, \
+				  a_buf + bli_bpm_offset( a, l, j ), \
+				  x + l*incx, incx, \
+				  x + j*incx, \
+				  kfp_dv, cntx_p \
+				); \
+\
+			if ( bli_is_nonunit_diag( diaga ) ) \
+			{ \
+				PASTEMAC(ch,copycjs)( conja, a_buf[ bli_bpm_offset( a, j, j ) ], alpha ); \
+				PASTEMAC(ch,invscals)( alpha, x[ j*incx ] ); \
+			} \
+\
+			/* x[l:h] := x[l:h] - A(l:h,j) * x[j] */ \
+			if ( notr && l < h ) \
+			{ \
+				PASTEMAC(ch,neg2s)( x[ j*incx ], alpha ); \
+\
+				PASTEMAC(ch,bpm_axpy_col) \
+				( \
+				  conja, h - l, &alpha, \
+				  a_buf + bli_bpm_offset( a, l, j ), \
+				  x + l*incx, incx, \
+				  kfp_av, cntx_p \
+				); \
+			} \
+		} \
+\
+		/* x[unsolved] := x[unsolved] - A(unsolved,j0:j1) * x[j0:j1] */ \
+		if ( notr ) \
+			PASTEMAC(ch,bpm_n) \
+			( \
+			  conja, a, kl_s, ku_s, \
+			  ( backward ? 0 : j1 ), ( backward ? j0 : n ), j0, j1, \
+			  minus_one, x, incx, x, incx, cntx_p \
+			); \
+	} \
+\
+	/* Finalize the local context if it was initialized here. */ \
+	bli_cntx_finalize_local_if( bpm, cntx ); \
+}
+
+INSERT_GENTFUNC_BASIC0( trsv_bpm )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       uplo_t  uploa, \
+       conj_t  conjh, \
+       ctype*  alpha, \
+       ctype*  x, inc_t incx, \
+       bpm_t*  a, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	PASTEMAC(ch,her2_bpm)( uploa, conjh, alpha, x, incx, NULL, 0, a, cntx ); \
+}
+
+INSERT_GENTFUNC_BASIC0( her_bpm )
+
+
+// When y is NULL, her2_bpm performs the rank-1 update of her_bpm instead.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       uplo_t  uploa, \
+       conj_t  conjh, \
+       ctype*  alpha, \
+       ctype*  x, inc_t incx, \
+       ctype*  y, inc_t incy, \
+       bpm_t*  a, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	bpm_params_t params; \
+	cntx_t*      cntx_p; \
+\
+	if ( bli_zero_dim1( a->n ) ) return; \
+	if ( PASTEMAC(ch,eq0)( *alpha ) ) return; \
+\
+	/* Initialize a local context if the given context is NULL. */ \
+	bli_cntx_init_local_if( bpm, cntx, cntx_p ); \
+\
+	params.uplo  = uploa; \
+	params.conjh = conjh; \
+	params.alpha = alpha; \
+	params.a     = a; \
+	params.x     = x; \
+	params.incx  = incx; \
+	params.y     = y; \
+	params.incy  = incy; \
+	params.cntx  = cntx_p; \
+\
+	bli_thread_launch( bli_bpm_nthread( a ), PASTEMAC(ch,her_bpm_thread), &params ); \
+\
+	/* Finalize the local context if it was initialized here. */ \
+	bli_cntx_finalize_local_if( bpm, cntx ); \
+}
+
+INSERT_GENTFUNC_BASIC0( her2_bpm )
+
@@ -0,0 +1,186 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// Banded and packed matrices.
+//
+// A bpm_t describes the stored part of an m x n matrix whose nonzero
+// elements lie within kl subdiagonals and ku superdiagonals. Column j
+// holds rows max(0,j-ku) through min(m-1,j+kl), stored contiguously:
+//
+// - In BLAS band storage, element (i,j) lives at buf[ (ku+i-j) + j*lda ].
+// - In BLAS packed storage (lda == 0), an n x n triangle is stored column
+//   by column without gaps. The upper triangle has kl = 0 and ku = n-1;
+//   the lower triangle has kl = n-1 and ku = 0.
+//
+// The operations below sweep either the whole stored band or a narrower
+// logical band within it, which is how the strictly triangular and
+// diagonal parts of symmetric and triangular matrices are handled.
+//
+
+typedef struct
+{
+	void*  buf;
+	dim_t  m;
+	dim_t  n;
+	dim_t  kl;
+	dim_t  ku;
+	inc_t  lda;
+} bpm_t;
+
+#define bli_bpm_is_packed( a ) \
+\
+	( (a)->lda == 0 )
+
+// Return the offset of element (i,j), which must lie within the stored
+// band, from the start of the buffer.
+#define bli_bpm_offset( a, i, j ) \
+\
+	( !bli_bpm_is_packed( a ) ? ( (a)->ku + (i) - (j) ) + (j) * (a)->lda \
+	  : (a)->kl == 0          ? (i) + ( (j) * ( (j) + 1 ) ) / 2 \
+	  :                         ( (i) - (j) ) + ( (j) * ( 2 * (a)->n - (j) + 1 ) ) / 2 )
+
+void bli_bpm_init_band( void* buf, dim_t m, dim_t n, dim_t kl, dim_t ku, inc_t lda, bpm_t* a );
+void bli_bpm_init_packed( void* buf, uplo_t uplo, dim_t n, bpm_t* a );
+
+
+//
+// Prototype the context initialization functions.
+//
+
+void bli_bpm_cntx_init( cntx_t* cntx );
+void bli_bpm_cntx_finalize( cntx_t* cntx );
+
+
+//
+// Prototype BLAS-like interfaces with typed operands.
+//
+
+// y := beta * y + alpha * transa(A) * x, with A general banded.
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       ctype*  alpha, \
+       bpm_t*  a, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy, \
+       cntx_t* cntx  \
+     );
+
+INSERT_GENTPROT_BASIC( gemv_bpm )
+
+// y := beta * y + alpha * A * x, with A Hermitian (conjh = BLIS_CONJUGATE)
+// or symmetric (conjh = BLIS_NO_CONJUGATE) and only the uploa triangle
+// stored. The imaginary parts of the diagonal of a Hermitian matrix are
+// not referenced.
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       uplo_t  uploa, \
+       conj_t  conjh, \
+       ctype*  alpha, \
+       bpm_t*  a, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy, \
+       cntx_t* cntx  \
+     );
+
+INSERT_GENTPROT_BASIC( hemv_bpm )
+
+// x := transa(A) * x or x := inv(transa(A)) * x, with A triangular.
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       uplo_t  uploa, \
+       trans_t transa, \
+       diag_t  diaga, \
+       bpm_t*  a, \
+       ctype*  x, inc_t incx, \
+       cntx_t* cntx  \
+     );
+
+INSERT_GENTPROT_BASIC( trmv_bpm )
+INSERT_GENTPROT_BASIC( trsv_bpm )
+
+// A := A + alpha * x * conjh(x)^T, with only the uploa triangle of A
+// stored. For a Hermitian update, alpha must be real and the imaginary
+// parts of the diagonal of A are set to zero.
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       uplo_t  uploa, \
+       conj_t  conjh, \
+       ctype*  alpha, \
+       ctype*  x, inc_t incx, \
+       bpm_t*  a, \
+       cntx_t* cntx  \
+     );
+
+INSERT_GENTPROT_BASIC( her_bpm )
+
+// A := A + alpha * x * conjh(y)^T + conjh(alpha) * y * conjh(x)^T, with
+// only the uploa triangle of A stored.
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       uplo_t  uploa, \
+       conj_t  conjh, \
+       ctype*  alpha, \
+       ctype*  x, inc_t incx, \
+       ctype*  y, inc_t incy, \
+       bpm_t*  a, \
+       cntx_t* cntx  \
+     );
+
+INSERT_GENTPROT_BASIC( her2_bpm )
+
@@ -44,6 +44,7 @@
 #include "bli_l3_direct.h"
 #include "bli_l3_prune.h"
 #include "bli_l3_packm.h"
+#include "bli_l3_model.h"
 
 // Prototype object APIs with and without contexts.
 #include "bli_oapi_w_cntx.h"
@@ -33,6 +33,19 @@
 */
 
 
+dim_t bli_l3_determine_kc
+      (
+         dir_t   direct,
+         dim_t   i,
+         dim_t   dim,
+         obj_t*  a,
+         obj_t*  b,
+         bszid_t bszid,
+         cntx_t* cntx,
+         rntm_t* rntm
+      );
+
+
 #undef  GENPROT
 #define GENPROT( opname ) \
 \
@@ -47,8 +60,6 @@ dim_t PASTEMAC0(opname) \
          cntx_t* cntx  \
       );
 
-GENPROT( l3_determine_kc )
-
 GENPROT( gemm_determine_kc )
 GENPROT( herk_determine_kc )
 GENPROT( trmm_determine_kc )
@@ -40,7 +40,7 @@ void bli_l3_cntl_create_if
        obj_t*   a,
        obj_t*   b,
        obj_t*   c,
-       cntx_t*  cntx,
+       rntm_t*  rntm,
        cntl_t*  cntl_orig,
        cntl_t** cntl_use
      )
@@ -49,7 +49,7 @@ void bli_l3_cntl_create_if
 	// tree as a function of the operation family.
 	if ( cntl_orig == NULL )
 	{
-		opid_t family = bli_cntx_get_family( cntx );
+		opid_t family = bli_rntm_family( rntm );
 
 		if ( family == BLIS_GEMM ||
 		     family == BLIS_HERK ||
@@ -81,7 +81,7 @@ void bli_l3_cntl_free_if
        obj_t*  a,
        obj_t*  b,
        obj_t*  c,
-       cntx_t* cntx,
+       rntm_t* rntm,
        cntl_t* cntl_orig,
        cntl_t* cntl_use,
        thrinfo_t* thread
@@ -91,7 +91,7 @@ void bli_l3_cntl_free_if
 	// been created, so we now must free it.
 	if ( cntl_orig == NULL )
 	{
-		opid_t family = bli_cntx_get_family( cntx );
+		opid_t family = bli_rntm_family( rntm );
 
 		if ( family == BLIS_GEMM ||
 		     family == BLIS_HERK ||
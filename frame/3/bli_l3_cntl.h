@@ -42,7 +42,7 @@ void bli_l3_cntl_create_if
        obj_t*   a,
        obj_t*   b,
        obj_t*   c,
-       cntx_t*  cntx,
+       rntm_t*  rntm,
        cntl_t*  cntl_orig,
        cntl_t** cntl_use
      );
@@ -52,9 +52,29 @@ void bli_l3_cntl_free_if
        obj_t*  a,
        obj_t*  b,
        obj_t*  c,
-       cntx_t* cntx,
+       rntm_t* rntm,
        cntl_t* cntl_orig,
        cntl_t* cntl_use,
        thrinfo_t* thread
      );
 
+
+// The profiling phase of a control tree node: the macro-kernel node is the
+// one whose sub-node (a placeholder needed by bli_thrinfo_rgrow()) has no
+// variant function, and every other node is a blocked or packing variant.
+
+#define bli_l3_cntl_prof_phase( cntl ) \
+\
+	( bli_cntl_sub_node( cntl ) == NULL || \
+	  bli_cntl_var_func( bli_cntl_sub_node( cntl ) ) == NULL \
+	  ? BLIS_PROF_L3_KER : BLIS_PROF_L3_BLK_VAR )
+
+// The loop level of a control tree node, for attributing barrier waits.
+
+#define bli_l3_cntl_prof_level( cntl ) \
+\
+	( bli_cntl_bszid( cntl ) == BLIS_NC ? BLIS_PROF_LVL_JC : \
+	  bli_cntl_bszid( cntl ) == BLIS_KC ? BLIS_PROF_LVL_PC : \
+	  bli_cntl_bszid( cntl ) == BLIS_MC ? BLIS_PROF_LVL_IC : \
+	  bli_cntl_bszid( cntl ) == BLIS_NR ? BLIS_PROF_LVL_JR : \
+	                                      BLIS_PROF_LVL_INHERIT )
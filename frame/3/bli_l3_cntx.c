@@ -72,6 +72,92 @@ void bli_gemm_cntx_finalize( cntx_t* cntx )
 {
 }
 
+// Return the fraction of the micro-tile computation over an m x n matrix C
+// that is not wasted on the zero-padded edges of C, given a micro-kernel's
+// register blocksizes and storage preference.
+static double bli_gemm_cntx_ukr_tile_eff
+     (
+       dim_t  m,
+       dim_t  n,
+       bool_t row_stored,
+       bool_t col_stored,
+       dim_t  mr,
+       dim_t  nr,
+       bool_t row_pref
+     )
+{
+	dim_t m_up, n_up;
+
+	// If the micro-kernel dislikes the storage of C, bli_gemm_front() will
+	// transpose the operation, and so the micro-kernel will see C^T.
+	if ( ( row_stored && !row_pref ) ||
+	     ( col_stored &&  row_pref ) )
+	{
+		dim_t t = m; m = n; n = t;
+	}
+
+	m_up = ( ( m + mr - 1 ) / mr ) * mr;
+	n_up = ( ( n + nr - 1 ) / nr ) * nr;
+
+	return ( ( double )m * ( double )n ) /
+	       ( ( double )m_up * ( double )n_up );
+}
+
+// Return the index of the gemm micro-kernel variant that best suits the
+// shape and storage of C, or -1 if the default micro-kernel is preferred.
+dim_t bli_gemm_cntx_select_ukr_var( obj_t* c, cntx_t* cntx )
+{
+	const num_t  dt         = bli_obj_datatype( *c );
+	const dim_t  m          = bli_obj_length_after_trans( *c );
+	const dim_t  n          = bli_obj_width_after_trans( *c );
+	const bool_t row_stored = bli_obj_is_row_stored( *c );
+	const bool_t col_stored = bli_obj_is_col_stored( *c );
+
+	dim_t        n_var;
+	dim_t        var;
+	dim_t        best_var;
+	double       best_eff;
+
+	// Only the native micro-kernels have registered variants.
+	if ( bli_cntx_get_ind_method( cntx ) != BLIS_NAT ) return -1;
+
+	n_var = bli_gks_gemm_ukr_num_vars( dt );
+
+	if ( n_var == 0 || m == 0 || n == 0 ) return -1;
+
+	// Start with the default micro-kernel, which is already present in the
+	// context. A variant must improve on it by a margin to be chosen, since
+	// the default is presumed to be the fastest on large problems.
+	best_var = -1;
+	best_eff = bli_gemm_cntx_ukr_tile_eff
+	           (
+	             m, n, row_stored, col_stored,
+	             bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx ),
+	             bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx ),
+	             bli_cntx_l3_nat_ukr_prefers_rows_dt( dt, BLIS_GEMM_UKR, cntx )
+	           ) * ( 1.0 + BLIS_GEMM_UKR_VARIANT_MIN_GAIN );
+
+	for ( var = 0; var < n_var; ++var )
+	{
+		dim_t  mr, nr;
+		bool_t row_pref;
+		double eff;
+
+		bli_gks_get_gemm_ukr_var( dt, var, &mr, &nr, &row_pref );
+
+		eff = bli_gemm_cntx_ukr_tile_eff( m, n, row_stored, col_stored,
+		                                  mr, nr, row_pref );
+
+		if ( eff > best_eff )
+		{
+			best_var = var;
+			best_eff = eff;
+		}
+	}
+
+	return best_var;
+}
+
 // -----------------------------------------------------------------------------
 
 void bli_trsm_cntx_init( cntx_t* cntx )
@@ -115,3 +201,257 @@ void bli_trsm_cntx_finalize( cntx_t* cntx )
 {
 }
 
+// -----------------------------------------------------------------------------
+
+//
+// Define the global contexts.
+//
+
+// The level-3 operations use these contexts whenever the caller does not
+// provide one, which spares each call the cost of initializing a context
+// from scratch. They are built once when BLIS is initialized, and rebuilt
+// only when the blocksizes in the gks change. The operations never modify
+// a context; any state that varies from one call to the next (e.g. the ways
+// of parallelism) is kept in a rntm_t.
+//
+// A call holds on to the contexts it queried until it returns, so they are
+// never rebuilt in place. Instead, a complete new set is built off to the
+// side and published by swapping the current set pointer, and calls that
+// start afterwards see the new blocksizes. A call may still be using the
+// set it replaced, so the replaced sets are retired rather than freed. The
+// calls that use the global contexts announce themselves with
+// bli_l3_cntx_hold() and bli_l3_cntx_release(), and the retired sets are
+// freed whenever no call holds the contexts (which, for a tuning run that
+// rebuilds the set between sequential trials, is at every rebuild).
+
+#define BLIS_L3_CNTX_MAX_STAGES 4
+
+typedef struct l3_cntx_set_s
+{
+	cntx_t                gemm[ BLIS_NUM_IND_METHODS ][ BLIS_L3_CNTX_MAX_STAGES ];
+	cntx_t                trsm[ BLIS_NUM_IND_METHODS ];
+	cntx_t*               gemm_ukrvar[ BLIS_NUM_FP_TYPES ];
+
+	struct l3_cntx_set_s* next;
+
+} l3_cntx_set_t;
+
+static l3_cntx_set_t* bli_l3_cntx_set_cur     = NULL;
+static l3_cntx_set_t* bli_l3_cntx_set_retired = NULL;
+static dim_t          bli_l3_cntx_set_holds   = 0;
+
+#ifdef BLIS_ENABLE_PTHREADS
+static pthread_mutex_t bli_l3_cntx_set_mutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+static bool_t         bli_l3_cntx_global_is_init = FALSE;
+
+static l3_cntx_set_t* bli_l3_cntx_set_create( void )
+{
+	l3_cntx_set_t* set = bli_malloc_intl( sizeof( l3_cntx_set_t ) );
+	ind_t          method;
+	dim_t          stage;
+	num_t          dt;
+	dim_t          var, n_var;
+
+	// Build the gemm context for every stage of every induced method. (The
+	// _cntx_stage() functions of single-stage methods do nothing.)
+	for ( method = 0; method < BLIS_NUM_IND_METHODS; ++method )
+	{
+		for ( stage = 0; stage < BLIS_L3_CNTX_MAX_STAGES; ++stage )
+		{
+			cntx_t* cntx = &set->gemm[ method ][ stage ];
+
+			bli_gemmind_cntx_init( method, cntx );
+			bli_gemmind_cntx_stage( method, stage, cntx );
+		}
+	}
+
+	// Build the trsm context for each induced method that supports trsm.
+	bli_trsmnat_cntx_init( &set->trsm[ BLIS_NAT ] );
+	bli_trsm3m1_cntx_init( &set->trsm[ BLIS_3M1 ] );
+	bli_trsm4m1_cntx_init( &set->trsm[ BLIS_4M1A ] );
+
+	// Build one native gemm context per registered micro-kernel variant.
+	for ( dt = BLIS_DT_LO; dt <= BLIS_DT_HI; ++dt )
+	{
+		n_var = bli_gks_gemm_ukr_num_vars( dt );
+
+		set->gemm_ukrvar[ dt ] = NULL;
+
+		if ( n_var == 0 ) continue;
+
+		set->gemm_ukrvar[ dt ] = bli_malloc_intl( n_var * sizeof( cntx_t ) );
+
+		for ( var = 0; var < n_var; ++var )
+		{
+			cntx_t* cntx = &set->gemm_ukrvar[ dt ][ var ];
+
+			bli_gemmnat_cntx_init( cntx );
+			bli_gks_cntx_set_gemm_ukr_var( dt, var, cntx );
+		}
+	}
+
+	set->next = NULL;
+
+	return set;
+}
+
+static void bli_l3_cntx_set_free( l3_cntx_set_t* set )
+{
+	num_t dt;
+
+	for ( dt = BLIS_DT_LO; dt <= BLIS_DT_HI; ++dt )
+		bli_free_intl( set->gemm_ukrvar[ dt ] );
+
+	bli_free_intl( set );
+}
+
+void bli_l3_cntx_global_init( void )
+{
+	if ( bli_l3_cntx_global_is_init == TRUE ) return;
+
+	__atomic_store_n( &bli_l3_cntx_set_cur, bli_l3_cntx_set_create(),
+	                  __ATOMIC_RELEASE );
+
+	bli_l3_cntx_global_is_init = TRUE;
+}
+
+// Free the retired sets if no call holds the contexts. This must be called
+// within the critical section. A call that holds the contexts from now on
+// can only obtain the current set, since its hold precedes its query.
+static void bli_l3_cntx_set_reclaim( void )
+{
+	l3_cntx_set_t* set;
+
+	if ( __atomic_load_n( &bli_l3_cntx_set_holds, __ATOMIC_SEQ_CST ) != 0 )
+		return;
+
+	while ( ( set = bli_l3_cntx_set_retired ) != NULL )
+	{
+		__atomic_store_n( &bli_l3_cntx_set_retired, set->next,
+		                  __ATOMIC_RELAXED );
+
+		bli_l3_cntx_set_free( set );
+	}
+}
+
+void bli_l3_cntx_global_reinit( void )
+{
+	// The blocksizes in the gks may be changed before the global contexts
+	// exist (e.g. by bli_cache_init()), in which case there is nothing to
+	// rebuild.
+	if ( bli_l3_cntx_global_is_init == FALSE ) return;
+
+#ifdef BLIS_ENABLE_OPENMP
+	_Pragma( "omp critical (l3_cntx)" )
+#endif
+#ifdef BLIS_ENABLE_PTHREADS
+	pthread_mutex_lock( &bli_l3_cntx_set_mutex );
+#endif
+
+	// BEGIN CRITICAL SECTION
+	{
+		l3_cntx_set_t* set = bli_l3_cntx_set_create();
+
+		// Publish the new set only once it is complete, and retire the old
+		// one.
+		set = __atomic_exchange_n( &bli_l3_cntx_set_cur, set,
+		                           __ATOMIC_SEQ_CST );
+
+		set->next = bli_l3_cntx_set_retired;
+		__atomic_store_n( &bli_l3_cntx_set_retired, set, __ATOMIC_RELAXED );
+
+		bli_l3_cntx_set_reclaim();
+	}
+	// END CRITICAL SECTION
+
+#ifdef BLIS_ENABLE_PTHREADS
+	pthread_mutex_unlock( &bli_l3_cntx_set_mutex );
+#endif
+}
+
+void bli_l3_cntx_global_finalize( void )
+{
+	l3_cntx_set_t* set;
+
+	if ( bli_l3_cntx_global_is_init == FALSE ) return;
+
+	// No level-3 call may be in progress once BLIS is being finalized, so
+	// any retired sets that remain may be freed.
+	while ( bli_l3_cntx_set_retired != NULL )
+	{
+		set                     = bli_l3_cntx_set_retired;
+		bli_l3_cntx_set_retired = set->next;
+
+		bli_l3_cntx_set_free( set );
+	}
+
+	bli_l3_cntx_set_free( bli_l3_cntx_set_cur );
+	bli_l3_cntx_set_cur = NULL;
+
+	bli_l3_cntx_global_is_init = FALSE;
+}
+
+// -----------------------------------------------------------------------------
+
+// NOTE: The gemm and trsm queries initialize BLIS if the application has
+// not done so already, just as bli_memsys_reinit() initializes the memory
+// pools if needed. bli_init() returns at once if BLIS is initialized, and
+// otherwise performs (or waits for another thread to finish) the
+// initialization under its lock, so the set is never seen half-built.
+
+static l3_cntx_set_t* bli_l3_cntx_set_query( void )
+{
+	bli_init();
+
+	return __atomic_load_n( &bli_l3_cntx_set_cur, __ATOMIC_SEQ_CST );
+}
+
+void bli_l3_cntx_hold( void )
+{
+	__atomic_add_fetch( &bli_l3_cntx_set_holds, 1, __ATOMIC_SEQ_CST );
+}
+
+void bli_l3_cntx_release( void )
+{
+	if ( __atomic_sub_fetch( &bli_l3_cntx_set_holds, 1, __ATOMIC_SEQ_CST ) != 0 )
+		return;
+
+	// The last call to let go of the contexts frees any sets that were
+	// retired while it ran.
+	if ( __atomic_load_n( &bli_l3_cntx_set_retired, __ATOMIC_RELAXED ) == NULL )
+		return;
+
+#ifdef BLIS_ENABLE_OPENMP
+	_Pragma( "omp critical (l3_cntx)" )
+#endif
+#ifdef BLIS_ENABLE_PTHREADS
+	pthread_mutex_lock( &bli_l3_cntx_set_mutex );
+#endif
+
+	// BEGIN CRITICAL SECTION
+	{
+		bli_l3_cntx_set_reclaim();
+	}
+	// END CRITICAL SECTION
+
+#ifdef BLIS_ENABLE_PTHREADS
+	pthread_mutex_unlock( &bli_l3_cntx_set_mutex );
+#endif
+}
+
+const cntx_t* bli_l3_cntx_query_gemm( ind_t method, dim_t stage )
+{
+	return &bli_l3_cntx_set_query()->gemm[ method ][ stage ];
+}
+
+const cntx_t* bli_l3_cntx_query_trsm( ind_t method )
+{
+	return &bli_l3_cntx_set_query()->trsm[ method ];
+}
+
+const cntx_t* bli_l3_cntx_query_gemm_ukr_var( num_t dt, dim_t var )
+{
+	return &bli_l3_cntx_set_query()->gemm_ukrvar[ dt ][ var ];
+}
@@ -45,3 +45,23 @@ void PASTEMAC(opname,_cntx_finalize)( cntx_t* cntx );
 
 GENPROT( gemm )
 GENPROT( trsm )
+
+dim_t bli_gemm_cntx_select_ukr_var( obj_t* c, cntx_t* cntx );
+
+//
+// Prototype functions for the global contexts.
+//
+
+void          bli_l3_cntx_global_init( void );
+void          bli_l3_cntx_global_reinit( void );
+void          bli_l3_cntx_global_finalize( void );
+
+const cntx_t* bli_l3_cntx_query_gemm( ind_t method, dim_t stage );
+const cntx_t* bli_l3_cntx_query_trsm( ind_t method );
+const cntx_t* bli_l3_cntx_query_gemm_ukr_var( num_t dt, dim_t var );
+
+// A call that uses the global contexts brackets the queries and its use of
+// the contexts with these, so that sets replaced in the meantime are not
+// freed under it.
+void          bli_l3_cntx_hold( void );
+void          bli_l3_cntx_release( void );
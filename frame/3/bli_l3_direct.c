@@ -39,11 +39,11 @@ dir_t bli_l3_direct
        obj_t*  a,
        obj_t*  b,
        obj_t*  c,
-       cntx_t* cntx
+       rntm_t* rntm
      )
 {
 	// Query the operation family.
-	opid_t family = bli_cntx_family( cntx );
+	opid_t family = bli_rntm_family( rntm );
 
 	if      ( family == BLIS_GEMM ) return bli_gemm_direct( a, b, c );
 	else if ( family == BLIS_HERK ) return bli_herk_direct( a, b, c );
@@ -37,7 +37,7 @@ dir_t bli_l3_direct
        obj_t*  a,
        obj_t*  b,
        obj_t*  c,
-       cntx_t* cntx
+       rntm_t* rntm
      );
 
 // -----------------------------------------------------------------------------
@@ -0,0 +1,256 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+static l3model_t l3_model;
+static bool_t    l3_model_on = TRUE;
+
+static const l3model_t l3_model_def =
+{
+	{
+	  BLIS_DEFAULT_MODEL_GFLOPS_S, BLIS_DEFAULT_MODEL_GFLOPS_C,
+	  BLIS_DEFAULT_MODEL_GFLOPS_D, BLIS_DEFAULT_MODEL_GFLOPS_Z,
+	},
+	BLIS_DEFAULT_MODEL_PACK_GBPS,
+	BLIS_DEFAULT_MODEL_CALL_US,
+	BLIS_DEFAULT_MODEL_THREAD_US,
+	BLIS_DEFAULT_MODEL_BARRIER_US,
+	BLIS_DEFAULT_MODEL_SMALL_EFF,
+	BLIS_DEFAULT_MODEL_SMALL_CALL_US,
+};
+
+// -----------------------------------------------------------------------------
+
+void bli_l3_model_init( void )
+{
+	char* str = getenv( "BLIS_THREAD_MODEL" );
+
+	bli_l3_model_reset();
+
+	l3_model_on = ( str == NULL || atoi( str ) != 0 );
+}
+
+void bli_l3_model_finalize( void )
+{
+}
+
+void bli_l3_model_get( l3model_t* model )
+{
+	*model = l3_model;
+}
+
+void bli_l3_model_set( l3model_t* model )
+{
+	l3_model = *model;
+}
+
+void bli_l3_model_reset( void )
+{
+	l3_model = l3_model_def;
+}
+
+bool_t bli_l3_model_is_enabled( void )
+{
+	return l3_model_on;
+}
+
+void bli_l3_model_enable( void )
+{
+	l3_model_on = TRUE;
+}
+
+void bli_l3_model_disable( void )
+{
+	l3_model_on = FALSE;
+}
+
+// -----------------------------------------------------------------------------
+
+static dim_t bli_l3_model_cdiv( dim_t x, dim_t y )
+{
+	return ( x + y - 1 ) / y;
+}
+
+// The number of flops of an operation relative to a gemm with the same m, n
+// and k. Only one triangle of C is updated by herk and syrk, and only one
+// triangle of A is referenced by trmm and trsm.
+static double bli_l3_model_op_scale( opid_t l3_op )
+{
+	switch ( l3_op )
+	{
+		case BLIS_HERK:
+		case BLIS_SYRK:
+		case BLIS_TRMM:
+		case BLIS_TRMM3:
+		case BLIS_TRSM:  return 0.5;
+		default:         return 1.0;
+	}
+}
+
+static double bli_l3_model_flops( opid_t l3_op, num_t dt,
+                                  dim_t m, dim_t n, dim_t k )
+{
+	double flops = 2.0 * m * n * k * bli_l3_model_op_scale( l3_op );
+
+	return bli_is_complex( dt ) ? 4.0 * flops : flops;
+}
+
+double bli_l3_model_blocked_time( opid_t  l3_op,
+                                  num_t   dt,
+                                  dim_t   m,
+                                  dim_t   n,
+                                  dim_t   k,
+                                  dim_t   jc,
+                                  dim_t   ic,
+                                  dim_t   jr,
+                                  dim_t   ir,
+                                  cntx_t* cntx )
+{
+	dim_t  mr = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+	dim_t  nr = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+	dim_t  mc = bli_cntx_get_blksz_def_dt( dt, BLIS_MC, cntx );
+	dim_t  kc = bli_cntx_get_blksz_def_dt( dt, BLIS_KC, cntx );
+	dim_t  nc = bli_cntx_get_blksz_def_dt( dt, BLIS_NC, cntx );
+	dim_t  nt = jc * ic * jr * ir;
+	siz_t  elem_size = bli_datatype_size( dt );
+	dim_t  m_ic, n_jc, m_th, n_th, log_nt, n_iter;
+	double elems, barriers, t;
+
+	if ( m <= 0 || n <= 0 || k <= 0 ) return l3_model.call_us;
+
+	// The rows and columns of C updated by the slowest thread, which are
+	// whole micro-tiles.
+	m_ic = bli_l3_model_cdiv( m, ic );
+	n_jc = bli_l3_model_cdiv( n, jc );
+	m_th = bli_l3_model_cdiv( bli_l3_model_cdiv( m, mr ), ic * ir ) * mr;
+	n_th = bli_l3_model_cdiv( bli_l3_model_cdiv( n, nr ), jc * jr ) * nr;
+
+	t  = l3_model.call_us;
+	t += bli_l3_model_flops( l3_op, dt, m_th, n_th, k ) /
+	     ( 1.0e3 * l3_model.gflops[ dt ] );
+
+	// The panel of B of each jc group is packed by all of its threads, and
+	// the block of A of each ic group is packed by its threads once for each
+	// panel of B.
+	n_iter = bli_l3_model_cdiv( n_jc, nc );
+	elems  = ( double )k * n_jc / ( ic * jr * ir ) +
+	         ( double )k * m_ic * n_iter / ( jr * ir );
+
+	t += elems * elem_size / ( 1.0e3 * l3_model.pack_gbps );
+
+	if ( nt > 1 )
+	{
+		for ( log_nt = 0; ( ( dim_t )1 << log_nt ) < nt; ++log_nt ) ;
+
+		// Packing a block is preceded and followed by a barrier.
+		barriers = ( double )n_iter * bli_l3_model_cdiv( k, kc ) *
+		           ( 2 + 2 * bli_l3_model_cdiv( m_ic, mc ) );
+
+		t += ( nt - 1 ) * l3_model.thread_us;
+		t += barriers * log_nt * l3_model.barrier_us;
+	}
+
+	return t;
+}
+
+double bli_l3_model_small_time( opid_t  l3_op,
+                                num_t   dt,
+                                dim_t   m,
+                                dim_t   n,
+                                dim_t   k )
+{
+	return l3_model.small_call_us +
+	       bli_l3_model_flops( l3_op, dt, m, n, k ) /
+	       ( 1.0e3 * l3_model.gflops[ dt ] * l3_model.small_eff );
+}
+
+// -----------------------------------------------------------------------------
+
+dim_t bli_l3_model_select_nthread( opid_t  l3_op,
+                                   num_t   dt,
+                                   dim_t   nthread,
+                                   dim_t   m,
+                                   dim_t   n,
+                                   dim_t   k,
+                                   cntx_t* cntx )
+{
+	dim_t  best_nt = 1;
+	double best_t  = 0.0;
+	dim_t  nt;
+
+	for ( nt = 1; nt <= nthread; ++nt )
+	{
+		dim_t  jc, ic, jr, ir;
+		double t;
+
+		bli_partition_l3_loops( nt, m, n, &jc, &ic, &jr, &ir );
+
+		t = bli_l3_model_blocked_time( l3_op, dt, m, n, k,
+		                               jc, ic, jr, ir, cntx );
+
+		// Ties go to the smaller number of threads.
+		if ( nt == 1 || t < best_t )
+		{
+			best_nt = nt;
+			best_t  = t;
+		}
+	}
+
+	return best_nt;
+}
+
+bool_t bli_l3_model_prefers_small( opid_t  l3_op,
+                                   num_t   dt,
+                                   dim_t   nthread,
+                                   dim_t   m,
+                                   dim_t   n,
+                                   dim_t   k,
+                                   cntx_t* cntx )
+{
+#ifdef BLIS_SMALL_MATRIX_ENABLE
+	dim_t  nt, jc, ic, jr, ir;
+
+	nt = bli_l3_model_select_nthread( l3_op, dt, nthread, m, n, k, cntx );
+
+	bli_partition_l3_loops( nt, m, n, &jc, &ic, &jr, &ir );
+
+	return bli_l3_model_small_time( l3_op, dt, m, n, k ) <
+	       bli_l3_model_blocked_time( l3_op, dt, m, n, k,
+	                                  jc, ic, jr, ir, cntx );
+#else
+	return FALSE;
+#endif
+}
+
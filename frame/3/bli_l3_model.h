@@ -0,0 +1,125 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_L3_MODEL_H
+#define BLIS_L3_MODEL_H
+
+//
+// Level-3 cost model.
+//
+// Before each level-3 operation, the cost model estimates the time of the
+// call when executed by 1, 2, ..., n threads (with n given by
+// BLIS_NUM_THREADS or OMP_NUM_THREADS), each with the ways of parallelism
+// that bli_partition_l3_loops() would choose, and the operation runs with
+// the cheapest number of threads. It also estimates the time of the
+// configuration's small-matrix path (if any), which runs single-threaded
+// without packing. The model is bypassed if the ways of parallelism are
+// given explicitly (BLIS_JC_NT, etc.) or if BLIS_THREAD_MODEL is set to 0.
+//
+// The estimate for the blocked path with ways jc, ic, jr and ir is the sum
+//
+//   call_us                             fixed cost of a call
+//   flops / gflops[dt]                  the share of the slowest thread,
+//                                       including the edge micro-tiles
+//   bytes packed / pack_gbps            its share of packing A and B
+//   (nt - 1) * thread_us                starting and joining the threads
+//   barriers * log2(nt) * barrier_us    synchronization between the loops
+//
+// where the rates are per thread. The parameters default to the values of
+// the configuration (see bli_kernel_macro_defs.h) and may be replaced by
+// those measured by the calibration in test/tune, which are saved in the
+// tuning file (see bli_tune.h).
+//
+
+typedef struct
+{
+	double gflops[ BLIS_NUM_FP_TYPES ];
+	double pack_gbps;
+	double call_us;
+	double thread_us;
+	double barrier_us;
+	double small_eff;     // small-matrix path rate relative to gflops[dt]
+	double small_call_us;
+} l3model_t;
+
+void   bli_l3_model_init( void );
+void   bli_l3_model_finalize( void );
+
+void   bli_l3_model_get( l3model_t* model );
+void   bli_l3_model_set( l3model_t* model );
+void   bli_l3_model_reset( void );
+
+bool_t bli_l3_model_is_enabled( void );
+void   bli_l3_model_enable( void );
+void   bli_l3_model_disable( void );
+
+// Estimated times, in microseconds.
+double bli_l3_model_blocked_time( opid_t  l3_op,
+                                  num_t   dt,
+                                  dim_t   m,
+                                  dim_t   n,
+                                  dim_t   k,
+                                  dim_t   jc,
+                                  dim_t   ic,
+                                  dim_t   jr,
+                                  dim_t   ir,
+                                  cntx_t* cntx );
+double bli_l3_model_small_time( opid_t  l3_op,
+                                num_t   dt,
+                                dim_t   m,
+                                dim_t   n,
+                                dim_t   k );
+
+// Return the number of threads, at most nthread, with the cheapest estimate
+// for the blocked path.
+dim_t  bli_l3_model_select_nthread( opid_t  l3_op,
+                                    num_t   dt,
+                                    dim_t   nthread,
+                                    dim_t   m,
+                                    dim_t   n,
+                                    dim_t   k,
+                                    cntx_t* cntx );
+
+// Return TRUE if the configuration has a small-matrix path and it is
+// expected to be faster than the blocked path with up to nthread threads.
+bool_t bli_l3_model_prefers_small( opid_t  l3_op,
+                                   num_t   dt,
+                                   dim_t   nthread,
+                                   dim_t   m,
+                                   dim_t   n,
+                                   dim_t   k,
+                                   cntx_t* cntx );
+
+#endif
+
@@ -54,6 +54,9 @@ void PASTEMAC(opname,EX_SUF) \
      ) \
 { \
 	BLIS_OAPI_CNTX_DECL \
+\
+	/* Log the call, if enabled. */ \
+	vrec_t* vrec = bli_verbose_begin_l3( MKSTR(opname), '-', a, b, c ); \
 \
 	/* Invoke the operation's "ind" function--its induced method front-end.
 	   This function will call native execution for real domain problems.
@@ -69,6 +72,8 @@ void PASTEMAC(opname,EX_SUF) \
 	  c, \
 	  cntx  \
 	); \
+\
+	bli_verbose_end( vrec ); \
 }
 
 GENFRONT( gemm )
@@ -91,6 +96,9 @@ void PASTEMAC(opname,EX_SUF) \
      ) \
 { \
 	BLIS_OAPI_CNTX_DECL \
+\
+	/* Log the call, if enabled. */ \
+	vrec_t* vrec = bli_verbose_begin_l3( MKSTR(opname), bli_verbose_side_ch( side ), a, b, c ); \
 \
 	PASTEMAC(opname,ind) \
 	( \
@@ -102,6 +110,8 @@ void PASTEMAC(opname,EX_SUF) \
 	  c, \
 	  cntx  \
 	); \
+\
+	bli_verbose_end( vrec ); \
 }
 
 GENFRONT( hemm )
@@ -122,6 +132,9 @@ void PASTEMAC(opname,EX_SUF) \
      ) \
 { \
 	BLIS_OAPI_CNTX_DECL \
+\
+	/* Log the call, if enabled. */ \
+	vrec_t* vrec = bli_verbose_begin_l3( MKSTR(opname), '-', a, NULL, c ); \
 \
 	PASTEMAC(opname,ind) \
 	( \
@@ -131,6 +144,8 @@ void PASTEMAC(opname,EX_SUF) \
 	  c, \
 	  cntx  \
 	); \
+\
+	bli_verbose_end( vrec ); \
 }
 
 GENFRONT( herk )
@@ -150,6 +165,9 @@ void PASTEMAC(opname,EX_SUF) \
      ) \
 { \
 	BLIS_OAPI_CNTX_DECL \
+\
+	/* Log the call, if enabled. */ \
+	vrec_t* vrec = bli_verbose_begin_l3( MKSTR(opname), bli_verbose_side_ch( side ), a, b, NULL ); \
 \
 	PASTEMAC(opname,ind) \
 	( \
@@ -159,6 +177,8 @@ void PASTEMAC(opname,EX_SUF) \
 	  b, \
 	  cntx  \
 	); \
+\
+	bli_verbose_end( vrec ); \
 }
 
 GENFRONT( trmm )
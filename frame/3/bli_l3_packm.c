@@ -48,6 +48,16 @@ void bli_l3_packm
 	mem_t*    cntl_mem_p;
 	siz_t     size_needed;
 
+	// NOTE: The chief thread broadcasts the address of its local_mem_s,
+	// so it must remain in scope until the other threads have copied it.
+	mem_t*    local_mem_p;
+	mem_t     local_mem_s;
+
+	// Query the pack buffer type from the control tree node.
+	pack_buf_type = bli_cntl_packm_params_pack_buf_type( cntl );
+
+	bli_prof_begin( bli_l3_packm_prof_phase( pack_buf_type ) );
+
 	// FGVZ: Not sure why we need this barrier, but we do.
 	bli_thread_obarrier( thread );
 
@@ -66,14 +76,15 @@ void bli_l3_packm
 
 	// If zero was returned, no memory needs to be allocated and so we can
 	// return early.
-	if ( size_needed == 0 ) return;
+	if ( size_needed == 0 )
+	{
+		bli_prof_end( bli_l3_packm_prof_phase( pack_buf_type ) );
+		return;
+	}
 
 	// Query the memory broker from the context.
 	membrk = bli_cntx_get_membrk( cntx );
 
-	// Query the pack buffer type from the control tree node.
-	pack_buf_type = bli_cntl_packm_params_pack_buf_type( cntl );
-
 	// Query the address of the mem_t entry within the control tree node.
 	cntl_mem_p = bli_cntl_pack_mem( cntl );
 
@@ -82,9 +93,6 @@ void bli_l3_packm
 	// all threads in the chief's thread group.
 	if ( bli_mem_is_unalloc( cntl_mem_p ) )
 	{
-		mem_t* local_mem_p;
-		mem_t  local_mem_s;
-
 		if ( bli_thread_am_ochief( thread ) )
 		{
 			// The chief thread acquires a block from the memory broker
@@ -108,9 +116,6 @@ void bli_l3_packm
 	}
 	else // ( bli_mem_is_alloc( cntl_mem_p ) )
 	{
-		mem_t* local_mem_p;
-		mem_t  local_mem_s;
-
 		// If the mem_t entry in the control tree does NOT contain a NULL
 		// buffer, then a block has already been acquired from the memory
 		// broker and cached in the control tree.
@@ -157,6 +162,17 @@ void bli_l3_packm
 	}
 
 
+	// If the block is new to the pool and the memory broker left touching
+	// it to us, each thread of the group faults in its share of the pages
+	// so that they are placed near the threads that pack into them.
+	if ( bli_mem_is_new( cntl_mem_p ) )
+	{
+		bli_membrk_touch_part( cntl_mem_p,
+		                       bli_thread_ocomm_id( thread ),
+		                       bli_thread_num_threads( thread ) );
+		bli_mem_set_is_new( FALSE, cntl_mem_p );
+	}
+
 	// Update the buffer address in x_pack to point to the buffer associated
 	// with the mem_t entry acquired from the memory broker (now cached in
 	// the control tree node).
@@ -175,5 +191,7 @@ void bli_l3_packm
 
 	// Barrier so that packing is done before computation.
 	bli_thread_obarrier( thread );
+
+	bli_prof_end( bli_l3_packm_prof_phase( pack_buf_type ) );
 }
 
@@ -43,3 +43,11 @@ void bli_l3_packm
        thrinfo_t* thread
      );
 
+
+// The profiling phase of packing into a buffer of the given type.
+
+#define bli_l3_packm_prof_phase( pack_buf_type ) \
+\
+	( (pack_buf_type) == BLIS_BUFFER_FOR_B_PANEL ? BLIS_PROF_PACKM_B \
+	                                             : BLIS_PROF_PACKM_A )
+
@@ -65,6 +65,42 @@ void PASTEMAC(ch,opname) \
 \
 	dim_t       m_a, n_a; \
 	dim_t       m_b, n_b; \
+\
+	/* Small problems bypass the objects and the blocked algorithm, unless
+	   the caller supplied a context, which only the blocked algorithm
+	   honors. */ \
+	if ( cntx == NULL && bli_gemm_sup_is_eligible( ch, m, n, k ) ) \
+	{ \
+		if ( bli_error_checking_is_enabled() ) \
+			bli_gemm_sup_check \
+			( \
+			  transa, \
+			  transb, \
+			  m, \
+			  n, \
+			  k, \
+			  alpha, \
+			  a, rs_a, cs_a, \
+			  b, rs_b, cs_b, \
+			  beta, \
+			  c, rs_c, cs_c  \
+			); \
+\
+		PASTEMAC(ch,gemm_sup) \
+		( \
+		  transa, \
+		  transb, \
+		  m, \
+		  n, \
+		  k, \
+		  alpha, \
+		  a, rs_a, cs_a, \
+		  b, rs_b, cs_b, \
+		  beta, \
+		  c, rs_c, cs_c  \
+		); \
+		return; \
+	} \
 \
 	bli_set_dims_with_trans( transa, m, k, m_a, n_a ); \
 	bli_set_dims_with_trans( transb, k, n, m_b, n_b ); \
@@ -73,6 +73,7 @@ void bli_l3_thrinfo_init
 	  n_way,
 	  work_id,
 	  TRUE,
+	  NULL,
 	  sub_node
 	);
 }
@@ -122,7 +123,7 @@ void bli_l3_thrinfo_create_root
      (
        dim_t       id,
        thrcomm_t*  gl_comm,
-       cntx_t*     cntx,
+       rntm_t*     rntm,
        cntl_t*     cntl,
        thrinfo_t** thread
      )
@@ -136,12 +137,13 @@ void bli_l3_thrinfo_create_root
 	// Use the blocksize id of the current (root) control tree node to
 	// query the top-most ways of parallelism to obtain.
 	bszid_t bszid      = bli_cntl_bszid( cntl );
-	dim_t   xx_way     = bli_cntx_way_for_bszid( bszid, cntx );
+	dim_t   xx_way     = bli_rntm_way_for_bszid( bszid, rntm );
 
 	// Determine the work id for this thrinfo_t node.
 	dim_t   work_id    = gl_comm_id / ( n_threads / xx_way );
 
-	// Create the root thrinfo_t node.
+	// Create the root thrinfo_t node. Its descendants inherit the rntm_t
+	// as they are grown (see bli_thrinfo_create_for_cntl()).
 	*thread = bli_thrinfo_create
 	(
 	  gl_comm,
@@ -149,6 +151,7 @@ void bli_l3_thrinfo_create_root
 	  xx_way,
 	  work_id,
 	  TRUE,
+	  rntm,
 	  NULL
 	);
 }
@@ -230,6 +233,22 @@ jc_work_id, pc_work_id, pb_work_id, ic_work_id, pa_work_id, jr_work_id, ir_work_
 printf( "---------------------------------------\n" );
 	}
 
+	bli_l3_thrinfo_print_imbalance();
+}
+
+void bli_l3_thrinfo_print_imbalance
+     (
+       void
+     )
+{
+#ifdef BLIS_ENABLE_PROFILING
+	prof_imb_t imb;
+
+	// Print a one-line summary of how evenly the most recent level-3
+	// operation was spread across threads.
+	bli_prof_get_imbalance( &imb );
+	bli_prof_fprint_imbalance( stdout, &imb );
+#endif
 }
 
 // -----------------------------------------------------------------------------
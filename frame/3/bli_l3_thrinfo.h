@@ -98,7 +98,7 @@ void bli_l3_thrinfo_create_root
      (
        dim_t       id,
        thrcomm_t*  gl_comm,
-       cntx_t*     cntx,
+       rntm_t*     rntm,
        cntl_t*     cntl,
        thrinfo_t** thread
      );
@@ -108,6 +108,11 @@ void bli_l3_thrinfo_print_paths
        thrinfo_t** threads
      );
 
+void bli_l3_thrinfo_print_imbalance
+     (
+       void
+     );
+
 // -----------------------------------------------------------------------------
 
 #if 0
@@ -35,6 +35,7 @@
 #include "bli_gemm_cntl.h"
 #include "bli_gemm_front.h"
 #include "bli_gemm_int.h"
+#include "bli_gemm_sup.h"
 
 #include "bli_gemm_var.h"
 
@@ -47,15 +47,29 @@ void bli_gemm_front
      )
 {
 #ifdef BLIS_SMALL_MATRIX_ENABLE
-#ifndef BLIS_ENABLE_MULTITHREADING
-    gint_t status = bli_gemm_small_matrix(alpha, a, b, beta, c, cntx, cntl);
-    if(BLIS_SUCCESS != status)
+    gint_t status = BLIS_FAILURE;
+
+#ifdef BLIS_ENABLE_MULTITHREADING
+    // The small-matrix path is single-threaded, so it is taken only if the
+    // cost model expects it to beat the blocked path with the threads
+    // available.
+    if ( bli_l3_model_is_enabled() &&
+         bli_l3_model_prefers_small( BLIS_GEMM,
+                                     bli_obj_execution_datatype( *c ),
+                                     bli_env_read_nthread(),
+                                     bli_obj_length( *c ),
+                                     bli_obj_width( *c ),
+                                     bli_obj_width_after_trans( *a ),
+                                     cntx ) )
 #endif
+    status = bli_gemm_small_matrix(alpha, a, b, beta, c, cntx, cntl);
+    if(BLIS_SUCCESS != status)
 #endif
     {
 	    obj_t   a_local;
 	    obj_t   b_local;
 	    obj_t   c_local;
+	    rntm_t  rntm;
 
 	    // Check parameters.
 	    if ( bli_error_checking_is_enabled() )
@@ -90,14 +104,15 @@ void bli_gemm_front
 		    bli_obj_induce_trans( c_local );
 	    }
 
-	    // Set the operation family id in the context.
-	    bli_cntx_set_family( BLIS_GEMM, cntx );
+	    // Set the operation family id in the runtime object.
+	    bli_rntm_set_family( BLIS_GEMM, &rntm );
 
-	    // Record the threading for each level within the context.
-	    bli_cntx_set_thrloop_from_env( BLIS_GEMM, BLIS_LEFT, cntx,
-                                       bli_obj_length( c_local ),
-                                       bli_obj_width( c_local ),
-                                       bli_obj_width( a_local ) );
+	    // Record the threading for each level within the runtime object.
+	    bli_rntm_set_ways_from_env( BLIS_GEMM, BLIS_LEFT,
+                                    bli_obj_execution_datatype( c_local ), cntx,
+                                    bli_obj_length( c_local ),
+                                    bli_obj_width( c_local ),
+                                    bli_obj_width( a_local ), &rntm );
 
 	    // Invoke the internal back-end via the thread handler.
 	    bli_l3_thread_decorator
@@ -109,6 +124,7 @@ void bli_gemm_front
 	      beta,
 	      &c_local,
 	      cntx,
+	      &rntm,
 	      cntl
 	    );
     }
@@ -102,7 +102,7 @@ void bli_gemm_int
 	}
 
 	// Create the next node in the thrinfo_t structure.
-	bli_thrinfo_grow( cntx, cntl, thread );
+	bli_thrinfo_grow( cntl, thread );
 
 	// Extract the function pointer from the current control tree node.
 	f = bli_cntl_var_func( cntl );
@@ -120,6 +120,8 @@ void bli_gemm_int
 	}
 
 	// Invoke the variant.
+	bli_prof_push_level( bli_l3_cntl_prof_level( cntl ) );
+	bli_prof_begin( bli_l3_cntl_prof_phase( cntl ) );
 	f
 	(
 	  &a_local,
@@ -129,5 +131,7 @@ void bli_gemm_int
 	  cntl,
       thread
 	);
+	bli_prof_end( bli_l3_cntl_prof_phase( cntl ) );
+	bli_prof_pop_level();
 }
 
@@ -292,6 +292,7 @@ void PASTEMAC(ch,varname) \
 			/* Handle interior and edge cases separately. */ \
 			if ( m_cur == MR && n_cur == NR ) \
 			{ \
+				bli_prof_count_ukr(); \
 				/* Invoke the gemm micro-kernel. */ \
 				gemm_ukr \
 				( \
@@ -307,6 +308,9 @@ void PASTEMAC(ch,varname) \
 			} \
 			else \
 			{ \
+				bli_prof_begin( BLIS_PROF_L3_KER_EDGE ); \
+\
+				bli_prof_count_ukr(); \
 				/* Invoke the gemm micro-kernel. */ \
 				gemm_ukr \
 				( \
@@ -325,6 +329,8 @@ void PASTEMAC(ch,varname) \
 				                        ct,  rs_ct, cs_ct, \
 				                        beta_cast, \
 				                        c11, rs_c,  cs_c ); \
+\
+				bli_prof_end( BLIS_PROF_L3_KER_EDGE ); \
 			} \
 		} \
 	} \
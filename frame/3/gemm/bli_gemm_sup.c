@@ -0,0 +1,201 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  b, inc_t rs_b, inc_t cs_b, \
+       ctype*  beta, \
+       ctype*  c, inc_t rs_c, inc_t cs_c  \
+     ) \
+{ \
+	conj_t conja = bli_extract_conj( transa ); \
+	conj_t conjb = bli_extract_conj( transb ); \
+\
+	if ( bli_zero_dim2( m, n ) ) return; \
+\
+	/* If the product vanishes, A and B are not referenced and C is only
+	   scaled by beta. */ \
+	if ( k == 0 || PASTEMAC(ch,eq0)( *alpha ) ) \
+	{ \
+		if ( PASTEMAC(ch,eq0)( *beta ) ) \
+			PASTEMAC(ch,setm)( BLIS_NO_CONJUGATE, 0, BLIS_NONUNIT_DIAG, \
+			                   BLIS_DENSE, m, n, beta, c, rs_c, cs_c, NULL ); \
+		else \
+			PASTEMAC(ch,scalm)( BLIS_NO_CONJUGATE, 0, BLIS_NONUNIT_DIAG, \
+			                    BLIS_DENSE, m, n, beta, c, rs_c, cs_c, NULL ); \
+		return; \
+	} \
+\
+	/* Express op(A) and op(B) through their strides. */ \
+	if ( bli_does_trans( transa ) ) bli_swap_incs( rs_a, cs_a ); \
+	if ( bli_does_trans( transb ) ) bli_swap_incs( rs_b, cs_b ); \
+\
+	/* The kernels read columns of A with unit stride and broadcast
+	   elements of B. If only B^T offers that layout (or A and B tie and
+	   only C^T is column-stored), compute C^T = B^T A^T instead. */ \
+	if ( ( rs_a != 1 && cs_b == 1 ) || \
+	     ( ( rs_a == 1 ) == ( cs_b == 1 ) && rs_c != 1 && cs_c == 1 ) ) \
+	{ \
+		ctype* t = a; a = b; b = t; \
+\
+		inc_t  rs_t = rs_a; inc_t cs_t = cs_a; \
+		rs_a = cs_b; cs_a = rs_b; \
+		rs_b = cs_t; cs_b = rs_t; \
+\
+		bli_swap_incs( rs_c, cs_c ); \
+		bli_swap_dims( m, n ); \
+\
+		conj_t conjt = conja; conja = conjb; conjb = conjt; \
+	} \
+\
+	/* Square problems within the tiny range have a kernel generated for
+	   their size. */ \
+	if ( bli_gemm_tiny_is_eligible( ch, m, n, k ) ) \
+	{ \
+		PASTEMAC(ch,gemmtiny_ker_query)( m ) \
+		( \
+		  conja, \
+		  conjb, \
+		  alpha, \
+		  a, rs_a, cs_a, \
+		  b, rs_b, cs_b, \
+		  beta, \
+		  c, rs_c, cs_c  \
+		); \
+		return; \
+	} \
+\
+	PASTEMAC(ch,gemmsup_ker_name) \
+	( \
+	  conja, \
+	  conjb, \
+	  m, \
+	  n, \
+	  k, \
+	  alpha, \
+	  a, rs_a, cs_a, \
+	  b, rs_b, cs_b, \
+	  beta, \
+	  c, rs_c, cs_c  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC0( gemm_sup )
+
+
+// -----------------------------------------------------------------------------
+
+// As bli_check_object_buffer(), for a buffer that is not wrapped in an
+// object.
+static err_t bli_gemm_sup_check_buffer( void* p, dim_t m, dim_t n )
+{
+	err_t e_val = BLIS_SUCCESS;
+
+	if ( p == NULL )
+	if ( m > 0 && n > 0 )
+		e_val = BLIS_EXPECTED_NONNULL_OBJECT_BUFFER;
+
+	return e_val;
+}
+
+void bli_gemm_sup_check
+     (
+       trans_t transa,
+       trans_t transb,
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       void*   alpha,
+       void*   a, inc_t rs_a, inc_t cs_a,
+       void*   b, inc_t rs_b, inc_t cs_b,
+       void*   beta,
+       void*   c, inc_t rs_c, inc_t cs_c
+     )
+{
+	err_t e_val;
+	dim_t m_a, n_a;
+	dim_t m_b, n_b;
+
+	// Check the transposition parameters.
+
+	e_val = bli_check_valid_trans( transa );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_valid_trans( transb );
+	bli_check_error_code( e_val );
+
+	// Check the dimensions and strides of the matrices, as they would be
+	// checked when attached to objects.
+
+	bli_set_dims_with_trans( transa, m, k, m_a, n_a );
+	bli_set_dims_with_trans( transb, k, n, m_b, n_b );
+
+	e_val = bli_check_matrix_strides( m_a, n_a, rs_a, cs_a, 1 );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_matrix_strides( m_b, n_b, rs_b, cs_b, 1 );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_matrix_strides( m, n, rs_c, cs_c, 1 );
+	bli_check_error_code( e_val );
+
+	// Check the buffers (for non-NULLness).
+
+	e_val = bli_gemm_sup_check_buffer( alpha, 1, 1 );
+	bli_check_error_code( e_val );
+
+	e_val = bli_gemm_sup_check_buffer( a, m_a, n_a );
+	bli_check_error_code( e_val );
+
+	e_val = bli_gemm_sup_check_buffer( b, m_b, n_b );
+	bli_check_error_code( e_val );
+
+	e_val = bli_gemm_sup_check_buffer( beta, 1, 1 );
+	bli_check_error_code( e_val );
+
+	e_val = bli_gemm_sup_check_buffer( c, m, n );
+	bli_check_error_code( e_val );
+}
@@ -0,0 +1,221 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+// -- gemmsup ------------------------------------------------------------------
+
+// Small gemm problems spend most of their time in the object and context
+// setup of the blocked algorithm rather than in arithmetic. The typed and
+// BLAS APIs send problems whose m, n and k are all no larger than the
+// threshold below directly to a gemmsup kernel, which computes C from the
+// user's buffers without packing. The defaults suit the reference kernel;
+// a configuration that registers an optimized gemmsup kernel in its
+// bli_kernel.h sets the threshold for that datatype there as well. A
+// threshold of 0 disables the path.
+
+#ifndef BLIS_SGEMMSUP_MAX
+#define BLIS_SGEMMSUP_MAX  12
+#endif
+
+#ifndef BLIS_DGEMMSUP_MAX
+#define BLIS_DGEMMSUP_MAX  12
+#endif
+
+#ifndef BLIS_CGEMMSUP_MAX
+#define BLIS_CGEMMSUP_MAX  12
+#endif
+
+#ifndef BLIS_ZGEMMSUP_MAX
+#define BLIS_ZGEMMSUP_MAX  12
+#endif
+
+#define bli_sgemmsup_max   BLIS_SGEMMSUP_MAX
+#define bli_dgemmsup_max   BLIS_DGEMMSUP_MAX
+#define bli_cgemmsup_max   BLIS_CGEMMSUP_MAX
+#define bli_zgemmsup_max   BLIS_ZGEMMSUP_MAX
+
+// -- gemmtiny -----------------------------------------------------------------
+
+// Square problems with m = n = k between 2 and BLIS_GEMMTINY_SIZE_MAX have
+// a kernel generated for their exact size, whose loops the compiler can
+// unroll completely. The gemmsup driver uses these kernels instead of the
+// gemmsup kernel for sizes up to the threshold below. As with gemmsup, a
+// configuration with an optimized gemmsup kernel may lower the threshold
+// in its bli_kernel.h, and a threshold of 0 disables the tiny kernels.
+
+#define BLIS_GEMMTINY_SIZE_MAX  16
+
+#ifndef BLIS_SGEMMTINY_MAX
+#define BLIS_SGEMMTINY_MAX  BLIS_GEMMTINY_SIZE_MAX
+#endif
+
+#ifndef BLIS_DGEMMTINY_MAX
+#define BLIS_DGEMMTINY_MAX  BLIS_GEMMTINY_SIZE_MAX
+#endif
+
+#ifndef BLIS_CGEMMTINY_MAX
+#define BLIS_CGEMMTINY_MAX  BLIS_GEMMTINY_SIZE_MAX
+#endif
+
+#ifndef BLIS_ZGEMMTINY_MAX
+#define BLIS_ZGEMMTINY_MAX  BLIS_GEMMTINY_SIZE_MAX
+#endif
+
+#if BLIS_SGEMMTINY_MAX > BLIS_GEMMTINY_SIZE_MAX || \
+    BLIS_DGEMMTINY_MAX > BLIS_GEMMTINY_SIZE_MAX || \
+    BLIS_CGEMMTINY_MAX > BLIS_GEMMTINY_SIZE_MAX || \
+    BLIS_ZGEMMTINY_MAX > BLIS_GEMMTINY_SIZE_MAX
+  #error "BLIS_?GEMMTINY_MAX may not exceed BLIS_GEMMTINY_SIZE_MAX."
+#endif
+
+#define bli_sgemmtiny_max  BLIS_SGEMMTINY_MAX
+#define bli_dgemmtiny_max  BLIS_DGEMMTINY_MAX
+#define bli_cgemmtiny_max  BLIS_CGEMMTINY_MAX
+#define bli_zgemmtiny_max  BLIS_ZGEMMTINY_MAX
+
+#define bli_gemm_tiny_is_eligible( ch, m, n, k ) \
+\
+	( (m) == (n) && (n) == (k) && \
+	  2 <= (m) && (m) <= PASTEMAC(ch,gemmtiny_max) )
+
+// Verbose mode records every level-3 call at the object API, so the
+// gemmsup path steps aside while it is enabled.
+
+#define bli_gemm_sup_is_eligible( ch, m, n, k ) \
+\
+	( ( ( (m) <= PASTEMAC(ch,gemmsup_max) && \
+	      (n) <= PASTEMAC(ch,gemmsup_max) && \
+	      (k) <= PASTEMAC(ch,gemmsup_max) ) || \
+	    bli_gemm_tiny_is_eligible( ch, m, n, k ) ) && \
+	  !bli_verbose_on )
+
+
+//
+// Prototype the typed gemmsup driver.
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  b, inc_t rs_b, inc_t cs_b, \
+       ctype*  beta, \
+       ctype*  c, inc_t rs_c, inc_t cs_c  \
+     );
+
+INSERT_GENTPROT_BASIC( gemm_sup )
+
+// Check the parameters of a gemmsup call. The typed API calls this in
+// place of the checks that the object API would otherwise perform.
+void bli_gemm_sup_check
+     (
+       trans_t transa,
+       trans_t transb,
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       void*   alpha,
+       void*   a, inc_t rs_a, inc_t cs_a,
+       void*   b, inc_t rs_b, inc_t cs_b,
+       void*   beta,
+       void*   c, inc_t rs_c, inc_t cs_c
+     );
+
+
+//
+// Prototype the gemmsup kernels. A kernel computes
+//
+//   C := beta * C + alpha * conja(A) * conjb(B)
+//
+// for an m x k matrix A and a k x n matrix B with arbitrary strides. The
+// kernels may assume that m, n and k are positive.
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       conj_t           conja, \
+       conj_t           conjb, \
+       dim_t            m, \
+       dim_t            n, \
+       dim_t            k, \
+       ctype*  restrict alpha, \
+       ctype*  restrict a, inc_t rs_a, inc_t cs_a, \
+       ctype*  restrict b, inc_t rs_b, inc_t cs_b, \
+       ctype*  restrict beta, \
+       ctype*  restrict c, inc_t rs_c, inc_t cs_c  \
+     );
+
+INSERT_GENTPROT_BASIC( gemmsup_ker_name )
+INSERT_GENTPROT_BASIC( gemmsup_ref )
+
+
+//
+// Define the tiny gemm kernel function type and prototype the query that
+// returns the kernel for a given size. The kernels compute the same update
+// as the gemmsup kernels with m, n and k all equal to that size.
+//
+
+#undef  GENTDEF
+#define GENTDEF( ctype, ch, opname, tsuf ) \
+\
+typedef void (*PASTECH2(ch,opname,tsuf)) \
+     ( \
+       conj_t           conja, \
+       conj_t           conjb, \
+       ctype*  restrict alpha, \
+       ctype*  restrict a, inc_t rs_a, inc_t cs_a, \
+       ctype*  restrict b, inc_t rs_b, inc_t cs_b, \
+       ctype*  restrict beta, \
+       ctype*  restrict c, inc_t rs_c, inc_t cs_c  \
+     );
+
+INSERT_GENTDEF( gemmtiny )
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, opname ) \
+\
+PASTECH2(ch,gemmtiny,_ft) PASTEMAC(ch,opname)( dim_t size );
+
+INSERT_GENTPROT_BASIC( gemmtiny_ker_query )
+
@@ -317,6 +317,7 @@ void PASTEMAC(ch,varname) \
 			/* Handle interior and edge cases separately. */ \
 			if ( m_cur == MR && n_cur == NR ) \
 			{ \
+				bli_prof_count_ukr(); \
 				/* Invoke the gemm micro-kernel. */ \
 				gemm_ukr \
 				( \
@@ -332,6 +333,7 @@ void PASTEMAC(ch,varname) \
 			} \
 			else \
 			{ \
+				bli_prof_count_ukr(); \
 				/* Invoke the gemm micro-kernel. */ \
 				gemm_ukr \
 				( \
@@ -309,6 +309,7 @@ void PASTEMAC(ch,varname) \
 			if ( m_cur == MR && n_cur == NR ) \
 			{ \
 /*PASTEMAC(ch,fprintm)( stdout, "gemm_ker_var3 (4m1b): c before", 8, 6, c11, rs_c, cs_c, "%4.1f", "" );*/ \
+				bli_prof_count_ukr(); \
 				/* Invoke the gemm micro-kernel. */ \
 				gemm_ukr \
 				( \
@@ -325,6 +326,7 @@ void PASTEMAC(ch,varname) \
 			} \
 			else \
 			{ \
+				bli_prof_count_ukr(); \
 				/* Invoke the gemm micro-kernel. */ \
 				gemm_ukr \
 				( \
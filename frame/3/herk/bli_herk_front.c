@@ -47,6 +47,7 @@ void bli_herk_front
 	obj_t   a_local;
 	obj_t   ah_local;
 	obj_t   c_local;
+	rntm_t  rntm;
 
 	// Check parameters.
 	if ( bli_error_checking_is_enabled() )
@@ -87,14 +88,15 @@ void bli_herk_front
 		bli_obj_induce_trans( c_local );
 	}
 
-	// Set the operation family id in the context.
-	bli_cntx_set_family( BLIS_HERK, cntx );
+	// Set the operation family id in the runtime object.
+	bli_rntm_set_family( BLIS_HERK, &rntm );
 
-	// Record the threading for each level within the context.
-	bli_cntx_set_thrloop_from_env( BLIS_HERK, BLIS_LEFT, cntx,
-                                   bli_obj_length( c_local ),
-                                   bli_obj_width( c_local ),
-                                   bli_obj_width( a_local ) );
+	// Record the threading for each level within the runtime object.
+	bli_rntm_set_ways_from_env( BLIS_HERK, BLIS_LEFT,
+                                bli_obj_execution_datatype( c_local ), cntx,
+                                bli_obj_length( c_local ),
+                                bli_obj_width( c_local ),
+                                bli_obj_width( a_local ), &rntm );
 
 	// Invoke the internal back-end.
 	bli_l3_thread_decorator
@@ -106,6 +108,7 @@ void bli_herk_front
 	  beta,
 	  &c_local,
 	  cntx,
+	  &rntm,
 	  cntl
 	);
 
@@ -335,6 +335,7 @@ void PASTEMAC(ch,varname) \
 			   continue. */ \
 			if ( bli_intersects_diag_n( diagoffc_ij, m_cur, n_cur ) ) \
 			{ \
+				bli_prof_count_ukr(); \
 				/* Invoke the gemm micro-kernel. */ \
 				gemm_ukr \
 				( \
@@ -360,6 +361,7 @@ void PASTEMAC(ch,varname) \
 				/* Handle interior and edge cases separately. */ \
 				if ( m_cur == MR && n_cur == NR ) \
 				{ \
+					bli_prof_count_ukr(); \
 					/* Invoke the gemm micro-kernel. */ \
 					gemm_ukr \
 					( \
@@ -375,6 +377,7 @@ void PASTEMAC(ch,varname) \
 				} \
 				else \
 				{ \
+					bli_prof_count_ukr(); \
 					/* Invoke the gemm micro-kernel. */ \
 					gemm_ukr \
 					( \
@@ -50,6 +50,7 @@ void bli_syr2k_front
 	obj_t    bt_local;
 	obj_t    b_local;
 	obj_t    at_local;
+	rntm_t   rntm;
 
 	// Check parameters.
 	if ( bli_error_checking_is_enabled() )
@@ -88,14 +89,15 @@ void bli_syr2k_front
 		bli_obj_induce_trans( c_local );
 	}
 
-	// Set the operation family id in the context.
-	bli_cntx_set_family( BLIS_HERK, cntx );
+	// Set the operation family id in the runtime object.
+	bli_rntm_set_family( BLIS_HERK, &rntm );
 
-	// Record the threading for each level within the context.
-	bli_cntx_set_thrloop_from_env( BLIS_SYR2K, BLIS_LEFT, cntx,
-                                   bli_obj_length( c_local ),
-                                   bli_obj_width( c_local ),
-                                   bli_obj_width( a_local ) );
+	// Record the threading for each level within the runtime object.
+	bli_rntm_set_ways_from_env( BLIS_SYR2K, BLIS_LEFT,
+                                bli_obj_execution_datatype( c_local ), cntx,
+                                bli_obj_length( c_local ),
+                                bli_obj_width( c_local ),
+                                bli_obj_width( a_local ), &rntm );
 
 	// Invoke herk twice, using beta only the first time.
 
@@ -109,6 +111,7 @@ void bli_syr2k_front
 	  beta,
 	  &c_local,
 	  cntx,
+	  &rntm,
 	  cntl
 	);
 
@@ -121,6 +124,7 @@ void bli_syr2k_front
 	  &BLIS_ONE,
 	  &c_local,
 	  cntx,
+	  &rntm,
 	  cntl
 	);
 }
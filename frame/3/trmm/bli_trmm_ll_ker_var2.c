@@ -390,6 +390,7 @@ void PASTEMAC(ch,varname) \
 				/* Handle interior and edge cases separately. */ \
 				if ( m_cur == MR && n_cur == NR ) \
 				{ \
+					bli_prof_count_ukr(); \
 					/* Invoke the gemm micro-kernel. */ \
 					gemm_ukr \
 					( \
@@ -410,6 +411,7 @@ void PASTEMAC(ch,varname) \
 					                        c11, rs_c,  cs_c, \
 					                        ct,  rs_ct, cs_ct ); \
 \
+					bli_prof_count_ukr(); \
 					/* Invoke the gemm micro-kernel. */ \
 					gemm_ukr \
 					( \
@@ -460,6 +462,7 @@ void PASTEMAC(ch,varname) \
 				/* Handle interior and edge cases separately. */ \
 				if ( m_cur == MR && n_cur == NR ) \
 				{ \
+					bli_prof_count_ukr(); \
 					/* Invoke the gemm micro-kernel. */ \
 					gemm_ukr \
 					( \
@@ -475,6 +478,7 @@ void PASTEMAC(ch,varname) \
 				} \
 				else \
 				{ \
+					bli_prof_count_ukr(); \
 					/* Invoke the gemm micro-kernel. */ \
 					gemm_ukr \
 					( \
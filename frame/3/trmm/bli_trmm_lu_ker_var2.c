@@ -397,6 +397,7 @@ void PASTEMAC(ch,varname) \
 				/* Handle interior and edge cases separately. */ \
 				if ( m_cur == MR && n_cur == NR ) \
 				{ \
+					bli_prof_count_ukr(); \
 					/* Invoke the gemm micro-kernel. */ \
 					gemm_ukr \
 					( \
@@ -417,6 +418,7 @@ void PASTEMAC(ch,varname) \
 					                        c11, rs_c,  cs_c, \
 					                        ct,  rs_ct, cs_ct ); \
 \
+					bli_prof_count_ukr(); \
 					/* Invoke the gemm micro-kernel. */ \
 					gemm_ukr \
 					( \
@@ -467,6 +469,7 @@ void PASTEMAC(ch,varname) \
 				/* Handle interior and edge cases separately. */ \
 				if ( m_cur == MR && n_cur == NR ) \
 				{ \
+					bli_prof_count_ukr(); \
 					/* Invoke the gemm micro-kernel. */ \
 					gemm_ukr \
 					( \
@@ -482,6 +485,7 @@ void PASTEMAC(ch,varname) \
 				} \
 				else \
 				{ \
+					bli_prof_count_ukr(); \
 					/* Invoke the gemm micro-kernel. */ \
 					gemm_ukr \
 					( \
@@ -397,6 +397,7 @@ void PASTEMAC(ch,varname) \
 				/* Handle interior and edge cases separately. */ \
 				if ( m_cur == MR && n_cur == NR ) \
 				{ \
+					bli_prof_count_ukr(); \
 					/* Invoke the gemm micro-kernel. */ \
 					gemm_ukr \
 					( \
@@ -417,6 +418,7 @@ void PASTEMAC(ch,varname) \
 					                        c11, rs_c,  cs_c, \
 					                        ct,  rs_ct, cs_ct ); \
 \
+					bli_prof_count_ukr(); \
 					/* Invoke the gemm micro-kernel. */ \
 					gemm_ukr \
 					( \
@@ -479,6 +481,7 @@ void PASTEMAC(ch,varname) \
 				/* Handle interior and edge cases separately. */ \
 				if ( m_cur == MR && n_cur == NR ) \
 				{ \
+					bli_prof_count_ukr(); \
 					/* Invoke the gemm micro-kernel. */ \
 					gemm_ukr \
 					( \
@@ -494,6 +497,7 @@ void PASTEMAC(ch,varname) \
 				} \
 				else \
 				{ \
+					bli_prof_count_ukr(); \
 					/* Invoke the gemm micro-kernel. */ \
 					gemm_ukr \
 					( \
@@ -49,6 +49,7 @@ void bli_trmm3_front
 	obj_t   a_local;
 	obj_t   b_local;
 	obj_t   c_local;
+	rntm_t  rntm;
 
 	// Check parameters.
 	if ( bli_error_checking_is_enabled() )
@@ -130,14 +131,15 @@ void bli_trmm3_front
 	bli_obj_set_as_root( b_local );
 	bli_obj_set_as_root( c_local );
 
-	// Set the operation family id in the context.
-	bli_cntx_set_family( BLIS_TRMM, cntx );
+	// Set the operation family id in the runtime object.
+	bli_rntm_set_family( BLIS_TRMM, &rntm );
 
-	// Record the threading for each level within the context.
-	bli_cntx_set_thrloop_from_env( BLIS_TRMM3, side, cntx,
-                                   bli_obj_length( c_local ),
-                                   bli_obj_width( c_local ),
-                                   bli_obj_width( a_local ) );
+	// Record the threading for each level within the runtime object.
+	bli_rntm_set_ways_from_env( BLIS_TRMM3, side,
+                                bli_obj_execution_datatype( c_local ), cntx,
+                                bli_obj_length( c_local ),
+                                bli_obj_width( c_local ),
+                                bli_obj_width( a_local ), &rntm );
 
 	// Invoke the internal back-end.
 	bli_l3_thread_decorator
@@ -149,6 +151,7 @@ void bli_trmm3_front
 	  beta,
 	  &c_local,
 	  cntx,
+	  &rntm,
 	  cntl
 	);
 }
@@ -46,6 +46,8 @@ void bli_trsm_blk_var1
 {
 	obj_t a1, c1;
 
+	rntm_t* rntm = bli_thrinfo_rntm( thread );
+
 	dir_t direct;
 
 	dim_t i;
@@ -53,10 +55,10 @@ void bli_trsm_blk_var1
 	dim_t my_start, my_end;
 
 	// Determine the direction in which to partition (forwards or backwards).
-	direct = bli_l3_direct( a, b, c, cntx );
+	direct = bli_l3_direct( a, b, c, rntm );
 
 	// Prune any zero region that exists along the partitioning dimension.
-	bli_l3_prune_unref_mparts_m( a, b, c, cntx );
+	bli_l3_prune_unref_mparts_m( a, b, c, rntm );
 
 	// Determine the current thread's subpartition range.
 	bli_thread_get_range_mdim
@@ -70,7 +72,7 @@ void bli_trsm_blk_var1
 	{
 		// Determine the current algorithmic blocksize.
 		b_alg = bli_determine_blocksize( direct, i, my_end, a,
-		                                 bli_cntl_bszid( cntl ), cntx );
+		                                 bli_cntl_bszid( cntl ), cntx, rntm );
 
 		// Acquire partitions for A1 and C1.
 		bli_acquire_mpart_mdim( direct, BLIS_SUBPART1,
@@ -46,6 +46,8 @@ void bli_trsm_blk_var2
 {
 	obj_t b1, c1;
 
+	rntm_t* rntm = bli_thrinfo_rntm( thread );
+
 	dir_t direct;
 
 	dim_t i;
@@ -53,10 +55,10 @@ void bli_trsm_blk_var2
 	dim_t my_start, my_end;
 
 	// Determine the direction in which to partition (forwards or backwards).
-	direct = bli_l3_direct( a, b, c, cntx );
+	direct = bli_l3_direct( a, b, c, rntm );
 
 	// Prune any zero region that exists along the partitioning dimension.
-	bli_l3_prune_unref_mparts_n( a, b, c, cntx );
+	bli_l3_prune_unref_mparts_n( a, b, c, rntm );
 
 	// Determine the current thread's subpartition range.
 	bli_thread_get_range_ndim
@@ -70,7 +72,7 @@ void bli_trsm_blk_var2
 	{
 		// Determine the current algorithmic blocksize.
 		b_alg = bli_determine_blocksize( direct, i, my_end, b,
-		                                 bli_cntl_bszid( cntl ), cntx );
+		                                 bli_cntl_bszid( cntl ), cntx, rntm );
 
 		// Acquire partitions for B1 and C1.
 		bli_acquire_mpart_ndim( direct, BLIS_SUBPART1,
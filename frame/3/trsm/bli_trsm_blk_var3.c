@@ -46,6 +46,8 @@ void bli_trsm_blk_var3
 {
 	obj_t a1, b1;
 
+	rntm_t* rntm = bli_thrinfo_rntm( thread );
+
 	dir_t direct;
 
 	dim_t i;
@@ -53,10 +55,10 @@ void bli_trsm_blk_var3
 	dim_t k_trans;
 
 	// Determine the direction in which to partition (forwards or backwards).
-	direct = bli_l3_direct( a, b, c, cntx );
+	direct = bli_l3_direct( a, b, c, rntm );
 
 	// Prune any zero region that exists along the partitioning dimension.
-	bli_l3_prune_unref_mparts_k( a, b, c, cntx );
+	bli_l3_prune_unref_mparts_k( a, b, c, rntm );
 
 	// Query dimension in partitioning direction.
 	k_trans = bli_obj_width_after_trans( *a );
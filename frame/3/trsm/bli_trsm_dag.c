@@ -0,0 +1,569 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+//
+// This file implements a lookahead variant of trsm that is driven by a
+// small task DAG over the KC x KC diagonal blocks of the triangular matrix.
+// bli_trsm_front() reduces all parameter cases to a left-side solve with
+// a non-transposed triangular matrix A, so we only consider that case here.
+// The k dimension of A is partitioned (in the same direction and with the
+// same blocksizes as bli_trsm_blk_var3()) into diagonal blocks A(p,p),
+// and B into the corresponding row panels B(p). Three tasks are defined for
+// each diagonal block p:
+//
+//   SOLVE(p):  B(p)    := inv( A(p,p) ) * B(p)
+//   NEXT(p):   B(p+1)  := B(p+1)  - A(p+1,p)  * B(p)
+//   REST(p):   B(p+2:) := B(p+2:) - A(p+2:,p) * B(p)
+//
+// with the dependencies
+//
+//   SOLVE(p) <- NEXT(p-1)
+//   NEXT(p)  <- SOLVE(p), REST(p-1)
+//   REST(p)  <- SOLVE(p), REST(p-1)
+//
+// The threads are split into two groups. The (small) panel group executes
+// the SOLVE tasks with the conventional trsm control tree (var2, var3, var1
+// and the trsm macro-kernels), parallelized along jc and jr. The update
+// group executes the NEXT and REST tasks, which are plain gemm subproblems,
+// and so they may be parallelized along jc, ic, and jr. Since SOLVE(p+1)
+// waits only on NEXT(p), the panel solve of the next diagonal block proceeds
+// concurrently with the bulk of the trailing update, REST(p).
+//
+
+typedef enum
+{
+	BLIS_TRSM_DAG_SOLVE = 0,
+	BLIS_TRSM_DAG_NEXT,
+	BLIS_TRSM_DAG_REST
+} trsm_dag_op_t;
+
+#define BLIS_TRSM_DAG_NUM_OPS  3
+#define BLIS_TRSM_DAG_MAX_DEPS 2
+
+#define BLIS_TRSM_DAG_PANEL    0
+#define BLIS_TRSM_DAG_UPDATE   1
+
+#define bli_trsm_dag_task_id( op, p ) \
+\
+	( BLIS_TRSM_DAG_NUM_OPS * (p) + (op) )
+
+typedef struct trsm_task_s
+{
+	dim_t           n_deps;
+	dim_t           deps[ BLIS_TRSM_DAG_MAX_DEPS ];
+
+	// The rows of B updated by the task, in units relative to the
+	// direction of movement.
+	dim_t           off;
+	dim_t           dim;
+
+	// The completion flag (a 32-bit word so that it can serve as a futex),
+	// and the number of threads sleeping on it.
+	uint32_t        done;
+	uint32_t        waiters;
+} trsm_task_t;
+
+typedef struct trsm_dag_s
+{
+	dir_t        direct;
+
+	dim_t        n_blk;
+	dim_t*       blk_off;
+	trsm_task_t* tasks;
+
+	// The group communicators and the runtime objects used by each group.
+	// The runtime objects differ from the caller's only in the ways of
+	// parallelism (and, for the update group, the operation family).
+	thrcomm_t*   comms[ 2 ];
+	rntm_t       rntms[ 2 ];
+	dim_t        n_pan;
+} trsm_dag_t;
+
+static bool_t bli_trsm_dag_on = TRUE;
+
+// -----------------------------------------------------------------------------
+
+void bli_trsm_dag_init( void )
+{
+	char* str = getenv( "BLIS_TRSM_DAG" );
+
+	bli_trsm_dag_on = ( str == NULL || atoi( str ) != 0 );
+}
+
+void bli_trsm_dag_enable( void )
+{
+	bli_trsm_dag_on = TRUE;
+}
+
+void bli_trsm_dag_disable( void )
+{
+	bli_trsm_dag_on = FALSE;
+}
+
+// -----------------------------------------------------------------------------
+
+cntl_t* bli_trsm_dag_cntl_create
+     (
+       void
+     )
+{
+	// The DAG is executed from a single control tree node. The sub-trees
+	// used by each group are created locally by bli_trsm_dag_int(). Note
+	// that BLIS_NC is needed only so that the thread decorator can create
+	// the root thrinfo_t node.
+	return bli_cntl_obj_create( BLIS_NC, bli_trsm_dag_int, NULL, NULL );
+}
+
+void bli_trsm_dag_cntl_free
+     (
+       cntl_t* cntl
+     )
+{
+	bli_cntl_obj_free( cntl );
+}
+
+// -----------------------------------------------------------------------------
+
+bool_t bli_trsm_dag_is_enabled
+     (
+       obj_t*  a,
+       obj_t*  b,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       cntl_t* cntl
+     )
+{
+	num_t dt = bli_obj_execution_datatype( *a );
+	dim_t k  = bli_obj_width_after_trans( *a );
+	dim_t kc = bli_cntx_get_blksz_def_dt( dt, BLIS_KC, cntx );
+
+	// The DAG needs at least two threads (one per group), and at least two
+	// diagonal blocks for there to be anything to overlap. It pays for
+	// itself only above the thresholds in bli_trsm_dag.h. Induced methods
+	// and user-supplied control trees use the conventional implementation.
+	if ( !bli_trsm_dag_on ) return FALSE;
+	if ( bli_rntm_get_num_threads( rntm ) <
+	     bli_max( 2, BLIS_TRSM_DAG_MIN_THREADS ) ) return FALSE;
+	if ( bli_cntx_get_ind_method( cntx ) != BLIS_NAT ) return FALSE;
+	if ( cntl != NULL ) return FALSE;
+	if ( k <= bli_max( 1, BLIS_TRSM_DAG_MIN_BLOCKS - 1 ) * kc ) return FALSE;
+	if ( bli_obj_width( *b ) == 0 ) return FALSE;
+
+	return TRUE;
+}
+
+// -----------------------------------------------------------------------------
+
+static void bli_trsm_dag_set_task
+     (
+       trsm_dag_t*   dag,
+       trsm_dag_op_t op,
+       dim_t         p,
+       dim_t         off,
+       dim_t         dim,
+       dim_t         n_deps,
+       dim_t         dep0,
+       dim_t         dep1
+     )
+{
+	trsm_task_t* task = &dag->tasks[ bli_trsm_dag_task_id( op, p ) ];
+
+	task->n_deps  = n_deps;
+	task->deps[0] = dep0;
+	task->deps[1] = dep1;
+	task->off     = off;
+	task->dim     = dim;
+
+	// Tasks with no work (ie: the updates following the last diagonal
+	// blocks) are complete from the start.
+	task->done    = ( dim == 0 );
+	task->waiters = 0;
+}
+
+static trsm_dag_t* bli_trsm_dag_create
+     (
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       dim_t   n_threads
+     )
+{
+	trsm_dag_t* dag = bli_malloc_intl( sizeof( trsm_dag_t ) );
+
+	num_t       dt  = bli_obj_execution_datatype( *a );
+	dim_t       k   = bli_obj_width_after_trans( *a );
+	dim_t       n   = bli_obj_width( *c );
+	dim_t       kc  = bli_cntx_get_blksz_def_dt( dt, BLIS_KC, cntx );
+	dim_t       i, p, b_alg;
+	dim_t       n_upd;
+	dim_t       jc, ic, jr, ir;
+
+	// Determine the direction in which to partition, just as
+	// bli_trsm_blk_var3() would.
+	dag->direct = bli_l3_direct( a, b, c, rntm );
+
+	// Count the diagonal blocks, and then record their offsets. Note that
+	// blk_off[ n_blk ] == k.
+	for ( i = 0, dag->n_blk = 0; i < k; i += b_alg, ++dag->n_blk )
+		b_alg = bli_trsm_determine_kc( dag->direct, i, k, a, b,
+		                               BLIS_KC, cntx );
+
+	dag->blk_off = bli_malloc_intl( ( dag->n_blk + 1 ) * sizeof( dim_t ) );
+
+	for ( i = 0, p = 0; i < k; i += b_alg, ++p )
+	{
+		b_alg = bli_trsm_determine_kc( dag->direct, i, k, a, b,
+		                               BLIS_KC, cntx );
+		dag->blk_off[ p ] = i;
+	}
+	dag->blk_off[ dag->n_blk ] = k;
+
+	// Build the task DAG.
+	dag->tasks = bli_malloc_intl( BLIS_TRSM_DAG_NUM_OPS * dag->n_blk *
+	                              sizeof( trsm_task_t ) );
+
+	for ( p = 0; p < dag->n_blk; ++p )
+	{
+		dim_t* off      = dag->blk_off;
+		dim_t  n_blk    = dag->n_blk;
+		dim_t  off_next = ( p + 1 < n_blk ? off[ p + 1 ] : k );
+		dim_t  off_rest = ( p + 2 < n_blk ? off[ p + 2 ] : k );
+		dim_t  solve_p  = bli_trsm_dag_task_id( BLIS_TRSM_DAG_SOLVE, p );
+		dim_t  next_pm1 = bli_trsm_dag_task_id( BLIS_TRSM_DAG_NEXT, p - 1 );
+		dim_t  rest_pm1 = bli_trsm_dag_task_id( BLIS_TRSM_DAG_REST, p - 1 );
+
+		if ( p == 0 )
+		{
+			bli_trsm_dag_set_task( dag, BLIS_TRSM_DAG_SOLVE, p,
+			                       off[ p ], off[ p + 1 ] - off[ p ],
+			                       0, 0, 0 );
+			bli_trsm_dag_set_task( dag, BLIS_TRSM_DAG_NEXT, p,
+			                       off_next, off_rest - off_next,
+			                       1, solve_p, 0 );
+			bli_trsm_dag_set_task( dag, BLIS_TRSM_DAG_REST, p,
+			                       off_rest, k - off_rest,
+			                       1, solve_p, 0 );
+		}
+		else
+		{
+			bli_trsm_dag_set_task( dag, BLIS_TRSM_DAG_SOLVE, p,
+			                       off[ p ], off[ p + 1 ] - off[ p ],
+			                       1, next_pm1, 0 );
+			bli_trsm_dag_set_task( dag, BLIS_TRSM_DAG_NEXT, p,
+			                       off_next, off_rest - off_next,
+			                       2, solve_p, rest_pm1 );
+			bli_trsm_dag_set_task( dag, BLIS_TRSM_DAG_REST, p,
+			                       off_rest, k - off_rest,
+			                       2, solve_p, rest_pm1 );
+		}
+	}
+
+	// Size the panel group in proportion to the ratio of panel solve flops
+	// to trailing update flops (roughly kc:k), keeping at least one thread
+	// in each group.
+	dag->n_pan = ( n_threads * kc + k - 1 ) / k;
+	dag->n_pan = bli_max( dag->n_pan, 1 );
+	dag->n_pan = bli_min( dag->n_pan, n_threads - 1 );
+	n_upd      = n_threads - dag->n_pan;
+
+	dag->comms[ BLIS_TRSM_DAG_PANEL  ] = bli_thrcomm_create( dag->n_pan );
+	dag->comms[ BLIS_TRSM_DAG_UPDATE ] = bli_thrcomm_create( n_upd );
+
+	// The panel group solves kc x n subproblems, which may only be
+	// parallelized along jc and jr (see bli_rntm_set_ways_from_env()).
+	dag->rntms[ BLIS_TRSM_DAG_PANEL ] = *rntm;
+	bli_partition_l3_loops( dag->n_pan, kc, n, &jc, &ic, &jr, &ir );
+	bli_rntm_set_thrloop( jc, 1, 1, ic * jr * ir, 1,
+	                      &dag->rntms[ BLIS_TRSM_DAG_PANEL ] );
+
+	// The update group performs gemm subproblems of roughly (k-kc) x n.
+	dag->rntms[ BLIS_TRSM_DAG_UPDATE ] = *rntm;
+	bli_rntm_set_family( BLIS_GEMM, &dag->rntms[ BLIS_TRSM_DAG_UPDATE ] );
+	bli_partition_l3_loops( n_upd, k - kc, n, &jc, &ic, &jr, &ir );
+	bli_rntm_set_thrloop( jc, 1, ic, jr, ir,
+	                      &dag->rntms[ BLIS_TRSM_DAG_UPDATE ] );
+
+	// Size NC for the jc ways of each group.
+	bli_cache_rntm_adjust_nc( &dag->rntms[ BLIS_TRSM_DAG_PANEL  ], cntx );
+	bli_cache_rntm_adjust_nc( &dag->rntms[ BLIS_TRSM_DAG_UPDATE ], cntx );
+
+	return dag;
+}
+
+static void bli_trsm_dag_free
+     (
+       trsm_dag_t* dag
+     )
+{
+	// NOTE: The group communicators are freed along with the groups'
+	// thrinfo_t trees.
+	bli_free_intl( dag->tasks );
+	bli_free_intl( dag->blk_off );
+	bli_free_intl( dag );
+}
+
+// -----------------------------------------------------------------------------
+
+static void bli_trsm_dag_wait
+     (
+       trsm_dag_t*  dag,
+       trsm_task_t* task
+     )
+{
+	dim_t i;
+
+	// Each task's flag goes from zero to one when it completes. Reaching
+	// one makes the results of the task visible to the waiting thread.
+	for ( i = 0; i < task->n_deps; ++i )
+	{
+		trsm_task_t* dep = &dag->tasks[ task->deps[i] ];
+
+		bli_thrcomm_wait_until( &dep->done, &dep->waiters, 1 );
+	}
+}
+
+static void bli_trsm_dag_signal
+     (
+       trsm_task_t* task,
+       thrinfo_t*   thread
+     )
+{
+	// All threads in the group must have finished their share of the task
+	// before the chief marks it as complete.
+	bli_thread_obarrier( thread );
+
+	if ( bli_thread_am_ochief( thread ) )
+	{
+		// Advancing the flag releases the task's results to the threads
+		// that wait on it (see bli_trsm_dag_wait()).
+		bli_thrcomm_advance( &task->done, &task->waiters );
+	}
+}
+
+static void bli_trsm_dag_solve
+     (
+       trsm_dag_t* dag,
+       dim_t       p,
+       obj_t*      alpha,
+       obj_t*      a,
+       obj_t*      b,
+       obj_t*      c,
+       cntx_t*     cntx,
+       cntl_t*     cntl,
+       thrinfo_t*  thread
+     )
+{
+	trsm_task_t* task   = &dag->tasks[ bli_trsm_dag_task_id( BLIS_TRSM_DAG_SOLVE, p ) ];
+	dir_t        direct = dag->direct;
+	obj_t*       alpha_p;
+	obj_t        a1, a11, b1, c1;
+
+	bli_trsm_dag_wait( dag, task );
+
+	// Acquire the diagonal block A(p,p) and the row panels of B and C.
+	bli_acquire_mpart_ndim( direct, BLIS_SUBPART1,
+	                        task->off, task->dim, a, &a1 );
+	bli_acquire_mpart_mdim( direct, BLIS_SUBPART1,
+	                        task->off, task->dim, &a1, &a11 );
+	bli_acquire_mpart_mdim( direct, BLIS_SUBPART1,
+	                        task->off, task->dim, b, &b1 );
+	bli_acquire_mpart_mdim( direct, BLIS_SUBPART1,
+	                        task->off, task->dim, c, &c1 );
+
+	// Only the first solve applies alpha. The remaining panels of B are
+	// scaled by the first trailing update.
+	alpha_p = ( p == 0 ? alpha : &BLIS_ONE );
+
+	bli_trsm_int
+	(
+	  alpha_p,
+	  &a11,
+	  &b1,
+	  alpha_p,
+	  &c1,
+	  cntx,
+	  cntl,
+	  thread
+	);
+
+	bli_trsm_dag_signal( task, thread );
+}
+
+static void bli_trsm_dag_update
+     (
+       trsm_dag_t*   dag,
+       trsm_dag_op_t op,
+       dim_t         p,
+       obj_t*        alpha,
+       obj_t*        a,
+       obj_t*        b,
+       obj_t*        c,
+       cntx_t*       cntx,
+       cntl_t*       cntl,
+       thrinfo_t*    thread
+     )
+{
+	trsm_task_t* task   = &dag->tasks[ bli_trsm_dag_task_id( op, p ) ];
+	dir_t        direct = dag->direct;
+	dim_t        off_p  = dag->blk_off[ p ];
+	dim_t        dim_p  = dag->blk_off[ p + 1 ] - off_p;
+	obj_t*       beta_p;
+	obj_t        a1, a21, b1, c2;
+
+	// Skip tasks with no work (they were marked as complete when the DAG
+	// was built).
+	if ( task->dim == 0 ) return;
+
+	bli_trsm_dag_wait( dag, task );
+
+	// Acquire A(q,p), where q is the range of rows updated by the task,
+	// the (already solved) row panel B(p), and the rows of C to update.
+	bli_acquire_mpart_ndim( direct, BLIS_SUBPART1,
+	                        off_p, dim_p, a, &a1 );
+	bli_acquire_mpart_mdim( direct, BLIS_SUBPART1,
+	                        task->off, task->dim, &a1, &a21 );
+	bli_acquire_mpart_mdim( direct, BLIS_SUBPART1,
+	                        off_p, dim_p, b, &b1 );
+	bli_acquire_mpart_mdim( direct, BLIS_SUBPART1,
+	                        task->off, task->dim, c, &c2 );
+
+	// A(q,p) lies entirely within the stored region of A, so it may be
+	// treated as a general matrix by the gemm subproblem.
+	bli_obj_set_struc( BLIS_GENERAL, a21 );
+	bli_obj_set_uplo( BLIS_DENSE, a21 );
+
+	// The first update of each row panel of C also applies alpha.
+	beta_p = ( p == 0 ? alpha : &BLIS_ONE );
+
+	bli_gemm_int
+	(
+	  &BLIS_MINUS_ONE,
+	  &a21,
+	  &b1,
+	  beta_p,
+	  &c2,
+	  cntx,
+	  cntl,
+	  thread
+	);
+
+	bli_trsm_dag_signal( task, thread );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_trsm_dag_int
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       cntl_t* cntl,
+       thrinfo_t* thread
+     )
+{
+	dim_t       n_threads = bli_thread_num_threads( thread );
+	dim_t       id        = bli_thread_ocomm_id( thread );
+	trsm_dag_t* dag       = NULL;
+
+	dim_t       group;
+	dim_t       group_id;
+	rntm_t*     rntm_g;
+	cntl_t*     cntl_g;
+	thrinfo_t*  thread_g;
+	dim_t       p;
+
+	// The chief builds the DAG (and the group communicators) and shares
+	// it with the other threads.
+	if ( bli_thread_am_ochief( thread ) )
+		dag = bli_trsm_dag_create( a, b, c, cntx,
+		                           bli_thrinfo_rntm( thread ), n_threads );
+
+	dag = bli_thread_obroadcast( thread, dag );
+
+	// The first n_pan threads form the panel group; the rest form the
+	// update group.
+	if ( id < dag->n_pan ) { group = BLIS_TRSM_DAG_PANEL;  group_id = id; }
+	else                   { group = BLIS_TRSM_DAG_UPDATE; group_id = id - dag->n_pan; }
+
+	rntm_g = &dag->rntms[ group ];
+
+	// Create the control tree for this group's subproblems along with the
+	// root of the group's thrinfo_t tree.
+	if ( group == BLIS_TRSM_DAG_PANEL ) cntl_g = bli_trsm_cntl_create( BLIS_LEFT );
+	else                                cntl_g = bli_gemm_cntl_create( BLIS_GEMM );
+
+	bli_l3_thrinfo_create_root( group_id, dag->comms[ group ],
+	                            rntm_g, cntl_g, &thread_g );
+
+	// Execute this group's tasks in order. The panel group performs the
+	// solves while the update group performs the trailing updates, with
+	// the updates of the next diagonal block prioritized over those of the
+	// rest of the matrix.
+	for ( p = 0; p < dag->n_blk; ++p )
+	{
+		if ( group == BLIS_TRSM_DAG_PANEL )
+		{
+			bli_trsm_dag_solve( dag, p, alpha, a, b, c,
+			                    cntx, cntl_g, thread_g );
+		}
+		else
+		{
+			bli_trsm_dag_update( dag, BLIS_TRSM_DAG_NEXT, p, alpha, a, b, c,
+			                     cntx, cntl_g, thread_g );
+			bli_trsm_dag_update( dag, BLIS_TRSM_DAG_REST, p, alpha, a, b, c,
+			                     cntx, cntl_g, thread_g );
+		}
+	}
+
+	// Free the group's control tree and thrinfo_t tree (including the
+	// group's communicator).
+	if ( group == BLIS_TRSM_DAG_PANEL ) bli_trsm_cntl_free( cntl_g, thread_g );
+	else                                bli_gemm_cntl_free( cntl_g, thread_g );
+
+	bli_l3_thrinfo_free( thread_g );
+
+	// Wait for both groups to finish before the chief frees the DAG.
+	bli_thread_obarrier( thread );
+
+	if ( bli_thread_am_ochief( thread ) )
+		bli_trsm_dag_free( dag );
+}
+
@@ -0,0 +1,84 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+// The DAG is used only when the triangular matrix spans at least
+// BLIS_TRSM_DAG_MIN_BLOCKS diagonal blocks of size KC, and the problem runs
+// with at least BLIS_TRSM_DAG_MIN_THREADS threads (and never fewer than
+// two). With fewer blocks, too little of the update overlaps the next
+// solve to repay splitting the threads into two groups. Setting
+// BLIS_TRSM_DAG to 0 in the environment disables the DAG altogether.
+#ifndef BLIS_TRSM_DAG_MIN_BLOCKS
+#define BLIS_TRSM_DAG_MIN_BLOCKS   3
+#endif
+
+#ifndef BLIS_TRSM_DAG_MIN_THREADS
+#define BLIS_TRSM_DAG_MIN_THREADS  2
+#endif
+
+void bli_trsm_dag_init( void );
+
+void bli_trsm_dag_enable( void );
+void bli_trsm_dag_disable( void );
+
+cntl_t* bli_trsm_dag_cntl_create
+     (
+       void
+     );
+
+void bli_trsm_dag_cntl_free
+     (
+       cntl_t* cntl
+     );
+
+bool_t bli_trsm_dag_is_enabled
+     (
+       obj_t*  a,
+       obj_t*  b,
+       cntx_t* cntx,
+       rntm_t* rntm,
+       cntl_t* cntl
+     );
+
+void bli_trsm_dag_int
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       cntl_t* cntl,
+       thrinfo_t* thread
+     );
+
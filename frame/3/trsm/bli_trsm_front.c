@@ -47,6 +47,7 @@ void bli_trsm_front
 	obj_t   a_local;
 	obj_t   b_local;
 	obj_t   c_local;
+	rntm_t  rntm;
 
 	// Check parameters.
 	if ( bli_error_checking_is_enabled() )
@@ -122,14 +123,40 @@ void bli_trsm_front
 	bli_obj_set_as_root( b_local );
 	bli_obj_set_as_root( c_local );
 
-	// Set the operation family id in the context.
-	bli_cntx_set_family( BLIS_TRSM, cntx );
+	// Set the operation family id in the runtime object.
+	bli_rntm_set_family( BLIS_TRSM, &rntm );
 
-	// Record the threading for each level within the context.
-	bli_cntx_set_thrloop_from_env( BLIS_TRSM, side, cntx,
-                                   bli_obj_length( c_local ),
-                                   bli_obj_width( c_local ),
-                                   bli_obj_width( a_local ) );
+	// Record the threading for each level within the runtime object.
+	bli_rntm_set_ways_from_env( BLIS_TRSM, side,
+                                bli_obj_execution_datatype( c_local ), cntx,
+                                bli_obj_length( c_local ),
+                                bli_obj_width( c_local ),
+                                bli_obj_width( a_local ), &rntm );
+
+	// If the problem is large enough and we have threads to spare, use the
+	// lookahead implementation, which overlaps the solves with diagonal
+	// blocks with the trailing updates.
+	if ( bli_trsm_dag_is_enabled( &a_local, &c_local, cntx, &rntm, cntl ) )
+	{
+		cntl_t* cntl_dag = bli_trsm_dag_cntl_create();
+
+		bli_l3_thread_decorator
+		(
+		  bli_trsm_dag_int,
+		  alpha,
+		  &a_local,
+		  &b_local,
+		  alpha,
+		  &c_local,
+		  cntx,
+		  &rntm,
+		  cntl_dag
+		);
+
+		bli_trsm_dag_cntl_free( cntl_dag );
+
+		return;
+	}
 
 	// Invoke the internal back-end.
 	bli_l3_thread_decorator
@@ -141,6 +168,7 @@ void bli_trsm_front
 	  alpha,
 	  &c_local,
 	  cntx,
+	  &rntm,
 	  cntl
 	);
 }
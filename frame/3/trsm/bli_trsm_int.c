@@ -118,12 +118,14 @@ void bli_trsm_int
 	bli_thread_obarrier( thread );
 
 	// Create the next node in the thrinfo_t structure.
-	bli_thrinfo_grow( cntx, cntl, thread );
+	bli_thrinfo_grow( cntl, thread );
 
 	// Extract the function pointer from the current control tree node.
 	f = bli_cntl_var_func( cntl );
 
 	// Invoke the variant.
+	bli_prof_push_level( bli_l3_cntl_prof_level( cntl ) );
+	bli_prof_begin( bli_l3_cntl_prof_phase( cntl ) );
 	f
 	(
 	  &a_local,
@@ -133,5 +135,7 @@ void bli_trsm_int
 	  cntl,
 	  thread
 	);
+	bli_prof_end( bli_l3_cntl_prof_phase( cntl ) );
+	bli_prof_pop_level();
 }
 
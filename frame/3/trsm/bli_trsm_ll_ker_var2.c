@@ -421,6 +421,7 @@ void PASTEMAC(ch,varname) \
 				/* Handle interior and edge cases separately. */ \
 				if ( m_cur == MR && n_cur == NR ) \
 				{ \
+					bli_prof_count_ukr(); \
 					/* Invoke the fused gemm/trsm micro-kernel. */ \
 					gemmtrsm_ukr \
 					( \
@@ -437,6 +438,7 @@ void PASTEMAC(ch,varname) \
 				} \
 				else \
 				{ \
+					bli_prof_count_ukr(); \
 					/* Invoke the fused gemm/trsm micro-kernel. */ \
 					gemmtrsm_ukr \
 					( \
@@ -486,6 +488,7 @@ void PASTEMAC(ch,varname) \
 				/* Handle interior and edge cases separately. */ \
 				if ( m_cur == MR && n_cur == NR ) \
 				{ \
+					bli_prof_count_ukr(); \
 					/* Invoke the gemm micro-kernel. */ \
 					gemm_ukr \
 					( \
@@ -501,6 +504,7 @@ void PASTEMAC(ch,varname) \
 				} \
 				else \
 				{ \
+					bli_prof_count_ukr(); \
 					/* Invoke the gemm micro-kernel. */ \
 					gemm_ukr \
 					( \
@@ -0,0 +1,139 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// The register blocksizes of the reference gemmsup kernel. Each MR x NR
+// tile of C is accumulated in local scalars, which the compiler is expected
+// to keep in registers since the loops over MR and NR have constant bounds.
+#define BLIS_GEMMSUP_REF_MR 4
+#define BLIS_GEMMSUP_REF_NR 4
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       conj_t           conja, \
+       conj_t           conjb, \
+       dim_t            m, \
+       dim_t            n, \
+       dim_t            k, \
+       ctype*  restrict alpha, \
+       ctype*  restrict a, inc_t rs_a, inc_t cs_a, \
+       ctype*  restrict b, inc_t rs_b, inc_t cs_b, \
+       ctype*  restrict beta, \
+       ctype*  restrict c, inc_t rs_c, inc_t cs_c  \
+     ) \
+{ \
+	const dim_t mr = BLIS_GEMMSUP_REF_MR; \
+	const dim_t nr = BLIS_GEMMSUP_REF_NR; \
+\
+	const bool_t beta_is_zero = PASTEMAC(ch,eq0)( *beta ); \
+\
+	ctype        ab[ BLIS_GEMMSUP_REF_MR * BLIS_GEMMSUP_REF_NR ]; \
+	ctype        ap, bp; \
+	dim_t        i, j, ii, jj, l; \
+\
+	for ( j = 0; j < n; j += nr ) \
+	{ \
+		const dim_t n_cur = bli_min( nr, n - j ); \
+\
+		for ( i = 0; i < m; i += mr ) \
+		{ \
+			const dim_t m_cur = bli_min( mr, m - i ); \
+\
+			ctype* restrict a_i = a + i*rs_a; \
+			ctype* restrict b_j = b + j*cs_b; \
+			ctype* restrict c_ij = c + i*rs_c + j*cs_c; \
+\
+			for ( ii = 0; ii < mr * nr; ++ii ) \
+				PASTEMAC(ch,set0s)( ab[ ii ] ); \
+\
+			if ( m_cur == mr && n_cur == nr ) \
+			{ \
+				/* Full tiles: constant trip counts. */ \
+				for ( l = 0; l < k; ++l ) \
+				{ \
+					for ( jj = 0; jj < nr; ++jj ) \
+					{ \
+						PASTEMAC(ch,copycjs)( conjb, *(b_j + l*rs_b + jj*cs_b), bp ); \
+\
+						for ( ii = 0; ii < mr; ++ii ) \
+						{ \
+							PASTEMAC(ch,copycjs)( conja, *(a_i + ii*rs_a + l*cs_a), ap ); \
+							PASTEMAC(ch,dots)( ap, bp, ab[ ii + jj*mr ] ); \
+						} \
+					} \
+				} \
+			} \
+			else \
+			{ \
+				/* Edge tiles. */ \
+				for ( l = 0; l < k; ++l ) \
+				{ \
+					for ( jj = 0; jj < n_cur; ++jj ) \
+					{ \
+						PASTEMAC(ch,copycjs)( conjb, *(b_j + l*rs_b + jj*cs_b), bp ); \
+\
+						for ( ii = 0; ii < m_cur; ++ii ) \
+						{ \
+							PASTEMAC(ch,copycjs)( conja, *(a_i + ii*rs_a + l*cs_a), ap ); \
+							PASTEMAC(ch,dots)( ap, bp, ab[ ii + jj*mr ] ); \
+						} \
+					} \
+				} \
+			} \
+\
+			/* Update the tile of C, overwriting it if beta is zero. */ \
+			for ( jj = 0; jj < n_cur; ++jj ) \
+			for ( ii = 0; ii < m_cur; ++ii ) \
+			{ \
+				ctype* restrict cij = c_ij + ii*rs_c + jj*cs_c; \
+\
+				if ( beta_is_zero ) \
+				{ \
+					PASTEMAC(ch,scal2s)( *alpha, ab[ ii + jj*mr ], *cij ); \
+				} \
+				else \
+				{ \
+					PASTEMAC(ch,axpbys)( *alpha, ab[ ii + jj*mr ], *beta, *cij ); \
+				} \
+			} \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( gemmsup_ref )
+
@@ -0,0 +1,169 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// The tiny gemm kernels compute C := beta * C + alpha * conja(A) * conjb(B)
+// for square operands of a size fixed at compile time. All loops have
+// constant trip counts, so the compiler can unroll them completely and keep
+// the accumulators in registers where they fit.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, sz ) \
+\
+static void PASTEMAC2(ch,opname,sz) \
+     ( \
+       conj_t           conja, \
+       conj_t           conjb, \
+       ctype*  restrict alpha, \
+       ctype*  restrict a, inc_t rs_a, inc_t cs_a, \
+       ctype*  restrict b, inc_t rs_b, inc_t cs_b, \
+       ctype*  restrict beta, \
+       ctype*  restrict c, inc_t rs_c, inc_t cs_c  \
+     ) \
+{ \
+	ctype ab[ sz ]; \
+	ctype ap, bp; \
+	dim_t i, j, l; \
+	bool_t unit = ( rs_a == 1 && rs_c == 1 && !bli_is_conj( conja ) ); \
+\
+	/* Compute one column of the product at a time. When A and C are
+	   stored by columns, the column loops are written with unit stride
+	   so that the compiler can vectorize them. */ \
+	for ( j = 0; j < sz; ++j ) \
+	{ \
+		for ( i = 0; i < sz; ++i ) \
+			PASTEMAC(ch,set0s)( ab[ i ] ); \
+\
+		if ( unit ) \
+		{ \
+			for ( l = 0; l < sz; ++l ) \
+			{ \
+				PASTEMAC(ch,copycjs)( conjb, b[ l*rs_b + j*cs_b ], bp ); \
+\
+				for ( i = 0; i < sz; ++i ) \
+					PASTEMAC(ch,dots)( a[ i + l*cs_a ], bp, ab[ i ] ); \
+			} \
+\
+			if ( PASTEMAC(ch,eq0)( *beta ) ) \
+			{ \
+				for ( i = 0; i < sz; ++i ) \
+					PASTEMAC(ch,scal2s)( *alpha, ab[ i ], c[ i + j*cs_c ] ); \
+			} \
+			else \
+			{ \
+				for ( i = 0; i < sz; ++i ) \
+					PASTEMAC(ch,axpbys)( *alpha, ab[ i ], *beta, c[ i + j*cs_c ] ); \
+			} \
+		} \
+		else \
+		{ \
+			for ( l = 0; l < sz; ++l ) \
+			{ \
+				PASTEMAC(ch,copycjs)( conjb, b[ l*rs_b + j*cs_b ], bp ); \
+\
+				for ( i = 0; i < sz; ++i ) \
+				{ \
+					PASTEMAC(ch,copycjs)( conja, a[ i*rs_a + l*cs_a ], ap ); \
+					PASTEMAC(ch,dots)( ap, bp, ab[ i ] ); \
+				} \
+			} \
+\
+			/* Overwrite C if beta is zero. */ \
+			if ( PASTEMAC(ch,eq0)( *beta ) ) \
+			{ \
+				for ( i = 0; i < sz; ++i ) \
+					PASTEMAC(ch,scal2s)( *alpha, ab[ i ], c[ i*rs_c + j*cs_c ] ); \
+			} \
+			else \
+			{ \
+				for ( i = 0; i < sz; ++i ) \
+					PASTEMAC(ch,axpbys)( *alpha, ab[ i ], *beta, c[ i*rs_c + j*cs_c ] ); \
+			} \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC( gemmtiny_ref_, 2 )
+INSERT_GENTFUNC_BASIC( gemmtiny_ref_, 3 )
+INSERT_GENTFUNC_BASIC( gemmtiny_ref_, 4 )
+INSERT_GENTFUNC_BASIC( gemmtiny_ref_, 5 )
+INSERT_GENTFUNC_BASIC( gemmtiny_ref_, 6 )
+INSERT_GENTFUNC_BASIC( gemmtiny_ref_, 7 )
+INSERT_GENTFUNC_BASIC( gemmtiny_ref_, 8 )
+INSERT_GENTFUNC_BASIC( gemmtiny_ref_, 9 )
+INSERT_GENTFUNC_BASIC( gemmtiny_ref_, 10 )
+INSERT_GENTFUNC_BASIC( gemmtiny_ref_, 11 )
+INSERT_GENTFUNC_BASIC( gemmtiny_ref_, 12 )
+INSERT_GENTFUNC_BASIC( gemmtiny_ref_, 13 )
+INSERT_GENTFUNC_BASIC( gemmtiny_ref_, 14 )
+INSERT_GENTFUNC_BASIC( gemmtiny_ref_, 15 )
+INSERT_GENTFUNC_BASIC( gemmtiny_ref_, 16 )
+
+
+// Return the tiny gemm kernel for operands of the given size, which must
+// be between 2 and BLIS_GEMMTINY_SIZE_MAX.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+PASTECH2(ch,gemmtiny,_ft) PASTEMAC(ch,opname)( dim_t size ) \
+{ \
+	static PASTECH2(ch,gemmtiny,_ft) ker[ BLIS_GEMMTINY_SIZE_MAX + 1 ] = \
+	{ \
+	  NULL, \
+	  NULL, \
+	  PASTEMAC2(ch,gemmtiny_ref_,2), \
+	  PASTEMAC2(ch,gemmtiny_ref_,3), \
+	  PASTEMAC2(ch,gemmtiny_ref_,4), \
+	  PASTEMAC2(ch,gemmtiny_ref_,5), \
+	  PASTEMAC2(ch,gemmtiny_ref_,6), \
+	  PASTEMAC2(ch,gemmtiny_ref_,7), \
+	  PASTEMAC2(ch,gemmtiny_ref_,8), \
+	  PASTEMAC2(ch,gemmtiny_ref_,9), \
+	  PASTEMAC2(ch,gemmtiny_ref_,10), \
+	  PASTEMAC2(ch,gemmtiny_ref_,11), \
+	  PASTEMAC2(ch,gemmtiny_ref_,12), \
+	  PASTEMAC2(ch,gemmtiny_ref_,13), \
+	  PASTEMAC2(ch,gemmtiny_ref_,14), \
+	  PASTEMAC2(ch,gemmtiny_ref_,15), \
+	  PASTEMAC2(ch,gemmtiny_ref_,16)  \
+	}; \
+\
+	return ker[ size ]; \
+}
+
+INSERT_GENTFUNC_BASIC0( gemmtiny_ker_query )
+
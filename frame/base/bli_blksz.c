@@ -126,13 +126,14 @@ dim_t bli_determine_blocksize
        dim_t   dim,
        obj_t*  obj,
        bszid_t bszid,
-       cntx_t* cntx
+       cntx_t* cntx,
+       rntm_t* rntm
      )
 {
 	if ( direct == BLIS_FWD )
-		return bli_determine_blocksize_f( i, dim, obj, bszid, cntx );
+		return bli_determine_blocksize_f( i, dim, obj, bszid, cntx, rntm );
 	else
-		return bli_determine_blocksize_b( i, dim, obj, bszid, cntx );
+		return bli_determine_blocksize_b( i, dim, obj, bszid, cntx, rntm );
 }
 
 dim_t bli_determine_blocksize_f
@@ -141,7 +142,8 @@ dim_t bli_determine_blocksize_f
        dim_t   dim,
        obj_t*  obj,
        bszid_t bszid,
-       cntx_t* cntx
+       cntx_t* cntx,
+       rntm_t* rntm
      )
 {
 	num_t    dt;
@@ -156,6 +158,11 @@ dim_t bli_determine_blocksize_f
 	b_alg = bli_blksz_get_def( dt, bsize );
 	b_max = bli_blksz_get_max( dt, bsize );
 
+	// The runtime object may carry a smaller NC for this call (see
+	// bli_cache_rntm_adjust_nc()).
+	if ( bszid == BLIS_NC && bli_rntm_nc( dt, rntm ) > 0 )
+		b_alg = bli_rntm_nc( dt, rntm );
+
 	b_use = bli_determine_blocksize_f_sub( i, dim, b_alg, b_max );
 
 	return b_use;
@@ -167,7 +174,8 @@ dim_t bli_determine_blocksize_b
        dim_t   dim,
        obj_t*  obj,
        bszid_t bszid,
-       cntx_t* cntx
+       cntx_t* cntx,
+       rntm_t* rntm
      )
 {
 	num_t    dt;
@@ -182,6 +190,11 @@ dim_t bli_determine_blocksize_b
 	b_alg = bli_blksz_get_def( dt, bsize );
 	b_max = bli_blksz_get_max( dt, bsize );
 
+	// The runtime object may carry a smaller NC for this call (see
+	// bli_cache_rntm_adjust_nc()).
+	if ( bszid == BLIS_NC && bli_rntm_nc( dt, rntm ) > 0 )
+		b_alg = bli_rntm_nc( dt, rntm );
+
 	b_use = bli_determine_blocksize_b_sub( i, dim, b_alg, b_max );
 
 	return b_use;
@@ -136,7 +136,8 @@ dim_t bli_determine_blocksize
        dim_t   dim,
        obj_t*  obj,
        bszid_t bszid,
-       cntx_t* cntx
+       cntx_t* cntx,
+       rntm_t* rntm
      );
 
 dim_t bli_determine_blocksize_f
@@ -145,7 +146,8 @@ dim_t bli_determine_blocksize_f
        dim_t   dim,
        obj_t*  obj,
        bszid_t bszid,
-       cntx_t* cntx
+       cntx_t* cntx,
+       rntm_t* rntm
      );
 
 dim_t bli_determine_blocksize_b
@@ -154,7 +156,8 @@ dim_t bli_determine_blocksize_b
        dim_t   dim,
        obj_t*  obj,
        bszid_t bszid,
-       cntx_t* cntx
+       cntx_t* cntx,
+       rntm_t* rntm
      );
 
 dim_t bli_determine_blocksize_f_sub
@@ -0,0 +1,472 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#if defined(__linux__)
+  #define _GNU_SOURCE
+#endif
+
+#include "blis.h"
+
+// The maximum ratio of a derived cache blocksize to the configuration's.
+#define CACHE_MAX_SCALE 4
+
+// The maximum number of logical CPUs counted as sharing a cache.
+#define CACHE_MAX_CPUS  1024
+
+typedef enum
+{
+	BLIS_CACHE_SRC_NONE = 0,
+	BLIS_CACHE_SRC_SYSFS,
+	BLIS_CACHE_SRC_CPUID
+} cache_src_t;
+
+static char* cache_src_str[ 3 ] = { "none", "sysfs", "cpuid" };
+
+static cacheinfo_t cache_info[ BLIS_CACHE_MAX_LEVEL ];
+static cache_src_t cache_src     = BLIS_CACHE_SRC_NONE;
+static bool_t      cache_blkszs  = FALSE;
+
+// -----------------------------------------------------------------------------
+
+#if BLIS_OS_LINUX
+
+static bool_t bli_cache_read_str( const char* dir, const char* name,
+                                  char* buf, size_t len )
+{
+	char  path[ 256 ];
+	FILE* fp;
+
+	sprintf( path, "%s/%s", dir, name );
+
+	fp = fopen( path, "r" );
+
+	if ( fp == NULL ) return FALSE;
+
+	if ( fgets( buf, len, fp ) == NULL ) buf[0] = '\0';
+
+	fclose( fp );
+
+	return TRUE;
+}
+
+static dim_t bli_cache_read_dim( const char* dir, const char* name )
+{
+	char buf[ 64 ];
+	long val;
+	char unit = '\0';
+
+	if ( !bli_cache_read_str( dir, name, buf, sizeof( buf ) ) ) return 0;
+
+	if ( sscanf( buf, "%ld%c", &val, &unit ) < 1 ) return 0;
+
+	if      ( unit == 'K' ) val *= 1024;
+	else if ( unit == 'M' ) val *= 1024 * 1024;
+	else if ( unit == 'G' ) val *= 1024 * 1024 * 1024;
+
+	return ( dim_t )val;
+}
+
+static bool_t bli_cache_detect_sysfs( void )
+{
+	char   dir[ 128 ];
+	char   buf[ 1024 ];
+	int    cpus[ CACHE_MAX_CPUS ];
+	bool_t found = FALSE;
+	dim_t  i, level;
+
+	for ( i = 0; ; ++i )
+	{
+		cacheinfo_t* c;
+
+		sprintf( dir, "/sys/devices/system/cpu/cpu0/cache/index%d", ( int )i );
+
+		if ( !bli_cache_read_str( dir, "type", buf, sizeof( buf ) ) ) break;
+		if ( strncmp( buf, "Instruction", 11 ) == 0 ) continue;
+
+		level = bli_cache_read_dim( dir, "level" );
+
+		if ( level < 1 || level > BLIS_CACHE_MAX_LEVEL ) continue;
+
+		c = &cache_info[ level - 1 ];
+
+		c->size    = bli_cache_read_dim( dir, "size" );
+		c->ways    = bli_cache_read_dim( dir, "ways_of_associativity" );
+		c->line    = bli_cache_read_dim( dir, "coherency_line_size" );
+		c->sets    = bli_cache_read_dim( dir, "number_of_sets" );
+		c->sharing = 1;
+
+		if ( c->sets == 0 && c->ways > 0 && c->line > 0 )
+			c->sets = c->size / ( c->ways * c->line );
+
+		if ( bli_cache_read_str( dir, "shared_cpu_list", buf, sizeof( buf ) ) )
+		{
+			dim_t n = bli_affinity_parse_list( buf, cpus, CACHE_MAX_CPUS );
+
+			if ( n > 0 ) c->sharing = n;
+		}
+
+		if ( c->size > 0 ) found = TRUE;
+	}
+
+	return found;
+}
+
+#endif
+
+#if defined(__x86_64__)
+
+static void bli_cache_cpuid( uint32_t leaf, uint32_t subleaf, uint32_t* r )
+{
+	__asm__ __volatile__
+	(
+	  "cpuid"
+	  : "=a" (r[0]), "=b" (r[1]), "=c" (r[2]), "=d" (r[3])
+	  : "a" (leaf), "c" (subleaf)
+	);
+}
+
+static bool_t bli_cache_detect_cpuid( void )
+{
+	uint32_t r[ 4 ];
+	uint32_t leaf, max_leaf;
+	bool_t   found = FALSE;
+	dim_t    i, type, level;
+
+	// The deterministic cache parameters are reported by leaf 4 on Intel
+	// processors and by leaf 0x8000001D on AMD processors, in the same
+	// format.
+	bli_cache_cpuid( 0, 0, r );
+
+	if ( r[1] == 0x68747541 ) // "Auth"enticAMD
+	{
+		leaf = 0x8000001D;
+		bli_cache_cpuid( 0x80000000, 0, r );
+		max_leaf = r[0];
+	}
+	else
+	{
+		leaf     = 4;
+		max_leaf = r[0];
+	}
+
+	if ( max_leaf < leaf ) return FALSE;
+
+	for ( i = 0; i < 16; ++i )
+	{
+		cacheinfo_t* c;
+		dim_t        parts;
+
+		bli_cache_cpuid( leaf, i, r );
+
+		type  = r[0] & 0x1f;
+		level = ( r[0] >> 5 ) & 0x7;
+
+		// Type 0 terminates the list; type 2 is an instruction cache.
+		if ( type == 0 ) break;
+		if ( type == 2 || level < 1 || level > BLIS_CACHE_MAX_LEVEL ) continue;
+
+		c = &cache_info[ level - 1 ];
+
+		c->ways    = ( ( r[1] >> 22 ) & 0x3ff ) + 1;
+		parts      = ( ( r[1] >> 12 ) & 0x3ff ) + 1;
+		c->line    = (   r[1]         & 0xfff ) + 1;
+		c->sets    = r[2] + 1;
+		c->sharing = ( ( r[0] >> 14 ) & 0xfff ) + 1;
+		c->size    = c->ways * parts * c->line * c->sets;
+
+		// Fully associative caches have no meaningful number of ways.
+		if ( r[0] & ( 1 << 9 ) ) c->ways = 0;
+
+		found = TRUE;
+	}
+
+	return found;
+}
+
+#endif
+
+// -----------------------------------------------------------------------------
+
+void bli_cache_init( void )
+{
+	char* str = getenv( "BLIS_CACHE_BLKSZ" );
+	num_t dt;
+
+	memset( cache_info, 0, sizeof( cache_info ) );
+	cache_src    = BLIS_CACHE_SRC_NONE;
+	cache_blkszs = FALSE;
+
+	// Start from the configuration's blocksizes, so that values derived or
+	// loaded before a previous bli_finalize() do not linger.
+	bli_gks_reset_blkszs();
+
+#if BLIS_OS_LINUX
+	if ( bli_cache_detect_sysfs() )
+		cache_src = BLIS_CACHE_SRC_SYSFS;
+#endif
+#if defined(__x86_64__)
+	if ( cache_src == BLIS_CACHE_SRC_NONE )
+	{
+		memset( cache_info, 0, sizeof( cache_info ) );
+
+		if ( bli_cache_detect_cpuid() )
+			cache_src = BLIS_CACHE_SRC_CPUID;
+	}
+#endif
+
+	if ( cache_src == BLIS_CACHE_SRC_NONE ) return;
+	if ( str != NULL && atoi( str ) == 0 ) return;
+
+	cache_blkszs = TRUE;
+
+	for ( dt = BLIS_DT_LO; dt <= BLIS_DT_HI; ++dt )
+	{
+		blksz_t mr, nr, kr, mc, kc, nc;
+		dim_t   mc_d, kc_d, nc_d;
+
+		bli_gks_get_blksz( BLIS_MR, &mr );
+		bli_gks_get_blksz( BLIS_NR, &nr );
+		bli_gks_get_blksz( BLIS_KR, &kr );
+		bli_gks_get_blksz( BLIS_MC, &mc );
+		bli_gks_get_blksz( BLIS_KC, &kc );
+		bli_gks_get_blksz( BLIS_NC, &nc );
+
+		mc_d = bli_blksz_get_def( dt, &mc );
+		kc_d = bli_blksz_get_def( dt, &kc );
+		nc_d = bli_blksz_get_def( dt, &nc );
+
+		if ( !bli_cache_derive_blkszs( dt,
+		                               bli_blksz_get_def( dt, &mr ),
+		                               bli_blksz_get_def( dt, &nr ),
+		                               bli_blksz_get_def( dt, &kr ),
+		                               1, &mc_d, &kc_d, &nc_d ) ) continue;
+
+		// As with tuning files, the maximum blocksizes keep their distance
+		// from the defaults.
+		bli_gks_set_blksz_dt( BLIS_MC, dt, mc_d, mc_d + bli_blksz_get_max( dt, &mc )
+		                                              - bli_blksz_get_def( dt, &mc ) );
+		bli_gks_set_blksz_dt( BLIS_KC, dt, kc_d, kc_d + bli_blksz_get_max( dt, &kc )
+		                                              - bli_blksz_get_def( dt, &kc ) );
+		bli_gks_set_blksz_dt( BLIS_NC, dt, nc_d, nc_d + bli_blksz_get_max( dt, &nc )
+		                                              - bli_blksz_get_def( dt, &nc ) );
+	}
+}
+
+void bli_cache_finalize( void )
+{
+}
+
+bool_t bli_cache_query( dim_t level, cacheinfo_t* info )
+{
+	if ( level < 1 || level > BLIS_CACHE_MAX_LEVEL ) return FALSE;
+	if ( cache_info[ level - 1 ].size == 0 ) return FALSE;
+
+	*info = cache_info[ level - 1 ];
+
+	return TRUE;
+}
+
+char* bli_cache_source_string( void )
+{
+	return cache_src_str[ cache_src ];
+}
+
+bool_t bli_cache_blkszs_enabled( void )
+{
+	return cache_blkszs;
+}
+
+// -----------------------------------------------------------------------------
+
+// Round val down to a multiple of mult, but not below mult, and cap it at
+// CACHE_MAX_SCALE times the configuration's value cfg.
+static dim_t bli_cache_round( dim_t val, dim_t mult, dim_t cfg )
+{
+	dim_t cap = CACHE_MAX_SCALE * cfg;
+
+	if ( val > cap ) val = cap;
+
+	val -= val % mult;
+
+	return bli_max( val, mult );
+}
+
+// The size of the panels of B that fit in the L3 cache, given the blocksizes
+// of A, as a number of columns. Return zero if the L3 was not detected.
+static dim_t bli_cache_nc_model( siz_t  elem_size,
+                                 dim_t  mc,
+                                 dim_t  kc,
+                                 dim_t  n_panels )
+{
+	cacheinfo_t* l1 = &cache_info[ 0 ];
+	cacheinfo_t* l3 = &cache_info[ 2 ];
+	dim_t        cores;
+	double       bytes;
+
+	if ( l3->size == 0 || l3->ways < 2 ) return 0;
+
+	// The number of cores sharing the L3, with SMT siblings (which share
+	// the L1) counted once.
+	cores = l3->sharing / bli_max( l1->sharing, 1 );
+	cores = bli_max( cores, 1 );
+
+	bytes  = ( double )l3->size * ( l3->ways - 1 ) / l3->ways;
+	bytes -= ( double )cores * mc * kc * elem_size;
+
+	if ( bytes <= 0.0 ) return 1;
+
+	return bli_max( ( dim_t )( bytes / ( n_panels * kc * elem_size ) ), 1 );
+}
+
+bool_t bli_cache_derive_blkszs( num_t  dt,
+                                dim_t  mr,
+                                dim_t  nr,
+                                dim_t  kr,
+                                dim_t  n_panels,
+                                dim_t* mc,
+                                dim_t* kc,
+                                dim_t* nc )
+{
+	cacheinfo_t* l1        = &cache_info[ 0 ];
+	cacheinfo_t* l2        = &cache_info[ 1 ];
+	siz_t        elem_size = bli_datatype_size( dt );
+	bool_t       derived   = FALSE;
+	dim_t        ways, way_size, nc_model;
+
+	if ( mr <= 0 || nr <= 0 || kr <= 0 || n_panels < 1 ) return FALSE;
+
+	// KC: the number of L1 ways given to the micro-panels of A.
+	if ( l1->size > 0 && l1->ways >= 2 && l1->sets > 0 && l1->line > 0 )
+	{
+		way_size = l1->sets * l1->line;
+		ways     = ( dim_t )( ( l1->ways - 1 ) / ( 1.0 + ( double )nr / mr ) );
+		ways     = bli_max( ways, 1 );
+
+		*kc      = bli_cache_round( ways * way_size / ( mr * elem_size ),
+		                            8 * kr, *kc );
+		derived  = TRUE;
+	}
+
+	// MC: the L2 ways left over by a micro-panel of B and one way for C.
+	if ( l2->size > 0 && l2->ways >= 2 && l2->sets > 0 && l2->line > 0 )
+	{
+		way_size = l2->sets * l2->line;
+		ways     = l2->ways - 1 - ( *kc * nr * elem_size + way_size - 1 ) / way_size;
+
+		if ( ways >= 1 )
+		{
+			*mc     = bli_cache_round( ways * way_size / ( *kc * elem_size ),
+			                           mr, *mc );
+			derived = TRUE;
+		}
+	}
+
+	// NC: the share of the L3 of each panel of B.
+	nc_model = bli_cache_nc_model( elem_size, *mc, *kc, n_panels );
+
+	if ( nc_model > 0 )
+	{
+		*nc     = bli_cache_round( nc_model, nr, *nc );
+		derived = TRUE;
+	}
+
+	return derived;
+}
+
+void bli_cache_rntm_adjust_nc( rntm_t* rntm, cntx_t* cntx )
+{
+	dim_t jc = bli_rntm_jc_way( rntm );
+	dim_t cores, n_panels;
+	num_t dt;
+
+	bli_rntm_clear_nc( rntm );
+
+	if ( !cache_blkszs || jc < 2 ) return;
+
+	// Assume that the jc thread groups are placed on as few L3 caches as
+	// possible, which is the worst case.
+	cores    = cache_info[ 2 ].sharing / bli_max( cache_info[ 0 ].sharing, 1 );
+	n_panels = bli_min( jc, bli_max( cores, 1 ) );
+
+	if ( n_panels < 2 ) return;
+
+	for ( dt = BLIS_DT_LO; dt <= BLIS_DT_HI; ++dt )
+	{
+		dim_t mc = bli_cntx_get_blksz_def_dt( dt, BLIS_MC, cntx );
+		dim_t kc = bli_cntx_get_blksz_def_dt( dt, BLIS_KC, cntx );
+		dim_t nc = bli_cntx_get_blksz_def_dt( dt, BLIS_NC, cntx );
+		dim_t nr = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+		dim_t nc_model;
+
+		nc_model = bli_cache_nc_model( bli_datatype_size( dt ), mc, kc, n_panels );
+
+		if ( nc_model == 0 || nr <= 0 ) continue;
+
+		nc_model -= nc_model % nr;
+		nc_model  = bli_max( nc_model, nr );
+
+		if ( nc_model < nc )
+			bli_rntm_set_nc( nc_model, dt, rntm );
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_cache_fprint( FILE* file )
+{
+	dim_t level;
+
+	fprintf( file, "cache hierarchy (from %s):\n", bli_cache_source_string() );
+
+	for ( level = 1; level <= BLIS_CACHE_MAX_LEVEL; ++level )
+	{
+		cacheinfo_t* c = &cache_info[ level - 1 ];
+
+		if ( c->size == 0 )
+		{
+			fprintf( file, "  L%d  not detected\n", ( int )level );
+			continue;
+		}
+
+		fprintf( file, "  L%d  %7ld KB  %3ld-way  %3ld B lines  %6ld sets"
+		               "  shared by %ld cpu(s)\n", ( int )level,
+		         ( long )( c->size / 1024 ), ( long )c->ways,
+		         ( long )c->line, ( long )c->sets, ( long )c->sharing );
+	}
+
+	fprintf( file, "cache blocksizes %s\n",
+	         cache_blkszs ? "derived from the cache hierarchy"
+	                      : "from the configuration" );
+}
+
@@ -0,0 +1,110 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_CACHE_H
+#define BLIS_CACHE_H
+
+//
+// Cache hierarchy detection.
+//
+// bli_init() detects the size, associativity, line size and sharing of the
+// level-1 data, level-2 and level-3 caches, from Linux sysfs or, failing
+// that, from x86 CPUID (leaf 4 on Intel, leaf 0x8000001D on AMD). Unless
+// the BLIS_CACHE_BLKSZ environment variable is set to 0, the cache
+// blocksizes of the native micro-kernels are then derived from them (see
+// bli_cache_derive_blkszs()) and replace the configuration's in the gks.
+// A tuning file (see bli_tune.h) may override the derived values in turn.
+//
+
+#define BLIS_CACHE_MAX_LEVEL 3
+
+typedef struct
+{
+	dim_t size;    // in bytes; zero if the cache was not detected
+	dim_t ways;    // zero if fully associative or unknown
+	dim_t line;
+	dim_t sets;
+	dim_t sharing; // logical CPUs sharing the cache
+} cacheinfo_t;
+
+void   bli_cache_init( void );
+void   bli_cache_finalize( void );
+
+// Query the data (or unified) cache of the given level (1 to 3). Return
+// FALSE if it was not detected.
+bool_t bli_cache_query( dim_t level, cacheinfo_t* info );
+char*  bli_cache_source_string( void );
+bool_t bli_cache_blkszs_enabled( void );
+
+// Derive the cache blocksizes of a micro-kernel with register blocksizes
+// mr x nr (and kr) for datatype dt, following the analytical model of Low
+// et al.:
+//
+//   KC  the mr x kc micro-panels of A stream through the L1 cache while the
+//       kc x nr micro-panel of B stays resident. Of the W ways of the L1,
+//       one is left to the elements of C and the rest are split between A
+//       and B in the ratio mr:nr.
+//   MC  the mc x kc block of A fits in the L2 cache, in the ways left over
+//       by one micro-panel of B and one way for C.
+//   NC  the kc x nc panel of B fits in one way less than the L3 cache,
+//       after the blocks of A of all cores sharing the L3. n_panels is the
+//       number of independent panels of B that share the L3 (one per jc
+//       thread group placed on it).
+//
+// On entry, mc, kc and nc hold the configuration's values, which are kept
+// for any level that was not detected. The derived values are rounded down
+// to multiples of mr, 8 * kr and nr, respectively, and do not exceed four
+// times the configuration's values (which bounds the size of the packing
+// buffers on machines that report very large caches). Return FALSE if
+// nothing was derived.
+bool_t bli_cache_derive_blkszs( num_t  dt,
+                                dim_t  mr,
+                                dim_t  nr,
+                                dim_t  kr,
+                                dim_t  n_panels,
+                                dim_t* mc,
+                                dim_t* kc,
+                                dim_t* nc );
+
+// Reduce NC for an operation whose jc loop is parallelized, so that the
+// panels of B of the jc thread groups sharing an L3 cache fit in it together.
+// The value of NC is never increased. The reduced values are recorded in
+// the runtime object, which the blocked variants consult before the context
+// (see bli_determine_blocksize()).
+void   bli_cache_rntm_adjust_nc( rntm_t* rntm, cntx_t* cntx );
+
+void   bli_cache_fprint( FILE* file );
+
+#endif
+
@@ -99,6 +99,8 @@ void bli_cntx_init( cntx_t* cntx )
 	bli_gks_cntx_set_l1v_ker( BLIS_DOTV_KER, cntx );
 	bli_gks_cntx_set_l1v_ker( BLIS_DOTXV_KER, cntx );
 	bli_gks_cntx_set_l1v_ker( BLIS_INVERTV_KER, cntx );
+	bli_gks_cntx_set_l1v_ker( BLIS_ROTMV_KER, cntx );
+	bli_gks_cntx_set_l1v_ker( BLIS_ROTV_KER, cntx );
 	bli_gks_cntx_set_l1v_ker( BLIS_SCALV_KER, cntx );
 	bli_gks_cntx_set_l1v_ker( BLIS_SCAL2V_KER, cntx );
 	bli_gks_cntx_set_l1v_ker( BLIS_SETV_KER, cntx );
@@ -341,37 +343,6 @@ pack_t bli_cntx_get_pack_schema_b( cntx_t* cntx )
 }
 #endif
 
-dim_t bli_cntx_get_num_threads( cntx_t* cntx )
-{
-	return bli_cntx_jc_way( cntx ) *
-	       bli_cntx_pc_way( cntx ) *
-	       bli_cntx_ic_way( cntx ) *
-	       bli_cntx_jr_way( cntx ) *
-	       bli_cntx_ir_way( cntx );
-}
-
-dim_t bli_cntx_get_num_threads_in( cntx_t* cntx, cntl_t* cntl )
-{
-	dim_t n_threads_in = 1;
-
-	for ( ; cntl != NULL; cntl = bli_cntl_sub_node( cntl ) )
-	{
-		bszid_t bszid = bli_cntl_bszid( cntl );
-		dim_t   cur_way;
-
-		// We assume bszid is in {KR,MR,NR,MC,KC,NR} if it is not
-		// BLIS_NO_PART.
-		if ( bszid != BLIS_NO_PART )
-			cur_way = bli_cntx_way_for_bszid( bszid, cntx );
-		else
-			cur_way = 1;
-
-		n_threads_in *= cur_way;
-	}
-
-	return n_threads_in;
-}
-
 // -----------------------------------------------------------------------------
 
 #if 1
@@ -694,129 +665,6 @@ void bli_cntx_set_pack_schema_c( pack_t  schema_c,
 	bli_cntx_set_schema_c( schema_c, cntx );
 }
 
-void bli_cntx_set_thrloop_from_env( opid_t l3_op, side_t side, cntx_t* cntx,
-                                    dim_t m, dim_t n, dim_t k )
-{
-	dim_t jc, pc, ic, jr, ir;
-
-#ifdef BLIS_ENABLE_MULTITHREADING
-
-	int nthread = bli_env_read_nway( "BLIS_NUM_THREADS", -1 );
-
-	if ( nthread == -1 )
-	    nthread = bli_env_read_nway( "OMP_NUM_THREADS", -1 );
-
-	if ( nthread < 1 ) nthread = 1;
-
-    bli_partition_2x2( nthread, m*BLIS_DEFAULT_M_THREAD_RATIO,
-                                n*BLIS_DEFAULT_N_THREAD_RATIO, &ic, &jc );
-
-    for ( ir = BLIS_DEFAULT_MR_THREAD_MAX ; ir > 1 ; ir-- )
-    {
-        if ( ic % ir == 0 )
-        {
-            ic /= ir;
-            break;
-        }
-    }
-
-    for ( jr = BLIS_DEFAULT_NR_THREAD_MAX ; jr > 1 ; jr-- )
-    {
-        if ( jc % jr == 0 )
-        {
-            jc /= jr;
-            break;
-        }
-    }
-
-	jc = bli_env_read_nway( "BLIS_JC_NT", jc );
-	//pc = bli_env_read_nway( "BLIS_KC_NT", 1 );
-	pc = 1;
-	ic = bli_env_read_nway( "BLIS_IC_NT", ic );
-	jr = bli_env_read_nway( "BLIS_JR_NT", jr );
-	ir = bli_env_read_nway( "BLIS_IR_NT", ir );
-
-#else
-
-	jc = 1;
-	pc = 1;
-	ic = 1;
-	jr = 1;
-	ir = 1;
-
-#endif
-
-	if ( l3_op == BLIS_TRMM )
-	{
-		// We reconfigure the paralelism from trmm_r due to a dependency in
-		// the jc loop. (NOTE: This dependency does not exist for trmm3 )
-		if ( bli_is_right( side ) )
-		{
-			bli_cntx_set_thrloop
-			(
-			  1,
-			  pc,
-			  ic,
-			  jr * jc,
-			  ir,
-			  cntx
-			);
-		}
-		else // if ( bli_is_left( side ) )
-		{
-			bli_cntx_set_thrloop
-			(
-			  jc,
-			  pc,
-			  ic,
-			  jr,
-			  ir,
-			  cntx
-			);
-		}
-	}
-	else if ( l3_op == BLIS_TRSM )
-	{
-		if ( bli_is_right( side ) )
-		{
-			bli_cntx_set_thrloop
-			(
-			  1,
-			  1,
-			  ic * pc * jc * ir * jr,
-			  1,
-			  1,
-			  cntx
-			);
-		}
-		else // if ( bli_is_left( side ) )
-		{
-			bli_cntx_set_thrloop
-			(
-			  1,
-			  1,
-			  1,
-			  ic * pc * jc * jr * ir,
-			  1,
-			  cntx
-			);
-		}
-	}
-	else // if ( l3_op == BLIS_TRSM )
-	{
-		bli_cntx_set_thrloop
-		(
-		  jc,
-		  pc,
-		  ic,
-		  jr,
-		  ir,
-		  cntx
-		);
-	}
-}
-
-
 // -----------------------------------------------------------------------------
 
 bool_t bli_cntx_l3_nat_ukr_prefers_rows_dt( num_t   dt,
@@ -1006,12 +854,6 @@ void bli_cntx_print( cntx_t* cntx )
 		      );
 	}
 
-	{
-		ind_t family = bli_cntx_get_family( cntx );
-
-		printf( "oper family  : %lu\n", ( guint_t )family );
-	}
-
 	{
 		ind_t method = bli_cntx_get_ind_method( cntx );
 
@@ -53,14 +53,11 @@ typedef struct cntx_s
 
 	func_t    packm_ukrs;
 
-	opid_t    family;
 	ind_t     method;
 	pack_t    schema_a;
 	pack_t    schema_b;
 	pack_t    schema_c;
 
-	dim_t*    thrloop;
-
 	membrk_t* membrk;
 } cntx_t;
 */
@@ -105,10 +102,6 @@ typedef struct cntx_s
 \
 	(&((cntx)->packm_ukrs) )
 
-#define bli_cntx_family( cntx ) \
-\
-	( (cntx)->family )
-
 #define bli_cntx_method( cntx ) \
 \
 	( (cntx)->method )
@@ -129,36 +122,6 @@ typedef struct cntx_s
 \
 	( (cntx)->membrk )
 
-#define bli_cntx_thrloop( cntx ) \
-\
-	( (cntx)->thrloop )
-
-#if 1
-#define bli_cntx_jc_way( cntx ) \
-\
-	( (cntx)->thrloop[ BLIS_NC ] )
-
-#define bli_cntx_pc_way( cntx ) \
-\
-	( (cntx)->thrloop[ BLIS_KC ] )
-
-#define bli_cntx_ic_way( cntx ) \
-\
-	( (cntx)->thrloop[ BLIS_MC ] )
-
-#define bli_cntx_jr_way( cntx ) \
-\
-	( (cntx)->thrloop[ BLIS_NR ] )
-
-#define bli_cntx_ir_way( cntx ) \
-\
-	( (cntx)->thrloop[ BLIS_MR ] )
-#endif
-
-#define bli_cntx_way_for_bszid( bszid, cntx ) \
-\
-    ( (cntx)->thrloop[ bszid ] )
-
 // cntx_t modification (fields only)
 
 #define bli_cntx_set_blkszs_buf( _blkszs, cntx_p ) \
@@ -201,11 +164,6 @@ typedef struct cntx_s
 	(cntx_p)->packm_ukrs = _packm_ukrs; \
 }
 
-#define bli_cntx_set_family( _family, cntx_p ) \
-{ \
-	(cntx_p)->family = _family; \
-}
-
 #define bli_cntx_set_method( _method, cntx_p ) \
 { \
 	(cntx_p)->method = _method; \
@@ -231,16 +189,6 @@ typedef struct cntx_s
 	(cntx_p)->membrk = _membrk; \
 }
 
-#define bli_cntx_set_thrloop( jc_, pc_, ic_, jr_, ir_, cntx_p ) \
-{ \
-	(cntx_p)->thrloop[ BLIS_NC ] = jc_; \
-	(cntx_p)->thrloop[ BLIS_KC ] = pc_; \
-	(cntx_p)->thrloop[ BLIS_MC ] = ic_; \
-	(cntx_p)->thrloop[ BLIS_NR ] = jr_; \
-	(cntx_p)->thrloop[ BLIS_MR ] = ir_; \
-	(cntx_p)->thrloop[ BLIS_KR ] = 1;   \
-}
-
 // cntx_t query (complex)
 
 #define bli_cntx_get_blksz_def_dt( dt, bs_id, cntx ) \
@@ -315,10 +263,6 @@ typedef struct cntx_s
 	  (dt), (&(bli_cntx_l3_nat_ukrs_prefs_buf( (cntx) ))[ ukr_id ]) \
 	)
 
-#define bli_cntx_get_family( cntx ) \
-\
-	bli_cntx_family( cntx )
-
 #define bli_cntx_get_ind_method( cntx ) \
 \
 	bli_cntx_method( cntx )
@@ -398,8 +342,6 @@ func_t*  bli_cntx_get_packm_ukr( cntx_t* cntx );
 //pack_t   bli_cntx_get_pack_schema_a( cntx_t* cntx );
 //pack_t   bli_cntx_get_pack_schema_b( cntx_t* cntx );
 //pack_t   bli_cntx_get_pack_schema_c( cntx_t* cntx );
-dim_t    bli_cntx_get_num_threads( cntx_t* cntx );
-dim_t    bli_cntx_get_num_threads_in( cntx_t* cntx, cntl_t* cntl );
 
 // set functions
 
@@ -434,12 +376,6 @@ void     bli_cntx_set_pack_schema_b( pack_t  schema_b,
                                      cntx_t* cntx );
 void     bli_cntx_set_pack_schema_c( pack_t  schema_c,
                                      cntx_t* cntx );
-void     bli_cntx_set_thrloop_from_env( opid_t  l3_op,
-                                        side_t  side,
-                                        cntx_t* cntx,
-                                        dim_t m,
-                                        dim_t n,
-                                        dim_t k );
 
 // other query functions
 
@@ -510,27 +446,5 @@ void bli_cntx_print( cntx_t* cntx );
 	}
 
 
-#define bli_cntx_init_local_if2( opname, suf, cntx, cntx_p ) \
-\
-	cntx_t _cntx_l; \
-\
-	if ( bli_is_null( cntx ) ) \
-	{ \
-		PASTEMAC2(opname,suf,_cntx_init)( &_cntx_l ); \
-		cntx_p = &_cntx_l; \
-	} \
-	else \
-	{ \
-		cntx_p = cntx; \
-	}
-
-#define bli_cntx_finalize_local_if2( opname, suf, cntx ) \
-\
-	if ( bli_is_null( cntx ) ) \
-	{ \
-		PASTEMAC2(opname,suf,_cntx_finalize)( &_cntx_l ); \
-	}
-
-
 #endif
 
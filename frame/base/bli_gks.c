@@ -82,6 +82,11 @@ static blksz_t bli_gks_blkszs[BLIS_NUM_BLKSZS] =
          },
 };
 
+// A copy of the configuration's blocksizes, saved before the first runtime
+// change to the table above.
+static blksz_t bli_gks_blkszs_saved[BLIS_NUM_BLKSZS];
+static bool_t  bli_gks_blkszs_changed = FALSE;
+
 // -----------------------------------------------------------------------------
 
 void bli_gks_get_blksz( bszid_t  bs_id,
@@ -90,6 +95,36 @@ void bli_gks_get_blksz( bszid_t  bs_id,
 	*blksz = bli_gks_blkszs[ bs_id ];
 }
 
+void bli_gks_set_blksz_dt( bszid_t bs_id,
+                           num_t   dt,
+                           dim_t   def,
+                           dim_t   max )
+{
+	if ( bli_gks_blkszs_changed == FALSE )
+	{
+		memcpy( bli_gks_blkszs_saved, bli_gks_blkszs, sizeof( bli_gks_blkszs ) );
+		bli_gks_blkszs_changed = TRUE;
+	}
+
+	// Contexts are initialized from this table, so the global level-3
+	// contexts are rebuilt and the new values take effect at the next
+	// operation. The memory allocator grows its pools as needed when the
+	// operation starts (see bli_memsys_reinit()).
+	bli_blksz_set_def_max( def, max, dt, &bli_gks_blkszs[ bs_id ] );
+
+	bli_l3_cntx_global_reinit();
+}
+
+void bli_gks_reset_blkszs( void )
+{
+	if ( bli_gks_blkszs_changed == FALSE ) return;
+
+	memcpy( bli_gks_blkszs, bli_gks_blkszs_saved, sizeof( bli_gks_blkszs ) );
+	bli_gks_blkszs_changed = FALSE;
+
+	bli_l3_cntx_global_reinit();
+}
+
 void bli_gks_cntx_set_blkszs( ind_t method, dim_t n_bs, ... )
 {
 	/* Example prototypes:
@@ -560,6 +595,145 @@ void bli_gks_cntx_set_l3_nat_ukr_prefs( l3ukr_t ukr,
 }
 
 
+//
+// -- level-3 gemm micro-kernel variants ---------------------------------------
+//
+
+typedef struct
+{
+	void*  ukr;
+	dim_t  mc;
+	dim_t  kc;
+	dim_t  nc;
+	dim_t  mr;
+	dim_t  nr;
+	bool_t row_pref;
+} gks_ukrvar_t;
+
+// Declare the variant micro-kernels, since only the default micro-kernel
+// for each datatype is prototyped elsewhere.
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ukrname ) \
+\
+void ukrname \
+     ( \
+       dim_t               k, \
+       ctype*     restrict alpha, \
+       ctype*     restrict a, \
+       ctype*     restrict b, \
+       ctype*     restrict beta, \
+       ctype*     restrict c, inc_t rs_c, inc_t cs_c, \
+       auxinfo_t* restrict data, \
+       cntx_t*    restrict cntx  \
+     );
+
+#define bli_gks_sgemm_ukrvar_prot( ukr, mc, kc, nc, mr, nr, rp ) GENTPROT( float,    ukr )
+#define bli_gks_dgemm_ukrvar_prot( ukr, mc, kc, nc, mr, nr, rp ) GENTPROT( double,   ukr )
+#define bli_gks_cgemm_ukrvar_prot( ukr, mc, kc, nc, mr, nr, rp ) GENTPROT( scomplex, ukr )
+#define bli_gks_zgemm_ukrvar_prot( ukr, mc, kc, nc, mr, nr, rp ) GENTPROT( dcomplex, ukr )
+
+BLIS_SGEMM_UKERNEL_VARIANTS( bli_gks_sgemm_ukrvar_prot )
+BLIS_DGEMM_UKERNEL_VARIANTS( bli_gks_dgemm_ukrvar_prot )
+BLIS_CGEMM_UKERNEL_VARIANTS( bli_gks_cgemm_ukrvar_prot )
+BLIS_ZGEMM_UKERNEL_VARIANTS( bli_gks_zgemm_ukrvar_prot )
+
+// Each list is terminated by an entry with a NULL kernel address.
+
+#define bli_gks_gemm_ukrvar_entry( ukr, mc, kc, nc, mr, nr, rp ) \
+        { ( void* )ukr, mc, kc, nc, mr, nr, rp },
+
+static gks_ukrvar_t bli_gks_sgemm_ukrvars[] =
+{
+	BLIS_SGEMM_UKERNEL_VARIANTS( bli_gks_gemm_ukrvar_entry )
+	{ NULL, 0, 0, 0, 0, 0, FALSE }
+};
+static gks_ukrvar_t bli_gks_dgemm_ukrvars[] =
+{
+	BLIS_DGEMM_UKERNEL_VARIANTS( bli_gks_gemm_ukrvar_entry )
+	{ NULL, 0, 0, 0, 0, 0, FALSE }
+};
+static gks_ukrvar_t bli_gks_cgemm_ukrvars[] =
+{
+	BLIS_CGEMM_UKERNEL_VARIANTS( bli_gks_gemm_ukrvar_entry )
+	{ NULL, 0, 0, 0, 0, 0, FALSE }
+};
+static gks_ukrvar_t bli_gks_zgemm_ukrvars[] =
+{
+	BLIS_ZGEMM_UKERNEL_VARIANTS( bli_gks_gemm_ukrvar_entry )
+	{ NULL, 0, 0, 0, 0, 0, FALSE }
+};
+
+static gks_ukrvar_t* bli_gks_gemm_ukrvars[BLIS_NUM_FP_TYPES] =
+{
+	/* float (0) */    bli_gks_sgemm_ukrvars,
+	/* scomplex (1) */ bli_gks_cgemm_ukrvars,
+	/* double (2) */   bli_gks_dgemm_ukrvars,
+	/* dcomplex (3) */ bli_gks_zgemm_ukrvars,
+};
+
+// -----------------------------------------------------------------------------
+
+dim_t bli_gks_gemm_ukr_num_vars( num_t dt )
+{
+	gks_ukrvar_t* vars = bli_gks_gemm_ukrvars[ dt ];
+	dim_t         n    = 0;
+
+	while ( vars[ n ].ukr != NULL ) ++n;
+
+	return n;
+}
+
+void bli_gks_get_gemm_ukr_var( num_t   dt,
+                               dim_t   var,
+                               dim_t*  mr,
+                               dim_t*  nr,
+                               bool_t* row_pref )
+{
+	gks_ukrvar_t* v = &bli_gks_gemm_ukrvars[ dt ][ var ];
+
+	*mr       = v->mr;
+	*nr       = v->nr;
+	*row_pref = v->row_pref;
+}
+
+void bli_gks_cntx_set_gemm_ukr_var( num_t   dt,
+                                    dim_t   var,
+                                    cntx_t* cntx )
+{
+	gks_ukrvar_t* v = &bli_gks_gemm_ukrvars[ dt ][ var ];
+
+	blksz_t*      cntx_blkszs = bli_cntx_blkszs_buf( cntx );
+	func_t*       cntx_ukrs   = bli_cntx_l3_nat_ukrs_buf( cntx );
+	mbool_t*      cntx_prefs  = bli_cntx_l3_nat_ukrs_prefs_buf( cntx );
+
+	dim_t         mc          = v->mc;
+	dim_t         kc          = v->kc;
+	dim_t         nc          = v->nc;
+
+	// The cache blocksizes registered with the variant are used unless they
+	// are derived from the cache hierarchy, as they are for the native
+	// micro-kernel.
+	if ( bli_cache_blkszs_enabled() )
+		bli_cache_derive_blkszs( dt, v->mr, v->nr,
+		                         bli_blksz_get_def( dt, &cntx_blkszs[ BLIS_KR ] ),
+		                         1, &mc, &kc, &nc );
+
+	// Replace the micro-kernel and its storage preference for the given
+	// datatype only.
+	bli_func_set_dt( v->ukr, dt, &cntx_ukrs[ BLIS_GEMM_UKR ] );
+	bli_mbool_set_dt( v->row_pref, dt, &cntx_prefs[ BLIS_GEMM_UKR ] );
+
+	// Replace the cache and register blocksizes. The packing dimensions of
+	// the register blocksizes are simply the blocksizes themselves.
+	bli_blksz_set_def_max( v->mr, v->mr, dt, &cntx_blkszs[ BLIS_MR ] );
+	bli_blksz_set_def_max( v->nr, v->nr, dt, &cntx_blkszs[ BLIS_NR ] );
+	bli_blksz_set_def_max( mc, mc, dt, &cntx_blkszs[ BLIS_MC ] );
+	bli_blksz_set_def_max( kc, kc, dt, &cntx_blkszs[ BLIS_KC ] );
+	bli_blksz_set_def_max( nc, nc, dt, &cntx_blkszs[ BLIS_NC ] );
+}
+
+
 #if 0
 //
 // -- packm structure-aware kernel structure -----------------------------------
@@ -775,6 +949,12 @@ static func_t bli_gks_l1v_kers[BLIS_NUM_LEVEL1V_KERS] =
 /* invertv    */ { { BLIS_SINVERTV_KERNEL, BLIS_CINVERTV_KERNEL,
                      BLIS_DINVERTV_KERNEL, BLIS_ZINVERTV_KERNEL, }
                  },
+/* rotmv      */ { { BLIS_SROTMV_KERNEL, BLIS_CROTMV_KERNEL,
+                     BLIS_DROTMV_KERNEL, BLIS_ZROTMV_KERNEL, }
+                 },
+/* rotv       */ { { BLIS_SROTV_KERNEL, BLIS_CROTV_KERNEL,
+                     BLIS_DROTV_KERNEL, BLIS_ZROTV_KERNEL, }
+                 },
 /* scalv      */ { { BLIS_SSCALV_KERNEL, BLIS_CSCALV_KERNEL,
                      BLIS_DSCALV_KERNEL, BLIS_ZSCALV_KERNEL, }
                  },
@@ -822,6 +1002,12 @@ static func_t bli_gks_l1v_ref_kers[BLIS_NUM_LEVEL1V_KERS] =
 /* invertv    */ { { BLIS_SINVERTV_KERNEL_REF, BLIS_CINVERTV_KERNEL_REF,
                      BLIS_DINVERTV_KERNEL_REF, BLIS_ZINVERTV_KERNEL_REF, }
                  },
+/* rotmv      */ { { BLIS_SROTMV_KERNEL_REF, BLIS_CROTMV_KERNEL_REF,
+                     BLIS_DROTMV_KERNEL_REF, BLIS_ZROTMV_KERNEL_REF, }
+                 },
+/* rotv       */ { { BLIS_SROTV_KERNEL_REF, BLIS_CROTV_KERNEL_REF,
+                     BLIS_DROTV_KERNEL_REF, BLIS_ZROTV_KERNEL_REF, }
+                 },
 /* scalv      */ { { BLIS_SSCALV_KERNEL_REF, BLIS_CSCALV_KERNEL_REF,
                      BLIS_DSCALV_KERNEL_REF, BLIS_ZSCALV_KERNEL_REF, }
                  },
@@ -40,6 +40,11 @@
 
 void bli_gks_get_blksz( bszid_t  bs_id,
                         blksz_t* blksz );
+void bli_gks_set_blksz_dt( bszid_t bs_id,
+                           num_t   dt,
+                           dim_t   def,
+                           dim_t   max );
+void bli_gks_reset_blkszs( void );
 
 void bli_gks_cntx_set_blkszs( ind_t method, dim_t n_bs, ... );
 
@@ -70,6 +75,18 @@ void bli_gks_cntx_set_l3_nat_ukr_prefs( l3ukr_t ukr,
 
 // -----------------------------------------------------------------------------
 
+dim_t bli_gks_gemm_ukr_num_vars( num_t dt );
+void  bli_gks_get_gemm_ukr_var( num_t   dt,
+                                dim_t   var,
+                                dim_t*  mr,
+                                dim_t*  nr,
+                                bool_t* row_pref );
+void  bli_gks_cntx_set_gemm_ukr_var( num_t   dt,
+                                     dim_t   var,
+                                     cntx_t* cntx );
+
+// -----------------------------------------------------------------------------
+
 void bli_gks_get_l1f_ker( l1fkr_t ker,
                           func_t* func );
 void bli_gks_get_l1f_ref_ker( l1fkr_t ker,
@@ -90,6 +90,22 @@ gint_t bli_info_get_enable_cblas( void )
 	return 0;
 #endif
 }
+gint_t bli_info_get_enable_blas_ilp64( void )
+{
+#ifdef BLIS_ENABLE_BLAS_ILP64
+	return 1;
+#else
+	return 0;
+#endif
+}
+gint_t bli_info_get_enable_profiling( void )
+{
+#ifdef BLIS_ENABLE_PROFILING
+	return 1;
+#else
+	return 0;
+#endif
+}
 gint_t bli_info_get_blas2blis_int_type_size( void ) { return BLIS_BLAS2BLIS_INT_TYPE_SIZE; }
 
 
@@ -117,6 +133,7 @@ char* bli_info_get_trsm_u_ukr_impl_string( ind_t method, num_t dt )
 gint_t bli_info_get_mk_pool_size( void ) { return bli_membrk_pool_size( bli_memsys_global_membrk(), BLIS_BUFFER_FOR_A_BLOCK ); }
 gint_t bli_info_get_kn_pool_size( void ) { return bli_membrk_pool_size( bli_memsys_global_membrk(), BLIS_BUFFER_FOR_B_PANEL ); }
 gint_t bli_info_get_mn_pool_size( void ) { return bli_membrk_pool_size( bli_memsys_global_membrk(), BLIS_BUFFER_FOR_C_PANEL ); }
+gint_t bli_info_get_gen_pool_size( void ) { return bli_membrk_pool_size( bli_memsys_global_membrk(), BLIS_BUFFER_FOR_GEN_USE ); }
 
 
 
@@ -56,6 +56,8 @@ gint_t bli_info_get_pool_addr_align_size( void );
 gint_t bli_info_get_enable_stay_auto_init( void );
 gint_t bli_info_get_enable_blas2blis( void );
 gint_t bli_info_get_enable_cblas( void );
+gint_t bli_info_get_enable_blas_ilp64( void );
+gint_t bli_info_get_enable_profiling( void );
 gint_t bli_info_get_blas2blis_int_type_size( void );
 
 
@@ -76,6 +78,7 @@ char* bli_info_get_trsm_u_ukr_impl_string( ind_t method, num_t dt );
 gint_t bli_info_get_mk_pool_size( void );
 gint_t bli_info_get_kn_pool_size( void );
 gint_t bli_info_get_mn_pool_size( void );
+gint_t bli_info_get_gen_pool_size( void );
 
 
 // -- BLIS implementation query (level-3) --------------------------------------
@@ -82,11 +82,25 @@ err_t bli_init( void )
 		if ( bli_is_init == FALSE )
 		{
 			// Initialize various sub-APIs.
+			// NOTE: The threading API is initialized before the memory
+			// allocator, since the latter keeps one set of pools per NUMA
+			// node, as discovered by the former. The blocksizes derived from
+			// the cache hierarchy, and then any tuning file (which may also
+			// replace the parameters of the cost model), are applied before
+			// the allocator sizes its pools from the blocksizes. The global
+			// level-3 contexts are built once the blocksizes are final.
 			bli_const_init();
 			bli_error_init();
+			bli_thread_init();
+			bli_cache_init();
+			bli_l3_model_init();
+			bli_trsm_dag_init();
+			bli_tune_init();
+			bli_l3_cntx_global_init();
 			bli_memsys_init();
 			bli_ind_init();
-			bli_thread_init();
+			bli_prof_init();
+			bli_verbose_init();
 
 			// After initialization is complete, mark BLIS as initialized.
 			bli_is_init = TRUE;
@@ -151,6 +165,12 @@ err_t bli_finalize( void )
 			bli_memsys_finalize();
 			bli_ind_finalize();
 			bli_thread_finalize();
+			bli_cache_finalize();
+			bli_l3_model_finalize();
+			bli_tune_finalize();
+			bli_l3_cntx_global_finalize();
+			bli_prof_finalize();
+			bli_verbose_finalize();
 
 			// After finalization is complete, mark BLIS as uninitialized.
 			bli_is_init = FALSE;
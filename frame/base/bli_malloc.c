@@ -32,21 +32,90 @@
 
 */
 
+#if defined(__linux__)
+  #define _GNU_SOURCE
+#endif
+
 #include "blis.h"
 
 // -----------------------------------------------------------------------------
 
+// Whether new pool blocks are mapped with mmap(MAP_POPULATE), which
+// pre-faults them, rather than allocated with BLIS_MALLOC_POOL.
+static bool_t pool_populate = FALSE;
+
+void bli_malloc_pool_set_populate( bool_t populate )
+{
+	pool_populate = populate;
+}
+
 void* bli_malloc_pool( size_t size )
 {
 	const malloc_ft malloc_fp  = BLIS_MALLOC_POOL;
 	const size_t    align_size = BLIS_POOL_ADDR_ALIGN_SIZE;
+	const size_t    ptr_size   = sizeof( void* );
+	size_t          map_size   = 0;
+	void*           p_orig     = NULL;
+	int8_t*         p_byte;
 
-	return bli_malloc_align( malloc_fp, size, align_size );
+	// Once memory is reserved, the pools are not expected to grow.
+	if ( bli_malloc_reserve_mode() == BLIS_RESERVE_SEALED )
+		bli_malloc_reserve_miss();
+
+	// Return early if zero bytes were requested.
+	if ( size == 0 ) return NULL;
+
+	// Make room for the alignment and for two words just before the
+	// aligned address: the size of the mapping (zero if the block did not
+	// come from mmap()) and the original address.
+	size += align_size + 2 * ptr_size;
+
+#ifdef MAP_POPULATE
+	if ( pool_populate )
+	{
+		p_orig = mmap( NULL, size, PROT_READ | PROT_WRITE,
+		               MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0 );
+
+		if ( p_orig == MAP_FAILED ) p_orig = NULL;
+		else                        map_size = size;
+	}
+#endif
+
+	if ( p_orig == NULL ) p_orig = malloc_fp( size );
+
+	// If NULL was returned, something is probably very wrong.
+	if ( p_orig == NULL ) bli_abort();
+
+	p_byte = ( int8_t* )p_orig + 2 * ptr_size;
+
+	if ( bli_is_unaligned_to( p_byte, align_size ) )
+		p_byte += align_size - bli_offset_past_alignment( p_byte, align_size );
+
+	( ( size_t* )p_byte )[ -2 ] = map_size;
+	( ( void**  )p_byte )[ -1 ] = p_orig;
+
+	return p_byte;
 }
 
 void bli_free_pool( void* p )
 {
-	bli_free_align( BLIS_FREE_POOL, p );
+	const free_ft free_fp = BLIS_FREE_POOL;
+	void*         p_orig;
+
+	if ( p == NULL ) return;
+
+	p_orig = ( ( void** )p )[ -1 ];
+
+#ifdef MAP_POPULATE
+	// Unmap the block if it was mapped.
+	{
+		size_t map_size = ( ( size_t* )p )[ -2 ];
+
+		if ( map_size != 0 ) { munmap( p_orig, map_size ); return; }
+	}
+#endif
+
+	free_fp( p_orig );
 }
 
 // -----------------------------------------------------------------------------
@@ -66,20 +135,177 @@ void bli_free_user( void* p )
 
 // -----------------------------------------------------------------------------
 
+// Internal allocations (control trees, thrinfo_t trees, communicators and
+// the like) carry a header that records their size class. While memory is
+// reserved (see bli_memsys_reserve()), blocks of up to
+// 2^(BLIS_MALLOC_INTL_NUM_CLASSES+4) bytes are recycled through one free
+// list per class instead of being returned to the heap, so that a call
+// that repeats an earlier one is served without touching the heap.
+#define BLIS_MALLOC_INTL_HDR_SIZE     16
+#define BLIS_MALLOC_INTL_NUM_CLASSES  12
+
+// The free lists link the blocks through the first word after their
+// headers.
+#define bli_malloc_intl_link( p ) \
+\
+	( *( void** )( ( int8_t* )(p) + BLIS_MALLOC_INTL_HDR_SIZE ) )
+
+static void*          intl_free_list[ BLIS_MALLOC_INTL_NUM_CLASSES ];
+static volatile int   intl_lock   = 0;
+static resmode_t      intl_mode   = BLIS_RESERVE_OFF;
+
+// The mode is read without the lock as a hint. It only changes with the
+// lock held, and bli_free_intl() checks it again under the lock, so that
+// no block can be pushed onto a free list after the lists were drained.
+#define bli_malloc_intl_mode() \
+\
+	( __atomic_load_n( &intl_mode, __ATOMIC_RELAXED ) )
+static volatile dim_t intl_misses = 0;
+
+static dim_t bli_malloc_intl_class( size_t size )
+{
+	size_t class_size = 32;
+	dim_t  i;
+
+	for ( i = 0; i < BLIS_MALLOC_INTL_NUM_CLASSES; ++i, class_size <<= 1 )
+	{
+		if ( size <= class_size ) return i;
+	}
+
+	return -1;
+}
+
 void* bli_malloc_intl( size_t size )
 {
 	const malloc_ft malloc_fp = BLIS_MALLOC_INTL;
 
-	return bli_malloc_noalign( malloc_fp, size );
+	dim_t  ci = -1;
+	void*  p  = NULL;
+	size_t size_alloc = size;
+
+	if ( bli_malloc_intl_mode() != BLIS_RESERVE_OFF )
+	{
+		ci = bli_malloc_intl_class( size );
+
+		if ( 0 <= ci )
+		{
+			size_alloc = ( size_t )32 << ci;
+
+			// Pop a block from the free list of the class.
+			while ( __sync_lock_test_and_set( &intl_lock, 1 ) ) ;
+			p = intl_free_list[ ci ];
+			if ( p != NULL ) intl_free_list[ ci ] = bli_malloc_intl_link( p );
+			__sync_lock_release( &intl_lock );
+		}
+	}
+
+	if ( p == NULL )
+	{
+		if ( bli_malloc_intl_mode() == BLIS_RESERVE_SEALED )
+			bli_malloc_reserve_miss();
+
+		p = bli_malloc_noalign( malloc_fp, size_alloc + BLIS_MALLOC_INTL_HDR_SIZE );
+
+		// Record the class of the block in its header.
+		*( dim_t* )p = ci;
+	}
+
+	return ( int8_t* )p + BLIS_MALLOC_INTL_HDR_SIZE;
 }
 
 void bli_free_intl( void* p )
 {
+	dim_t ci;
+
+	if ( p == NULL ) return;
+
+	p  = ( int8_t* )p - BLIS_MALLOC_INTL_HDR_SIZE;
+	ci = *( dim_t* )p;
+
+	if ( 0 <= ci && bli_malloc_intl_mode() != BLIS_RESERVE_OFF )
+	{
+		bool_t pushed = FALSE;
+
+		// Push the block onto the free list of its class, unless the
+		// reserve was switched off (and the lists drained) in the meantime.
+		// The link overwrites only the payload, so the header stays intact.
+		while ( __sync_lock_test_and_set( &intl_lock, 1 ) ) ;
+		if ( intl_mode != BLIS_RESERVE_OFF )
+		{
+			bli_malloc_intl_link( p ) = intl_free_list[ ci ];
+			intl_free_list[ ci ]      = p;
+			pushed = TRUE;
+		}
+		__sync_lock_release( &intl_lock );
+
+		if ( pushed ) return;
+	}
+
 	bli_free_noalign( BLIS_FREE_INTL, p );
 }
 
 // -----------------------------------------------------------------------------
 
+void bli_malloc_set_reserve_mode( resmode_t mode )
+{
+	const free_ft free_fp = BLIS_FREE_INTL;
+	void*         lists[ BLIS_MALLOC_INTL_NUM_CLASSES ];
+	void*         p;
+	dim_t         i;
+
+	// Change the mode and, if the reserve is being switched off, detach the
+	// free lists, all under the lock. A concurrent bli_free_intl() then
+	// either pushes its block before the lists are detached or sees the new
+	// mode and returns the block to the heap itself.
+	while ( __sync_lock_test_and_set( &intl_lock, 1 ) ) ;
+
+	__atomic_store_n( &intl_mode, mode, __ATOMIC_RELAXED );
+
+	for ( i = 0; i < BLIS_MALLOC_INTL_NUM_CLASSES; ++i )
+	{
+		lists[ i ] = NULL;
+
+		if ( mode == BLIS_RESERVE_OFF )
+		{
+			lists[ i ]          = intl_free_list[ i ];
+			intl_free_list[ i ] = NULL;
+		}
+	}
+
+	__sync_lock_release( &intl_lock );
+
+	// Return the detached blocks to the heap.
+	for ( i = 0; i < BLIS_MALLOC_INTL_NUM_CLASSES; ++i )
+	{
+		while ( ( p = lists[ i ] ) != NULL )
+		{
+			lists[ i ] = bli_malloc_intl_link( p );
+			bli_free_noalign( free_fp, p );
+		}
+	}
+}
+
+resmode_t bli_malloc_reserve_mode( void )
+{
+	return bli_malloc_intl_mode();
+}
+
+void bli_malloc_reserve_miss( void )
+{
+	__sync_fetch_and_add( &intl_misses, 1 );
+
+#ifdef BLIS_ENABLE_RESERVE_ASSERT
+	bli_abort();
+#endif
+}
+
+dim_t bli_malloc_reserve_num_misses( void )
+{
+	return intl_misses;
+}
+
+// -----------------------------------------------------------------------------
+
 void* bli_malloc_align
      (
        malloc_ft f,
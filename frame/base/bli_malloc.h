@@ -36,10 +36,20 @@
 typedef void* (*malloc_ft) ( size_t size );
 typedef void  (*free_ft)   ( void*  p    );
 
+// The state of the reservation of internal memory: none, being filled by
+// bli_memsys_reserve(), or in force.
+typedef enum
+{
+	BLIS_RESERVE_OFF = 0,
+	BLIS_RESERVE_FILLING,
+	BLIS_RESERVE_SEALED
+} resmode_t;
+
 // -----------------------------------------------------------------------------
 
 void* bli_malloc_pool( size_t size );
 void  bli_free_pool( void* p );
+void  bli_malloc_pool_set_populate( bool_t populate );
 
 void* bli_malloc_intl( size_t size );
 void  bli_free_intl( void* p );
@@ -47,6 +57,11 @@ void  bli_free_intl( void* p );
 void* bli_malloc_user( size_t size );
 void  bli_free_user( void* p );
 
+void      bli_malloc_set_reserve_mode( resmode_t mode );
+resmode_t bli_malloc_reserve_mode( void );
+void      bli_malloc_reserve_miss( void );
+dim_t     bli_malloc_reserve_num_misses( void );
+
 // -----------------------------------------------------------------------------
 
 void* bli_malloc_align( malloc_ft f, size_t size, size_t align_size );
@@ -67,6 +67,10 @@
 \
 	( (mem_p)->size )
 
+#define bli_mem_is_new( mem_p ) \
+\
+	( (mem_p)->is_new )
+
 #define bli_mem_is_alloc( mem_p ) \
 \
 	( bli_mem_buffer( mem_p ) != NULL )
@@ -113,6 +117,11 @@
 	mem_p->size = size0; \
 }
 
+#define bli_mem_set_is_new( is_new0, mem_p ) \
+{ \
+	(mem_p)->is_new = is_new0; \
+}
+
 #define bli_mem_clear( mem_p ) \
 { \
 	bli_mem_set_buffer( NULL, mem_p ); \
@@ -120,6 +129,7 @@
 	bli_mem_set_pool( NULL, mem_p ); \
 	bli_mem_set_size( 0, mem_p ); \
 	bli_mem_set_membrk( NULL, mem_p ); \
+	bli_mem_set_is_new( FALSE, mem_p ); \
 }
 
 
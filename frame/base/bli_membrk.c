@@ -35,15 +35,294 @@
 
 #include "blis.h"
 
+// Write to each page of a newly allocated block so that, under a
+// first-touch page placement policy, the block is placed on the NUMA node
+// of the calling thread.
+static void bli_membrk_touch( void* buf, siz_t size )
+{
+	volatile char* p = buf;
+	siz_t          i;
+
+	for ( i = 0; i < size; i += BLIS_PAGE_SIZE ) p[ i ] = 0;
+}
+
+// Return the index of the smallest general-use size class whose blocks
+// hold req_size bytes, or -1 if req_size exceeds the largest class.
+static dim_t bli_membrk_gen_index( siz_t req_size )
+{
+	siz_t block_size = ( siz_t )1 << BLIS_GEN_POOL_MIN_SIZE_LOG2;
+	dim_t i;
+
+	for ( i = 0; i < BLIS_NUM_GEN_POOLS; ++i, block_size <<= 1 )
+	{
+		if ( req_size <= block_size ) return i;
+	}
+
+	return -1;
+}
+
+#ifdef BLIS_ENABLE_PTHREADS
+
+// Each thread keeps the general-use blocks it released in a cache, at most
+// one per size class, and reuses them without taking the lock of the
+// membrk_t. The caches are registered in a global list so that trimming
+// and finalizing the pools can return the blocks of every thread, and a
+// thread's cache is emptied into the pools when the thread exits. Each
+// cache has a lock of its own, which its thread takes around every use of
+// the cache; it is contended only while the cache is being drained.
+//
+// Locks are taken in the order: list, membrk_t, cache.
+
+typedef struct gen_cache_s
+{
+	pblk_t              blocks[ BLIS_NUM_GEN_POOLS ];
+	membrk_t*           membrk;
+	volatile int        lock;
+	bool_t              is_reg;
+
+	struct gen_cache_s* next;
+	struct gen_cache_s* prev;
+
+} gen_cache_t;
+
+static __thread gen_cache_t bli_membrk_gen_cache;
+
+static gen_cache_t*    bli_membrk_gen_cache_list       = NULL;
+static pthread_mutex_t bli_membrk_gen_cache_list_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_key_t   bli_membrk_gen_cache_key;
+static pthread_once_t  bli_membrk_gen_cache_key_once   = PTHREAD_ONCE_INIT;
+
+#define bli_membrk_gen_cache_lock( c ) \
+{ \
+	while ( __sync_lock_test_and_set( &(c)->lock, 1 ) ) ; \
+}
+
+#define bli_membrk_gen_cache_unlock( c ) \
+{ \
+	__sync_lock_release( &(c)->lock ); \
+}
+
+// Check the blocks in cache c back into the pools of its membrk_t. The
+// caller must hold the list lock, the lock of that membrk_t and the lock
+// of c.
+static void bli_membrk_gen_cache_empty( gen_cache_t* c )
+{
+	dim_t i;
+
+	for ( i = 0; i < BLIS_NUM_GEN_POOLS; ++i )
+	{
+		if ( bli_pblk_buf_sys( &c->blocks[ i ] ) != NULL )
+		{
+			bli_pool_checkin_block( &c->blocks[ i ],
+			                        bli_membrk_gen_pool( i, c->membrk ) );
+			bli_pblk_clear( &c->blocks[ i ] );
+		}
+	}
+
+	c->membrk = NULL;
+}
+
+// Unregister the cache of an exiting thread and return its blocks to the
+// pools.
+static void bli_membrk_gen_cache_exit( void* arg )
+{
+	gen_cache_t* c = arg;
+
+	pthread_mutex_lock( &bli_membrk_gen_cache_list_mutex );
+	{
+		// While the list lock is held, the membrk_t cannot be finalized,
+		// since that drains the caches first.
+		if ( c->membrk != NULL )
+		{
+			membrk_t* membrk = c->membrk;
+
+			bli_membrk_lock( membrk );
+			bli_membrk_gen_cache_lock( c );
+			bli_membrk_gen_cache_empty( c );
+			bli_membrk_gen_cache_unlock( c );
+			bli_membrk_unlock( membrk );
+		}
+
+		if ( c->prev != NULL ) c->prev->next = c->next;
+		else                   bli_membrk_gen_cache_list = c->next;
+		if ( c->next != NULL ) c->next->prev = c->prev;
+
+		c->is_reg = FALSE;
+	}
+	pthread_mutex_unlock( &bli_membrk_gen_cache_list_mutex );
+}
+
+static void bli_membrk_gen_cache_key_create( void )
+{
+	pthread_key_create( &bli_membrk_gen_cache_key, bli_membrk_gen_cache_exit );
+}
+
+// Return the calling thread's cache, registering it on first use.
+static gen_cache_t* bli_membrk_gen_cache_get( void )
+{
+	gen_cache_t* c = &bli_membrk_gen_cache;
+
+	if ( c->is_reg ) return c;
+
+	pthread_once( &bli_membrk_gen_cache_key_once, bli_membrk_gen_cache_key_create );
+
+	// The key only serves to run bli_membrk_gen_cache_exit() when the
+	// thread exits.
+	pthread_setspecific( bli_membrk_gen_cache_key, c );
+
+	pthread_mutex_lock( &bli_membrk_gen_cache_list_mutex );
+	{
+		c->prev = NULL;
+		c->next = bli_membrk_gen_cache_list;
+		if ( c->next != NULL ) c->next->prev = c;
+		bli_membrk_gen_cache_list = c;
+
+		c->is_reg = TRUE;
+	}
+	pthread_mutex_unlock( &bli_membrk_gen_cache_list_mutex );
+
+	return c;
+}
+
+// Take a cached block of size class pi of membrk into pblk, returning
+// FALSE if the calling thread's cache has none.
+static bool_t bli_membrk_gen_cache_take( dim_t pi, membrk_t* membrk, pblk_t* pblk )
+{
+	gen_cache_t* c = bli_membrk_gen_cache_get();
+	bool_t       r_val = FALSE;
+
+	bli_membrk_gen_cache_lock( c );
+	if ( c->membrk == membrk && bli_pblk_buf_sys( &c->blocks[ pi ] ) != NULL )
+	{
+		*pblk = c->blocks[ pi ];
+		bli_pblk_clear( &c->blocks[ pi ] );
+		r_val = TRUE;
+	}
+	bli_membrk_gen_cache_unlock( c );
+
+	return r_val;
+}
+
+// Put the block in pblk, of size class pi of membrk, into the calling
+// thread's cache, returning FALSE if the cache cannot hold it.
+static bool_t bli_membrk_gen_cache_put( dim_t pi, membrk_t* membrk, pblk_t* pblk )
+{
+	gen_cache_t* c = bli_membrk_gen_cache_get();
+	bool_t       r_val = FALSE;
+
+	bli_membrk_gen_cache_lock( c );
+	if ( ( c->membrk == NULL || c->membrk == membrk ) &&
+	     bli_pblk_buf_sys( &c->blocks[ pi ] ) == NULL )
+	{
+		c->blocks[ pi ] = *pblk;
+		c->membrk       = membrk;
+		r_val = TRUE;
+	}
+	bli_membrk_gen_cache_unlock( c );
+
+	return r_val;
+}
+
+// Return the blocks that any thread has cached from membrk to their pools.
+// The caller must not hold the lock of membrk.
+static void bli_membrk_gen_cache_drain( membrk_t* membrk )
+{
+	gen_cache_t* c;
+
+	pthread_mutex_lock( &bli_membrk_gen_cache_list_mutex );
+	bli_membrk_lock( membrk );
+	{
+		for ( c = bli_membrk_gen_cache_list; c != NULL; c = c->next )
+		{
+			bli_membrk_gen_cache_lock( c );
+			if ( c->membrk == membrk ) bli_membrk_gen_cache_empty( c );
+			bli_membrk_gen_cache_unlock( c );
+		}
+	}
+	bli_membrk_unlock( membrk );
+	pthread_mutex_unlock( &bli_membrk_gen_cache_list_mutex );
+}
+
+#else
+
+// Without pthreads there is no way to empty a thread's cache when the
+// thread exits, so the blocks are always returned to the pools.
+
+static bool_t bli_membrk_gen_cache_take( dim_t pi, membrk_t* membrk, pblk_t* pblk )
+{
+	return FALSE;
+}
+
+static bool_t bli_membrk_gen_cache_put( dim_t pi, membrk_t* membrk, pblk_t* pblk )
+{
+	return FALSE;
+}
+
+static void bli_membrk_gen_cache_drain( membrk_t* membrk )
+{
+}
+
+#endif
+
+// Return the total size of the pools of membrk, including the blocks for
+// general use that are checked out or cached by threads. The caller must
+// hold the lock of membrk.
+static siz_t bli_membrk_size( membrk_t* membrk )
+{
+	siz_t r_val = membrk->gen_footprint;
+	dim_t node, pi;
+
+	for ( node = 0; node < bli_membrk_num_nodes( membrk ); ++node )
+		for ( pi = 0; pi < 3; ++pi )
+			r_val += bli_pool_size( bli_membrk_node_pool( node, pi, membrk ) );
+
+	return r_val;
+}
+
+// Free the idle blocks of pool, one at a time, until the pools of membrk
+// fit within its cap again or pool has no more idle blocks. The caller
+// must hold the lock of membrk.
+static void bli_membrk_shrink_to_max( pool_t* pool, membrk_t* membrk )
+{
+	const bool_t is_gen = ( membrk->gen_pools <= pool &&
+	                        pool < membrk->gen_pools + BLIS_NUM_GEN_POOLS );
+
+	// Reserved memory is kept regardless of the cap.
+	if ( membrk->max_size == 0 ||
+	     bli_malloc_reserve_mode() != BLIS_RESERVE_OFF ) return;
+
+	while ( bli_pool_num_blocks_avail( pool ) > 0 &&
+	        bli_membrk_size( membrk ) > membrk->max_size )
+	{
+		bli_pool_shrink( 1, pool );
+
+		if ( is_gen ) membrk->gen_footprint -= bli_pool_block_size( pool );
+	}
+}
+
 void bli_membrk_init
      (
        cntx_t*   cntx,
        membrk_t* membrk
      )
 {
+	dim_t n_nodes = bli_thread_topo_num_nodes();
+
+	if ( n_nodes > BLIS_NUM_NUMA_NODES_MAX ) n_nodes = BLIS_NUM_NUMA_NODES_MAX;
+	if ( n_nodes < 1 )                       n_nodes = 1;
+
+	membrk->n_nodes  = n_nodes;
+	membrk->max_size = bli_env_read_nway( "BLIS_POOL_MAX_SIZE", BLIS_POOL_MAX_SIZE );
+	membrk->num_uses = 0;
+	membrk->prefault = bli_env_read_nway( "BLIS_POOL_PREFAULT", BLIS_POOL_PREFAULT );
+
+	bli_malloc_pool_set_populate( membrk->prefault == BLIS_POOL_PREFAULT_POPULATE );
+
 	bli_mutex_init( bli_membrk_mutex( membrk ) );
 	bli_membrk_init_pools( cntx, membrk );
+	bli_membrk_init_gen_pools( membrk );
 	bli_membrk_set_malloc_fp( bli_malloc_pool, membrk );
+	bli_membrk_set_free_fp( bli_free_pool, membrk );
 }
 
 void bli_membrk_finalize
@@ -52,6 +331,8 @@ void bli_membrk_finalize
      )
 {
 	bli_membrk_set_malloc_fp( NULL, membrk );
+	bli_membrk_set_free_fp( NULL, membrk );
+	bli_membrk_finalize_gen_pools( membrk );
 	bli_membrk_finalize_pools( membrk );
 	bli_mutex_finalize( bli_membrk_mutex( membrk ) );
 }
@@ -67,31 +348,72 @@ void bli_membrk_acquire_m
 	pool_t* pool;
 	pblk_t* pblk;
 	dim_t   pi;
+	dim_t   node;
 	siz_t   block_size;
+	dim_t   num_blocks_prev;
+	bool_t  is_new;
 
 	// Make sure the API is initialized.
 	//assert( membrk ); //??
 
 	if ( buf_type == BLIS_BUFFER_FOR_GEN_USE )
 	{
-		// For general-use buffer requests, such as those used by level-2
-		// operations, dynamically allocating memory is sufficient.
-		// Note that we use the malloc()-style memory allocation function
-		// that is stored in the membrk_t object.
-		void* buf_sys = bli_membrk_malloc( req_size, membrk );
+		// General-use buffers, such as the temporaries of level-2
+		// operations, are small and requested often, so we recycle them
+		// through pools of power-of-two size classes. A block that the
+		// calling thread released earlier is reused without locking.
+		pblk = bli_mem_pblk( mem );
+		pi   = bli_membrk_gen_index( req_size );
+
+		if ( pi < 0 )
+		{
+			// The request exceeds the largest size class, so the block
+			// is allocated here and freed when it is released.
+			pool       = NULL;
+			block_size = req_size;
+
+			bli_pool_alloc_block( block_size, BLIS_HEAP_ADDR_ALIGN_SIZE, pblk );
+
+			bli_membrk_lock( membrk );
+			membrk->gen_footprint += block_size;
+			bli_membrk_unlock( membrk );
+		}
+		else
+		{
+			pool       = bli_membrk_gen_pool( pi, membrk );
+			block_size = bli_pool_block_size( pool );
+
+			if ( !bli_membrk_gen_cache_take( pi, membrk, pblk ) )
+			{
+				// BEGIN CRITICAL SECTION
+				bli_membrk_lock( membrk );
+				{
+					num_blocks_prev = bli_pool_num_blocks( pool );
+
+					bli_pool_checkout_block( pblk, pool );
+
+					membrk->gen_footprint += block_size *
+					  ( bli_pool_num_blocks( pool ) - num_blocks_prev );
+					membrk->num_uses      += 1;
+				}
+				bli_membrk_unlock( membrk );
+				// END CRITICAL SECTION
+			}
+		}
 
 		// Initialize the mem_t object with:
-		// - the address of the memory block,
 		// - the buffer type (a packbuf_t value),
-		// - the size of the requested region,
+		// - the address of the size class pool to which the block belongs
+		//   (NULL if it belongs to none),
+		// - the size of the contiguous memory block,
 		// - the membrk_t from which the mem_t entry was acquired.
-		// NOTE: We do not initialize the pool field since this block did not
-		// come from a memory pool.
-		bli_mem_set_buffer( buf_sys, mem );
-		bli_mem_set_buf_sys( buf_sys, mem );
+		// The addresses are already stored in the mem_t struct's pblk_t
+		// field.
 		bli_mem_set_buf_type( buf_type, mem );
-		bli_mem_set_size( req_size, mem );
+		bli_mem_set_pool( pool, mem );
+		bli_mem_set_size( block_size, mem );
 		bli_mem_set_membrk( membrk, mem );
+		bli_mem_set_is_new( FALSE, mem );
 	}
 	else
 	{
@@ -100,9 +422,12 @@ void bli_membrk_acquire_m
 		// and then recycled.
 
 		// Map the requested packed buffer type to a zero-based index, which
-		// we then use to select the corresponding memory pool.
+		// we then use to select the corresponding memory pool. Each NUMA
+		// node has its own set of pools, and we use those of the node on
+		// which the calling thread (the chief of its thread group) runs.
 		pi   = bli_packbuf_index( buf_type );
-		pool = bli_membrk_pool( pi, membrk );
+		node = bli_thread_topo_current_node() % bli_membrk_num_nodes( membrk );
+		pool = bli_membrk_node_pool( node, pi, membrk );
 
 		// Unconditionally perform error checking on the memory pool.
 		{
@@ -128,8 +453,15 @@ void bli_membrk_acquire_m
 			// automatically, as-needed. Note that the addresses are stored
 			// directly into the mem_t struct since pblk is the address of
 			// the struct's pblk_t field.
+			num_blocks_prev = bli_pool_num_blocks( pool );
+
 			bli_pool_checkout_block( pblk, pool );
 
+			is_new = ( bli_pool_num_blocks( pool ) != num_blocks_prev );
+
+			// Note the use of the pools for the idle trimming.
+			membrk->num_uses += 1;
+
 			// Query the size of the blocks in the pool so we can store it in
 			// the mem_t object. At this point, it is guaranteed to be at
 			// least as large as req_size. (NOTE: We must perform the query
@@ -141,18 +473,30 @@ void bli_membrk_acquire_m
 		bli_membrk_unlock( membrk );
 		// END CRITICAL SECTION
 
+		// If the pool had to grow, the block is fresh from the allocator,
+		// so we touch it here (outside the critical section) to place its
+		// pages near the requesting thread group. In parallel mode, the
+		// caller is told that the block is new and touches it with all the
+		// threads of the group instead (see bli_membrk_touch_part()).
+		if ( is_new && membrk->prefault == BLIS_POOL_PREFAULT_SERIAL )
+			bli_membrk_touch( bli_pblk_buf_align( pblk ), block_size );
+
+		is_new = ( is_new && membrk->prefault == BLIS_POOL_PREFAULT_PARALLEL );
+
 		// Initialize the mem_t object with:
 		// - the buffer type (a packbuf_t value),
 		// - the address of the memory pool to which it belongs,
 		// - the size of the contiguous memory block (NOT the size of the
 		//   requested region),
-		// - the membrk_t from which the mem_t entry was acquired.
+		// - the membrk_t from which the mem_t entry was acquired,
+		// - whether the block still needs to be touched by the caller.
 		// The actual addresses (system and aligned) are already stored in
 		// the mem_t struct's pblk_t field
 		bli_mem_set_buf_type( buf_type, mem );
 		bli_mem_set_pool( pool, mem );
 		bli_mem_set_size( block_size, mem );
 		bli_mem_set_membrk( membrk, mem );
+		bli_mem_set_is_new( is_new, mem );
 	}
 }
 
@@ -177,13 +521,34 @@ void bli_membrk_release
 
 	if ( buf_type == BLIS_BUFFER_FOR_GEN_USE )
 	{
-		void* buf_sys = bli_mem_buf_sys( mem );
+		pool = bli_mem_pool( mem );
+		pblk = bli_mem_pblk( mem );
+
+		if ( pool == NULL )
+		{
+			// The block was too large for any size class, so free it.
+			bli_membrk_lock( membrk );
+			membrk->gen_footprint -= bli_mem_size( mem );
+			bli_membrk_unlock( membrk );
 
-		// For general-use buffers, we dynamically allocate memory, and so
-		// here we need to free.
-		// Note that we use the free()-style memory release function that
-		// is stored in the membrk_t object.
-		bli_membrk_free( buf_sys, membrk );
+			bli_pool_free_block( pblk );
+		}
+		else
+		{
+			dim_t pi = pool - membrk->gen_pools;
+
+			// Keep the block in the calling thread's cache if its class is
+			// small enough and the cache has no block of that class yet.
+			// Otherwise, return it to its pool.
+			if ( bli_pool_block_size( pool ) > BLIS_GEN_POOL_CACHE_MAX_SIZE ||
+			     !bli_membrk_gen_cache_put( pi, membrk, pblk ) )
+			{
+				bli_membrk_lock( membrk );
+				bli_pool_checkin_block( pblk, pool );
+				bli_membrk_shrink_to_max( pool, membrk );
+				bli_membrk_unlock( membrk );
+			}
+		}
 	}
 	else
 	{
@@ -220,8 +585,10 @@ void bli_membrk_release
 			}
 			else
 			{
-				// Check the block back into the pool.
+				// Check the block back into the pool, and free an idle block
+				// if the pools have outgrown their cap.
 				bli_pool_checkin_block( pblk, pool );
+				bli_membrk_shrink_to_max( pool, membrk );
 			}
 
 		}
@@ -240,6 +607,26 @@ void bli_membrk_release
 }
 
 
+void bli_membrk_touch_part
+     (
+       mem_t* mem,
+       dim_t  part,
+       dim_t  n_parts
+     )
+{
+	const siz_t size    = bli_mem_size( mem );
+	const siz_t n_pages = ( size + BLIS_PAGE_SIZE - 1 ) / BLIS_PAGE_SIZE;
+
+	// Split the pages of the block into n_parts nearly equal ranges and
+	// touch the range with index part.
+	const siz_t off0    = ( ( n_pages * part       ) / n_parts ) * BLIS_PAGE_SIZE;
+	const siz_t off1    = ( ( n_pages * ( part + 1 ) ) / n_parts ) * BLIS_PAGE_SIZE;
+
+	if ( off0 < off1 )
+		bli_membrk_touch( ( int8_t* )bli_mem_buffer( mem ) + off0,
+		                  bli_min( off1, size ) - off0 );
+}
+
 void bli_membrk_acquire_v
      (
        membrk_t* membrk,
@@ -264,8 +651,37 @@ siz_t bli_membrk_pool_size
 
 	if ( buf_type == BLIS_BUFFER_FOR_GEN_USE )
 	{
-		// We don't (yet) track the amount of general-purpose
-		// memory that is currently allocated.
+		// Report the memory held by the size class pools, including the
+		// blocks that are checked out or cached by threads, plus that of
+		// any outstanding blocks too large for the pools.
+		r_val = membrk->gen_footprint;
+	}
+	else
+	{
+		dim_t node;
+
+		// Sum the sizes of the pools of all NUMA nodes.
+		r_val = 0;
+
+		for ( node = 0; node < bli_membrk_num_nodes( membrk ); ++node )
+			r_val += bli_membrk_node_pool_size( membrk, node, buf_type );
+	}
+
+	return r_val;
+}
+
+siz_t bli_membrk_node_pool_size
+     (
+       membrk_t* membrk,
+       dim_t     node,
+       packbuf_t buf_type
+     )
+{
+	siz_t r_val;
+
+	if ( buf_type == BLIS_BUFFER_FOR_GEN_USE ||
+	     node < 0 || bli_membrk_num_nodes( membrk ) <= node )
+	{
 		r_val = 0;
 	}
 	else
@@ -276,7 +692,7 @@ siz_t bli_membrk_pool_size
 		// Acquire the pointer to the pool corresponding to the buf_type
 		// provided.
 		pool_index = bli_packbuf_index( buf_type );
-		pool       = bli_membrk_pool( pool_index, membrk );
+		pool       = bli_membrk_node_pool( node, pool_index, membrk );
 
 		// Compute the pool "size" as the product of the block size
 		// and the number of blocks in the pool.
@@ -287,6 +703,161 @@ siz_t bli_membrk_pool_size
 	return r_val;
 }
 
+void bli_membrk_pool_stats
+     (
+       membrk_t*     membrk,
+       packbuf_t     buf_type,
+       pool_stats_t* stats
+     )
+{
+	dim_t i;
+
+	bli_pool_stats_clear( stats );
+
+	// BEGIN CRITICAL SECTION
+	bli_membrk_lock( membrk );
+	{
+		if ( buf_type == BLIS_BUFFER_FOR_GEN_USE )
+		{
+			for ( i = 0; i < BLIS_NUM_GEN_POOLS; ++i )
+				bli_pool_stats_accum( bli_membrk_gen_pool( i, membrk ), stats );
+
+			// Also count the blocks too large for the size classes.
+			stats->size = membrk->gen_footprint;
+		}
+		else
+		{
+			dim_t pi = bli_packbuf_index( buf_type );
+
+			for ( i = 0; i < bli_membrk_num_nodes( membrk ); ++i )
+				bli_pool_stats_accum( bli_membrk_node_pool( i, pi, membrk ), stats );
+		}
+	}
+	bli_membrk_unlock( membrk );
+	// END CRITICAL SECTION
+}
+
+siz_t bli_membrk_trim
+     (
+       membrk_t* membrk
+     )
+{
+	siz_t r_val = 0;
+	siz_t size;
+	dim_t node, i;
+
+	// The blocks cached by threads are idle, too.
+	bli_membrk_gen_cache_drain( membrk );
+
+	// BEGIN CRITICAL SECTION
+	bli_membrk_lock( membrk );
+	{
+		for ( node = 0; node < bli_membrk_num_nodes( membrk ); ++node )
+			for ( i = 0; i < 3; ++i )
+				r_val += bli_pool_trim( bli_membrk_node_pool( node, i, membrk ) );
+
+		for ( i = 0; i < BLIS_NUM_GEN_POOLS; ++i )
+		{
+			size = bli_pool_trim( bli_membrk_gen_pool( i, membrk ) );
+
+			membrk->gen_footprint -= size;
+			r_val                 += size;
+		}
+	}
+	bli_membrk_unlock( membrk );
+	// END CRITICAL SECTION
+
+	return r_val;
+}
+
+siz_t bli_membrk_trim_if_idle
+     (
+       membrk_t* membrk,
+       dim_t*    num_uses_prev
+     )
+{
+	bool_t is_idle;
+
+	// Reserved memory is not trimmed, however long it sits idle.
+	if ( bli_malloc_reserve_mode() != BLIS_RESERVE_OFF ) return 0;
+
+	// The pools are idle if no block has been checked out since the
+	// previous call.
+	bli_membrk_lock( membrk );
+	is_idle        = ( membrk->num_uses == *num_uses_prev );
+	*num_uses_prev = membrk->num_uses;
+	bli_membrk_unlock( membrk );
+
+	return ( is_idle ? bli_membrk_trim( membrk ) : 0 );
+}
+
+void bli_membrk_reserve
+     (
+       dim_t     num_blocks,
+       membrk_t* membrk
+     )
+{
+	const dim_t index_a = bli_packbuf_index( BLIS_BUFFER_FOR_A_BLOCK );
+	const dim_t index_b = bli_packbuf_index( BLIS_BUFFER_FOR_B_PANEL );
+
+	dim_t       node, i, j;
+
+	// Grow the pools for A and B of every node to num_blocks blocks, which
+	// covers every partitioning of num_blocks threads into thread groups,
+	// and touch the new blocks so that using them causes no page faults.
+	for ( node = 0; node < bli_membrk_num_nodes( membrk ); ++node )
+	{
+		pool_t* pools[ 2 ];
+
+		pools[ 0 ] = bli_membrk_node_pool( node, index_a, membrk );
+		pools[ 1 ] = bli_membrk_node_pool( node, index_b, membrk );
+
+		for ( i = 0; i < 2; ++i )
+		{
+			pool_t* pool = pools[ i ];
+			dim_t   num_blocks_prev;
+
+			bli_membrk_lock( membrk );
+			{
+				num_blocks_prev = bli_pool_num_blocks( pool );
+
+				bli_pool_grow( num_blocks - num_blocks_prev, pool );
+
+				for ( j = num_blocks_prev; j < num_blocks; ++j )
+					bli_membrk_touch( bli_pblk_buf_align( &bli_pool_block_ptrs( pool )[ j ] ),
+					                  bli_pool_block_size( pool ) );
+			}
+			bli_membrk_unlock( membrk );
+		}
+	}
+}
+
+void bli_membrk_set_max_size
+     (
+       siz_t     max_size,
+       membrk_t* membrk
+     )
+{
+	dim_t node, i;
+
+	// BEGIN CRITICAL SECTION
+	bli_membrk_lock( membrk );
+	{
+		membrk->max_size = max_size;
+
+		// Bring the pools within the new cap right away, as far as their
+		// idle blocks allow.
+		for ( node = 0; node < bli_membrk_num_nodes( membrk ); ++node )
+			for ( i = 0; i < 3; ++i )
+				bli_membrk_shrink_to_max( bli_membrk_node_pool( node, i, membrk ), membrk );
+
+		for ( i = 0; i < BLIS_NUM_GEN_POOLS; ++i )
+			bli_membrk_shrink_to_max( bli_membrk_gen_pool( i, membrk ), membrk );
+	}
+	bli_membrk_unlock( membrk );
+	// END CRITICAL SECTION
+}
+
 // -----------------------------------------------------------------------------
 
 void bli_membrk_init_pools
@@ -302,11 +873,6 @@ void bli_membrk_init_pools
 
 	const siz_t align_size   = BLIS_POOL_ADDR_ALIGN_SIZE;
 
-	// Alias the pool addresses to convenient identifiers.
-	pool_t*     pool_a       = bli_membrk_pool( index_a, membrk );
-	pool_t*     pool_b       = bli_membrk_pool( index_b, membrk );
-	pool_t*     pool_c       = bli_membrk_pool( index_c, membrk );
-
 	// Start with empty pools.
 	const dim_t num_blocks_a = 0;
 	const dim_t num_blocks_b = 0;
@@ -316,16 +882,26 @@ void bli_membrk_init_pools
 	siz_t       block_size_b = 0;
 	siz_t       block_size_c = 0;
 
+	dim_t       node;
+
 	// Determine the block size for each memory pool.
 	bli_membrk_compute_pool_block_sizes( &block_size_a,
 	                                     &block_size_b,
 	                                     &block_size_c,
 	                                     cntx );
 
-	// Initialize the memory pools for A, B, and C.
-	bli_pool_init( num_blocks_a, block_size_a, align_size, pool_a );
-	bli_pool_init( num_blocks_b, block_size_b, align_size, pool_b );
-	bli_pool_init( num_blocks_c, block_size_c, align_size, pool_c );
+	for ( node = 0; node < bli_membrk_num_nodes( membrk ); ++node )
+	{
+		// Alias the pool addresses to convenient identifiers.
+		pool_t* pool_a = bli_membrk_node_pool( node, index_a, membrk );
+		pool_t* pool_b = bli_membrk_node_pool( node, index_b, membrk );
+		pool_t* pool_c = bli_membrk_node_pool( node, index_c, membrk );
+
+		// Initialize the memory pools for A, B, and C.
+		bli_pool_init( num_blocks_a, block_size_a, align_size, pool_a );
+		bli_pool_init( num_blocks_b, block_size_b, align_size, pool_b );
+		bli_pool_init( num_blocks_c, block_size_c, align_size, pool_c );
+	}
 }
 
 void bli_membrk_reinit_pools
@@ -341,34 +917,39 @@ void bli_membrk_reinit_pools
 
 	const siz_t align_size   = BLIS_POOL_ADDR_ALIGN_SIZE;
 
-	// Alias the pool addresses to convenient identifiers.
-	pool_t*     pool_a       = bli_membrk_pool( index_a, membrk );
-	pool_t*     pool_b       = bli_membrk_pool( index_b, membrk );
-	pool_t*     pool_c       = bli_membrk_pool( index_c, membrk );
-
-	// Query the number of blocks currently allocated in each pool.
-	const dim_t num_blocks_a = bli_pool_num_blocks( pool_a );
-	const dim_t num_blocks_b = bli_pool_num_blocks( pool_b );
-	const dim_t num_blocks_c = bli_pool_num_blocks( pool_c );
-
 	siz_t       block_size_a_new = 0;
 	siz_t       block_size_b_new = 0;
 	siz_t       block_size_c_new = 0;
 
+	dim_t       node;
+
 	// Determine the context-implied block size needed for each pool.
 	bli_membrk_compute_pool_block_sizes( &block_size_a_new,
 	                                     &block_size_b_new,
 	                                     &block_size_c_new,
 	                                     cntx );
 
-	// Reinitialize the pool, but only if one of the parameters has
-	// changed in such a way that reinitialization would be required.
-	// In this case, the align_size is constant, as is num_blocks, so
-	// what this actually boils down to is that reinitialization of a
-	// pool occurs only if the block size for that pool has increased.
-	bli_pool_reinit_if( num_blocks_a, block_size_a_new, align_size, pool_a );
-	bli_pool_reinit_if( num_blocks_b, block_size_b_new, align_size, pool_b );
-	bli_pool_reinit_if( num_blocks_c, block_size_c_new, align_size, pool_c );
+	for ( node = 0; node < bli_membrk_num_nodes( membrk ); ++node )
+	{
+		// Alias the pool addresses to convenient identifiers.
+		pool_t*     pool_a       = bli_membrk_node_pool( node, index_a, membrk );
+		pool_t*     pool_b       = bli_membrk_node_pool( node, index_b, membrk );
+		pool_t*     pool_c       = bli_membrk_node_pool( node, index_c, membrk );
+
+		// Query the number of blocks currently allocated in each pool.
+		const dim_t num_blocks_a = bli_pool_num_blocks( pool_a );
+		const dim_t num_blocks_b = bli_pool_num_blocks( pool_b );
+		const dim_t num_blocks_c = bli_pool_num_blocks( pool_c );
+
+		// Reinitialize the pool, but only if one of the parameters has
+		// changed in such a way that reinitialization would be required.
+		// In this case, the align_size is constant, as is num_blocks, so
+		// what this actually boils down to is that reinitialization of a
+		// pool occurs only if the block size for that pool has increased.
+		bli_pool_reinit_if( num_blocks_a, block_size_a_new, align_size, pool_a );
+		bli_pool_reinit_if( num_blocks_b, block_size_b_new, align_size, pool_b );
+		bli_pool_reinit_if( num_blocks_c, block_size_c_new, align_size, pool_c );
+	}
 }
 
 void bli_membrk_finalize_pools
@@ -381,15 +962,55 @@ void bli_membrk_finalize_pools
 	dim_t   index_b = bli_packbuf_index( BLIS_BUFFER_FOR_B_PANEL );
 	dim_t   index_c = bli_packbuf_index( BLIS_BUFFER_FOR_C_PANEL );
 
-	// Alias the pool addresses to convenient identifiers.
-	pool_t* pool_a  = bli_membrk_pool( index_a, membrk );
-	pool_t* pool_b  = bli_membrk_pool( index_b, membrk );
-	pool_t* pool_c  = bli_membrk_pool( index_c, membrk );
+	dim_t   node;
+
+	for ( node = 0; node < bli_membrk_num_nodes( membrk ); ++node )
+	{
+		// Alias the pool addresses to convenient identifiers.
+		pool_t* pool_a = bli_membrk_node_pool( node, index_a, membrk );
+		pool_t* pool_b = bli_membrk_node_pool( node, index_b, membrk );
+		pool_t* pool_c = bli_membrk_node_pool( node, index_c, membrk );
+
+		// Finalize the memory pools for A, B, and C.
+		bli_pool_finalize( pool_a );
+		bli_pool_finalize( pool_b );
+		bli_pool_finalize( pool_c );
+	}
+}
+
+void bli_membrk_init_gen_pools
+     (
+       membrk_t* membrk
+     )
+{
+	siz_t block_size = ( siz_t )1 << BLIS_GEN_POOL_MIN_SIZE_LOG2;
+	dim_t i;
+
+	// Start with empty pools, one per size class.
+	for ( i = 0; i < BLIS_NUM_GEN_POOLS; ++i, block_size <<= 1 )
+	{
+		bli_pool_init( 0, block_size, BLIS_HEAP_ADDR_ALIGN_SIZE,
+		               bli_membrk_gen_pool( i, membrk ) );
+	}
+
+	membrk->gen_footprint = 0;
+}
+
+void bli_membrk_finalize_gen_pools
+     (
+       membrk_t* membrk
+     )
+{
+	dim_t i;
+
+	// Return the blocks cached by all threads to their pools so that they
+	// are freed below.
+	bli_membrk_gen_cache_drain( membrk );
+
+	for ( i = 0; i < BLIS_NUM_GEN_POOLS; ++i )
+		bli_pool_finalize( bli_membrk_gen_pool( i, membrk ) );
 
-	// Finalize the memory pools for A, B, and C.
-	bli_pool_finalize( pool_a );
-	bli_pool_finalize( pool_b );
-	bli_pool_finalize( pool_c );
+	membrk->gen_footprint = 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -39,7 +39,23 @@
 
 #define bli_membrk_pool( pool_index, membrk_p ) \
 \
-	( (membrk_p)->pools + (pool_index) )
+	( (membrk_p)->pools[0] + (pool_index) )
+
+#define bli_membrk_node_pool( node, pool_index, membrk_p ) \
+\
+	( (membrk_p)->pools[node] + (pool_index) )
+
+#define bli_membrk_gen_pool( class_index, membrk_p ) \
+\
+	( (membrk_p)->gen_pools + (class_index) )
+
+#define bli_membrk_num_nodes( membrk_p ) \
+\
+	( (membrk_p)->n_nodes )
+
+#define bli_membrk_max_size( membrk_p ) \
+\
+	( (membrk_p)->max_size )
 
 #define bli_membrk_mutex( membrk_p ) \
 \
@@ -116,11 +132,50 @@ void bli_membrk_release
        mem_t* mem
      );
 
+void bli_membrk_touch_part
+     (
+       mem_t* mem,
+       dim_t  part,
+       dim_t  n_parts
+     );
+
 siz_t bli_membrk_pool_size
      (
        membrk_t* membrk,
        packbuf_t buf_type
      );
+siz_t bli_membrk_node_pool_size
+     (
+       membrk_t* membrk,
+       dim_t     node,
+       packbuf_t buf_type
+     );
+
+void bli_membrk_pool_stats
+     (
+       membrk_t*     membrk,
+       packbuf_t     buf_type,
+       pool_stats_t* stats
+     );
+siz_t bli_membrk_trim
+     (
+       membrk_t* membrk
+     );
+siz_t bli_membrk_trim_if_idle
+     (
+       membrk_t* membrk,
+       dim_t*    num_uses_prev
+     );
+void bli_membrk_reserve
+     (
+       dim_t     num_blocks,
+       membrk_t* membrk
+     );
+void bli_membrk_set_max_size
+     (
+       siz_t     max_size,
+       membrk_t* membrk
+     );
 
 // ----------------------------------------------------------------------------
 
@@ -139,6 +194,15 @@ void bli_membrk_finalize_pools
        membrk_t* membrk
      );
 
+void bli_membrk_init_gen_pools
+     (
+       membrk_t* membrk
+     );
+void bli_membrk_finalize_gen_pools
+     (
+       membrk_t* membrk
+     );
+
 void bli_membrk_compute_pool_block_sizes
      (
        siz_t*  bs_a,
@@ -41,6 +41,77 @@ pthread_mutex_t mem_manager_mutex = PTHREAD_MUTEX_INITIALIZER;
 
 static membrk_t global_membrk;
 
+#ifdef BLIS_ENABLE_PTHREADS
+// The background thread that trims the pools of the global membrk_t once
+// they have been idle for trim_idle_ms milliseconds.
+static pthread_t       trim_thread;
+static pthread_mutex_t trim_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  trim_cond  = PTHREAD_COND_INITIALIZER;
+static bool_t          trim_stop;
+static bool_t          trim_running = FALSE;
+static dim_t           trim_idle_ms;
+
+static void* bli_memsys_trim_thread_entry( void* arg )
+{
+	dim_t           num_uses_prev = -1;
+	struct timespec deadline;
+
+	pthread_mutex_lock( &trim_mutex );
+
+	while ( !trim_stop )
+	{
+		clock_gettime( CLOCK_REALTIME, &deadline );
+
+		deadline.tv_sec  += trim_idle_ms / 1000;
+		deadline.tv_nsec += ( trim_idle_ms % 1000 ) * 1000000;
+
+		if ( deadline.tv_nsec >= 1000000000 )
+		{
+			deadline.tv_sec  += 1;
+			deadline.tv_nsec -= 1000000000;
+		}
+
+		// Sleep for one idle period, or until bli_memsys_finalize() asks
+		// us to stop.
+		while ( !trim_stop &&
+		        pthread_cond_timedwait( &trim_cond, &trim_mutex, &deadline ) == 0 );
+
+		if ( trim_stop ) break;
+
+		bli_membrk_trim_if_idle( &global_membrk, &num_uses_prev );
+	}
+
+	pthread_mutex_unlock( &trim_mutex );
+
+	return NULL;
+}
+
+static void bli_memsys_trim_thread_start( void )
+{
+	trim_idle_ms = bli_env_read_nway( "BLIS_POOL_TRIM_IDLE_MS", BLIS_POOL_TRIM_IDLE_MS );
+
+	if ( trim_idle_ms <= 0 || trim_running ) return;
+
+	trim_stop    = FALSE;
+	trim_running = ( pthread_create( &trim_thread, NULL,
+	                                 bli_memsys_trim_thread_entry, NULL ) == 0 );
+}
+
+static void bli_memsys_trim_thread_stop( void )
+{
+	if ( !trim_running ) return;
+
+	pthread_mutex_lock( &trim_mutex );
+	trim_stop = TRUE;
+	pthread_cond_signal( &trim_cond );
+	pthread_mutex_unlock( &trim_mutex );
+
+	pthread_join( trim_thread, NULL );
+
+	trim_running = FALSE;
+}
+#endif
+
 // -----------------------------------------------------------------------------
 
 membrk_t* bli_memsys_global_membrk( void )
@@ -83,6 +154,11 @@ void bli_memsys_init( void )
 			// Initialize the global membrk_t object and its memory pools.
 			bli_membrk_init( &cntx, &global_membrk );
 
+#ifdef BLIS_ENABLE_PTHREADS
+			// Start trimming the pools when idle, if requested.
+			bli_memsys_trim_thread_start();
+#endif
+
 			// After initialization, mark the API as initialized.
 			bli_memsys_is_init = TRUE;
 		}
@@ -153,6 +229,14 @@ void bli_memsys_finalize( void )
 		// critical section.
 		if ( bli_memsys_is_init == TRUE )
 		{
+#ifdef BLIS_ENABLE_PTHREADS
+			// Stop the trimming thread before its pools go away.
+			bli_memsys_trim_thread_stop();
+#endif
+
+			// Give the recycled internal allocations back to the heap.
+			bli_malloc_set_reserve_mode( BLIS_RESERVE_OFF );
+
 			// Finalize the global membrk_t object and its memory pools.
 			bli_membrk_finalize( &global_membrk );
 
@@ -172,3 +256,231 @@ bool_t bli_memsys_is_initialized( void )
 	return bli_memsys_is_init;
 }
 
+// -----------------------------------------------------------------------------
+
+void bli_memsys_pool_stats( packbuf_t buf_type, pool_stats_t* stats )
+{
+	bli_pool_stats_clear( stats );
+
+	if ( bli_memsys_is_init == FALSE ) return;
+
+	bli_membrk_pool_stats( &global_membrk, buf_type, stats );
+}
+
+siz_t bli_memsys_trim( void )
+{
+	if ( bli_memsys_is_init == FALSE ) return 0;
+
+	return bli_membrk_trim( &global_membrk );
+}
+
+void bli_memsys_set_max_size( siz_t max_size )
+{
+	// Make sure the global membrk_t exists so that the cap is not lost
+	// to a later initialization.
+	bli_memsys_init();
+
+	bli_membrk_set_max_size( max_size, &global_membrk );
+}
+
+siz_t bli_memsys_max_size( void )
+{
+	if ( bli_memsys_is_init == FALSE ) return 0;
+
+	return bli_membrk_max_size( &global_membrk );
+}
+
+// -----------------------------------------------------------------------------
+
+// Each thread of the warm-up acquires a block for A and a block for B from
+// the pools of its node and touches them, so that their pages are placed
+// near it. The blocks are held until all threads are done so that the pools
+// grow to one block of each per thread.
+static void bli_memsys_warmup_thread( dim_t tid, dim_t nt, void* params )
+{
+	mem_t* mem = ( mem_t* )params + 2 * tid;
+
+	bli_membrk_acquire_m( &global_membrk, 1, BLIS_BUFFER_FOR_A_BLOCK, &mem[ 0 ] );
+	bli_membrk_acquire_m( &global_membrk, 1, BLIS_BUFFER_FOR_B_PANEL, &mem[ 1 ] );
+
+	bli_membrk_touch_part( &mem[ 0 ], 0, 1 );
+	bli_membrk_touch_part( &mem[ 1 ], 0, 1 );
+}
+
+void bli_memsys_warmup( dim_t n_threads )
+{
+	mem_t* mems;
+	dim_t  i;
+
+	bli_init();
+
+	if ( n_threads < 1 ) n_threads = bli_env_read_nthread();
+
+	mems = bli_malloc_intl( 2 * n_threads * sizeof( mem_t ) );
+
+	bli_thread_launch( n_threads, bli_memsys_warmup_thread, mems );
+
+	for ( i = 0; i < 2 * n_threads; ++i )
+		bli_membrk_release( &mems[ i ] );
+
+	bli_free_intl( mems );
+}
+
+// -----------------------------------------------------------------------------
+
+// Run op once on zero operands of the given datatype and (maximum) sizes,
+// with A on the given side and the structured operand stored in the given
+// triangle, so that the internal memory it uses gets allocated, touched by
+// the threads that use it, and recycled.
+static void bli_memsys_reserve_run
+     (
+       opid_t op,
+       side_t side,
+       uplo_t uplo,
+       num_t  dt,
+       dim_t  m,
+       dim_t  n,
+       dim_t  k
+     )
+{
+	obj_t   a, b, c;
+	dim_t   m_a, n_a, m_b, n_b;
+	struc_t struc;
+
+	switch ( op )
+	{
+		case BLIS_GEMM:
+			m_a = m; n_a = k; m_b = k; n_b = n; struc = BLIS_GENERAL; break;
+		case BLIS_HERK:
+		case BLIS_HER2K:
+			m_a = m; n_a = k; m_b = m; n_b = k; n = m; struc = BLIS_HERMITIAN; break;
+		case BLIS_SYRK:
+		case BLIS_SYR2K:
+			m_a = m; n_a = k; m_b = m; n_b = k; n = m; struc = BLIS_SYMMETRIC; break;
+		default:
+			m_a = n_a = ( bli_is_left( side ) ? m : n ); m_b = m; n_b = n;
+			struc = ( op == BLIS_HEMM ? BLIS_HERMITIAN :
+			          op == BLIS_SYMM ? BLIS_SYMMETRIC : BLIS_TRIANGULAR );
+	}
+
+	bli_obj_create( dt, m_a, n_a, 0, 0, &a );
+	bli_obj_create( dt, m_b, n_b, 0, 0, &b );
+	bli_obj_create( dt, m,   n,   0, 0, &c );
+
+	bli_setm( &BLIS_ZERO, &a );
+	bli_setm( &BLIS_ZERO, &b );
+	bli_setm( &BLIS_ZERO, &c );
+
+	// Give triangular matrices a unit diagonal so that trsm stays finite.
+	if ( struc == BLIS_TRIANGULAR ) bli_setd( &BLIS_ONE, &a );
+
+	if ( op == BLIS_HERK || op == BLIS_HER2K ||
+	     op == BLIS_SYRK || op == BLIS_SYR2K )
+	{
+		bli_obj_set_struc( struc, c );
+		bli_obj_set_uplo( uplo, c );
+	}
+	else if ( op != BLIS_GEMM )
+	{
+		bli_obj_set_struc( struc, a );
+		bli_obj_set_uplo( uplo, a );
+	}
+
+	switch ( op )
+	{
+		case BLIS_GEMM:  bli_gemm( &BLIS_ONE, &a, &b, &BLIS_ZERO, &c ); break;
+		case BLIS_HEMM:  bli_hemm( side, &BLIS_ONE, &a, &b, &BLIS_ZERO, &c ); break;
+		case BLIS_SYMM:  bli_symm( side, &BLIS_ONE, &a, &b, &BLIS_ZERO, &c ); break;
+		case BLIS_HERK:  bli_herk( &BLIS_ONE, &a, &BLIS_ZERO, &c ); break;
+		case BLIS_SYRK:  bli_syrk( &BLIS_ONE, &a, &BLIS_ZERO, &c ); break;
+		case BLIS_HER2K: bli_her2k( &BLIS_ONE, &a, &b, &BLIS_ZERO, &c ); break;
+		case BLIS_SYR2K: bli_syr2k( &BLIS_ONE, &a, &b, &BLIS_ZERO, &c ); break;
+		case BLIS_TRMM3: bli_trmm3( side, &BLIS_ONE, &a, &b, &BLIS_ZERO, &c ); break;
+		case BLIS_TRMM:  bli_trmm( side, &BLIS_ONE, &a, &b ); break;
+		case BLIS_TRSM:  bli_trsm( side, &BLIS_ONE, &a, &b ); break;
+		default: break;
+	}
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+}
+
+void bli_memsys_reserve
+     (
+       opid_t op,
+       num_t  dt,
+       dim_t  m,
+       dim_t  n,
+       dim_t  k
+     )
+{
+	const bool_t has_side = ( op == BLIS_HEMM  || op == BLIS_SYMM ||
+	                          op == BLIS_TRMM3 || op == BLIS_TRMM ||
+	                          op == BLIS_TRSM );
+	const bool_t has_uplo = ( op != BLIS_GEMM );
+
+	dim_t        s, u;
+
+	bli_init();
+
+#ifdef BLIS_ENABLE_PTHREADS
+	// Reserved memory must not be trimmed. The trimming thread is started
+	// and stopped under the same lock as in bli_memsys_init() and
+	// bli_memsys_finalize(), so that it is never joined twice.
+	pthread_mutex_lock( &mem_manager_mutex );
+
+	// BEGIN CRITICAL SECTION
+	{
+		bli_memsys_trim_thread_stop();
+	}
+	// END CRITICAL SECTION
+
+	pthread_mutex_unlock( &mem_manager_mutex );
+#endif
+
+	// Recycle internal allocations from now on, and run op in every
+	// configuration it may be called in so that the free lists fill up.
+	bli_malloc_set_reserve_mode( BLIS_RESERVE_FILLING );
+
+	if ( 0 < m && 0 < n && 0 < k && op < BLIS_NOID )
+	{
+		for ( s = 0; s < ( has_side ? 2 : 1 ); ++s )
+		for ( u = 0; u < ( has_uplo ? 2 : 1 ); ++u )
+		{
+			bli_memsys_reserve_run( op,
+			                        ( s == 0 ? BLIS_LEFT  : BLIS_RIGHT ),
+			                        ( u == 0 ? BLIS_LOWER : BLIS_UPPER ),
+			                        dt, m, n, k );
+		}
+	}
+
+	// The call above used only the thread groups of one partitioning of
+	// the threads, so make room in the pools for any other.
+	bli_membrk_reserve( bli_env_read_nthread(), &global_membrk );
+
+	bli_malloc_set_reserve_mode( BLIS_RESERVE_SEALED );
+}
+
+void bli_memsys_unreserve( void )
+{
+	bli_malloc_set_reserve_mode( BLIS_RESERVE_OFF );
+
+#ifdef BLIS_ENABLE_PTHREADS
+	pthread_mutex_lock( &mem_manager_mutex );
+
+	// BEGIN CRITICAL SECTION
+	{
+		if ( bli_memsys_is_init == TRUE ) bli_memsys_trim_thread_start();
+	}
+	// END CRITICAL SECTION
+
+	pthread_mutex_unlock( &mem_manager_mutex );
+#endif
+}
+
+dim_t bli_memsys_reserve_num_misses( void )
+{
+	return bli_malloc_reserve_num_misses();
+}
+
@@ -47,6 +47,23 @@ void   bli_memsys_reinit( cntx_t* cntx );
 void   bli_memsys_finalize( void );
 bool_t bli_memsys_is_initialized( void );
 
+// -----------------------------------------------------------------------------
+
+void   bli_memsys_pool_stats( packbuf_t buf_type, pool_stats_t* stats );
+siz_t  bli_memsys_trim( void );
+void   bli_memsys_set_max_size( siz_t max_size );
+siz_t  bli_memsys_max_size( void );
+
+// -----------------------------------------------------------------------------
+
+void   bli_memsys_warmup( dim_t n_threads );
+
+// -----------------------------------------------------------------------------
+
+void   bli_memsys_reserve( opid_t op, num_t dt, dim_t m, dim_t n, dim_t k );
+void   bli_memsys_unreserve( void );
+dim_t  bli_memsys_reserve_num_misses( void );
+
 
 #endif
 
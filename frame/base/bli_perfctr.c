@@ -0,0 +1,214 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#if defined(__linux__)
+  #define _GNU_SOURCE
+#endif
+
+#include "blis.h"
+
+#if BLIS_OS_LINUX
+  #include <unistd.h>
+  #include <sys/syscall.h>
+  #include <linux/perf_event.h>
+#endif
+
+static char* perfctr_ev_str[ BLIS_NUM_PERF_EVENTS ] =
+{
+	"cycles",
+	"instructions",
+	"l1d misses",
+	"l2 misses",
+	"llc misses",
+	"dtlb misses",
+};
+
+#if BLIS_OS_LINUX
+
+#define PERFCTR_CACHE_EV( cache, op, result ) \
+\
+	( ( cache ) | ( ( op ) << 8 ) | ( ( result ) << 16 ) )
+
+static void bli_perfctr_init_attr( perf_ev_t ev, struct perf_event_attr* attr )
+{
+	char* str;
+
+	memset( attr, 0, sizeof( struct perf_event_attr ) );
+
+	attr->size = sizeof( struct perf_event_attr );
+	attr->type = PERF_TYPE_HARDWARE;
+
+	switch ( ev )
+	{
+		case BLIS_PERF_CYCLES:
+		attr->config = PERF_COUNT_HW_CPU_CYCLES;
+		break;
+
+		case BLIS_PERF_INSTRUCTIONS:
+		attr->config = PERF_COUNT_HW_INSTRUCTIONS;
+		break;
+
+		case BLIS_PERF_L1D_MISSES:
+		attr->type   = PERF_TYPE_HW_CACHE;
+		attr->config = PERFCTR_CACHE_EV( PERF_COUNT_HW_CACHE_L1D,
+		                                 PERF_COUNT_HW_CACHE_OP_READ,
+		                                 PERF_COUNT_HW_CACHE_RESULT_MISS );
+		break;
+
+		case BLIS_PERF_L2_MISSES:
+		str = getenv( "BLIS_PERF_L2_RAW" );
+		if ( str != NULL )
+		{
+			attr->type   = PERF_TYPE_RAW;
+			attr->config = strtoull( str, NULL, 0 );
+		}
+		else
+		{
+			attr->config = PERF_COUNT_HW_CACHE_REFERENCES;
+		}
+		break;
+
+		case BLIS_PERF_LLC_MISSES:
+		attr->config = PERF_COUNT_HW_CACHE_MISSES;
+		break;
+
+		case BLIS_PERF_DTLB_MISSES:
+		default:
+		attr->type   = PERF_TYPE_HW_CACHE;
+		attr->config = PERFCTR_CACHE_EV( PERF_COUNT_HW_CACHE_DTLB,
+		                                 PERF_COUNT_HW_CACHE_OP_READ,
+		                                 PERF_COUNT_HW_CACHE_RESULT_MISS );
+		break;
+	}
+
+	// Count user-space events only, so that the counters work with the
+	// default perf_event_paranoid setting.
+	attr->exclude_kernel = 1;
+	attr->exclude_hv     = 1;
+	attr->read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED |
+	                       PERF_FORMAT_TOTAL_TIME_RUNNING;
+}
+
+#endif
+
+// -----------------------------------------------------------------------------
+
+dim_t bli_perfctr_open( bool_t inherit, perfctr_t* ctr )
+{
+	dim_t i;
+
+	ctr->n_avail = 0;
+
+	for ( i = 0; i < BLIS_NUM_PERF_EVENTS; ++i )
+	{
+		ctr->fd[ i ] = -1;
+
+#if BLIS_OS_LINUX
+		{
+			struct perf_event_attr attr;
+
+			bli_perfctr_init_attr( i, &attr );
+			attr.inherit = ( inherit ? 1 : 0 );
+
+			// Count the calling thread on any cpu. Events are opened
+			// individually rather than as a group so that the kernel can
+			// multiplex them when there are fewer counters than events.
+			ctr->fd[ i ] = ( int )syscall( SYS_perf_event_open, &attr,
+			                               0, -1, -1, 0 );
+		}
+#else
+		( void )inherit;
+#endif
+
+		if ( ctr->fd[ i ] >= 0 ) ctr->n_avail += 1;
+	}
+
+	return ctr->n_avail;
+}
+
+void bli_perfctr_close( perfctr_t* ctr )
+{
+	dim_t i;
+
+	for ( i = 0; i < BLIS_NUM_PERF_EVENTS; ++i )
+	{
+#if BLIS_OS_LINUX
+		if ( ctr->fd[ i ] >= 0 ) close( ctr->fd[ i ] );
+#endif
+		ctr->fd[ i ] = -1;
+	}
+
+	ctr->n_avail = 0;
+}
+
+void bli_perfctr_read( perfctr_t* ctr, uint64_t* counts )
+{
+	dim_t i;
+
+	for ( i = 0; i < BLIS_NUM_PERF_EVENTS; ++i )
+	{
+		counts[ i ] = 0;
+
+#if BLIS_OS_LINUX
+		if ( ctr->fd[ i ] >= 0 )
+		{
+			// The value, the time the event was enabled, and the time it
+			// was actually counting.
+			uint64_t buf[ 3 ];
+
+			if ( read( ctr->fd[ i ], buf, sizeof( buf ) ) != sizeof( buf ) )
+				continue;
+
+			if ( buf[ 2 ] == 0 )
+				counts[ i ] = 0;
+			else if ( buf[ 2 ] < buf[ 1 ] )
+				counts[ i ] = ( uint64_t )( ( double )buf[ 0 ] *
+				                            ( double )buf[ 1 ] /
+				                            ( double )buf[ 2 ] );
+			else
+				counts[ i ] = buf[ 0 ];
+		}
+#endif
+	}
+}
+
+bool_t bli_perfctr_is_avail( perfctr_t* ctr, perf_ev_t ev )
+{
+	return ( ctr->fd[ ev ] >= 0 );
+}
+
+char* bli_perfctr_event_string( perf_ev_t ev )
+{
+	return perfctr_ev_str[ ev ];
+}
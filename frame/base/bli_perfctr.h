@@ -0,0 +1,83 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_PERFCTR_H
+#define BLIS_PERFCTR_H
+
+//
+// Hardware performance counters via the Linux perf_event_open() interface.
+//
+// A perfctr_t counts the events below for the calling thread (and, if it was
+// opened with inherit = TRUE, for the threads that the calling thread creates
+// afterwards, once they have exited). Counting starts when the counters are
+// opened; bli_perfctr_read() returns the running totals, so a measurement is
+// the difference of two reads. Events that the kernel or the hardware does
+// not support (and all events on other operating systems, or when
+// perf_event_paranoid forbids user-space counting) read as zero, and
+// bli_perfctr_is_avail() reports them as unavailable. Counts are scaled up
+// when the kernel had to multiplex the events onto fewer hardware counters.
+//
+// There is no generic perf event for L2 misses. By default, L2 misses are
+// counted as the cache references of the last-level cache, which on Intel
+// cores are the requests that missed the L2. Set BLIS_PERF_L2_RAW to a raw
+// event code (e.g. 0x3f24 for L2_RQSTS.MISS on Haswell) to count a specific
+// event instead.
+//
+
+typedef enum
+{
+	BLIS_PERF_CYCLES = 0,
+	BLIS_PERF_INSTRUCTIONS,
+	BLIS_PERF_L1D_MISSES,
+	BLIS_PERF_L2_MISSES,
+	BLIS_PERF_LLC_MISSES,
+	BLIS_PERF_DTLB_MISSES,
+} perf_ev_t;
+
+#define BLIS_NUM_PERF_EVENTS   6
+
+typedef struct
+{
+	int    fd[ BLIS_NUM_PERF_EVENTS ];
+	dim_t  n_avail;
+} perfctr_t;
+
+
+dim_t  bli_perfctr_open( bool_t inherit, perfctr_t* ctr );
+void   bli_perfctr_close( perfctr_t* ctr );
+void   bli_perfctr_read( perfctr_t* ctr, uint64_t* counts );
+bool_t bli_perfctr_is_avail( perfctr_t* ctr, perf_ev_t ev );
+char*  bli_perfctr_event_string( perf_ev_t ev );
+
+#endif
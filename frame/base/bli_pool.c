@@ -58,6 +58,12 @@ void bli_pool_init( dim_t   num_blocks,
 	bli_pool_set_top_index( 0, pool );
 	bli_pool_set_block_size( block_size, pool );
 	bli_pool_set_align_size( align_size, pool );
+
+	// Start the statistics of the pool.
+	pool->num_blocks_max = num_blocks;
+	pool->num_checkouts  = 0;
+	pool->num_allocs     = num_blocks;
+	pool->num_frees      = 0;
 }
 
 void bli_pool_finalize( pool_t* pool )
@@ -97,6 +103,11 @@ void bli_pool_finalize( pool_t* pool )
 	bli_pool_set_top_index( 0, pool );
 	bli_pool_set_block_size( 0, pool );
 	bli_pool_set_align_size( 0, pool );
+
+	pool->num_blocks_max = 0;
+	pool->num_checkouts  = 0;
+	pool->num_allocs     = 0;
+	pool->num_frees      = 0;
 }
 
 void bli_pool_reinit( dim_t   num_blocks_new,
@@ -104,6 +115,13 @@ void bli_pool_reinit( dim_t   num_blocks_new,
                       siz_t   align_size_new,
                       pool_t* pool )
 {
+	// Save the statistics of the pool so that they survive the change
+	// of configuration. The blocks freed by the finalization below count
+	// as frees.
+	pool_t stats = *pool;
+
+	stats.num_frees += bli_pool_num_blocks_avail( pool );
+
 	// Finalize the pool as it is currently configured. If some blocks
 	// are still checked out to threads, those blocks are not freed
 	// here, and instead will be freed when the threads are ready to
@@ -114,6 +132,11 @@ void bli_pool_reinit( dim_t   num_blocks_new,
 	// Reinitialize the pool with the new parameters, in particular,
 	// the new block size.
 	bli_pool_init( num_blocks_new, block_size_new, align_size_new, pool );
+
+	pool->num_blocks_max = bli_max( stats.num_blocks_max, num_blocks_new );
+	pool->num_checkouts  = stats.num_checkouts;
+	pool->num_allocs     = stats.num_allocs + num_blocks_new;
+	pool->num_frees      = stats.num_frees;
 }
 
 void bli_pool_reinit_if( dim_t   num_blocks_new,
@@ -178,6 +201,8 @@ void bli_pool_checkout_block( pblk_t* block, pool_t* pool )
 
 	// Increment the pool's top_index.
 	bli_pool_set_top_index( top_index + 1, pool );
+
+	pool->num_checkouts += 1;
 }
 
 void bli_pool_checkin_block( pblk_t* block, pool_t* pool )
@@ -282,6 +307,9 @@ void bli_pool_grow( dim_t num_blocks_add, pool_t* pool )
 	// Notice that top_index remains unchanged, as do the block_size and
 	// align_size fields.
 	bli_pool_set_num_blocks( num_blocks_new, pool );
+
+	pool->num_allocs     += num_blocks_add;
+	pool->num_blocks_max  = bli_max( pool->num_blocks_max, num_blocks_new );
 }
 
 void bli_pool_shrink( dim_t num_blocks_sub, pool_t* pool )
@@ -329,11 +357,52 @@ void bli_pool_shrink( dim_t num_blocks_sub, pool_t* pool )
 	// Update the pool_t struct.
 	bli_pool_set_num_blocks( num_blocks_new, pool );
 
+	pool->num_frees += num_blocks_sub;
+
 	// Note that after shrinking the pool, num_blocks < block_ptrs_len.
 	// This means the pool can grow again by num_blocks_sub before
 	// a re-allocation of block_ptrs is triggered.
 }
 
+siz_t bli_pool_trim( pool_t* pool )
+{
+	// Free every block that is not checked out and return the number of
+	// bytes released.
+	dim_t num_blocks_sub = bli_pool_num_blocks_avail( pool );
+
+	bli_pool_shrink( num_blocks_sub, pool );
+
+	return num_blocks_sub * bli_pool_block_size( pool );
+}
+
+void bli_pool_stats_clear( pool_stats_t* stats )
+{
+	stats->size             = 0;
+	stats->size_max         = 0;
+	stats->num_blocks       = 0;
+	stats->num_blocks_avail = 0;
+	stats->num_blocks_max   = 0;
+	stats->num_checkouts    = 0;
+	stats->num_allocs       = 0;
+	stats->num_frees        = 0;
+}
+
+void bli_pool_stats_accum( pool_t* pool, pool_stats_t* stats )
+{
+	// Add the statistics of the pool to those in stats. Note that the
+	// high-water mark of the size is that of each pool, so the sum over
+	// several pools bounds their combined high-water mark from above.
+	stats->size             += bli_pool_size( pool );
+	stats->size_max         += bli_pool_block_size( pool ) *
+	                           bli_pool_num_blocks_max( pool );
+	stats->num_blocks       += bli_pool_num_blocks( pool );
+	stats->num_blocks_avail += bli_pool_num_blocks_avail( pool );
+	stats->num_blocks_max   += bli_pool_num_blocks_max( pool );
+	stats->num_checkouts    += bli_pool_num_checkouts( pool );
+	stats->num_allocs       += bli_pool_num_allocs( pool );
+	stats->num_frees        += bli_pool_num_frees( pool );
+}
+
 void bli_pool_alloc_block( siz_t   block_size,
                            siz_t   align_size,
                            pblk_t* block )
@@ -58,6 +58,11 @@ typedef struct
 
     siz_t   block_size;
     siz_t   align_size;
+
+    dim_t   num_blocks_max;
+    dim_t   num_checkouts;
+    dim_t   num_allocs;
+    dim_t   num_frees;
 } pool_t;
 */
 
@@ -122,6 +127,32 @@ typedef struct
 	( bli_pool_top_index( pool_p ) == \
 	  bli_pool_num_blocks( pool_p ) )
 
+#define bli_pool_num_blocks_avail( pool_p ) \
+\
+	( bli_pool_num_blocks( pool_p ) - \
+	  bli_pool_top_index( pool_p ) )
+
+#define bli_pool_size( pool_p ) \
+\
+	( bli_pool_block_size( pool_p ) * \
+	  bli_pool_num_blocks( pool_p ) )
+
+#define bli_pool_num_blocks_max( pool_p ) \
+\
+	( (pool_p)->num_blocks_max )
+
+#define bli_pool_num_checkouts( pool_p ) \
+\
+	( (pool_p)->num_checkouts )
+
+#define bli_pool_num_allocs( pool_p ) \
+\
+	( (pool_p)->num_allocs )
+
+#define bli_pool_num_frees( pool_p ) \
+\
+	( (pool_p)->num_frees )
+
 // Pool entry modification
 
 #define bli_pool_set_block_ptrs( block_ptrs0, pool_p ) \
@@ -177,6 +208,10 @@ void bli_pool_checkin_block( pblk_t* block, pool_t* pool );
 
 void bli_pool_grow( dim_t num_blocks_add, pool_t* pool );
 void bli_pool_shrink( dim_t num_blocks_sub, pool_t* pool );
+siz_t bli_pool_trim( pool_t* pool );
+
+void bli_pool_stats_clear( pool_stats_t* stats );
+void bli_pool_stats_accum( pool_t* pool, pool_stats_t* stats );
 
 void bli_pool_alloc_block( siz_t   block_size,
                            siz_t   align_size,
@@ -0,0 +1,699 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// The accumulators of one thread. The padding keeps the hot fields of
+// neighbouring threads on separate cache lines.
+typedef struct
+{
+	uint64_t ticks[ BLIS_NUM_PROF_PHASES ];
+	uint64_t count[ BLIS_NUM_PROF_PHASES ];
+
+	// Barrier waits by loop level, and micro-kernel invocations.
+	uint64_t bar_ticks[ BLIS_NUM_PROF_LEVELS ];
+	uint64_t bar_count[ BLIS_NUM_PROF_LEVELS ];
+	uint64_t ukr_count;
+
+	// Hardware events by phase, and the counter values at the last phase
+	// change.
+	uint64_t events[ BLIS_NUM_PROF_PHASES ][ BLIS_NUM_PERF_EVENTS ];
+	uint64_t last_ev[ BLIS_NUM_PERF_EVENTS ];
+
+	// The stack of active phases and the timestamp of the last phase change.
+	int      stack[ BLIS_PROF_MAX_DEPTH ];
+	dim_t    depth;
+	uint64_t last;
+	uint64_t bar_start;
+
+	// The stack of active loop levels.
+	int      lstack[ BLIS_PROF_MAX_DEPTH ];
+	dim_t    ldepth;
+
+	// Snapshots taken when the thread entered the current operation, and
+	// the resulting totals for that operation.
+	uint64_t call_start;
+	uint64_t call_bar0[ BLIS_NUM_PROF_LEVELS ];
+	uint64_t call_ukr0;
+	uint64_t call_busy;
+	uint64_t call_bar[ BLIS_NUM_PROF_LEVELS ];
+	uint64_t call_ukr;
+
+	char     pad[ BLIS_CACHE_LINE_SIZE ];
+} prof_thread_t;
+
+static prof_thread_t prof_threads[ BLIS_PROF_MAX_THREADS ];
+
+// The highest thread slot that has been used since the last reset.
+static dim_t         prof_max_tid = 0;
+
+// The slot of the calling thread.
+static __thread dim_t prof_tid = 0;
+
+// The load balance of the most recent level-3 operation.
+static prof_imb_t    prof_imb;
+
+// Whether hardware events are counted, which events could be opened, and
+// the counters of the calling thread (open only within an operation).
+static bool_t        prof_perf = FALSE;
+static bool_t        prof_perf_avail[ BLIS_NUM_PERF_EVENTS ];
+
+static __thread perfctr_t prof_ctr;
+static __thread bool_t    prof_ctr_open = FALSE;
+
+// A reference point for converting ticks to seconds.
+static uint64_t      prof_ref_ticks = 0;
+static double        prof_ref_time  = 0.0;
+
+static bool_t        prof_atexit_done = FALSE;
+
+static char*         prof_phase_str[ BLIS_NUM_PROF_PHASES ] =
+{
+	"blk_var",
+	"packm_a",
+	"packm_b",
+	"macro-kernel",
+	"edge tiles",
+	"barrier",
+};
+
+static char*         prof_level_str[ BLIS_NUM_PROF_LEVELS ] =
+{
+	"jc",
+	"pc",
+	"ic",
+	"jr",
+};
+
+// -----------------------------------------------------------------------------
+
+static inline uint64_t bli_prof_ticks( void )
+{
+#if defined(__x86_64__) || defined(__i386__)
+	uint32_t lo, hi;
+
+	__asm__ volatile ( "rdtsc" : "=a" (lo), "=d" (hi) );
+
+	return ( ( uint64_t )hi << 32 ) | lo;
+#else
+	struct timespec ts;
+
+	clock_gettime( CLOCK_MONOTONIC, &ts );
+
+	return ( uint64_t )ts.tv_sec * 1000000000ULL + ( uint64_t )ts.tv_nsec;
+#endif
+}
+
+static double bli_prof_ticks_per_sec( void )
+{
+#if defined(__x86_64__) || defined(__i386__)
+	// Calibrate the timestamp counter against the wall clock over the time
+	// since initialization.
+	double   dt = bli_clock() - prof_ref_time;
+	uint64_t dc = bli_prof_ticks() - prof_ref_ticks;
+
+	if ( dt <= 0.0 || dc == 0 ) return 1.0e9;
+
+	return ( double )dc / dt;
+#else
+	return 1.0e9;
+#endif
+}
+
+// Charge the hardware events since the last phase change to the given phase.
+static void bli_prof_charge_events( prof_thread_t* p, int phase )
+{
+	uint64_t now[ BLIS_NUM_PERF_EVENTS ];
+	dim_t    i;
+
+	bli_perfctr_read( &prof_ctr, now );
+
+	for ( i = 0; i < BLIS_NUM_PERF_EVENTS; ++i )
+	{
+		if ( 0 <= phase ) p->events[ phase ][ i ] += now[ i ] - p->last_ev[ i ];
+
+		p->last_ev[ i ] = now[ i ];
+	}
+}
+
+static void bli_prof_print_at_exit( void )
+{
+	bli_prof_fprint( stderr );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_prof_init( void )
+{
+	// Keep the first reference point so that the calibration interval grows
+	// across bli_init()/bli_finalize() cycles.
+	if ( prof_ref_ticks == 0 )
+	{
+		prof_ref_time  = bli_clock();
+		prof_ref_ticks = bli_prof_ticks();
+	}
+
+	bli_prof_reset();
+
+#ifdef BLIS_ENABLE_PROFILING
+	// If requested, dump the profile when the process exits. (BLIS usually
+	// stays initialized until then, so bli_finalize() is not a good hook.)
+	if ( getenv( "BLIS_PROF_DUMP" ) != NULL && !prof_atexit_done )
+	{
+		atexit( bli_prof_print_at_exit );
+		prof_atexit_done = TRUE;
+	}
+
+	if ( getenv( "BLIS_PROF_PERF" ) != NULL ) prof_perf = TRUE;
+#else
+	( void )prof_atexit_done;
+	( void )bli_prof_print_at_exit;
+#endif
+}
+
+void bli_prof_finalize( void )
+{
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_prof_begin_phase( prof_t phase )
+{
+	prof_thread_t* p   = &prof_threads[ prof_tid ];
+	uint64_t       now = bli_prof_ticks();
+	dim_t          d   = p->depth;
+
+	// Charge the time since the last phase change to the enclosing phase.
+	if ( 0 < d && d <= BLIS_PROF_MAX_DEPTH )
+		p->ticks[ p->stack[ d - 1 ] ] += now - p->last;
+
+	if ( prof_ctr_open )
+		bli_prof_charge_events( p, ( 0 < d && d <= BLIS_PROF_MAX_DEPTH
+		                             ? p->stack[ d - 1 ] : -1 ) );
+
+	if ( d < BLIS_PROF_MAX_DEPTH ) p->stack[ d ] = phase;
+
+	if ( phase == BLIS_PROF_BARRIER ) p->bar_start = now;
+
+	p->depth          = d + 1;
+	p->count[ phase ] += 1;
+	p->last           = now;
+}
+
+void bli_prof_end_phase( prof_t phase )
+{
+	prof_thread_t* p   = &prof_threads[ prof_tid ];
+	uint64_t       now = bli_prof_ticks();
+	dim_t          d   = p->depth;
+
+	// Ignore an unmatched end (e.g. after a reset from within a phase).
+	if ( d == 0 ) return;
+
+	// Charge the time since the last phase change to the phase that ends.
+	if ( d <= BLIS_PROF_MAX_DEPTH )
+		p->ticks[ p->stack[ d - 1 ] ] += now - p->last;
+
+	if ( prof_ctr_open )
+		bli_prof_charge_events( p, ( d <= BLIS_PROF_MAX_DEPTH
+		                             ? p->stack[ d - 1 ] : -1 ) );
+
+	// Attribute barrier waits to the current loop level.
+	if ( phase == BLIS_PROF_BARRIER )
+	{
+		dim_t ld  = p->ldepth;
+		int   lvl = ( 0 < ld && ld <= BLIS_PROF_MAX_DEPTH
+		              ? p->lstack[ ld - 1 ] : BLIS_PROF_LVL_JC );
+
+		p->bar_ticks[ lvl ] += now - p->bar_start;
+		p->bar_count[ lvl ] += 1;
+	}
+
+	p->depth = d - 1;
+	p->last  = now;
+}
+
+void bli_prof_push_level_int( dim_t lvl )
+{
+	prof_thread_t* p = &prof_threads[ prof_tid ];
+	dim_t          d = p->ldepth;
+
+	// Nodes that do not start a loop level stay at the enclosing level.
+	if ( lvl == BLIS_PROF_LVL_INHERIT )
+		lvl = ( 0 < d && d <= BLIS_PROF_MAX_DEPTH
+		        ? p->lstack[ d - 1 ] : BLIS_PROF_LVL_JC );
+
+	if ( d < BLIS_PROF_MAX_DEPTH ) p->lstack[ d ] = lvl;
+
+	p->ldepth = d + 1;
+}
+
+void bli_prof_pop_level_int( void )
+{
+	prof_thread_t* p = &prof_threads[ prof_tid ];
+
+	if ( 0 < p->ldepth ) p->ldepth -= 1;
+}
+
+void bli_prof_count_ukr_int( void )
+{
+	prof_threads[ prof_tid ].ukr_count += 1;
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_prof_begin_thread_int( dim_t id )
+{
+	prof_thread_t* p;
+	dim_t          i;
+
+	if ( id < 0 || BLIS_PROF_MAX_THREADS <= id ) id = 0;
+
+	prof_tid = id;
+
+	if ( prof_max_tid < id ) prof_max_tid = id;
+
+	p = &prof_threads[ id ];
+
+	for ( i = 0; i < BLIS_NUM_PROF_LEVELS; ++i )
+		p->call_bar0[ i ] = p->bar_ticks[ i ];
+
+	p->call_ukr0  = p->ukr_count;
+
+	// Open this thread's hardware counters for the duration of the
+	// operation. (The threads of an operation may be created anew for
+	// each call, so the counters cannot outlive it.)
+	if ( prof_perf && !prof_ctr_open )
+	{
+		bli_perfctr_open( FALSE, &prof_ctr );
+
+		for ( i = 0; i < BLIS_NUM_PERF_EVENTS; ++i )
+			if ( bli_perfctr_is_avail( &prof_ctr, i ) )
+				prof_perf_avail[ i ] = TRUE;
+
+		bli_perfctr_read( &prof_ctr, p->last_ev );
+		prof_ctr_open = TRUE;
+	}
+
+	p->call_start = bli_prof_ticks();
+}
+
+void bli_prof_end_thread_int( void )
+{
+	prof_thread_t* p     = &prof_threads[ prof_tid ];
+	uint64_t       total = bli_prof_ticks() - p->call_start;
+	uint64_t       wait  = 0;
+	dim_t          i;
+
+	for ( i = 0; i < BLIS_NUM_PROF_LEVELS; ++i )
+	{
+		p->call_bar[ i ] = p->bar_ticks[ i ] - p->call_bar0[ i ];
+		wait += p->call_bar[ i ];
+	}
+
+	p->call_busy = ( wait < total ? total - wait : 0 );
+	p->call_ukr  = p->ukr_count - p->call_ukr0;
+
+	if ( prof_ctr_open )
+	{
+		bli_perfctr_close( &prof_ctr );
+		prof_ctr_open = FALSE;
+	}
+}
+
+void bli_prof_end_call_int( dim_t n_threads )
+{
+	double tps = bli_prof_ticks_per_sec();
+	double busy_sum = 0.0;
+	double ukr_sum  = 0.0;
+	dim_t  t, i;
+
+	// The caller has joined the other threads, so their totals for this
+	// operation are final.
+	if ( BLIS_PROF_MAX_THREADS < n_threads ) n_threads = BLIS_PROF_MAX_THREADS;
+
+	prof_imb.n_threads = n_threads;
+	prof_imb.busy_min  = 0.0;
+	prof_imb.busy_max  = 0.0;
+	prof_imb.ukr_min   = 0;
+	prof_imb.ukr_max   = 0;
+
+	for ( i = 0; i < BLIS_NUM_PROF_LEVELS; ++i )
+		prof_imb.wait_max[ i ] = 0.0;
+
+	for ( t = 0; t < n_threads; ++t )
+	{
+		prof_thread_t* p    = &prof_threads[ t ];
+		double         busy = ( double )p->call_busy / tps;
+		dim_t          ukr  = ( dim_t )p->call_ukr;
+
+		if ( t == 0 || busy < prof_imb.busy_min ) prof_imb.busy_min = busy;
+		if ( t == 0 || busy > prof_imb.busy_max ) prof_imb.busy_max = busy;
+		if ( t == 0 || ukr  < prof_imb.ukr_min  ) prof_imb.ukr_min  = ukr;
+		if ( t == 0 || ukr  > prof_imb.ukr_max  ) prof_imb.ukr_max  = ukr;
+
+		busy_sum += busy;
+		ukr_sum  += ( double )ukr;
+
+		for ( i = 0; i < BLIS_NUM_PROF_LEVELS; ++i )
+		{
+			double wait = ( double )p->call_bar[ i ] / tps;
+
+			if ( wait > prof_imb.wait_max[ i ] ) prof_imb.wait_max[ i ] = wait;
+		}
+	}
+
+	prof_imb.busy_avg = busy_sum / ( double )n_threads;
+	prof_imb.ukr_avg  = ukr_sum  / ( double )n_threads;
+
+	prof_imb.imbalance     = ( prof_imb.busy_avg > 0.0
+	                           ? prof_imb.busy_max / prof_imb.busy_avg : 1.0 );
+	prof_imb.ukr_imbalance = ( prof_imb.ukr_avg > 0.0
+	                           ? prof_imb.ukr_max / prof_imb.ukr_avg : 1.0 );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_prof_reset( void )
+{
+	dim_t t, i;
+
+	for ( t = 0; t < BLIS_PROF_MAX_THREADS; ++t )
+	{
+		prof_thread_t* p = &prof_threads[ t ];
+
+		for ( i = 0; i < BLIS_NUM_PROF_PHASES; ++i )
+		{
+			p->ticks[ i ] = 0;
+			p->count[ i ] = 0;
+		}
+		for ( i = 0; i < BLIS_NUM_PROF_LEVELS; ++i )
+		{
+			p->bar_ticks[ i ] = 0;
+			p->bar_count[ i ] = 0;
+			p->call_bar0[ i ] = 0;
+		}
+		p->ukr_count = 0;
+		p->call_ukr0 = 0;
+
+		memset( p->events, 0, sizeof( p->events ) );
+	}
+
+	memset( &prof_imb, 0, sizeof( prof_imb_t ) );
+
+	prof_max_tid = prof_tid;
+}
+
+void bli_prof_get( dim_t tid, prof_t phase, double* time, dim_t* count )
+{
+	uint64_t ticks = 0;
+	uint64_t calls = 0;
+	dim_t    t;
+
+	for ( t = 0; t <= prof_max_tid; ++t )
+	{
+		if ( tid != BLIS_PROF_ALL_THREADS && tid != t ) continue;
+
+		ticks += prof_threads[ t ].ticks[ phase ];
+		calls += prof_threads[ t ].count[ phase ];
+	}
+
+	if ( time  != NULL ) *time  = ( double )ticks / bli_prof_ticks_per_sec();
+	if ( count != NULL ) *count = ( dim_t )calls;
+}
+
+void bli_prof_get_barrier( dim_t tid, prof_lvl_t lvl, double* wait, dim_t* count )
+{
+	uint64_t ticks = 0;
+	uint64_t calls = 0;
+	dim_t    t;
+
+	for ( t = 0; t <= prof_max_tid; ++t )
+	{
+		if ( tid != BLIS_PROF_ALL_THREADS && tid != t ) continue;
+
+		ticks += prof_threads[ t ].bar_ticks[ lvl ];
+		calls += prof_threads[ t ].bar_count[ lvl ];
+	}
+
+	if ( wait  != NULL ) *wait  = ( double )ticks / bli_prof_ticks_per_sec();
+	if ( count != NULL ) *count = ( dim_t )calls;
+}
+
+dim_t bli_prof_get_ukr_count( dim_t tid )
+{
+	uint64_t calls = 0;
+	dim_t    t;
+
+	for ( t = 0; t <= prof_max_tid; ++t )
+	{
+		if ( tid != BLIS_PROF_ALL_THREADS && tid != t ) continue;
+
+		calls += prof_threads[ t ].ukr_count;
+	}
+
+	return ( dim_t )calls;
+}
+
+void bli_prof_get_imbalance( prof_imb_t* imb )
+{
+	*imb = prof_imb;
+}
+
+void bli_prof_set_perf( bool_t enable )
+{
+	prof_perf = enable;
+}
+
+bool_t bli_prof_get_perf_enabled( void )
+{
+#ifdef BLIS_ENABLE_PROFILING
+	return prof_perf;
+#else
+	return FALSE;
+#endif
+}
+
+bool_t bli_prof_perf_is_avail( perf_ev_t ev )
+{
+	return prof_perf_avail[ ev ];
+}
+
+dim_t bli_prof_get_perf( dim_t tid, prof_t phase, perf_ev_t ev )
+{
+	uint64_t count = 0;
+	dim_t    t, i;
+
+	for ( t = 0; t <= prof_max_tid; ++t )
+	{
+		if ( tid != BLIS_PROF_ALL_THREADS && tid != t ) continue;
+
+		for ( i = 0; i < BLIS_NUM_PROF_PHASES; ++i )
+		{
+			if ( phase != BLIS_PROF_ALL_PHASES && phase != i ) continue;
+
+			count += prof_threads[ t ].events[ i ][ ev ];
+		}
+	}
+
+	return ( dim_t )count;
+}
+
+dim_t bli_prof_get_num_threads( void )
+{
+	return prof_max_tid + 1;
+}
+
+char* bli_prof_phase_string( prof_t phase )
+{
+	return prof_phase_str[ phase ];
+}
+
+char* bli_prof_level_string( prof_lvl_t lvl )
+{
+	return prof_level_str[ lvl ];
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_prof_fprint_imbalance( FILE* file, prof_imb_t* imb )
+{
+	dim_t i;
+
+	fprintf( file, "imbalance: nt %ld  busy max/avg %.3f (%.6f/%.6f s)"
+	               "  ukr max/avg %.3f (min %ld max %ld)  max wait (s)",
+	         ( long )imb->n_threads,
+	         imb->imbalance, imb->busy_max, imb->busy_avg,
+	         imb->ukr_imbalance, ( long )imb->ukr_min, ( long )imb->ukr_max );
+
+	for ( i = 0; i < BLIS_NUM_PROF_LEVELS; ++i )
+		fprintf( file, " %s %.6f", bli_prof_level_string( i ),
+		         imb->wait_max[ i ] );
+
+	fprintf( file, "\n" );
+}
+
+static void bli_prof_fprint_perf_header( FILE* file, char* label )
+{
+	dim_t i;
+
+	fprintf( file, "  %-14s", label );
+	for ( i = 0; i < BLIS_NUM_PERF_EVENTS; ++i )
+		fprintf( file, " %14s", bli_perfctr_event_string( i ) );
+	fprintf( file, " %6s\n", "ipc" );
+}
+
+static void bli_prof_fprint_perf_row( FILE* file, char* label, dim_t tid, prof_t phase )
+{
+	dim_t cyc = bli_prof_get_perf( tid, phase, BLIS_PERF_CYCLES );
+	dim_t ins = bli_prof_get_perf( tid, phase, BLIS_PERF_INSTRUCTIONS );
+	dim_t i;
+
+	fprintf( file, "  %-14s", label );
+	for ( i = 0; i < BLIS_NUM_PERF_EVENTS; ++i )
+	{
+		if ( bli_prof_perf_is_avail( i ) )
+			fprintf( file, " %14ld", ( long )bli_prof_get_perf( tid, phase, i ) );
+		else
+			fprintf( file, " %14s", "n/a" );
+	}
+	if ( cyc > 0 && bli_prof_perf_is_avail( BLIS_PERF_INSTRUCTIONS ) )
+		fprintf( file, " %6.2f\n", ( double )ins / ( double )cyc );
+	else           fprintf( file, " %6s\n", "n/a" );
+}
+
+void bli_prof_fprint( FILE* file )
+{
+	dim_t  n_threads = bli_prof_get_num_threads();
+	double total[ BLIS_PROF_MAX_THREADS ];
+	double time, sum;
+	dim_t  count;
+	dim_t  t, i;
+
+#ifndef BLIS_ENABLE_PROFILING
+	fprintf( file, "BLIS profile: profiling is disabled "
+	               "(configure with --enable-profiling).\n" );
+	return;
+#endif
+
+	// Sum the time over all phases for each thread.
+	for ( t = 0, sum = 0.0; t < n_threads; ++t )
+	{
+		for ( i = 0, total[ t ] = 0.0; i < BLIS_NUM_PROF_PHASES; ++i )
+		{
+			bli_prof_get( t, i, &time, NULL );
+			total[ t ] += time;
+		}
+		sum += total[ t ];
+	}
+
+	fprintf( file, "BLIS profile: %ld thread(s), %.6f s total\n",
+	         ( long )n_threads, sum );
+	fprintf( file, "  %-14s %12s %12s %7s\n",
+	         "phase", "calls", "time (s)", "share" );
+
+	for ( i = 0; i < BLIS_NUM_PROF_PHASES; ++i )
+	{
+		bli_prof_get( BLIS_PROF_ALL_THREADS, i, &time, &count );
+
+		fprintf( file, "  %-14s %12ld %12.6f %6.1f%%\n",
+		         bli_prof_phase_string( i ), ( long )count, time,
+		         ( sum > 0.0 ? 100.0 * time / sum : 0.0 ) );
+	}
+
+	// Per-thread breakdown, in percent of that thread's total, followed by
+	// the micro-kernel invocations and the barrier waits by loop level.
+	fprintf( file, "  %-8s %12s", "thread", "time (s)" );
+	for ( i = 0; i < BLIS_NUM_PROF_PHASES; ++i )
+		fprintf( file, " %13s", bli_prof_phase_string( i ) );
+	fprintf( file, " %12s", "ukr calls" );
+	for ( i = 0; i < BLIS_NUM_PROF_LEVELS; ++i )
+		fprintf( file, "  wait %-2s (s)", bli_prof_level_string( i ) );
+	fprintf( file, "\n" );
+
+	for ( t = 0; t < n_threads; ++t )
+	{
+		fprintf( file, "  %-8ld %12.6f", ( long )t, total[ t ] );
+
+		for ( i = 0; i < BLIS_NUM_PROF_PHASES; ++i )
+		{
+			bli_prof_get( t, i, &time, NULL );
+
+			fprintf( file, " %12.1f%%",
+			         ( total[ t ] > 0.0 ? 100.0 * time / total[ t ] : 0.0 ) );
+		}
+
+		fprintf( file, " %12ld", ( long )bli_prof_get_ukr_count( t ) );
+
+		for ( i = 0; i < BLIS_NUM_PROF_LEVELS; ++i )
+		{
+			bli_prof_get_barrier( t, i, &time, NULL );
+
+			fprintf( file, " %13.6f", time );
+		}
+		fprintf( file, "\n" );
+	}
+
+	// Hardware events by phase and by thread.
+	if ( prof_perf )
+	{
+		bli_prof_fprint_perf_header( file, "phase" );
+
+		for ( i = 0; i < BLIS_NUM_PROF_PHASES; ++i )
+			bli_prof_fprint_perf_row( file, bli_prof_phase_string( i ),
+			                          BLIS_PROF_ALL_THREADS, i );
+
+		bli_prof_fprint_perf_header( file, "thread" );
+
+		for ( t = 0; t < n_threads; ++t )
+		{
+			char tid_str[ 32 ];
+
+			sprintf( tid_str, "%ld", ( long )t );
+			bli_prof_fprint_perf_row( file, tid_str, t, BLIS_PROF_ALL_PHASES );
+		}
+	}
+
+	// The load balance of the most recent operation.
+	if ( 0 < prof_imb.n_threads )
+	{
+		fprintf( file, "  last call " );
+		bli_prof_fprint_imbalance( file, &prof_imb );
+	}
+}
+
+void bli_prof_print( void )
+{
+	bli_prof_fprint( stdout );
+}
+
@@ -0,0 +1,183 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_PROF_H
+#define BLIS_PROF_H
+
+//
+// Per-phase profiling of level-3 operations.
+//
+// When BLIS is configured with --enable-profiling, each thread accumulates
+// the time it spends in the phases below. Phases nest (e.g. a barrier inside
+// packm inside a blocked variant), and time is always charged to the
+// innermost active phase, so the per-phase times of a thread add up to the
+// time that thread spent inside level-3 operations. When profiling is
+// disabled, the instrumentation macros below expand to nothing and the
+// query functions below report zeros.
+//
+// NOTE: Timestamps are taken with rdtsc on x86 (clock_gettime() elsewhere)
+// and converted to seconds at query time. Threads are identified by their
+// id within the level-3 thread decorator, so concurrent BLIS calls from
+// several application threads will share (and race on) the same counters.
+// At the end of each level-3 operation, the chief thread also summarizes
+// the load balance across threads (see prof_imb_t).
+//
+// If BLIS_PROF_PERF is set in the environment (or bli_prof_set_perf() is
+// called), each thread also opens hardware performance counters (see
+// bli_perfctr.h) while it executes a level-3 operation, and the events
+// between two phase changes are charged to the innermost active phase in
+// the same way as time. Reading the counters costs a system call per event
+// at every phase change, so this perturbs very small problems.
+//
+
+typedef enum
+{
+	BLIS_PROF_L3_BLK_VAR = 0, // blocked variants (the control tree nodes)
+	BLIS_PROF_PACKM_A,        // packing of A (and other non-B operands)
+	BLIS_PROF_PACKM_B,        // packing of B
+	BLIS_PROF_L3_KER,         // macro-kernel, including the micro-kernel
+	BLIS_PROF_L3_KER_EDGE,    // edge-case micro-tiles within the macro-kernel
+	BLIS_PROF_BARRIER,        // waiting at thread barriers
+} prof_t;
+
+#define BLIS_NUM_PROF_PHASES   6
+
+// The loops whose thread communicators barrier waits are attributed to.
+// A barrier is charged to the innermost loop of the control tree that is
+// active when it is reached (e.g. barriers while packing B count as pc).
+typedef enum
+{
+	BLIS_PROF_LVL_JC = 0,
+	BLIS_PROF_LVL_PC,
+	BLIS_PROF_LVL_IC,
+	BLIS_PROF_LVL_JR,
+} prof_lvl_t;
+
+#define BLIS_NUM_PROF_LEVELS   4
+
+// Use for control tree nodes that do not start a new loop level.
+#define BLIS_PROF_LVL_INHERIT  -1
+
+// Pass as the thread id to bli_prof_get() to sum over all threads, or as the
+// phase to bli_prof_get_perf() to sum over all phases.
+#define BLIS_PROF_ALL_THREADS  -1
+#define BLIS_PROF_ALL_PHASES   -1
+
+// The maximum number of threads (and the maximum phase nesting depth) that
+// are tracked.
+#define BLIS_PROF_MAX_THREADS  256
+#define BLIS_PROF_MAX_DEPTH    16
+
+// The load balance of one level-3 operation. "Busy" time is the time a
+// thread spent inside the operation minus the time it waited at barriers.
+// The wait at a barrier is the time between the thread's arrival and its
+// release, i.e. the thread's share of the arrival skew.
+typedef struct
+{
+	dim_t  n_threads;
+
+	double busy_min;
+	double busy_max;
+	double busy_avg;
+
+	dim_t  ukr_min;
+	dim_t  ukr_max;
+	double ukr_avg;
+
+	// The maximum (over threads) barrier wait at each loop level.
+	double wait_max[ BLIS_NUM_PROF_LEVELS ];
+
+	// busy_max / busy_avg and ukr_max / ukr_avg. 1.0 is perfect balance.
+	double imbalance;
+	double ukr_imbalance;
+} prof_imb_t;
+
+
+#ifdef BLIS_ENABLE_PROFILING
+
+#define bli_prof_begin( phase )      bli_prof_begin_phase( phase )
+#define bli_prof_end( phase )        bli_prof_end_phase( phase )
+#define bli_prof_push_level( lvl )   bli_prof_push_level_int( lvl )
+#define bli_prof_pop_level()         bli_prof_pop_level_int()
+#define bli_prof_count_ukr()         bli_prof_count_ukr_int()
+#define bli_prof_begin_thread( id )  bli_prof_begin_thread_int( id )
+#define bli_prof_end_thread()        bli_prof_end_thread_int()
+#define bli_prof_end_call( nt )      bli_prof_end_call_int( nt )
+
+#else
+
+#define bli_prof_begin( phase )
+#define bli_prof_end( phase )
+#define bli_prof_push_level( lvl )
+#define bli_prof_pop_level()
+#define bli_prof_count_ukr()
+#define bli_prof_begin_thread( id )
+#define bli_prof_end_thread()
+#define bli_prof_end_call( nt )
+
+#endif
+
+
+void   bli_prof_init( void );
+void   bli_prof_finalize( void );
+
+void   bli_prof_begin_phase( prof_t phase );
+void   bli_prof_end_phase( prof_t phase );
+void   bli_prof_push_level_int( dim_t lvl );
+void   bli_prof_pop_level_int( void );
+void   bli_prof_count_ukr_int( void );
+
+void   bli_prof_begin_thread_int( dim_t id );
+void   bli_prof_end_thread_int( void );
+void   bli_prof_end_call_int( dim_t n_threads );
+
+void   bli_prof_reset( void );
+void   bli_prof_get( dim_t tid, prof_t phase, double* time, dim_t* count );
+void   bli_prof_get_barrier( dim_t tid, prof_lvl_t lvl, double* wait, dim_t* count );
+dim_t  bli_prof_get_ukr_count( dim_t tid );
+void   bli_prof_get_imbalance( prof_imb_t* imb );
+void   bli_prof_set_perf( bool_t enable );
+bool_t bli_prof_get_perf_enabled( void );
+bool_t bli_prof_perf_is_avail( perf_ev_t ev );
+dim_t  bli_prof_get_perf( dim_t tid, prof_t phase, perf_ev_t ev );
+dim_t  bli_prof_get_num_threads( void );
+char*  bli_prof_phase_string( prof_t phase );
+char*  bli_prof_level_string( prof_lvl_t lvl );
+
+void   bli_prof_fprint_imbalance( FILE* file, prof_imb_t* imb );
+void   bli_prof_fprint( FILE* file );
+void   bli_prof_print( void );
+
+#endif
+
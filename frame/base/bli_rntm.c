@@ -0,0 +1,177 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+dim_t bli_rntm_get_num_threads( rntm_t* rntm )
+{
+	return bli_rntm_jc_way( rntm ) *
+	       bli_rntm_pc_way( rntm ) *
+	       bli_rntm_ic_way( rntm ) *
+	       bli_rntm_jr_way( rntm ) *
+	       bli_rntm_ir_way( rntm );
+}
+
+dim_t bli_rntm_get_num_threads_in( rntm_t* rntm, cntl_t* cntl )
+{
+	dim_t n_threads_in = 1;
+
+	for ( ; cntl != NULL; cntl = bli_cntl_sub_node( cntl ) )
+	{
+		bszid_t bszid = bli_cntl_bszid( cntl );
+		dim_t   cur_way;
+
+		// We assume bszid is in {KR,MR,NR,MC,KC,NR} if it is not
+		// BLIS_NO_PART.
+		if ( bszid != BLIS_NO_PART )
+			cur_way = bli_rntm_way_for_bszid( bszid, rntm );
+		else
+			cur_way = 1;
+
+		n_threads_in *= cur_way;
+	}
+
+	return n_threads_in;
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_rntm_set_ways_from_env( opid_t  l3_op,
+                                 side_t  side,
+                                 num_t   dt,
+                                 cntx_t* cntx,
+                                 dim_t   m,
+                                 dim_t   n,
+                                 dim_t   k,
+                                 rntm_t* rntm )
+{
+	dim_t jc, pc, ic, jr, ir;
+
+#ifdef BLIS_ENABLE_MULTITHREADING
+
+	dim_t nthread = bli_env_read_nthread();
+
+	// Unless the ways of parallelism are given explicitly, use only as many
+	// of the threads as the cost model expects to pay off. (A small problem
+	// spends more time starting threads and in barriers than computing.)
+	if ( nthread > 1 && bli_l3_model_is_enabled() &&
+	     getenv( "BLIS_JC_NT" ) == NULL && getenv( "BLIS_IC_NT" ) == NULL &&
+	     getenv( "BLIS_JR_NT" ) == NULL && getenv( "BLIS_IR_NT" ) == NULL )
+		nthread = bli_l3_model_select_nthread( l3_op, dt, nthread,
+		                                       m, n, k, cntx );
+
+	bli_partition_l3_loops( nthread, m, n, &jc, &ic, &jr, &ir );
+
+	jc = bli_env_read_nway( "BLIS_JC_NT", jc );
+	//pc = bli_env_read_nway( "BLIS_KC_NT", 1 );
+	pc = 1;
+	ic = bli_env_read_nway( "BLIS_IC_NT", ic );
+	jr = bli_env_read_nway( "BLIS_JR_NT", jr );
+	ir = bli_env_read_nway( "BLIS_IR_NT", ir );
+
+#else
+
+	jc = 1;
+	pc = 1;
+	ic = 1;
+	jr = 1;
+	ir = 1;
+
+#endif
+
+	if ( l3_op == BLIS_TRMM )
+	{
+		// We reconfigure the paralelism from trmm_r due to a dependency in
+		// the jc loop. (NOTE: This dependency does not exist for trmm3 )
+		if ( bli_is_right( side ) )
+		{
+			bli_rntm_set_thrloop
+			(
+			  1,
+			  pc,
+			  ic,
+			  jr * jc,
+			  ir,
+			  rntm
+			);
+		}
+		else // if ( bli_is_left( side ) )
+		{
+			bli_rntm_set_thrloop
+			(
+			  jc,
+			  pc,
+			  ic,
+			  jr,
+			  ir,
+			  rntm
+			);
+		}
+	}
+	else if ( l3_op == BLIS_TRSM )
+	{
+		// Both sides of trsm are executed as left-side solves (the right
+		// side is handled by transposing all operands). The column panels
+		// of B are independent, so the jc loop may be parallelized, as may
+		// the jr loop within the macro-kernel. The ic loop carries the
+		// dependency on the diagonal block, so its ways (and the ir ways,
+		// which are not supported by the trsm macro-kernels) are folded
+		// into jr here. The lookahead implementation (bli_trsm_dag_int())
+		// re-partitions these threads and recovers ic parallelism for the
+		// trailing updates.
+		bli_rntm_set_thrloop
+		(
+		  jc,
+		  1,
+		  1,
+		  ic * pc * jr * ir,
+		  1,
+		  rntm
+		);
+	}
+	else // if ( l3_op == BLIS_TRSM )
+	{
+		bli_rntm_set_thrloop
+		(
+		  jc,
+		  pc,
+		  ic,
+		  jr,
+		  ir,
+		  rntm
+		);
+	}
+}
+
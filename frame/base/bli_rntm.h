@@ -0,0 +1,142 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifndef BLIS_RNTM_H
+#define BLIS_RNTM_H
+
+// Runtime object type (defined in bli_type_defs.h)
+
+/*
+typedef struct rntm_s
+{
+	opid_t    family;
+
+	dim_t     thrloop[ BLIS_NUM_LOOPS ];
+
+	dim_t     nc[ BLIS_NUM_FP_TYPES ];
+} rntm_t;
+*/
+
+// -----------------------------------------------------------------------------
+
+// rntm_t query (fields only)
+
+#define bli_rntm_family( rntm ) \
+\
+	( (rntm)->family )
+
+#define bli_rntm_thrloop( rntm ) \
+\
+	( (rntm)->thrloop )
+
+#define bli_rntm_jc_way( rntm ) \
+\
+	( (rntm)->thrloop[ BLIS_NC ] )
+
+#define bli_rntm_pc_way( rntm ) \
+\
+	( (rntm)->thrloop[ BLIS_KC ] )
+
+#define bli_rntm_ic_way( rntm ) \
+\
+	( (rntm)->thrloop[ BLIS_MC ] )
+
+#define bli_rntm_jr_way( rntm ) \
+\
+	( (rntm)->thrloop[ BLIS_NR ] )
+
+#define bli_rntm_ir_way( rntm ) \
+\
+	( (rntm)->thrloop[ BLIS_MR ] )
+
+#define bli_rntm_way_for_bszid( bszid, rntm ) \
+\
+	( (rntm)->thrloop[ bszid ] )
+
+#define bli_rntm_nc( dt, rntm ) \
+\
+	( (rntm)->nc[ dt ] )
+
+// rntm_t modification (fields only)
+
+#define bli_rntm_set_family( _family, rntm_p ) \
+{ \
+	(rntm_p)->family = _family; \
+}
+
+#define bli_rntm_set_nc( nc_, dt, rntm_p ) \
+{ \
+	(rntm_p)->nc[ dt ] = nc_; \
+}
+
+#define bli_rntm_clear_nc( rntm_p ) \
+{ \
+	(rntm_p)->nc[ BLIS_FLOAT    ] = 0; \
+	(rntm_p)->nc[ BLIS_SCOMPLEX ] = 0; \
+	(rntm_p)->nc[ BLIS_DOUBLE   ] = 0; \
+	(rntm_p)->nc[ BLIS_DCOMPLEX ] = 0; \
+}
+
+// Any NC chosen for the previous ways of parallelism no longer applies once
+// the ways change (see bli_cache_rntm_adjust_nc()).
+#define bli_rntm_set_thrloop( jc_, pc_, ic_, jr_, ir_, rntm_p ) \
+{ \
+	(rntm_p)->thrloop[ BLIS_NC ] = jc_; \
+	(rntm_p)->thrloop[ BLIS_KC ] = pc_; \
+	(rntm_p)->thrloop[ BLIS_MC ] = ic_; \
+	(rntm_p)->thrloop[ BLIS_NR ] = jr_; \
+	(rntm_p)->thrloop[ BLIS_MR ] = ir_; \
+	(rntm_p)->thrloop[ BLIS_KR ] = 1;   \
+	bli_rntm_clear_nc( rntm_p ); \
+}
+
+// -----------------------------------------------------------------------------
+
+// Function prototypes
+
+dim_t    bli_rntm_get_num_threads( rntm_t* rntm );
+dim_t    bli_rntm_get_num_threads_in( rntm_t* rntm, cntl_t* cntl );
+
+void     bli_rntm_set_ways_from_env( opid_t  l3_op,
+                                     side_t  side,
+                                     num_t   dt,
+                                     cntx_t* cntx,
+                                     dim_t   m,
+                                     dim_t   n,
+                                     dim_t   k,
+                                     rntm_t* rntm );
+
+#endif
+
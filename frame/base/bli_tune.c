@@ -0,0 +1,277 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#define TUNE_MAX_LINE 256
+#define TUNE_MAX_PATH 1024
+
+// The path of the tuning file that was loaded last, if any.
+static char tune_file[ TUNE_MAX_PATH ] = "";
+
+static char* tune_bsz_str[ 3 ] = { "mc", "kc", "nc" };
+static char* tune_thr_str[ 4 ] = { "m_thread_ratio", "n_thread_ratio",
+                                   "mr_thread_max",  "nr_thread_max" };
+static char* tune_mdl_str[ 6 ] = { "model_pack_gbps",  "model_call_us",
+                                   "model_thread_us",  "model_barrier_us",
+                                   "model_small_eff",  "model_small_call_us" };
+
+static num_t bli_tune_char_to_dt( char ch )
+{
+	switch ( ch )
+	{
+		case 's': return BLIS_FLOAT;
+		case 'c': return BLIS_SCOMPLEX;
+		case 'd': return BLIS_DOUBLE;
+		case 'z': return BLIS_DCOMPLEX;
+		default:  return BLIS_NUM_FP_TYPES;
+	}
+}
+
+// Set a cache blocksize in the gks, provided that it is a multiple of the
+// corresponding register blocksize.
+static bool_t bli_tune_set_blksz( bszid_t bs_id, bszid_t bm_id, num_t dt, dim_t val )
+{
+	blksz_t blksz;
+	blksz_t bmult;
+	dim_t   def, max, mult;
+
+	bli_gks_get_blksz( bs_id, &blksz );
+	bli_gks_get_blksz( bm_id, &bmult );
+
+	def  = bli_blksz_get_def( dt, &blksz );
+	max  = bli_blksz_get_max( dt, &blksz );
+	mult = bli_blksz_get_def( dt, &bmult );
+
+	if ( val <= 0 || mult <= 0 || val % mult != 0 ) return FALSE;
+
+	bli_gks_set_blksz_dt( bs_id, dt, val, val + ( max - def ) );
+
+	return TRUE;
+}
+
+// Set a parameter of the cost model. Return FALSE if it is not valid.
+static bool_t bli_tune_apply_model( char* line )
+{
+	l3model_t model;
+	double*   params[ 6 ];
+	char      key[ 32 ];
+	char      dt_str[ 8 ];
+	double    val;
+	num_t     dt;
+	dim_t     i;
+
+	bli_l3_model_get( &model );
+
+	params[0] = &model.pack_gbps;
+	params[1] = &model.call_us;
+	params[2] = &model.thread_us;
+	params[3] = &model.barrier_us;
+	params[4] = &model.small_eff;
+	params[5] = &model.small_call_us;
+
+	if ( sscanf( line, "%31s %7s %lf", key, dt_str, &val ) == 3 )
+	{
+		dt = bli_tune_char_to_dt( dt_str[0] );
+
+		if ( strcmp( key, "model_gflops" ) != 0 || dt_str[1] != '\0' ||
+		     dt == BLIS_NUM_FP_TYPES || val <= 0.0 ) return FALSE;
+
+		model.gflops[ dt ] = val;
+	}
+	else if ( sscanf( line, "%31s %lf", key, &val ) == 2 )
+	{
+		for ( i = 0; i < 6; ++i )
+			if ( strcmp( key, tune_mdl_str[ i ] ) == 0 ) break;
+
+		// The rates must be positive; the overheads may be zero.
+		if ( i == 6 || val < 0.0 || ( val == 0.0 && ( i == 0 || i == 4 ) ) )
+			return FALSE;
+
+		*params[ i ] = val;
+	}
+	else
+	{
+		return FALSE;
+	}
+
+	bli_l3_model_set( &model );
+
+	return TRUE;
+}
+
+// Apply one line of a tuning file. Return FALSE if it is not valid.
+static bool_t bli_tune_apply( char* line )
+{
+	char  key[ 32 ];
+	char  dt_str[ 8 ];
+	long  val;
+	num_t dt;
+	dim_t i;
+
+	if ( sscanf( line, "%31s", key ) == 1 && strncmp( key, "model_", 6 ) == 0 )
+		return bli_tune_apply_model( line );
+
+	if ( sscanf( line, "%31s %7s %ld", key, dt_str, &val ) == 3 )
+	{
+		dt = bli_tune_char_to_dt( dt_str[0] );
+
+		if ( dt_str[1] != '\0' || dt == BLIS_NUM_FP_TYPES ) return FALSE;
+
+		if ( strcmp( key, "mc" ) == 0 )
+			return bli_tune_set_blksz( BLIS_MC, BLIS_MR, dt, val );
+		if ( strcmp( key, "kc" ) == 0 )
+			return bli_tune_set_blksz( BLIS_KC, BLIS_KR, dt, val );
+		if ( strcmp( key, "nc" ) == 0 )
+			return bli_tune_set_blksz( BLIS_NC, BLIS_NR, dt, val );
+
+		return FALSE;
+	}
+
+	if ( sscanf( line, "%31s %ld", key, &val ) == 2 && val > 0 )
+	{
+		for ( i = 0; i < 4; ++i )
+		{
+			if ( strcmp( key, tune_thr_str[ i ] ) != 0 ) continue;
+
+			bli_thread_set_ratios( i == 0 ? val : 0, i == 1 ? val : 0,
+			                       i == 2 ? val : 0, i == 3 ? val : 0 );
+			return TRUE;
+		}
+	}
+
+	return FALSE;
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_tune_init( void )
+{
+	char* path = getenv( "BLIS_TUNE_FILE" );
+
+	// Start from the configuration's thread partitioning, so that a tuning
+	// file loaded before a previous bli_finalize() does not linger. (The
+	// blocksizes were reset by bli_cache_init().)
+	bli_thread_reset_ratios();
+	tune_file[0] = '\0';
+
+	if ( path == NULL || path[0] == '\0' ) return;
+
+	if ( bli_tune_load( path ) != BLIS_SUCCESS )
+		fprintf( stderr, "libblis: cannot read tuning file '%s'; "
+		                 "using the default blocksizes.\n", path );
+}
+
+void bli_tune_finalize( void )
+{
+}
+
+err_t bli_tune_load( char* path )
+{
+	FILE*  file = fopen( path, "r" );
+	char   line[ TUNE_MAX_LINE ];
+	char*  p;
+	dim_t  lineno = 0;
+
+	if ( file == NULL ) return BLIS_FAILURE;
+
+	while ( fgets( line, TUNE_MAX_LINE, file ) != NULL )
+	{
+		lineno += 1;
+
+		// Strip comments and the end of the line, and skip blank lines.
+		if ( ( p = strchr( line, '#'  ) ) != NULL ) *p = '\0';
+		if ( ( p = strchr( line, '\n' ) ) != NULL ) *p = '\0';
+		if ( strspn( line, " \t\r" ) == strlen( line ) ) continue;
+
+		if ( !bli_tune_apply( line ) )
+			fprintf( stderr, "libblis: %s (line %ld): ignoring '%s'.\n",
+			         path, ( long )lineno, line );
+	}
+
+	fclose( file );
+
+	strncpy( tune_file, path, TUNE_MAX_PATH - 1 );
+	tune_file[ TUNE_MAX_PATH - 1 ] = '\0';
+
+	return BLIS_SUCCESS;
+}
+
+char* bli_tune_get_file( void )
+{
+	return tune_file;
+}
+
+void bli_tune_fprint( FILE* file )
+{
+	char*     dt_chars = "sdcz";
+	bszid_t   bs_ids[ 3 ] = { BLIS_MC, BLIS_KC, BLIS_NC };
+	dim_t     thr[ 4 ];
+	l3model_t model;
+	double    mdl[ 6 ];
+	blksz_t   blksz;
+	char*   ch;
+	dim_t   i;
+
+	for ( i = 0; i < 3; ++i )
+	{
+		bli_gks_get_blksz( bs_ids[ i ], &blksz );
+
+		for ( ch = dt_chars; *ch != '\0'; ++ch )
+			fprintf( file, "%s %c %ld\n", tune_bsz_str[ i ], *ch,
+			         ( long )bli_blksz_get_def( bli_tune_char_to_dt( *ch ),
+			                                    &blksz ) );
+	}
+
+	bli_thread_get_ratios( &thr[0], &thr[1], &thr[2], &thr[3] );
+
+	for ( i = 0; i < 4; ++i )
+		fprintf( file, "%s %ld\n", tune_thr_str[ i ], ( long )thr[ i ] );
+
+	bli_l3_model_get( &model );
+
+	for ( ch = dt_chars; *ch != '\0'; ++ch )
+		fprintf( file, "model_gflops %c %g\n", *ch,
+		         model.gflops[ bli_tune_char_to_dt( *ch ) ] );
+
+	mdl[0] = model.pack_gbps;
+	mdl[1] = model.call_us;
+	mdl[2] = model.thread_us;
+	mdl[3] = model.barrier_us;
+	mdl[4] = model.small_eff;
+	mdl[5] = model.small_call_us;
+
+	for ( i = 0; i < 6; ++i )
+		fprintf( file, "%s %g\n", tune_mdl_str[ i ], mdl[ i ] );
+}
@@ -0,0 +1,79 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_TUNE_H
+#define BLIS_TUNE_H
+
+//
+// Tuning files.
+//
+// A tuning file overrides the cache blocksizes of the native micro-kernels,
+// the parameters of the automatic thread partitioning and those of the
+// level-3 cost model, which otherwise are derived from the cache hierarchy
+// (see bli_cache.h) or come from the configuration's bli_kernel.h. It is
+// usually written by the autotuner in test/tune on the machine where it is
+// used. bli_init() loads the file named by the BLIS_TUNE_FILE environment
+// variable, if it is set.
+// The format is one setting per line; '#' starts a comment:
+//
+//   mc d 72                  cache blocksizes: mc, kc or nc, followed by
+//   kc d 256                 the datatype (s, d, c or z) and the value
+//   nc d 4080
+//   m_thread_ratio 2         thread partitioning (see
+//   n_thread_ratio 1         bli_partition_l3_loops())
+//   mr_thread_max 1
+//   nr_thread_max 4
+//   model_gflops d 27.5      cost model parameters (see bli_l3_model.h):
+//   model_pack_gbps 6.2      the rates are per thread, in GFLOPS (for each
+//   model_call_us 1.8        datatype) and GB/s, and the overheads are in
+//   model_thread_us 12       microseconds
+//   model_barrier_us 0.3
+//   model_small_eff 0.7
+//   model_small_call_us 0.2
+//
+// MC and NC must be multiples of MR and NR, respectively, and KC must be a
+// multiple of KR. The maximum blocksizes keep their distance from the
+// defaults. Invalid lines are reported on stderr and skipped. The gemm
+// micro-kernel variants registered with BLIS_?GEMM_UKERNEL_VARIANTS keep
+// their own blocksizes.
+//
+
+void  bli_tune_init( void );
+void  bli_tune_finalize( void );
+
+err_t bli_tune_load( char* path );
+char* bli_tune_get_file( void );
+void  bli_tune_fprint( FILE* file );
+
+#endif
@@ -0,0 +1,465 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// The ring buffer of one application thread. Rings are linked into a list
+// the first time a thread logs a call, and are never freed, so that the
+// records of threads that have exited can still be dumped.
+typedef struct vring_s
+{
+	vrec_t*          recs;
+	dim_t            size;
+	volatile uint64_t head;
+	dim_t            id;
+	struct vring_s*  next;
+} vring_t;
+
+bool_t                bli_verbose_on = FALSE;
+
+static vring_t* volatile vring_list  = NULL;
+static volatile dim_t vring_n        = 0;
+static dim_t          vring_size     = BLIS_VERBOSE_SIZE_DEF;
+static bool_t         vring_atexit   = FALSE;
+
+// The calling thread's ring, the record of its outermost active call, and
+// its nesting depth of BLIS calls (only the outermost call is logged).
+static __thread vring_t* vring_mine  = NULL;
+static __thread vrec_t*  vrec_cur    = NULL;
+static __thread dim_t    vdepth      = 0;
+
+// A record handed out for nested calls so that their ends can be matched.
+static vrec_t         vrec_nested;
+
+static void bli_verbose_dump_at_exit( void );
+
+// -----------------------------------------------------------------------------
+
+void bli_verbose_init( void )
+{
+	char* str = getenv( "BLIS_VERBOSE" );
+
+	vring_size = bli_env_read_nway( "BLIS_VERBOSE_SIZE", BLIS_VERBOSE_SIZE_DEF );
+	if ( vring_size < 1 ) vring_size = BLIS_VERBOSE_SIZE_DEF;
+
+	if ( str == NULL || atoi( str ) == 0 ) return;
+
+	bli_verbose_enable();
+
+	if ( !vring_atexit )
+	{
+		atexit( bli_verbose_dump_at_exit );
+		vring_atexit = TRUE;
+	}
+}
+
+void bli_verbose_finalize( void )
+{
+	// Keep logging (and the rings) across bli_finalize() so that calls made
+	// after a re-initialization are recorded too.
+}
+
+void bli_verbose_enable( void )
+{
+	bli_verbose_on = TRUE;
+}
+
+void bli_verbose_disable( void )
+{
+	bli_verbose_on = FALSE;
+}
+
+bool_t bli_verbose_is_enabled( void )
+{
+	return bli_verbose_on;
+}
+
+// -----------------------------------------------------------------------------
+
+static vring_t* bli_verbose_ring( void )
+{
+	vring_t* ring = vring_mine;
+	vring_t* head;
+
+	if ( ring != NULL ) return ring;
+
+	ring       = bli_malloc_intl( sizeof( vring_t ) );
+	ring->recs = bli_malloc_intl( vring_size * sizeof( vrec_t ) );
+	ring->size = vring_size;
+	ring->head = 0;
+	ring->id   = __sync_fetch_and_add( &vring_n, 1 );
+
+	memset( ring->recs, 0, vring_size * sizeof( vrec_t ) );
+
+	// Push the ring onto the global list.
+	do
+	{
+		head       = vring_list;
+		ring->next = head;
+	}
+	while ( !__sync_bool_compare_and_swap( &vring_list, head, ring ) );
+
+	vring_mine = ring;
+
+	return ring;
+}
+
+static vrec_t* bli_verbose_begin( char* opname, num_t dt, dim_t level,
+                                  char* params )
+{
+	vring_t* ring;
+	vrec_t*  vrec;
+	dim_t    i;
+
+	// Calls made from within a logged call are not logged.
+	if ( vdepth++ > 0 ) return &vrec_nested;
+
+	ring = bli_verbose_ring();
+	vrec = &ring->recs[ ring->head % ring->size ];
+
+	vrec->seq    = 0;
+	__sync_synchronize();
+
+	vrec->opname = opname;
+	vrec->dt     = dt;
+	vrec->level  = level;
+	vrec->m      = 0;
+	vrec->n      = 0;
+	vrec->k      = 0;
+	vrec->method = BLIS_NAT;
+	vrec->tid    = ring->id;
+
+	for ( i = 0; i < 7 && params[ i ] != '\0'; ++i )
+		vrec->params[ i ] = params[ i ];
+	vrec->params[ i ] = '\0';
+
+	for ( i = 0; i < 6; ++i ) vrec->strides[ i ] = 0;
+	for ( i = 0; i < 5; ++i ) vrec->ways[ i ]    = 0;
+
+	vrec_cur = vrec;
+
+	return vrec;
+}
+
+vrec_t* bli_verbose_begin_l3_int( char* opname, char side_ch,
+                                  obj_t* a, obj_t* b, obj_t* c )
+{
+	obj_t*  x = ( c != NULL ? c : b );
+	char    params[ 6 ];
+	vrec_t* vrec;
+
+	// side, uplo and diag of the structured operand, transa, transb.
+	params[ 0 ] = side_ch;
+	params[ 1 ] = '-';
+	params[ 2 ] = bli_verbose_trans_ch( bli_obj_conjtrans_status( *a ) );
+	params[ 3 ] = ( b != NULL
+	                ? bli_verbose_trans_ch( bli_obj_conjtrans_status( *b ) )
+	                : '-' );
+	params[ 4 ] = '-';
+	params[ 5 ] = '\0';
+
+	if ( !bli_obj_is_general( *a ) )
+	{
+		params[ 1 ] = bli_verbose_uplo_ch( bli_obj_uplo( *a ) );
+
+		if ( bli_obj_is_triangular( *a ) )
+			params[ 4 ] = bli_verbose_diag_ch( bli_obj_diag( *a ) );
+	}
+	else if ( c != NULL && !bli_obj_is_general( *c ) )
+	{
+		params[ 1 ] = bli_verbose_uplo_ch( bli_obj_uplo( *c ) );
+	}
+
+	vrec = bli_verbose_begin( opname, bli_obj_datatype( *x ), 3, params );
+
+	if ( vrec != &vrec_nested )
+	{
+		vrec->m = bli_obj_length( *x );
+		vrec->n = bli_obj_width( *x );
+		vrec->k = bli_obj_width_after_trans( *a );
+
+		vrec->strides[ 0 ] = bli_obj_row_stride( *a );
+		vrec->strides[ 1 ] = bli_obj_col_stride( *a );
+
+		if ( b != NULL )
+		{
+			vrec->strides[ 2 ] = bli_obj_row_stride( *b );
+			vrec->strides[ 3 ] = bli_obj_col_stride( *b );
+		}
+		if ( c != NULL )
+		{
+			vrec->strides[ 4 ] = bli_obj_row_stride( *c );
+			vrec->strides[ 5 ] = bli_obj_col_stride( *c );
+		}
+
+		vrec->t_start = bli_clock();
+	}
+
+	return vrec;
+}
+
+vrec_t* bli_verbose_begin_l2_int( char* opname, num_t dt, char* params,
+                                  dim_t m, dim_t n, inc_t rs_a, inc_t cs_a,
+                                  inc_t incx, inc_t incy )
+{
+	vrec_t* vrec = bli_verbose_begin( opname, dt, 2, params );
+
+	if ( vrec != &vrec_nested )
+	{
+		vrec->m            = m;
+		vrec->n            = n;
+		vrec->strides[ 0 ] = rs_a;
+		vrec->strides[ 1 ] = cs_a;
+		vrec->strides[ 2 ] = incx;
+		vrec->strides[ 3 ] = incy;
+		vrec->t_start      = bli_clock();
+	}
+
+	return vrec;
+}
+
+vrec_t* bli_verbose_begin_l1v_int( char* opname, num_t dt, char* params,
+                                   dim_t n, inc_t incx, inc_t incy )
+{
+	vrec_t* vrec = bli_verbose_begin( opname, dt, 1, params );
+
+	if ( vrec != &vrec_nested )
+	{
+		vrec->n            = n;
+		vrec->strides[ 0 ] = incx;
+		vrec->strides[ 1 ] = incy;
+		vrec->t_start      = bli_clock();
+	}
+
+	return vrec;
+}
+
+void bli_verbose_end_int( vrec_t* vrec )
+{
+	vring_t* ring;
+
+	if ( vdepth > 0 ) --vdepth;
+
+	if ( vrec == &vrec_nested ) return;
+
+	ring = vring_mine;
+
+	vrec->time = bli_clock() - vrec->t_start;
+	vrec_cur   = NULL;
+
+	// Publish the record: the sequence number is written last.
+	__sync_synchronize();
+	vrec->seq  = ring->head + 1;
+	ring->head = ring->head + 1;
+}
+
+void bli_verbose_set_ways_int( cntx_t* cntx, rntm_t* rntm )
+{
+	vrec_t* vrec = vrec_cur;
+
+	if ( vrec == NULL || vdepth != 1 ) return;
+
+	vrec->ways[ 0 ] = bli_rntm_jc_way( rntm );
+	vrec->ways[ 1 ] = bli_rntm_pc_way( rntm );
+	vrec->ways[ 2 ] = bli_rntm_ic_way( rntm );
+	vrec->ways[ 3 ] = bli_rntm_jr_way( rntm );
+	vrec->ways[ 4 ] = bli_rntm_ir_way( rntm );
+	vrec->method    = bli_cntx_get_ind_method( cntx );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_verbose_suspend( void )
+{
+	// Treat the calling thread as being inside a logged call. This is used
+	// by the threads that BLIS spawns to execute level-3 operations.
+	++vdepth;
+}
+
+void bli_verbose_resume( void )
+{
+	if ( vdepth > 0 ) --vdepth;
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_verbose_clear( void )
+{
+	vring_t* ring;
+
+	// NOTE: Records being written concurrently may survive the clear.
+	for ( ring = vring_list; ring != NULL; ring = ring->next )
+	{
+		dim_t i;
+
+		for ( i = 0; i < ring->size; ++i ) ring->recs[ i ].seq = 0;
+	}
+}
+
+dim_t bli_verbose_get_records( dim_t n_max, vrec_t* recs )
+{
+	vring_t* ring;
+	dim_t    n = 0;
+
+	for ( ring = vring_list; ring != NULL; ring = ring->next )
+	{
+		uint64_t head  = ring->head;
+		uint64_t first = ( head > ( uint64_t )ring->size
+		                   ? head - ring->size : 0 );
+		uint64_t j;
+
+		for ( j = first; j < head && n < n_max; ++j )
+		{
+			vrec_t*  vrec = &ring->recs[ j % ring->size ];
+			uint64_t seq0, seq1;
+
+			// Copy the record and keep it only if it was not being
+			// overwritten while we copied it.
+			seq0 = vrec->seq;
+			__sync_synchronize();
+			recs[ n ] = *vrec;
+			__sync_synchronize();
+			seq1 = vrec->seq;
+
+			if ( seq0 == j + 1 && seq1 == j + 1 ) ++n;
+		}
+	}
+
+	return n;
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_verbose_fprint_record( FILE* file, vrec_t* vrec )
+{
+	char dt_ch = ( bli_is_float( vrec->dt )    ? 's' :
+	               bli_is_double( vrec->dt )   ? 'd' :
+	               bli_is_scomplex( vrec->dt ) ? 'c' : 'z' );
+	char* p    = vrec->params;
+
+	fprintf( file, "BLIS_VERBOSE op=%s dt=%c", vrec->opname, dt_ch );
+
+	if ( vrec->level == 3 )
+	{
+		fprintf( file, " side=%c uplo=%c transa=%c transb=%c diag=%c"
+		               " m=%ld n=%ld k=%ld"
+		               " rs_a=%ld cs_a=%ld rs_b=%ld cs_b=%ld"
+		               " rs_c=%ld cs_c=%ld"
+		               " ways=%ld:%ld:%ld:%ld:%ld ind=%s",
+		         p[ 0 ], p[ 1 ], p[ 2 ], p[ 3 ], p[ 4 ],
+		         ( long )vrec->m, ( long )vrec->n, ( long )vrec->k,
+		         ( long )vrec->strides[ 0 ], ( long )vrec->strides[ 1 ],
+		         ( long )vrec->strides[ 2 ], ( long )vrec->strides[ 3 ],
+		         ( long )vrec->strides[ 4 ], ( long )vrec->strides[ 5 ],
+		         ( long )vrec->ways[ 0 ], ( long )vrec->ways[ 1 ],
+		         ( long )vrec->ways[ 2 ], ( long )vrec->ways[ 3 ],
+		         ( long )vrec->ways[ 4 ],
+		         bli_ind_get_impl_string( vrec->method ) );
+	}
+	else if ( vrec->level == 2 )
+	{
+		fprintf( file, " params=%s m=%ld n=%ld rs_a=%ld cs_a=%ld"
+		               " incx=%ld incy=%ld",
+		         p, ( long )vrec->m, ( long )vrec->n,
+		         ( long )vrec->strides[ 0 ], ( long )vrec->strides[ 1 ],
+		         ( long )vrec->strides[ 2 ], ( long )vrec->strides[ 3 ] );
+	}
+	else
+	{
+		fprintf( file, " params=%s n=%ld incx=%ld incy=%ld",
+		         p, ( long )vrec->n,
+		         ( long )vrec->strides[ 0 ], ( long )vrec->strides[ 1 ] );
+	}
+
+	fprintf( file, " tid=%ld start=%.9f time=%.9f\n",
+	         ( long )vrec->tid, vrec->t_start, vrec->time );
+}
+
+static int bli_verbose_cmp_start( const void* x, const void* y )
+{
+	const vrec_t* a = x;
+	const vrec_t* b = y;
+
+	return ( a->t_start < b->t_start ? -1 : a->t_start > b->t_start );
+}
+
+void bli_verbose_dump( FILE* file )
+{
+	dim_t    n_max = 0;
+	vring_t* ring;
+	vrec_t*  recs;
+	dim_t    n, i;
+
+	for ( ring = vring_list; ring != NULL; ring = ring->next )
+		n_max += ring->size;
+
+	if ( n_max == 0 ) return;
+
+	recs = bli_malloc_intl( n_max * sizeof( vrec_t ) );
+
+	// Gather the records of all threads and print them in the order in
+	// which the calls started.
+	n = bli_verbose_get_records( n_max, recs );
+
+	qsort( recs, n, sizeof( vrec_t ), bli_verbose_cmp_start );
+
+	for ( i = 0; i < n; ++i )
+		bli_verbose_fprint_record( file, &recs[ i ] );
+
+	fflush( file );
+
+	bli_free_intl( recs );
+}
+
+err_t bli_verbose_dump_file( char* path )
+{
+	FILE* file = fopen( path, "w" );
+
+	if ( file == NULL ) return BLIS_FAILURE;
+
+	bli_verbose_dump( file );
+
+	fclose( file );
+
+	return BLIS_SUCCESS;
+}
+
+static void bli_verbose_dump_at_exit( void )
+{
+	char* path = getenv( "BLIS_VERBOSE_FILE" );
+
+	if ( path == NULL || bli_verbose_dump_file( path ) != BLIS_SUCCESS )
+		bli_verbose_dump( stderr );
+}
+
@@ -0,0 +1,166 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_VERBOSE_H
+#define BLIS_VERBOSE_H
+
+//
+// Call-level logging of BLAS and BLIS entry points.
+//
+// When enabled (BLIS_VERBOSE=1 in the environment, or bli_verbose_enable()),
+// every call that reaches the level-3 object API (and thus every level-3
+// call made through the BLAS, CBLAS, typed or object APIs) and every call
+// to the typed level-2 and level-1v APIs (which the BLAS and object APIs of
+// those levels use) is recorded with its operation, datatype, dimensions,
+// parameters, strides, the thread ways chosen (level-3 only) and its wall
+// time. Calls made from within a logged call are not logged.
+//
+// Records go into a ring buffer owned by the calling thread, so logging
+// takes no locks. The buffers keep the most recent BLIS_VERBOSE_SIZE calls
+// of each thread and can be dumped at any time with bli_verbose_dump(). If
+// BLIS_VERBOSE is set, they are also dumped at exit to the file named by
+// BLIS_VERBOSE_FILE (or to stderr).
+//
+// When disabled, each entry point pays only for testing a global flag.
+//
+
+typedef struct
+{
+	// The position of this record in its ring, plus one. Zero while the
+	// record is being written.
+	volatile uint64_t seq;
+
+	char*    opname;
+	num_t    dt;
+	dim_t    level;
+
+	// Parameter characters, e.g. side, uplo, transa, transb and diag for
+	// level-3 operations ('-' if not applicable).
+	char     params[ 8 ];
+
+	dim_t    m;
+	dim_t    n;
+	dim_t    k;
+
+	// Strides of the operands: (rs_a, cs_a, rs_b, cs_b, rs_c, cs_c) for
+	// level-3, (rs_a, cs_a, incx, incy) for level-2, (incx, incy) for
+	// level-1v.
+	inc_t    strides[ 6 ];
+
+	// The ways of parallelism (jc, pc, ic, jr, ir) and induced method used
+	// by level-3 operations.
+	dim_t    ways[ 5 ];
+	ind_t    method;
+
+	dim_t    tid;
+	double   t_start;
+	double   time;
+} vrec_t;
+
+#define BLIS_VERBOSE_SIZE_DEF  1024
+
+extern bool_t bli_verbose_on;
+
+
+// Entry point instrumentation. The arguments are only evaluated when
+// logging is enabled.
+
+#define bli_verbose_begin_l3( opname, side_ch, a, b, c ) \
+\
+	( bli_verbose_on ? bli_verbose_begin_l3_int( opname, side_ch, a, b, c ) \
+	                 : NULL )
+
+#define bli_verbose_begin_l2( opname, dt, params, m, n, rs_a, cs_a, incx, incy ) \
+\
+	( bli_verbose_on ? bli_verbose_begin_l2_int( opname, dt, params, m, n, \
+	                                             rs_a, cs_a, incx, incy ) \
+	                 : NULL )
+
+#define bli_verbose_begin_l1v( opname, dt, params, n, incx, incy ) \
+\
+	( bli_verbose_on ? bli_verbose_begin_l1v_int( opname, dt, params, n, \
+	                                              incx, incy ) \
+	                 : NULL )
+
+#define bli_verbose_end( vrec ) \
+\
+	( (vrec) != NULL ? bli_verbose_end_int( vrec ) : ( void )0 )
+
+#define bli_verbose_set_ways( cntx, rntm ) \
+\
+	( bli_verbose_on ? bli_verbose_set_ways_int( cntx, rntm ) : ( void )0 )
+
+// Parameter characters for the records.
+
+#define bli_verbose_side_ch( side ) \
+	( bli_is_left( side ) ? 'l' : 'r' )
+#define bli_verbose_uplo_ch( uplo ) \
+	( bli_is_lower( uplo ) ? 'l' : ( bli_is_upper( uplo ) ? 'u' : 'e' ) )
+#define bli_verbose_trans_ch( trans ) \
+	( bli_does_trans( trans ) ? ( bli_does_conj( trans ) ? 'h' : 't' ) \
+	                          : ( bli_does_conj( trans ) ? 'c' : 'n' ) )
+#define bli_verbose_conj_ch( conj ) \
+	( bli_is_conj( conj ) ? 'c' : 'n' )
+#define bli_verbose_diag_ch( diag ) \
+	( bli_is_unit_diag( diag ) ? 'u' : 'n' )
+
+
+void    bli_verbose_init( void );
+void    bli_verbose_finalize( void );
+
+void    bli_verbose_enable( void );
+void    bli_verbose_disable( void );
+bool_t  bli_verbose_is_enabled( void );
+
+vrec_t* bli_verbose_begin_l3_int( char* opname, char side_ch,
+                                  obj_t* a, obj_t* b, obj_t* c );
+vrec_t* bli_verbose_begin_l2_int( char* opname, num_t dt, char* params,
+                                  dim_t m, dim_t n, inc_t rs_a, inc_t cs_a,
+                                  inc_t incx, inc_t incy );
+vrec_t* bli_verbose_begin_l1v_int( char* opname, num_t dt, char* params,
+                                   dim_t n, inc_t incx, inc_t incy );
+void    bli_verbose_end_int( vrec_t* vrec );
+void    bli_verbose_set_ways_int( cntx_t* cntx, rntm_t* rntm );
+
+void    bli_verbose_suspend( void );
+void    bli_verbose_resume( void );
+
+void    bli_verbose_clear( void );
+dim_t   bli_verbose_get_records( dim_t n_max, vrec_t* recs );
+void    bli_verbose_fprint_record( FILE* file, vrec_t* vrec );
+void    bli_verbose_dump( FILE* file );
+err_t   bli_verbose_dump_file( char* path );
+
+#endif
+
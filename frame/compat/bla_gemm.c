@@ -98,21 +98,41 @@ void PASTEF77(ch,blasname) \
 	rs_c = 1; \
 	cs_c = *ldc; \
 \
-	/* Call BLIS interface. */ \
-	PASTEMAC(ch,blisname) \
-	( \
-	  blis_transa, \
-	  blis_transb, \
-	  m0, \
-	  n0, \
-	  k0, \
-	  (ftype*)alpha, \
-	  (ftype*)a, rs_a, cs_a, \
-	  (ftype*)b, rs_b, cs_b, \
-	  (ftype*)beta, \
-	  (ftype*)c, rs_c, cs_c, \
-	  NULL  \
-	); \
+	/* Call BLIS interface. Small problems go straight to the gemmsup
+	   driver. */ \
+	if ( bli_gemm_sup_is_eligible( ch, m0, n0, k0 ) ) \
+	{ \
+		PASTEMAC(ch,gemm_sup) \
+		( \
+		  blis_transa, \
+		  blis_transb, \
+		  m0, \
+		  n0, \
+		  k0, \
+		  (ftype*)alpha, \
+		  (ftype*)a, rs_a, cs_a, \
+		  (ftype*)b, rs_b, cs_b, \
+		  (ftype*)beta, \
+		  (ftype*)c, rs_c, cs_c  \
+		); \
+	} \
+	else \
+	{ \
+		PASTEMAC(ch,blisname) \
+		( \
+		  blis_transa, \
+		  blis_transb, \
+		  m0, \
+		  n0, \
+		  k0, \
+		  (ftype*)alpha, \
+		  (ftype*)a, rs_a, cs_a, \
+		  (ftype*)b, rs_b, cs_b, \
+		  (ftype*)beta, \
+		  (ftype*)c, rs_c, cs_c, \
+		  NULL  \
+		); \
+	} \
 \
 	/* Finalize BLIS (if it was initialized above). */ \
 	bli_finalize_auto( init_result ); \
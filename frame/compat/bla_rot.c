@@ -0,0 +1,96 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+
+//
+// Define BLAS-to-BLIS interfaces.
+//
+#undef  GENTFUNCR2
+#define GENTFUNCR2( ftype_x, ftype_r, chx, chr, blasname, blisname ) \
+\
+void PASTEF772(chx,chr,blasname) \
+     ( \
+       const f77_int* n, \
+       ftype_x* x, const f77_int* incx, \
+       ftype_x* y, const f77_int* incy, \
+       const ftype_r* c, \
+       const ftype_r* s  \
+     ) \
+{ \
+	dim_t    n0; \
+	ftype_x* x0; \
+	ftype_x* y0; \
+	inc_t    incx0; \
+	inc_t    incy0; \
+	ftype_r  c0; \
+	ftype_x  s0; \
+	err_t    init_result; \
+\
+	/* Initialize BLIS (if it is not already initialized). */ \
+	bli_init_auto( &init_result ); \
+\
+	/* Convert/typecast negative values of n to zero. */ \
+	bli_convert_blas_dim1( *n, n0 ); \
+\
+	/* If the input increments are negative, adjust the pointers so we can
+	   use positive increments instead. */ \
+	bli_convert_blas_incv( n0, (ftype_x*)x, *incx, x0, incx0 ); \
+	bli_convert_blas_incv( n0, (ftype_x*)y, *incy, y0, incy0 ); \
+\
+	/* The BLAS routines take a real s, which we promote to the type of
+	   x and y (the kernels detect when its imaginary part is zero). */ \
+	c0 = *c; \
+	PASTEMAC(chx,sets)( *s, 0.0, s0 ); \
+\
+	/* Call BLIS interface. */ \
+	PASTEMAC(chx,blisname) \
+	( \
+	  n0, \
+	  &c0, \
+	  &s0, \
+	  x0, incx0, \
+	  y0, incy0, \
+	  NULL  \
+	); \
+\
+	/* Finalize BLIS (if it was initialized above). */ \
+	bli_finalize_auto( init_result ); \
+}
+
+#ifdef BLIS_ENABLE_BLAS2BLIS
+INSERT_GENTFUNCR2_BLAS( rot, rotv )
+#endif
+
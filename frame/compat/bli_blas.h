@@ -50,6 +50,15 @@
 #include <ctype.h>  // for toupper(), used in xerbla()
 
 
+// -- ILP64 interface --
+
+// When BLIS_ENABLE_BLAS_ILP64 is defined, the library also contains a copy
+// of the BLAS (and CBLAS, if enabled) compatibility layer in which f77_int
+// is 64 bits and every symbol carries a _64 suffix (e.g. dgemm_64_). Define
+// BLIS_BLAS_ILP64_API before including blis.h to obtain the prototypes for
+// that interface instead of the default one.
+
+
 // -- Constants --
 
 #define BLIS_MAX_BLAS_FUNC_STR_LENGTH (6+1)
@@ -142,6 +151,15 @@
 #include "bla_tpmv.h"
 #include "bla_tpsv.h"
 
+#include "bla_hpmv_check.h"
+#include "bla_hpr_check.h"
+#include "bla_hpr2_check.h"
+#include "bla_spmv_check.h"
+#include "bla_spr_check.h"
+#include "bla_spr2_check.h"
+#include "bla_tpmv_check.h"
+#include "bla_tpsv_check.h"
+
 // banded
 
 #include "bla_gbmv.h"
@@ -150,6 +168,12 @@
 #include "bla_tbmv.h"
 #include "bla_tbsv.h"
 
+#include "bla_gbmv_check.h"
+#include "bla_hbmv_check.h"
+#include "bla_sbmv_check.h"
+#include "bla_tbmv_check.h"
+#include "bla_tbsv_check.h"
+
 
 // -- Level-3 BLAS prototypes --
 
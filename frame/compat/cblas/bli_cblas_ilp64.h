@@ -0,0 +1,200 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_CBLAS_ILP64_H
+#define BLIS_CBLAS_ILP64_H
+
+// When BLIS_BLAS_ILP64_API is defined, every CBLAS symbol is renamed with a
+// _64 suffix (e.g. cblas_dgemm_64). This happens when the compatibility
+// layer is compiled a second time to produce its ILP64 interface, in which
+// f77_int is 64 bits, and it also lets applications that define the macro
+// before including blis.h (or cblas.h) call that interface with the
+// conventional CBLAS names.
+
+#ifdef BLIS_BLAS_ILP64_API
+
+// -- Global state --
+
+#define CBLAS_CallFromC  CBLAS_CallFromC_64
+#define RowMajorStrg     RowMajorStrg_64
+
+// -- CBLAS functions --
+
+#define cblas_caxpy        cblas_caxpy_64
+#define cblas_ccopy        cblas_ccopy_64
+#define cblas_cdotc_sub    cblas_cdotc_sub_64
+#define cblas_cdotu_sub    cblas_cdotu_sub_64
+#define cblas_cgbmv        cblas_cgbmv_64
+#define cblas_cgemm        cblas_cgemm_64
+#define cblas_cgemv        cblas_cgemv_64
+#define cblas_cgerc        cblas_cgerc_64
+#define cblas_cgeru        cblas_cgeru_64
+#define cblas_chbmv        cblas_chbmv_64
+#define cblas_chemm        cblas_chemm_64
+#define cblas_chemv        cblas_chemv_64
+#define cblas_cher         cblas_cher_64
+#define cblas_cher2        cblas_cher2_64
+#define cblas_cher2k       cblas_cher2k_64
+#define cblas_cherk        cblas_cherk_64
+#define cblas_chpmv        cblas_chpmv_64
+#define cblas_chpr         cblas_chpr_64
+#define cblas_chpr2        cblas_chpr2_64
+#define cblas_cscal        cblas_cscal_64
+#define cblas_csscal       cblas_csscal_64
+#define cblas_cswap        cblas_cswap_64
+#define cblas_csymm        cblas_csymm_64
+#define cblas_csyr2k       cblas_csyr2k_64
+#define cblas_csyrk        cblas_csyrk_64
+#define cblas_ctbmv        cblas_ctbmv_64
+#define cblas_ctbsv        cblas_ctbsv_64
+#define cblas_ctpmv        cblas_ctpmv_64
+#define cblas_ctpsv        cblas_ctpsv_64
+#define cblas_ctrmm        cblas_ctrmm_64
+#define cblas_ctrmv        cblas_ctrmv_64
+#define cblas_ctrsm        cblas_ctrsm_64
+#define cblas_ctrsv        cblas_ctrsv_64
+#define cblas_dasum        cblas_dasum_64
+#define cblas_daxpy        cblas_daxpy_64
+#define cblas_dcopy        cblas_dcopy_64
+#define cblas_ddot         cblas_ddot_64
+#define cblas_dgbmv        cblas_dgbmv_64
+#define cblas_dgemm        cblas_dgemm_64
+#define cblas_dgemv        cblas_dgemv_64
+#define cblas_dger         cblas_dger_64
+#define cblas_dnrm2        cblas_dnrm2_64
+#define cblas_drot         cblas_drot_64
+#define cblas_drotg        cblas_drotg_64
+#define cblas_drotm        cblas_drotm_64
+#define cblas_drotmg       cblas_drotmg_64
+#define cblas_dsbmv        cblas_dsbmv_64
+#define cblas_dscal        cblas_dscal_64
+#define cblas_dsdot        cblas_dsdot_64
+#define cblas_dspmv        cblas_dspmv_64
+#define cblas_dspr         cblas_dspr_64
+#define cblas_dspr2        cblas_dspr2_64
+#define cblas_dswap        cblas_dswap_64
+#define cblas_dsymm        cblas_dsymm_64
+#define cblas_dsymv        cblas_dsymv_64
+#define cblas_dsyr         cblas_dsyr_64
+#define cblas_dsyr2        cblas_dsyr2_64
+#define cblas_dsyr2k       cblas_dsyr2k_64
+#define cblas_dsyrk        cblas_dsyrk_64
+#define cblas_dtbmv        cblas_dtbmv_64
+#define cblas_dtbsv        cblas_dtbsv_64
+#define cblas_dtpmv        cblas_dtpmv_64
+#define cblas_dtpsv        cblas_dtpsv_64
+#define cblas_dtrmm        cblas_dtrmm_64
+#define cblas_dtrmv        cblas_dtrmv_64
+#define cblas_dtrsm        cblas_dtrsm_64
+#define cblas_dtrsv        cblas_dtrsv_64
+#define cblas_dzasum       cblas_dzasum_64
+#define cblas_dznrm2       cblas_dznrm2_64
+#define cblas_icamax       cblas_icamax_64
+#define cblas_idamax       cblas_idamax_64
+#define cblas_isamax       cblas_isamax_64
+#define cblas_izamax       cblas_izamax_64
+#define cblas_sasum        cblas_sasum_64
+#define cblas_saxpy        cblas_saxpy_64
+#define cblas_scasum       cblas_scasum_64
+#define cblas_scnrm2       cblas_scnrm2_64
+#define cblas_scopy        cblas_scopy_64
+#define cblas_sdot         cblas_sdot_64
+#define cblas_sdsdot       cblas_sdsdot_64
+#define cblas_sgbmv        cblas_sgbmv_64
+#define cblas_sgemm        cblas_sgemm_64
+#define cblas_sgemv        cblas_sgemv_64
+#define cblas_sger         cblas_sger_64
+#define cblas_snrm2        cblas_snrm2_64
+#define cblas_srot         cblas_srot_64
+#define cblas_srotg        cblas_srotg_64
+#define cblas_srotm        cblas_srotm_64
+#define cblas_srotmg       cblas_srotmg_64
+#define cblas_ssbmv        cblas_ssbmv_64
+#define cblas_sscal        cblas_sscal_64
+#define cblas_sspmv        cblas_sspmv_64
+#define cblas_sspr         cblas_sspr_64
+#define cblas_sspr2        cblas_sspr2_64
+#define cblas_sswap        cblas_sswap_64
+#define cblas_ssymm        cblas_ssymm_64
+#define cblas_ssymv        cblas_ssymv_64
+#define cblas_ssyr         cblas_ssyr_64
+#define cblas_ssyr2        cblas_ssyr2_64
+#define cblas_ssyr2k       cblas_ssyr2k_64
+#define cblas_ssyrk        cblas_ssyrk_64
+#define cblas_stbmv        cblas_stbmv_64
+#define cblas_stbsv        cblas_stbsv_64
+#define cblas_stpmv        cblas_stpmv_64
+#define cblas_stpsv        cblas_stpsv_64
+#define cblas_strmm        cblas_strmm_64
+#define cblas_strmv        cblas_strmv_64
+#define cblas_strsm        cblas_strsm_64
+#define cblas_strsv        cblas_strsv_64
+#define cblas_xerbla       cblas_xerbla_64
+#define cblas_zaxpy        cblas_zaxpy_64
+#define cblas_zcopy        cblas_zcopy_64
+#define cblas_zdotc_sub    cblas_zdotc_sub_64
+#define cblas_zdotu_sub    cblas_zdotu_sub_64
+#define cblas_zdscal       cblas_zdscal_64
+#define cblas_zgbmv        cblas_zgbmv_64
+#define cblas_zgemm        cblas_zgemm_64
+#define cblas_zgemv        cblas_zgemv_64
+#define cblas_zgerc        cblas_zgerc_64
+#define cblas_zgeru        cblas_zgeru_64
+#define cblas_zhbmv        cblas_zhbmv_64
+#define cblas_zhemm        cblas_zhemm_64
+#define cblas_zhemv        cblas_zhemv_64
+#define cblas_zher         cblas_zher_64
+#define cblas_zher2        cblas_zher2_64
+#define cblas_zher2k       cblas_zher2k_64
+#define cblas_zherk        cblas_zherk_64
+#define cblas_zhpmv        cblas_zhpmv_64
+#define cblas_zhpr         cblas_zhpr_64
+#define cblas_zhpr2        cblas_zhpr2_64
+#define cblas_zscal        cblas_zscal_64
+#define cblas_zswap        cblas_zswap_64
+#define cblas_zsymm        cblas_zsymm_64
+#define cblas_zsyr2k       cblas_zsyr2k_64
+#define cblas_zsyrk        cblas_zsyrk_64
+#define cblas_ztbmv        cblas_ztbmv_64
+#define cblas_ztbsv        cblas_ztbsv_64
+#define cblas_ztpmv        cblas_ztpmv_64
+#define cblas_ztpsv        cblas_ztpsv_64
+#define cblas_ztrmm        cblas_ztrmm_64
+#define cblas_ztrmv        cblas_ztrmv_64
+#define cblas_ztrsm        cblas_ztrsm_64
+#define cblas_ztrsv        cblas_ztrsv_64
+
+#endif // BLIS_BLAS_ILP64_API
+
+#endif // BLIS_CBLAS_ILP64_H
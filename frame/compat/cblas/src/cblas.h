@@ -10,6 +10,9 @@
 #include "bli_config_macro_defs.h"
 #include "bli_type_defs.h"
 
+// Rename the CBLAS symbols when compiling (or calling) the ILP64 interface.
+#include "bli_cblas_ilp64.h"
+
 /*
  * Enumerated and derived types
  */
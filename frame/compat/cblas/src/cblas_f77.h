@@ -14,154 +14,154 @@
 /*
  * Level 1 BLAS
  */
-#define F77_xerbla     xerbla_
-#define F77_srotg      srotg_
-#define F77_srotmg     srotmg_
-#define F77_srot       srot_
-#define F77_srotm      srotm_
-#define F77_drotg      drotg_
-#define F77_drotmg     drotmg_
-#define F77_drot       drot_
-#define F77_drotm      drotm_
-#define F77_sswap      sswap_
-#define F77_scopy      scopy_
-#define F77_saxpy      saxpy_
-#define F77_isamax_sub isamaxsub_
-#define F77_dswap      dswap_
-#define F77_dcopy      dcopy_
-#define F77_daxpy      daxpy_
-#define F77_idamax_sub idamaxsub_
-#define F77_cswap      cswap_
-#define F77_ccopy      ccopy_
-#define F77_caxpy      caxpy_
-#define F77_icamax_sub icamaxsub_
-#define F77_zswap      zswap_
-#define F77_zcopy      zcopy_
-#define F77_zaxpy      zaxpy_
-#define F77_izamax_sub izamaxsub_
-#define F77_sdot_sub   sdotsub_
-#define F77_ddot_sub   ddotsub_
-#define F77_dsdot_sub  dsdotsub_
-#define F77_sscal      sscal_
-#define F77_dscal      dscal_
-#define F77_cscal      cscal_
-#define F77_zscal      zscal_
-#define F77_csscal     csscal_
-#define F77_zdscal     zdscal_
-#define F77_cdotu_sub  cdotusub_
-#define F77_cdotc_sub  cdotcsub_
-#define F77_zdotu_sub  zdotusub_
-#define F77_zdotc_sub  zdotcsub_
-#define F77_snrm2_sub  snrm2sub_
-#define F77_sasum_sub  sasumsub_
-#define F77_dnrm2_sub  dnrm2sub_
-#define F77_dasum_sub  dasumsub_
-#define F77_scnrm2_sub scnrm2sub_
-#define F77_scasum_sub scasumsub_
-#define F77_dznrm2_sub dznrm2sub_
-#define F77_dzasum_sub dzasumsub_
-#define F77_sdsdot_sub sdsdotsub_
+#define F77_xerbla     PASTEF770(xerbla)
+#define F77_srotg      PASTEF770(srotg)
+#define F77_srotmg     PASTEF770(srotmg)
+#define F77_srot       PASTEF770(srot)
+#define F77_srotm      PASTEF770(srotm)
+#define F77_drotg      PASTEF770(drotg)
+#define F77_drotmg     PASTEF770(drotmg)
+#define F77_drot       PASTEF770(drot)
+#define F77_drotm      PASTEF770(drotm)
+#define F77_sswap      PASTEF770(sswap)
+#define F77_scopy      PASTEF770(scopy)
+#define F77_saxpy      PASTEF770(saxpy)
+#define F77_isamax_sub PASTEF770(isamaxsub)
+#define F77_dswap      PASTEF770(dswap)
+#define F77_dcopy      PASTEF770(dcopy)
+#define F77_daxpy      PASTEF770(daxpy)
+#define F77_idamax_sub PASTEF770(idamaxsub)
+#define F77_cswap      PASTEF770(cswap)
+#define F77_ccopy      PASTEF770(ccopy)
+#define F77_caxpy      PASTEF770(caxpy)
+#define F77_icamax_sub PASTEF770(icamaxsub)
+#define F77_zswap      PASTEF770(zswap)
+#define F77_zcopy      PASTEF770(zcopy)
+#define F77_zaxpy      PASTEF770(zaxpy)
+#define F77_izamax_sub PASTEF770(izamaxsub)
+#define F77_sdot_sub   PASTEF770(sdotsub)
+#define F77_ddot_sub   PASTEF770(ddotsub)
+#define F77_dsdot_sub  PASTEF770(dsdotsub)
+#define F77_sscal      PASTEF770(sscal)
+#define F77_dscal      PASTEF770(dscal)
+#define F77_cscal      PASTEF770(cscal)
+#define F77_zscal      PASTEF770(zscal)
+#define F77_csscal     PASTEF770(csscal)
+#define F77_zdscal     PASTEF770(zdscal)
+#define F77_cdotu_sub  PASTEF770(cdotusub)
+#define F77_cdotc_sub  PASTEF770(cdotcsub)
+#define F77_zdotu_sub  PASTEF770(zdotusub)
+#define F77_zdotc_sub  PASTEF770(zdotcsub)
+#define F77_snrm2_sub  PASTEF770(snrm2sub)
+#define F77_sasum_sub  PASTEF770(sasumsub)
+#define F77_dnrm2_sub  PASTEF770(dnrm2sub)
+#define F77_dasum_sub  PASTEF770(dasumsub)
+#define F77_scnrm2_sub PASTEF770(scnrm2sub)
+#define F77_scasum_sub PASTEF770(scasumsub)
+#define F77_dznrm2_sub PASTEF770(dznrm2sub)
+#define F77_dzasum_sub PASTEF770(dzasumsub)
+#define F77_sdsdot_sub PASTEF770(sdsdotsub)
 /*
 * Level 2 BLAS
 */
-#define F77_ssymv ssymv_
-#define F77_ssbmv ssbmv_
-#define F77_sspmv sspmv_
-#define F77_sger  sger_
-#define F77_ssyr  ssyr_
-#define F77_sspr  sspr_
-#define F77_ssyr2 ssyr2_
-#define F77_sspr2 sspr2_
-#define F77_dsymv dsymv_
-#define F77_dsbmv dsbmv_
-#define F77_dspmv dspmv_
-#define F77_dger  dger_
-#define F77_dsyr  dsyr_
-#define F77_dspr  dspr_
-#define F77_dsyr2 dsyr2_
-#define F77_dspr2 dspr2_
-#define F77_chemv chemv_
-#define F77_chbmv chbmv_
-#define F77_chpmv chpmv_
-#define F77_cgeru cgeru_
-#define F77_cgerc cgerc_
-#define F77_cher  cher_
-#define F77_chpr  chpr_
-#define F77_cher2 cher2_
-#define F77_chpr2 chpr2_
-#define F77_zhemv zhemv_
-#define F77_zhbmv zhbmv_
-#define F77_zhpmv zhpmv_
-#define F77_zgeru zgeru_
-#define F77_zgerc zgerc_
-#define F77_zher  zher_
-#define F77_zhpr  zhpr_
-#define F77_zher2 zher2_
-#define F77_zhpr2 zhpr2_
-#define F77_sgemv sgemv_
-#define F77_sgbmv sgbmv_
-#define F77_strmv strmv_
-#define F77_stbmv stbmv_
-#define F77_stpmv stpmv_
-#define F77_strsv strsv_
-#define F77_stbsv stbsv_
-#define F77_stpsv stpsv_
-#define F77_dgemv dgemv_
-#define F77_dgbmv dgbmv_
-#define F77_dtrmv dtrmv_
-#define F77_dtbmv dtbmv_
-#define F77_dtpmv dtpmv_
-#define F77_dtrsv dtrsv_
-#define F77_dtbsv dtbsv_
-#define F77_dtpsv dtpsv_
-#define F77_cgemv cgemv_
-#define F77_cgbmv cgbmv_
-#define F77_ctrmv ctrmv_
-#define F77_ctbmv ctbmv_
-#define F77_ctpmv ctpmv_
-#define F77_ctrsv ctrsv_
-#define F77_ctbsv ctbsv_
-#define F77_ctpsv ctpsv_
-#define F77_zgemv zgemv_
-#define F77_zgbmv zgbmv_
-#define F77_ztrmv ztrmv_
-#define F77_ztbmv ztbmv_
-#define F77_ztpmv ztpmv_
-#define F77_ztrsv ztrsv_
-#define F77_ztbsv ztbsv_
-#define F77_ztpsv ztpsv_
+#define F77_ssymv PASTEF770(ssymv)
+#define F77_ssbmv PASTEF770(ssbmv)
+#define F77_sspmv PASTEF770(sspmv)
+#define F77_sger  PASTEF770(sger)
+#define F77_ssyr  PASTEF770(ssyr)
+#define F77_sspr  PASTEF770(sspr)
+#define F77_ssyr2 PASTEF770(ssyr2)
+#define F77_sspr2 PASTEF770(sspr2)
+#define F77_dsymv PASTEF770(dsymv)
+#define F77_dsbmv PASTEF770(dsbmv)
+#define F77_dspmv PASTEF770(dspmv)
+#define F77_dger  PASTEF770(dger)
+#define F77_dsyr  PASTEF770(dsyr)
+#define F77_dspr  PASTEF770(dspr)
+#define F77_dsyr2 PASTEF770(dsyr2)
+#define F77_dspr2 PASTEF770(dspr2)
+#define F77_chemv PASTEF770(chemv)
+#define F77_chbmv PASTEF770(chbmv)
+#define F77_chpmv PASTEF770(chpmv)
+#define F77_cgeru PASTEF770(cgeru)
+#define F77_cgerc PASTEF770(cgerc)
+#define F77_cher  PASTEF770(cher)
+#define F77_chpr  PASTEF770(chpr)
+#define F77_cher2 PASTEF770(cher2)
+#define F77_chpr2 PASTEF770(chpr2)
+#define F77_zhemv PASTEF770(zhemv)
+#define F77_zhbmv PASTEF770(zhbmv)
+#define F77_zhpmv PASTEF770(zhpmv)
+#define F77_zgeru PASTEF770(zgeru)
+#define F77_zgerc PASTEF770(zgerc)
+#define F77_zher  PASTEF770(zher)
+#define F77_zhpr  PASTEF770(zhpr)
+#define F77_zher2 PASTEF770(zher2)
+#define F77_zhpr2 PASTEF770(zhpr2)
+#define F77_sgemv PASTEF770(sgemv)
+#define F77_sgbmv PASTEF770(sgbmv)
+#define F77_strmv PASTEF770(strmv)
+#define F77_stbmv PASTEF770(stbmv)
+#define F77_stpmv PASTEF770(stpmv)
+#define F77_strsv PASTEF770(strsv)
+#define F77_stbsv PASTEF770(stbsv)
+#define F77_stpsv PASTEF770(stpsv)
+#define F77_dgemv PASTEF770(dgemv)
+#define F77_dgbmv PASTEF770(dgbmv)
+#define F77_dtrmv PASTEF770(dtrmv)
+#define F77_dtbmv PASTEF770(dtbmv)
+#define F77_dtpmv PASTEF770(dtpmv)
+#define F77_dtrsv PASTEF770(dtrsv)
+#define F77_dtbsv PASTEF770(dtbsv)
+#define F77_dtpsv PASTEF770(dtpsv)
+#define F77_cgemv PASTEF770(cgemv)
+#define F77_cgbmv PASTEF770(cgbmv)
+#define F77_ctrmv PASTEF770(ctrmv)
+#define F77_ctbmv PASTEF770(ctbmv)
+#define F77_ctpmv PASTEF770(ctpmv)
+#define F77_ctrsv PASTEF770(ctrsv)
+#define F77_ctbsv PASTEF770(ctbsv)
+#define F77_ctpsv PASTEF770(ctpsv)
+#define F77_zgemv PASTEF770(zgemv)
+#define F77_zgbmv PASTEF770(zgbmv)
+#define F77_ztrmv PASTEF770(ztrmv)
+#define F77_ztbmv PASTEF770(ztbmv)
+#define F77_ztpmv PASTEF770(ztpmv)
+#define F77_ztrsv PASTEF770(ztrsv)
+#define F77_ztbsv PASTEF770(ztbsv)
+#define F77_ztpsv PASTEF770(ztpsv)
 /*
 * Level 3 BLAS
 */
-#define F77_chemm  chemm_
-#define F77_cherk  cherk_
-#define F77_cher2k cher2k_
-#define F77_zhemm  zhemm_
-#define F77_zherk  zherk_
-#define F77_zher2k zher2k_
-#define F77_sgemm  sgemm_
-#define F77_ssymm  ssymm_
-#define F77_ssyrk  ssyrk_
-#define F77_ssyr2k ssyr2k_
-#define F77_strmm  strmm_
-#define F77_strsm  strsm_
-#define F77_dgemm  dgemm_
-#define F77_dsymm  dsymm_
-#define F77_dsyrk  dsyrk_
-#define F77_dsyr2k dsyr2k_
-#define F77_dtrmm  dtrmm_
-#define F77_dtrsm  dtrsm_
-#define F77_cgemm  cgemm_
-#define F77_csymm  csymm_
-#define F77_csyrk  csyrk_
-#define F77_csyr2k csyr2k_
-#define F77_ctrmm  ctrmm_
-#define F77_ctrsm  ctrsm_
-#define F77_zgemm  zgemm_
-#define F77_zsymm  zsymm_
-#define F77_zsyrk  zsyrk_
-#define F77_zsyr2k zsyr2k_
-#define F77_ztrmm  ztrmm_
-#define F77_ztrsm  ztrsm_
+#define F77_chemm  PASTEF770(chemm)
+#define F77_cherk  PASTEF770(cherk)
+#define F77_cher2k PASTEF770(cher2k)
+#define F77_zhemm  PASTEF770(zhemm)
+#define F77_zherk  PASTEF770(zherk)
+#define F77_zher2k PASTEF770(zher2k)
+#define F77_sgemm  PASTEF770(sgemm)
+#define F77_ssymm  PASTEF770(ssymm)
+#define F77_ssyrk  PASTEF770(ssyrk)
+#define F77_ssyr2k PASTEF770(ssyr2k)
+#define F77_strmm  PASTEF770(strmm)
+#define F77_strsm  PASTEF770(strsm)
+#define F77_dgemm  PASTEF770(dgemm)
+#define F77_dsymm  PASTEF770(dsymm)
+#define F77_dsyrk  PASTEF770(dsyrk)
+#define F77_dsyr2k PASTEF770(dsyr2k)
+#define F77_dtrmm  PASTEF770(dtrmm)
+#define F77_dtrsm  PASTEF770(dtrsm)
+#define F77_cgemm  PASTEF770(cgemm)
+#define F77_csymm  PASTEF770(csymm)
+#define F77_csyrk  PASTEF770(csyrk)
+#define F77_csyr2k PASTEF770(csyr2k)
+#define F77_ctrmm  PASTEF770(ctrmm)
+#define F77_ctrsm  PASTEF770(ctrsm)
+#define F77_zgemm  PASTEF770(zgemm)
+#define F77_zsymm  PASTEF770(zsymm)
+#define F77_zsyrk  PASTEF770(zsyrk)
+#define F77_zsyr2k PASTEF770(zsyr2k)
+#define F77_ztrmm  PASTEF770(ztrmm)
+#define F77_ztrsm  PASTEF770(ztrsm)
 
 #endif /*  CBLAS_F77_H */
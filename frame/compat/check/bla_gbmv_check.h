@@ -32,11 +32,21 @@
 
 */
 
+
 #ifdef BLIS_ENABLE_BLAS2BLIS
 
-int PASTEF77(c,tbsv)(const bla_character *uplo, const bla_character *trans, const bla_character *diag, const bla_integer *n, const bla_integer *k, const bla_scomplex *a, const bla_integer *lda, bla_scomplex *x, const bla_integer *incx);
-int PASTEF77(d,tbsv)(const bla_character *uplo, const bla_character *trans, const bla_character *diag, const bla_integer *n, const bla_integer *k, const bla_double *a, const bla_integer *lda, bla_double *x, const bla_integer *incx);
-int PASTEF77(s,tbsv)(const bla_character *uplo, const bla_character *trans, const bla_character *diag, const bla_integer *n, const bla_integer *k, const bla_real *a, const bla_integer *lda, bla_real *x, const bla_integer *incx);
-int PASTEF77(z,tbsv)(const bla_character *uplo, const bla_character *trans, const bla_character *diag, const bla_integer *n, const bla_integer *k, const bla_dcomplex *a, const bla_integer *lda, bla_dcomplex *x, const bla_integer *incx);
+void PASTEBLACHK(gbmv)
+     (
+       const char*     dt_str,
+       const char*     op_str,
+       const f77_char* transa,
+       const f77_int*  m,
+       const f77_int*  n,
+       const f77_int*  kl,
+       const f77_int*  ku,
+       const f77_int*  lda,
+       const f77_int*  incx,
+       const f77_int*  incy
+     );
 
 #endif
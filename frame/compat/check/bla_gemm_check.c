@@ -36,7 +36,7 @@
 
 #ifdef BLIS_ENABLE_BLAS2BLIS
 
-void bla_gemm_check
+void PASTEBLACHK(gemm)
      (
        const char*     dt_str,
        const char*     op_str,
@@ -36,7 +36,7 @@
 
 #ifdef BLIS_ENABLE_BLAS2BLIS
 
-void bla_ger_check
+void PASTEBLACHK(ger)
      (
        const char*     dt_str,
        const char*     op_str,
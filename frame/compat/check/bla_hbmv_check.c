@@ -32,11 +32,61 @@
 
 */
 
+
+#include "blis.h"
+
 #ifdef BLIS_ENABLE_BLAS2BLIS
 
-int PASTEF77(c,tbmv)(const bla_character *uplo, const bla_character *trans, const bla_character *diag, const bla_integer *n, const bla_integer *k, const bla_scomplex *a, const bla_integer *lda, bla_scomplex *x, const bla_integer *incx);
-int PASTEF77(d,tbmv)(const bla_character *uplo, const bla_character *trans, const bla_character *diag, const bla_integer *n, const bla_integer *k, const bla_double *a, const bla_integer *lda, bla_double *x, const bla_integer *incx);
-int PASTEF77(s,tbmv)(const bla_character *uplo, const bla_character *trans, const bla_character *diag, const bla_integer *n, const bla_integer *k, const bla_real *a, const bla_integer *lda, bla_real *x, const bla_integer *incx);
-int PASTEF77(z,tbmv)(const bla_character *uplo, const bla_character *trans, const bla_character *diag, const bla_integer *n, const bla_integer *k, const bla_dcomplex *a, const bla_integer *lda, bla_dcomplex *x, const bla_integer *incx);
+void PASTEBLACHK(hbmv)
+     (
+       const char*     dt_str,
+       const char*     op_str,
+       const f77_char* uploa,
+       const f77_int*  m,
+       const f77_int*  k,
+       const f77_int*  lda,
+       const f77_int*  incx,
+       const f77_int*  incy
+     )
+{
+	f77_int info = 0;
+	f77_int lower, upper;
+
+	lower = PASTEF770(lsame)( uploa, "L", (ftnlen)1, (ftnlen)1
+     );
+	upper = PASTEF770(lsame)( uploa, "U", (ftnlen)1, (ftnlen)1
+     );
+
+	if      ( !lower && !upper
+     )
+		info = 1;
+	else if ( *m < 0
+     )
+		info = 2;
+	else if ( *k < 0
+     )
+		info = 3;
+	else if ( *lda < *k + 1
+     )
+		info = 6;
+	else if ( *incx == 0
+     )
+		info = 8;
+	else if ( *incy == 0
+     )
+		info = 11;
+
+	if ( info != 0
+     )
+	{
+		char func_str[ BLIS_MAX_BLAS_FUNC_STR_LENGTH ];
+
+		sprintf( func_str, "%s%-5s", dt_str, op_str
+     );
+
+		PASTEF770(xerbla)( func_str, &info, (ftnlen)6
+     );
+	}
+}
 
 #endif
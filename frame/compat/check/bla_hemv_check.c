@@ -36,7 +36,7 @@
 
 #ifdef BLIS_ENABLE_BLAS2BLIS
 
-void bla_hemv_check
+void PASTEBLACHK(hemv)
      (
        const char*     dt_str,
        const char*     op_str,
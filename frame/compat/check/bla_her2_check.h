@@ -34,7 +34,7 @@
 
 #ifdef BLIS_ENABLE_BLAS2BLIS
 
-void bla_her2_check
+void PASTEBLACHK(her2)
      (
        const char*     dt_str,
        const char*     op_str,
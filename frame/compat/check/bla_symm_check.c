@@ -36,7 +36,7 @@
 
 #ifdef BLIS_ENABLE_BLAS2BLIS
 
-void bla_symm_check
+void PASTEBLACHK(symm)
      (
        const char*     dt_str,
        const char*     op_str,
@@ -49,7 +49,7 @@ void bla_symm_check
        const f77_int*  ldc
      )
 {
-	bla_hemm_check
+	PASTEBLACHK(hemm)
      (
        dt_str,
 	                op_str,
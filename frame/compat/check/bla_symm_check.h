@@ -34,7 +34,7 @@
 
 #ifdef BLIS_ENABLE_BLAS2BLIS
 
-void bla_symm_check
+void PASTEBLACHK(symm)
      (
        const char*     dt_str,
        const char*     op_str,
@@ -36,7 +36,7 @@
 
 #ifdef BLIS_ENABLE_BLAS2BLIS
 
-void bla_symv_check
+void PASTEBLACHK(symv)
      (
        const char*     dt_str,
        const char*     op_str,
@@ -47,7 +47,7 @@ void bla_symv_check
        const f77_int*  incy
      )
 {
-	bla_hemv_check
+	PASTEBLACHK(hemv)
      (
        dt_str,
 	                op_str,
@@ -36,7 +36,7 @@
 
 #ifdef BLIS_ENABLE_BLAS2BLIS
 
-void bla_syr2_check
+void PASTEBLACHK(syr2)
      (
        const char*     dt_str,
        const char*     op_str,
@@ -47,7 +47,7 @@ void bla_syr2_check
        const f77_int*  lda
      )
 {
-	bla_her2_check
+	PASTEBLACHK(her2)
      (
        dt_str,
 	                op_str,
@@ -34,7 +34,7 @@
 
 #ifdef BLIS_ENABLE_BLAS2BLIS
 
-void bla_syr2k_check
+void PASTEBLACHK(syr2k)
      (
        const char*     dt_str,
        const char*     op_str,
@@ -36,7 +36,7 @@
 
 #ifdef BLIS_ENABLE_BLAS2BLIS
 
-void bla_syr_check
+void PASTEBLACHK(syr)
      (
        const char*     dt_str,
        const char*     op_str,
@@ -46,7 +46,7 @@ void bla_syr_check
        const f77_int*  lda
      )
 {
-	bla_her_check
+	PASTEBLACHK(her)
      (
        dt_str,
 	               op_str,
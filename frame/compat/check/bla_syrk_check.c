@@ -36,7 +36,7 @@
 
 #ifdef BLIS_ENABLE_BLAS2BLIS
 
-void bla_syrk_check
+void PASTEBLACHK(syrk)
      (
        const char*     dt_str,
        const char*     op_str,
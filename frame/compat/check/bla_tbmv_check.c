@@ -32,11 +32,77 @@
 
 */
 
+
+#include "blis.h"
+
 #ifdef BLIS_ENABLE_BLAS2BLIS
 
-int PASTEF77(c,gbmv)(const bla_character *trans, const bla_integer *m, const bla_integer *n, const bla_integer *kl, const bla_integer *ku, const bla_scomplex *alpha, const bla_scomplex *a, const bla_integer *lda, const bla_scomplex *x, const bla_integer *incx, const bla_scomplex *beta, bla_scomplex *y, const bla_integer *incy);
-int PASTEF77(d,gbmv)(const bla_character *trans, const bla_integer *m, const bla_integer *n, const bla_integer *kl, const bla_integer *ku, const bla_double *alpha, const bla_double *a, const bla_integer *lda, const bla_double *x, const bla_integer *incx, const bla_double *beta, bla_double *y, const bla_integer *incy);
-int PASTEF77(s,gbmv)(const bla_character *trans, const bla_integer *m, const bla_integer *n, const bla_integer *kl, const bla_integer *ku, const bla_real *alpha, const bla_real *a, const bla_integer *lda, const bla_real *x, const bla_integer * incx, const bla_real *beta, bla_real *y, const bla_integer *incy);
-int PASTEF77(z,gbmv)(const bla_character *trans, const bla_integer *m, const bla_integer *n, const bla_integer *kl, const bla_integer *ku, const bla_dcomplex *alpha, const bla_dcomplex *a, const bla_integer *lda, const bla_dcomplex *x, const bla_integer *incx, const bla_dcomplex *beta, bla_dcomplex * y, const bla_integer *incy);
+void PASTEBLACHK(tbmv)
+     (
+       const char*     dt_str,
+       const char*     op_str,
+       const f77_char* uploa,
+       const f77_char* transa,
+       const f77_char* diaga,
+       const f77_int*  m,
+       const f77_int*  k,
+       const f77_int*  lda,
+       const f77_int*  incx
+     )
+{
+	f77_int info = 0;
+	f77_int lower, upper;
+	f77_int nota, ta, conja;
+	f77_int unita, nonua;
+
+	lower = PASTEF770(lsame)( uploa, "L", (ftnlen)1, (ftnlen)1
+     );
+	upper = PASTEF770(lsame)( uploa, "U", (ftnlen)1, (ftnlen)1
+     );
+	nota  = PASTEF770(lsame)( transa, "N", (ftnlen)1, (ftnlen)1
+     );
+	ta    = PASTEF770(lsame)( transa, "T", (ftnlen)1, (ftnlen)1
+     );
+	conja = PASTEF770(lsame)( transa, "C", (ftnlen)1, (ftnlen)1
+     );
+	unita = PASTEF770(lsame)( diaga , "U", (ftnlen)1, (ftnlen)1
+     );
+	nonua = PASTEF770(lsame)( diaga , "N", (ftnlen)1, (ftnlen)1
+     );
+
+	if      ( !lower && !upper
+     )
+		info = 1;
+	else if ( !nota && !ta && !conja
+     )
+		info = 2;
+	else if ( !unita && !nonua
+     )
+		info = 3;
+	else if ( *m < 0
+     )
+		info = 4;
+	else if ( *k < 0
+     )
+		info = 5;
+	else if ( *lda < *k + 1
+     )
+		info = 7;
+	else if ( *incx == 0
+     )
+		info = 9;
+
+	if ( info != 0
+     )
+	{
+		char func_str[ BLIS_MAX_BLAS_FUNC_STR_LENGTH ];
+
+		sprintf( func_str, "%s%-5s", dt_str, op_str
+     );
+
+		PASTEF770(xerbla)( func_str, &info, (ftnlen)6
+     );
+	}
+}
 
 #endif
@@ -36,7 +36,7 @@
 
 #ifdef BLIS_ENABLE_BLAS2BLIS
 
-void bla_trmv_check
+void PASTEBLACHK(trmv)
      (
        const char*     dt_str,
        const char*     op_str,
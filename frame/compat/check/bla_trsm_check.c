@@ -36,7 +36,7 @@
 
 #ifdef BLIS_ENABLE_BLAS2BLIS
 
-void bla_trsm_check
+void PASTEBLACHK(trsm)
      (
        const char*     dt_str,
        const char*     op_str,
@@ -50,7 +50,7 @@ void bla_trsm_check
        const f77_int*  ldb
      )
 {
-	bla_trmm_check
+	PASTEBLACHK(trmm)
      (
        dt_str,
 	                op_str,
@@ -34,7 +34,7 @@
 
 #ifdef BLIS_ENABLE_BLAS2BLIS
 
-void bla_trsm_check
+void PASTEBLACHK(trsm)
      (
        const char*     dt_str,
        const char*     op_str,
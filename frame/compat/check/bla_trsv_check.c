@@ -36,7 +36,7 @@
 
 #ifdef BLIS_ENABLE_BLAS2BLIS
 
-void bla_trsv_check
+void PASTEBLACHK(trsv)
      (
        const char*     dt_str,
        const char*     op_str,
@@ -48,7 +48,7 @@ void bla_trsv_check
        const f77_int*  incx
      )
 {
-	bla_trmv_check
+	PASTEBLACHK(trmv)
      (
        dt_str,
 	                op_str,
@@ -34,7 +34,7 @@
 
 #ifdef BLIS_ENABLE_BLAS2BLIS
 
-void bla_trsv_check
+void PASTEBLACHK(trsv)
      (
        const char*     dt_str,
        const char*     op_str,
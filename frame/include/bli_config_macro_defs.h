@@ -98,6 +98,68 @@
   #define BLIS_ENABLE_MULTITHREADING
 #endif
 
+// The maximum number of NUMA nodes for which the memory broker keeps
+// separate pools of packing buffers. Threads on nodes beyond this number
+// share pools with lower-numbered nodes.
+#ifndef BLIS_NUM_NUMA_NODES_MAX
+#define BLIS_NUM_NUMA_NODES_MAX          8
+#endif
+
+// General-use buffers (such as the temporaries of level-2 operations) are
+// recycled through BLIS_NUM_GEN_POOLS pools whose block sizes are the
+// powers of two from 2^BLIS_GEN_POOL_MIN_SIZE_LOG2 bytes upward. Requests
+// larger than the largest class are allocated and freed directly. When
+// BLIS is built with pthreads, each thread keeps one released block per
+// class, up to a block size of BLIS_GEN_POOL_CACHE_MAX_SIZE bytes, for
+// reuse without taking the lock of the pools.
+#ifndef BLIS_NUM_GEN_POOLS
+#define BLIS_NUM_GEN_POOLS               14
+#endif
+
+#ifndef BLIS_GEN_POOL_MIN_SIZE_LOG2
+#define BLIS_GEN_POOL_MIN_SIZE_LOG2      8
+#endif
+
+#ifndef BLIS_GEN_POOL_CACHE_MAX_SIZE
+#define BLIS_GEN_POOL_CACHE_MAX_SIZE     65536
+#endif
+
+// The memory that the memory broker may keep in its pools, in bytes (zero
+// for no limit). Blocks are still allocated as needed while the pools are
+// above this size, but they are freed, rather than kept, once released.
+// BLIS_POOL_MAX_SIZE may also be set in the environment.
+#ifndef BLIS_POOL_MAX_SIZE
+#define BLIS_POOL_MAX_SIZE               0
+#endif
+
+// If positive, a background thread frees the idle blocks of the memory
+// pools once no block has been checked out for this many milliseconds
+// (pthreads builds only). BLIS_POOL_TRIM_IDLE_MS may also be set in the
+// environment.
+#ifndef BLIS_POOL_TRIM_IDLE_MS
+#define BLIS_POOL_TRIM_IDLE_MS           0
+#endif
+
+// How the memory broker pre-faults the blocks that it adds to its pools
+// for packing: NONE leaves the page faults to the first use of a block,
+// SERIAL has the thread that grows a pool touch the new block, PARALLEL
+// has the threads of the group that acquired the block share the touching
+// (so that its pages are placed near all of them), and POPULATE maps new
+// blocks with mmap(MAP_POPULATE) where available. BLIS_POOL_PREFAULT may
+// also be set in the environment, to 0 through 3.
+#define BLIS_POOL_PREFAULT_NONE          0
+#define BLIS_POOL_PREFAULT_SERIAL        1
+#define BLIS_POOL_PREFAULT_PARALLEL      2
+#define BLIS_POOL_PREFAULT_POPULATE      3
+
+#ifndef BLIS_POOL_PREFAULT
+#define BLIS_POOL_PREFAULT               BLIS_POOL_PREFAULT_SERIAL
+#endif
+
+// Once bli_memsys_reserve() has run, internal memory allocated outside of
+// the reservation is counted (see bli_memsys_reserve_num_misses()). Define
+// BLIS_ENABLE_RESERVE_ASSERT, for example in debug builds, to abort instead.
+
 
 // -- MISCELLANEOUS OPTIONS ----------------------------------------------------
 
@@ -85,6 +85,12 @@
 #define BLIS_PAGE_SIZE                   4096
 #endif
 
+// Size of a cache line. This is used to pad data that is written by one
+// thread and polled by another, such as barrier flags.
+#ifndef BLIS_CACHE_LINE_SIZE
+#define BLIS_CACHE_LINE_SIZE             64
+#endif
+
 // Number of named SIMD vector registers available for use.
 #ifndef BLIS_SIMD_NUM_REGISTERS
 #define BLIS_SIMD_NUM_REGISTERS          16
@@ -101,6 +107,15 @@
 #define BLIS_SIMD_ALIGN_SIZE             BLIS_SIMD_SIZE
 #endif
 
+// Number of SIMD fused multiply-add instructions (or, on hardware without
+// fused multiply-add, pairs of SIMD multiply and add instructions) that a
+// core can issue per cycle. Together with BLIS_SIMD_SIZE, this gives the
+// peak floating-point rate per core per cycle that is used by the
+// benchmark drivers to report efficiency.
+#ifndef BLIS_SIMD_FMA_PER_CYCLE
+#define BLIS_SIMD_FMA_PER_CYCLE          1
+#endif
+
 // The maximum size in bytes of local stack buffers within macro-kernel
 // functions. These buffers are usually used to store a temporary copy
 // of a single microtile. The reason we multiply by 2 is to handle induced
@@ -279,6 +294,24 @@
 #define BLIS_ZTRSM_U_UKERNEL BLIS_ZTRSM_U_UKERNEL_REF
 #endif
 
+// gemmsup kernels
+
+#ifndef BLIS_SGEMMSUP_KERNEL
+#define BLIS_SGEMMSUP_KERNEL BLIS_SGEMMSUP_KERNEL_REF
+#endif
+
+#ifndef BLIS_DGEMMSUP_KERNEL
+#define BLIS_DGEMMSUP_KERNEL BLIS_DGEMMSUP_KERNEL_REF
+#endif
+
+#ifndef BLIS_CGEMMSUP_KERNEL
+#define BLIS_CGEMMSUP_KERNEL BLIS_CGEMMSUP_KERNEL_REF
+#endif
+
+#ifndef BLIS_ZGEMMSUP_KERNEL
+#define BLIS_ZGEMMSUP_KERNEL BLIS_ZGEMMSUP_KERNEL_REF
+#endif
+
 //
 // Level-1m
 //
@@ -867,6 +900,42 @@
 #define BLIS_ZINVERTV_KERNEL BLIS_ZINVERTV_KERNEL_REF
 #endif
 
+// rotmv kernels
+
+#ifndef BLIS_SROTMV_KERNEL
+#define BLIS_SROTMV_KERNEL BLIS_SROTMV_KERNEL_REF
+#endif
+
+#ifndef BLIS_DROTMV_KERNEL
+#define BLIS_DROTMV_KERNEL BLIS_DROTMV_KERNEL_REF
+#endif
+
+#ifndef BLIS_CROTMV_KERNEL
+#define BLIS_CROTMV_KERNEL BLIS_CROTMV_KERNEL_REF
+#endif
+
+#ifndef BLIS_ZROTMV_KERNEL
+#define BLIS_ZROTMV_KERNEL BLIS_ZROTMV_KERNEL_REF
+#endif
+
+// rotv kernels
+
+#ifndef BLIS_SROTV_KERNEL
+#define BLIS_SROTV_KERNEL BLIS_SROTV_KERNEL_REF
+#endif
+
+#ifndef BLIS_DROTV_KERNEL
+#define BLIS_DROTV_KERNEL BLIS_DROTV_KERNEL_REF
+#endif
+
+#ifndef BLIS_CROTV_KERNEL
+#define BLIS_CROTV_KERNEL BLIS_CROTV_KERNEL_REF
+#endif
+
+#ifndef BLIS_ZROTV_KERNEL
+#define BLIS_ZROTV_KERNEL BLIS_ZROTV_KERNEL_REF
+#endif
+
 // scal2v kernels
 
 #ifndef BLIS_SSCAL2V_KERNEL
@@ -1347,6 +1416,36 @@
 #endif
 
 
+// -- Define default gemm micro-kernel variants --------------------------------
+
+// A configuration may list additional gemm micro-kernels (with their cache
+// and register blocksizes) that can be selected according to the shape of
+// the problem. If none are given, only the default micro-kernel is used.
+
+#ifndef BLIS_SGEMM_UKERNEL_VARIANTS
+#define BLIS_SGEMM_UKERNEL_VARIANTS( var )
+#endif
+
+#ifndef BLIS_DGEMM_UKERNEL_VARIANTS
+#define BLIS_DGEMM_UKERNEL_VARIANTS( var )
+#endif
+
+#ifndef BLIS_CGEMM_UKERNEL_VARIANTS
+#define BLIS_CGEMM_UKERNEL_VARIANTS( var )
+#endif
+
+#ifndef BLIS_ZGEMM_UKERNEL_VARIANTS
+#define BLIS_ZGEMM_UKERNEL_VARIANTS( var )
+#endif
+
+// If set, a variant replaces the default only when it is expected to waste
+// at least this much less of the micro-tile computation at the edges of C.
+
+#ifndef BLIS_GEMM_UKR_VARIANT_MIN_GAIN
+#define BLIS_GEMM_UKR_VARIANT_MIN_GAIN 0.10
+#endif
+
+
 // -- Define default threading parameters --------------------------------------
 
 
@@ -1367,6 +1466,58 @@
 #endif
 
 
+// -- Define default cost model parameters -------------------------------------
+
+// See bli_l3_model.h. The rates are per thread, in GFLOPS and GB/s, and the
+// overheads are in microseconds.
+
+#ifndef BLIS_DEFAULT_MODEL_GFLOPS_S
+#define BLIS_DEFAULT_MODEL_GFLOPS_S 8.0
+#endif
+
+#ifndef BLIS_DEFAULT_MODEL_GFLOPS_D
+#define BLIS_DEFAULT_MODEL_GFLOPS_D 4.0
+#endif
+
+#ifndef BLIS_DEFAULT_MODEL_GFLOPS_C
+#define BLIS_DEFAULT_MODEL_GFLOPS_C 8.0
+#endif
+
+#ifndef BLIS_DEFAULT_MODEL_GFLOPS_Z
+#define BLIS_DEFAULT_MODEL_GFLOPS_Z 4.0
+#endif
+
+#ifndef BLIS_DEFAULT_MODEL_PACK_GBPS
+#define BLIS_DEFAULT_MODEL_PACK_GBPS 4.0
+#endif
+
+#ifndef BLIS_DEFAULT_MODEL_CALL_US
+#define BLIS_DEFAULT_MODEL_CALL_US 2.0
+#endif
+
+// Starting a thread costs far more with pthreads, which are created for
+// each call, than with OpenMP, which keeps a pool of threads.
+#ifndef BLIS_DEFAULT_MODEL_THREAD_US
+#ifdef BLIS_ENABLE_OPENMP
+#define BLIS_DEFAULT_MODEL_THREAD_US 1.0
+#else
+#define BLIS_DEFAULT_MODEL_THREAD_US 15.0
+#endif
+#endif
+
+#ifndef BLIS_DEFAULT_MODEL_BARRIER_US
+#define BLIS_DEFAULT_MODEL_BARRIER_US 0.2
+#endif
+
+#ifndef BLIS_DEFAULT_MODEL_SMALL_EFF
+#define BLIS_DEFAULT_MODEL_SMALL_EFF 0.7
+#endif
+
+#ifndef BLIS_DEFAULT_MODEL_SMALL_CALL_US
+#define BLIS_DEFAULT_MODEL_SMALL_CALL_US 0.2
+#endif
+
+
 // -- Kernel blocksize checks --------------------------------------------------
 
 // Verify that cache blocksizes are whole multiples of register blocksizes.
@@ -76,6 +76,13 @@
 #define BLIS_CTRSM_U_UKERNEL_REF         bli_ctrsm_u_ukr_ref
 #define BLIS_ZTRSM_U_UKERNEL_REF         bli_ztrsm_u_ukr_ref
 
+// gemmsup kernels
+
+#define BLIS_SGEMMSUP_KERNEL_REF         bli_sgemmsup_ref
+#define BLIS_DGEMMSUP_KERNEL_REF         bli_dgemmsup_ref
+#define BLIS_CGEMMSUP_KERNEL_REF         bli_cgemmsup_ref
+#define BLIS_ZGEMMSUP_KERNEL_REF         bli_zgemmsup_ref
+
 //
 // Level-1m
 //
@@ -316,6 +323,20 @@
 #define BLIS_CINVERTV_KERNEL_REF         bli_cinvertv_ref
 #define BLIS_ZINVERTV_KERNEL_REF         bli_zinvertv_ref
 
+// rotmv kernels
+
+#define BLIS_SROTMV_KERNEL_REF           bli_srotmv_ref
+#define BLIS_DROTMV_KERNEL_REF           bli_drotmv_ref
+#define BLIS_CROTMV_KERNEL_REF           bli_crotmv_ref
+#define BLIS_ZROTMV_KERNEL_REF           bli_zrotmv_ref
+
+// rotv kernels
+
+#define BLIS_SROTV_KERNEL_REF            bli_srotv_ref
+#define BLIS_DROTV_KERNEL_REF            bli_drotv_ref
+#define BLIS_CROTV_KERNEL_REF            bli_crotv_ref
+#define BLIS_ZROTV_KERNEL_REF            bli_zrotv_ref
+
 // scal2v kernels
 
 #define BLIS_SSCAL2V_KERNEL_REF          bli_sscal2v_ref
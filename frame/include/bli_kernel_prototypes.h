@@ -66,6 +66,11 @@
 #define bli_ctrsm_u_ukr_name     BLIS_CTRSM_U_UKERNEL
 #define bli_ztrsm_u_ukr_name     BLIS_ZTRSM_U_UKERNEL
 
+#define bli_sgemmsup_ker_name    BLIS_SGEMMSUP_KERNEL
+#define bli_dgemmsup_ker_name    BLIS_DGEMMSUP_KERNEL
+#define bli_cgemmsup_ker_name    BLIS_CGEMMSUP_KERNEL
+#define bli_zgemmsup_ker_name    BLIS_ZGEMMSUP_KERNEL
+
 #include "bli_l3_ukr.h"
 
 //
@@ -204,6 +209,16 @@
 #define bli_cinvertv_ker_name   BLIS_CINVERTV_KERNEL
 #define bli_zinvertv_ker_name   BLIS_ZINVERTV_KERNEL
 
+#define bli_srotmv_ker_name     BLIS_SROTMV_KERNEL
+#define bli_drotmv_ker_name     BLIS_DROTMV_KERNEL
+#define bli_crotmv_ker_name     BLIS_CROTMV_KERNEL
+#define bli_zrotmv_ker_name     BLIS_ZROTMV_KERNEL
+
+#define bli_srotv_ker_name      BLIS_SROTV_KERNEL
+#define bli_drotv_ker_name      BLIS_DROTV_KERNEL
+#define bli_crotv_ker_name      BLIS_CROTV_KERNEL
+#define bli_zrotv_ker_name      BLIS_ZROTV_KERNEL
+
 #define bli_sscalv_ker_name     BLIS_SSCALV_KERNEL
 #define bli_dscalv_ker_name     BLIS_DSCALV_KERNEL
 #define bli_cscalv_ker_name     BLIS_CSCALV_KERNEL
@@ -95,7 +95,11 @@
 #define PASTEMAC3_(ch1,ch2,ch3,op) bli_ ## ch1 ## ch2 ## ch3 ## op
 #define PASTEMAC3(ch1,ch2,ch3,op)  PASTEMAC3_(ch1,ch2,ch3,op)
 
+#ifdef BLIS_BLAS_ILP64_API
+#define PASTEBLACHK_(op)           bla_ ## op ## _check_64
+#else
 #define PASTEBLACHK_(op)           bla_ ## op ## _check
+#endif
 #define PASTEBLACHK(op)            PASTEBLACHK_(op)
 
 #define PASTECH_(ch,op)            ch ## op
@@ -107,11 +111,21 @@
 #define MKSTR(s1)                  #s1
 #define STRINGIFY_INT( s )         MKSTR( s )
 
-// Fortran-77 name-mangling macros.
+// Fortran-77 name-mangling macros. The ILP64 interface of the BLAS
+// compatibility layer is built from the same sources with an additional
+// _64 suffix (e.g. dgemm_64_) so that it may coexist with the default
+// interface in one library.
+#ifdef BLIS_BLAS_ILP64_API
+#define PASTEF770(name)                            name ## _64_
+#define PASTEF77(ch1,name)           ch1        ## name ## _64_
+#define PASTEF772(ch1,ch2,name)      ch1 ## ch2 ## name ## _64_
+#define PASTEF773(ch1,ch2,ch3,name)  ch1 ## ch2 ## ch3 ## name ## _64_
+#else
 #define PASTEF770(name)                            name ## _
 #define PASTEF77(ch1,name)           ch1        ## name ## _
 #define PASTEF772(ch1,ch2,name)      ch1 ## ch2 ## name ## _
 #define PASTEF773(ch1,ch2,ch3,name)  ch1 ## ch2 ## ch3 ## name ## _
+#endif
 
 // -- Include other groups of macros
 
@@ -85,6 +85,11 @@
 
 #endif
 
+// mmap() needs this.
+#if !BLIS_OS_WINDOWS
+  #include <sys/mman.h>
+#endif
+
 // gettimeofday() needs this.
 #if BLIS_OS_WINDOWS
   #include <time.h>
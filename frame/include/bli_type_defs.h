@@ -158,8 +158,13 @@ typedef dcomplex atom_t;
 // we must define them even when the compatibility layer isn't being built
 // because they also occur in bli_slamch() and bli_dlamch().
 
-// Define f77_int depending on what size of integer was requested.
-#if   BLIS_BLAS2BLIS_INT_TYPE_SIZE == 32
+// Define f77_int depending on what size of integer was requested. When
+// BLIS_BLAS_ILP64_API is defined, the BLAS/CBLAS compatibility layer is
+// being compiled as (or an application is calling into) the _64-suffixed
+// ILP64 interface, which always uses 64-bit integers.
+#if   defined(BLIS_BLAS_ILP64_API)
+typedef int64_t   f77_int;
+#elif BLIS_BLAS2BLIS_INT_TYPE_SIZE == 32
 typedef int32_t   f77_int;
 #elif BLIS_BLAS2BLIS_INT_TYPE_SIZE == 64
 typedef int64_t   f77_int;
@@ -593,6 +598,8 @@ typedef enum
 	BLIS_DOTV_KER,
 	BLIS_DOTXV_KER,
 	BLIS_INVERTV_KER,
+	BLIS_ROTMV_KER,
+	BLIS_ROTV_KER,
 	BLIS_SCALV_KER,
 	BLIS_SCAL2V_KER,
 	BLIS_SETV_KER,
@@ -601,7 +608,7 @@ typedef enum
 	BLIS_XPBYV_KER,
 } l1vkr_t;
 
-#define BLIS_NUM_LEVEL1V_KERS 14
+#define BLIS_NUM_LEVEL1V_KERS 16
 
 
 typedef enum
@@ -735,8 +742,29 @@ typedef struct
 
 	siz_t   block_size;
 	siz_t   align_size;
+
+	dim_t   num_blocks_max;
+	dim_t   num_checkouts;
+	dim_t   num_allocs;
+	dim_t   num_frees;
 } pool_t;
 
+// -- Pool statistics type --
+
+typedef struct
+{
+	siz_t   size;
+	siz_t   size_max;
+
+	dim_t   num_blocks;
+	dim_t   num_blocks_avail;
+	dim_t   num_blocks_max;
+
+	dim_t   num_checkouts;
+	dim_t   num_allocs;
+	dim_t   num_frees;
+} pool_stats_t;
+
 // -- Mutex object type --
 
 #include "bli_mutex.h"
@@ -746,9 +774,17 @@ typedef struct
 
 typedef struct membrk_s
 {
-	pool_t    pools[3];
+	pool_t    pools[BLIS_NUM_NUMA_NODES_MAX][3];
+	dim_t     n_nodes;
 	mtx_t     mutex;
 
+	pool_t    gen_pools[BLIS_NUM_GEN_POOLS];
+	siz_t     gen_footprint;
+
+	siz_t     max_size;
+	dim_t     num_uses;
+	dim_t     prefault;
+
 	malloc_ft malloc_fp;
 	free_ft   free_fp;
 } membrk_t;
@@ -762,6 +798,7 @@ typedef struct mem_s
 	pool_t*   pool;
 	membrk_t* membrk;
 	siz_t     size;
+	bool_t    is_new;
 } mem_t;
 
 // -- Control tree node type --
@@ -958,18 +995,33 @@ typedef struct cntx_s
 
 	func_t    packm_ukrs;
 
-	opid_t    family;
 	ind_t     method;
 	pack_t    schema_a;
 	pack_t    schema_b;
 	pack_t    schema_c;
 
-	dim_t     thrloop[ BLIS_NUM_LOOPS ];
-
 	membrk_t* membrk;
 } cntx_t;
 
 
+// -- Runtime type --
+
+// The state of a single level-3 operation that is not fixed by the context:
+// the operation family, the ways of parallelism for each loop, and the NC
+// to use in place of the context's for each datatype (or 0 to use the
+// context's). Contexts are shared by all calls (and threads), and so they
+// are never modified while an operation executes.
+
+typedef struct rntm_s
+{
+	opid_t    family;
+
+	dim_t     thrloop[ BLIS_NUM_LOOPS ];
+
+	dim_t     nc[ BLIS_NUM_FP_TYPES ];
+} rntm_t;
+
+
 // -- Error types --
 
 typedef enum
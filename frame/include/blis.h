@@ -99,6 +99,7 @@ extern "C" {
 #include "bli_obj.h"
 #include "bli_obj_scalar.h"
 #include "bli_cntx.h"
+#include "bli_rntm.h"
 #include "bli_gks.h"
 #include "bli_ind.h"
 #include "bli_membrk.h"
@@ -114,6 +115,11 @@ extern "C" {
 #include "bli_auxinfo.h"
 #include "bli_param_map.h"
 #include "bli_clock.h"
+#include "bli_perfctr.h"
+#include "bli_prof.h"
+#include "bli_verbose.h"
+#include "bli_cache.h"
+#include "bli_tune.h"
 #include "bli_check.h"
 #include "bli_error.h"
 #include "bli_f2c.h"
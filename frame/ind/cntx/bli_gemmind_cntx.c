@@ -35,22 +35,24 @@
 #include "blis.h"
 
 typedef void (*cntx_ft)( cntx_t* cntx );
+typedef void (*cntx_stage_ft)( dim_t stage, cntx_t* cntx );
 
-static void* bli_gemmind_cntx_fp[BLIS_NUM_IND_METHODS][2] = 
-{
-        /*              _cntx_init             _cntx_finalize   */
-/* 3mh  */ { bli_gemm3mh_cntx_init, bli_gemm3mh_cntx_finalize },
-/* 3m3  */ { bli_gemm3m3_cntx_init, bli_gemm3m3_cntx_finalize },
-/* 3m2  */ { bli_gemm3m2_cntx_init, bli_gemm3m2_cntx_finalize },
-/* 3m1  */ { bli_gemm3m1_cntx_init, bli_gemm3m1_cntx_finalize },
-/* 4mh  */ { bli_gemm4mh_cntx_init, bli_gemm4mh_cntx_finalize },
-/* 4mb  */ { bli_gemm4mb_cntx_init, bli_gemm4mb_cntx_finalize },
-/* 4m1  */ { bli_gemm4m1_cntx_init, bli_gemm4m1_cntx_finalize },
-/* nat  */ { bli_gemmnat_cntx_init, bli_gemmnat_cntx_finalize }
+static void* bli_gemmind_cntx_fp[BLIS_NUM_IND_METHODS][3] = 
+{
+        /*              _cntx_init             _cntx_stage             _cntx_finalize   */
+/* 3mh  */ { bli_gemm3mh_cntx_init, bli_gemm3mh_cntx_stage, bli_gemm3mh_cntx_finalize },
+/* 3m3  */ { bli_gemm3m3_cntx_init, bli_gemm3m3_cntx_stage, bli_gemm3m3_cntx_finalize },
+/* 3m2  */ { bli_gemm3m2_cntx_init, bli_gemm3m2_cntx_stage, bli_gemm3m2_cntx_finalize },
+/* 3m1  */ { bli_gemm3m1_cntx_init, bli_gemm3m1_cntx_stage, bli_gemm3m1_cntx_finalize },
+/* 4mh  */ { bli_gemm4mh_cntx_init, bli_gemm4mh_cntx_stage, bli_gemm4mh_cntx_finalize },
+/* 4mb  */ { bli_gemm4mb_cntx_init, bli_gemm4mb_cntx_stage, bli_gemm4mb_cntx_finalize },
+/* 4m1  */ { bli_gemm4m1_cntx_init, bli_gemm4m1_cntx_stage, bli_gemm4m1_cntx_finalize },
+/* nat  */ { bli_gemmnat_cntx_init, bli_gemmnat_cntx_stage, bli_gemmnat_cntx_finalize }
 };
 
 #define BLIS_CNTX_INIT_INDEX     0
-#define BLIS_CNTX_FINALIZE_INDEX 1
+#define BLIS_CNTX_STAGE_INDEX    1
+#define BLIS_CNTX_FINALIZE_INDEX 2
 
 // -----------------------------------------------------------------------------
 
@@ -74,8 +76,8 @@ void bli_gemmind_cntx_finalize_avail( num_t dt, cntx_t* cntx )
 
 // -----------------------------------------------------------------------------
 
-// Execute the context initialization/finalization function associated
-// with a given induced method.
+// Execute the context initialization/staging/finalization function
+// associated with a given induced method.
 
 void bli_gemmind_cntx_init( ind_t method, cntx_t* cntx )
 {
@@ -84,6 +86,13 @@ void bli_gemmind_cntx_init( ind_t method, cntx_t* cntx )
 	func( cntx );
 }
 
+void bli_gemmind_cntx_stage( ind_t method, dim_t stage, cntx_t* cntx )
+{
+	cntx_stage_ft func = bli_gemmind_cntx_stage_get_func( method );
+
+	func( stage, cntx );
+}
+
 void bli_gemmind_cntx_finalize( ind_t method, cntx_t* cntx )
 {
 	cntx_ft func = bli_gemmind_cntx_finalize_get_func( method );
@@ -98,6 +107,11 @@ void* bli_gemmind_cntx_init_get_func( ind_t method )
 	return bli_gemmind_cntx_fp[ method ][ BLIS_CNTX_INIT_INDEX ];
 }
 
+void* bli_gemmind_cntx_stage_get_func( ind_t method )
+{
+	return bli_gemmind_cntx_fp[ method ][ BLIS_CNTX_STAGE_INDEX ];
+}
+
 void* bli_gemmind_cntx_finalize_get_func( ind_t method )
 {
 	return bli_gemmind_cntx_fp[ method ][ BLIS_CNTX_FINALIZE_INDEX ];
@@ -491,3 +505,25 @@ void bli_gemmnat_cntx_finalize( cntx_t* cntx )
 	bli_gemm_cntx_finalize( cntx );
 }
 
+// -----------------------------------------------------------------------------
+
+// Return the global (read-only) context for the given stage of each induced
+// method. These are built by bli_l3_cntx_global_init() from the context
+// initialization and staging functions above.
+
+#undef  GENFUNC
+#define GENFUNC( imeth, method ) \
+\
+const cntx_t* PASTEMAC2(gemm,imeth,_cntx_query)( dim_t stage ) \
+{ \
+	return bli_l3_cntx_query_gemm( method, stage ); \
+}
+
+GENFUNC( nat, BLIS_NAT )
+GENFUNC( 3mh, BLIS_3MH )
+GENFUNC( 3m3, BLIS_3M3 )
+GENFUNC( 3m2, BLIS_3M2 )
+GENFUNC( 3m1, BLIS_3M1 )
+GENFUNC( 4mh, BLIS_4MH )
+GENFUNC( 4mb, BLIS_4M1B )
+GENFUNC( 4m1, BLIS_4M1A )
@@ -58,34 +58,42 @@ GENPROT( gemm, 4m1 )
 void  bli_gemmnat_cntx_init( cntx_t* cntx );
 void  bli_gemmnat_cntx_stage( dim_t stage, cntx_t* cntx );
 void  bli_gemmnat_cntx_finalize( cntx_t* cntx );
+const cntx_t* bli_gemmnat_cntx_query( dim_t stage );
 
 void  bli_gemm3mh_cntx_init( cntx_t* cntx );
 void  bli_gemm3mh_cntx_stage( dim_t stage, cntx_t* cntx );
 void  bli_gemm3mh_cntx_finalize( cntx_t* cntx );
+const cntx_t* bli_gemm3mh_cntx_query( dim_t stage );
 
 void  bli_gemm3m3_cntx_init( cntx_t* cntx );
 void  bli_gemm3m3_cntx_stage( dim_t stage, cntx_t* cntx );
 void  bli_gemm3m3_cntx_finalize( cntx_t* cntx );
+const cntx_t* bli_gemm3m3_cntx_query( dim_t stage );
 
 void  bli_gemm3m2_cntx_init( cntx_t* cntx );
 void  bli_gemm3m2_cntx_stage( dim_t stage, cntx_t* cntx );
 void  bli_gemm3m2_cntx_finalize( cntx_t* cntx );
+const cntx_t* bli_gemm3m2_cntx_query( dim_t stage );
 
 void  bli_gemm3m1_cntx_init( cntx_t* cntx );
 void  bli_gemm3m1_cntx_stage( dim_t stage, cntx_t* cntx );
 void  bli_gemm3m1_cntx_finalize( cntx_t* cntx );
+const cntx_t* bli_gemm3m1_cntx_query( dim_t stage );
 
 void  bli_gemm4mh_cntx_init( cntx_t* cntx );
 void  bli_gemm4mh_cntx_stage( dim_t stage, cntx_t* cntx );
 void  bli_gemm4mh_cntx_finalize( cntx_t* cntx );
+const cntx_t* bli_gemm4mh_cntx_query( dim_t stage );
 
 void  bli_gemm4mb_cntx_init( cntx_t* cntx );
 void  bli_gemm4mb_cntx_stage( dim_t stage, cntx_t* cntx );
 void  bli_gemm4mb_cntx_finalize( cntx_t* cntx );
+const cntx_t* bli_gemm4mb_cntx_query( dim_t stage );
 
 void  bli_gemm4m1_cntx_init( cntx_t* cntx );
 void  bli_gemm4m1_cntx_stage( dim_t stage, cntx_t* cntx );
 void  bli_gemm4m1_cntx_finalize( cntx_t* cntx );
+const cntx_t* bli_gemm4m1_cntx_query( dim_t stage );
 
 // -----------------------------------------------------------------------------
 
@@ -93,8 +101,10 @@ void  bli_gemmind_cntx_init_avail( num_t dt, cntx_t* cntx );
 void  bli_gemmind_cntx_finalize_avail( num_t dt, cntx_t* cntx );
 
 void  bli_gemmind_cntx_init( ind_t method, cntx_t* cntx );
+void  bli_gemmind_cntx_stage( ind_t method, dim_t stage, cntx_t* cntx );
 void  bli_gemmind_cntx_finalize( ind_t method, cntx_t* cntx );
 
 void* bli_gemmind_cntx_init_get_func( ind_t method );
+void* bli_gemmind_cntx_stage_get_func( ind_t method );
 void* bli_gemmind_cntx_finalize_get_func( ind_t method );
 
@@ -138,3 +138,20 @@ void bli_trsmnat_cntx_finalize( cntx_t* cntx )
 	bli_trsm_cntx_finalize( cntx );
 }
 
+// -----------------------------------------------------------------------------
+
+// Return the global (read-only) context for each induced method. These are
+// built by bli_l3_cntx_global_init() from the context initialization
+// functions above.
+
+#undef  GENFUNC
+#define GENFUNC( imeth, method ) \
+\
+const cntx_t* PASTEMAC2(trsm,imeth,_cntx_query)( void ) \
+{ \
+	return bli_l3_cntx_query_trsm( method ); \
+}
+
+GENFUNC( nat, BLIS_NAT )
+GENFUNC( 3m1, BLIS_3M1 )
+GENFUNC( 4m1, BLIS_4M1A )
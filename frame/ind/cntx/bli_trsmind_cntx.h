@@ -51,10 +51,13 @@ GENPROT( trsm, 4m1 )
 
 void  bli_trsmnat_cntx_init( cntx_t* cntx );
 void  bli_trsmnat_cntx_finalize( cntx_t* cntx );
+const cntx_t* bli_trsmnat_cntx_query( void );
 
 void  bli_trsm4m1_cntx_init( cntx_t* cntx );
 void  bli_trsm4m1_cntx_finalize( cntx_t* cntx );
+const cntx_t* bli_trsm4m1_cntx_query( void );
 
 void  bli_trsm3m1_cntx_init( cntx_t* cntx );
 void  bli_trsm3m1_cntx_finalize( cntx_t* cntx );
+const cntx_t* bli_trsm3m1_cntx_query( void );
 
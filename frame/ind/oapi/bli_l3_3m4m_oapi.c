@@ -34,6 +34,10 @@
 
 #include "blis.h"
 
+// NOTE: The global contexts returned by the _cntx_query() functions are
+// const because they are shared by all calls. The level-3 implementation
+// only ever reads from a context, so we may safely cast away the qualifier.
+
 // -- gemm/her2k/syr2k ---------------------------------------------------------
 
 #undef  GENFRONT
@@ -49,7 +53,7 @@ void PASTEMAC(opname,imeth) \
        cntx_t* cntx  \
      ) \
 { \
-	cntx_t* cntx_p; \
+	cntx_t* cntx_p = cntx; \
 	dim_t   i; \
 \
 	obj_t*  beta_use = beta; \
@@ -62,14 +66,20 @@ void PASTEMAC(opname,imeth) \
 		return; \
 	} \
 \
-	/* Initialize a local context if the one provided is NULL. */ \
-	bli_cntx_init_local_if2( cname, imeth, cntx, cntx_p ); \
+	/* Hold on to the global contexts until the last stage returns. */ \
+	if ( bli_is_null( cntx ) ) \
+		bli_l3_cntx_hold(); \
 \
 	/* Some induced methods execute in multiple "stages". */ \
 	for ( i = 0; i < nstage; ++i ) \
 	{ \
-		/* Prepare the context for the ith stage of computation. */ \
-		PASTEMAC2(cname,imeth,_cntx_stage)( i, cntx_p ); \
+		/* Use the global context for the ith stage of computation if the
+		   context provided is NULL. Otherwise, prepare the context provided
+		   for the ith stage. */ \
+		if ( bli_is_null( cntx ) ) \
+			cntx_p = ( cntx_t* )PASTEMAC2(cname,imeth,_cntx_query)( i ); \
+		else \
+			PASTEMAC2(cname,imeth,_cntx_stage)( i, cntx_p ); \
 \
 		/* For multi-stage methods, use BLIS_ONE as beta after the first
 		   stage. */ \
@@ -80,8 +90,8 @@ void PASTEMAC(opname,imeth) \
 		PASTEMAC(opname,_front)( alpha, a, b, beta_use, c, cntx_p, NULL ); \
 	} \
 \
-	/* Finalize the local context if it was initialized here. */ \
-	bli_cntx_finalize_local_if2( cname, imeth, cntx ); \
+	if ( bli_is_null( cntx ) ) \
+		bli_l3_cntx_release(); \
 }
 
 // gemm
@@ -128,7 +138,7 @@ void PASTEMAC(opname,imeth) \
        cntx_t* cntx  \
      ) \
 { \
-	cntx_t* cntx_p; \
+	cntx_t* cntx_p = cntx; \
 	dim_t   i; \
 \
 	obj_t*  beta_use = beta; \
@@ -141,14 +151,20 @@ void PASTEMAC(opname,imeth) \
 		return; \
 	} \
 \
-	/* Initialize a local context if the one provided is NULL. */ \
-	bli_cntx_init_local_if2( cname, imeth, cntx, cntx_p ); \
+	/* Hold on to the global contexts until the last stage returns. */ \
+	if ( bli_is_null( cntx ) ) \
+		bli_l3_cntx_hold(); \
 \
 	/* Some induced methods execute in multiple "stages". */ \
 	for ( i = 0; i < nstage; ++i ) \
 	{ \
-		/* Prepare the context for the ith stage of computation. */ \
-		PASTEMAC2(cname,imeth,_cntx_stage)( i, cntx_p ); \
+		/* Use the global context for the ith stage of computation if the
+		   context provided is NULL. Otherwise, prepare the context provided
+		   for the ith stage. */ \
+		if ( bli_is_null( cntx ) ) \
+			cntx_p = ( cntx_t* )PASTEMAC2(cname,imeth,_cntx_query)( i ); \
+		else \
+			PASTEMAC2(cname,imeth,_cntx_stage)( i, cntx_p ); \
 \
 		/* For multi-stage methods, use BLIS_ONE as beta after the first
 		   stage. */ \
@@ -159,8 +175,8 @@ void PASTEMAC(opname,imeth) \
 		PASTEMAC(opname,_front)( side, alpha, a, b, beta_use, c, cntx_p, NULL ); \
 	} \
 \
-	/* Finalize the local context if it was initialized here. */ \
-	bli_cntx_finalize_local_if2( cname, imeth, cntx ); \
+	if ( bli_is_null( cntx ) ) \
+		bli_l3_cntx_release(); \
 }
 
 // hemm
@@ -205,7 +221,7 @@ void PASTEMAC(opname,imeth) \
        cntx_t* cntx  \
      ) \
 { \
-	cntx_t* cntx_p; \
+	cntx_t* cntx_p = cntx; \
 	dim_t   i; \
 \
 	obj_t*  beta_use = beta; \
@@ -218,14 +234,20 @@ void PASTEMAC(opname,imeth) \
 		return; \
 	} \
 \
-	/* Initialize a local context if the one provided is NULL. */ \
-	bli_cntx_init_local_if2( cname, imeth, cntx, cntx_p ); \
+	/* Hold on to the global contexts until the last stage returns. */ \
+	if ( bli_is_null( cntx ) ) \
+		bli_l3_cntx_hold(); \
 \
 	/* Some induced methods execute in multiple "stages". */ \
 	for ( i = 0; i < nstage; ++i ) \
 	{ \
-		/* Prepare the context for the ith stage of computation. */ \
-		PASTEMAC2(cname,imeth,_cntx_stage)( i, cntx_p ); \
+		/* Use the global context for the ith stage of computation if the
+		   context provided is NULL. Otherwise, prepare the context provided
+		   for the ith stage. */ \
+		if ( bli_is_null( cntx ) ) \
+			cntx_p = ( cntx_t* )PASTEMAC2(cname,imeth,_cntx_query)( i ); \
+		else \
+			PASTEMAC2(cname,imeth,_cntx_stage)( i, cntx_p ); \
 \
 		/* For multi-stage methods, use BLIS_ONE as beta after the first
 		   stage. */ \
@@ -236,8 +258,8 @@ void PASTEMAC(opname,imeth) \
 		PASTEMAC(opname,_front)( alpha, a, beta_use, c, cntx_p, NULL ); \
 	} \
 \
-	/* Finalize the local context if it was initialized here. */ \
-	bli_cntx_finalize_local_if2( cname, imeth, cntx ); \
+	if ( bli_is_null( cntx ) ) \
+		bli_l3_cntx_release(); \
 }
 
 // herk
@@ -273,7 +295,7 @@ void PASTEMAC(opname,imeth) \
        cntx_t* cntx  \
      ) \
 { \
-	cntx_t* cntx_p; \
+	cntx_t* cntx_p = cntx; \
 	dim_t   i; \
 \
 	/* If the objects are in the real domain, execute the native
@@ -284,22 +306,28 @@ void PASTEMAC(opname,imeth) \
 		return; \
 	} \
 \
-	/* Initialize a local context if the one provided is NULL. */ \
-	bli_cntx_init_local_if2( cname, imeth, cntx, cntx_p ); \
+	/* Hold on to the global contexts until the last stage returns. */ \
+	if ( bli_is_null( cntx ) ) \
+		bli_l3_cntx_hold(); \
 \
 	/* Some induced methods execute in multiple "stages". */ \
 	for ( i = 0; i < nstage; ++i ) \
 	{ \
-		/* Prepare the context for the ith stage of computation. */ \
-		PASTEMAC2(cname,imeth,_cntx_stage)( i, cntx_p ); \
+		/* Use the global context for the ith stage of computation if the
+		   context provided is NULL. Otherwise, prepare the context provided
+		   for the ith stage. */ \
+		if ( bli_is_null( cntx ) ) \
+			cntx_p = ( cntx_t* )PASTEMAC2(cname,imeth,_cntx_query)( i ); \
+		else \
+			PASTEMAC2(cname,imeth,_cntx_stage)( i, cntx_p ); \
 \
 		/* Invoke the operation's front end and request the default control
 		   tree. */ \
 		PASTEMAC(opname,_front)( side, alpha, a, b, cntx_p, NULL ); \
 	} \
 \
-	/* Finalize the local context if it was initialized here. */ \
-	bli_cntx_finalize_local_if2( cname, imeth, cntx ); \
+	if ( bli_is_null( cntx ) ) \
+		bli_l3_cntx_release(); \
 }
 
 // trmm
@@ -326,7 +354,7 @@ void PASTEMAC(opname,imeth) \
        cntx_t* cntx  \
      ) \
 { \
-	cntx_t* cntx_p; \
+	cntx_t* cntx_p = cntx; \
 \
 	/* If the objects are in the real domain, execute the native
 	   implementation. */ \
@@ -336,8 +364,12 @@ void PASTEMAC(opname,imeth) \
 		return; \
 	} \
 \
-	/* Initialize a local context if the one provided is NULL. */ \
-	bli_cntx_init_local_if2( cname, imeth, cntx, cntx_p ); \
+	/* Use the global context if the one provided is NULL. */ \
+	if ( bli_is_null( cntx ) ) \
+	{ \
+		bli_l3_cntx_hold(); \
+		cntx_p = ( cntx_t* )PASTEMAC2(cname,imeth,_cntx_query)(); \
+	} \
 \
 	{ \
 		/* NOTE: trsm cannot be implemented via any induced method that
@@ -348,8 +380,8 @@ void PASTEMAC(opname,imeth) \
 		PASTEMAC(opname,_front)( side, alpha, a, b, cntx_p, NULL ); \
 	} \
 \
-	/* Finalize the local context if it was initialized here. */ \
-	bli_cntx_finalize_local_if2( cname, imeth, cntx ); \
+	if ( bli_is_null( cntx ) ) \
+		bli_l3_cntx_release(); \
 }
 
 // trsm
@@ -39,6 +39,12 @@
 // them separate is that it allows us to avoid the very small loop overhead
 // of executing one iteration of a for loop, plus the overhead of calling a
 // function that does nothing (ie: the _cntx_init_stage() function).
+//
+// The global contexts returned by the _cntx_query() functions are const
+// because they are shared by all calls. The level-3 implementation only
+// ever reads from a context, so we may safely cast away the qualifier.
+// A call holds on to the global contexts (see bli_l3_cntx_hold()) from the
+// query until its front end returns.
 
 // -- gemm/her2k/syr2k ---------------------------------------------------------
 
@@ -55,10 +61,14 @@ void PASTEMAC(opname,imeth) \
        cntx_t* cntx  \
      ) \
 { \
-	cntx_t* cntx_p; \
+	cntx_t* cntx_p = cntx; \
 \
-	/* Initialize a local context if the one provided is NULL. */ \
-	bli_cntx_init_local_if2( cname, imeth, cntx, cntx_p ); \
+	/* Use the global context if the one provided is NULL. */ \
+	if ( bli_is_null( cntx ) ) \
+	{ \
+		bli_l3_cntx_hold(); \
+		cntx_p = ( cntx_t* )PASTEMAC2(cname,imeth,_cntx_query)( 0 ); \
+	} \
 \
 	/* Invoke the operation's front end with the appropriate control
 	   tree. */ \
@@ -67,14 +77,56 @@ void PASTEMAC(opname,imeth) \
 	  alpha, a, b, beta, c, cntx_p, NULL \
 	); \
 \
-	/* Finalize the local context if it was initialized here. */ \
-	bli_cntx_finalize_local_if2( cname, imeth, cntx ); \
+	if ( bli_is_null( cntx ) ) \
+		bli_l3_cntx_release(); \
 }
 
-GENFRONT( gemm, gemm, nat )
 GENFRONT( her2k, gemm, nat )
 GENFRONT( syr2k, gemm, nat )
 
+// gemm is defined separately so that, when the caller does not provide a
+// context, its micro-kernel (and blocksizes) may be chosen for the problem
+// at hand.
+
+void bli_gemmnat
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx
+     )
+{
+	cntx_t* cntx_p = cntx;
+	dim_t   var;
+
+	// Use the global context if the one provided is NULL, or, if one of
+	// the micro-kernel variants better suits the shape and storage of C,
+	// the global context for that variant.
+	if ( bli_is_null( cntx ) )
+	{
+		bli_l3_cntx_hold();
+
+		cntx_p = ( cntx_t* )bli_gemmnat_cntx_query( 0 );
+
+		var = bli_gemm_cntx_select_ukr_var( c, cntx_p );
+
+		if ( var >= 0 )
+			cntx_p = ( cntx_t* )bli_l3_cntx_query_gemm_ukr_var
+			         ( bli_obj_datatype( *c ), var );
+	}
+
+	// Invoke the operation's front end with the appropriate control tree.
+	bli_gemm_front
+	(
+	  alpha, a, b, beta, c, cntx_p, NULL
+	);
+
+	if ( bli_is_null( cntx ) )
+		bli_l3_cntx_release();
+}
+
 
 // -- hemm/symm/trmm3 ----------------------------------------------------------
 
@@ -92,10 +144,14 @@ void PASTEMAC(opname,imeth) \
        cntx_t* cntx  \
      ) \
 { \
-	cntx_t* cntx_p; \
+	cntx_t* cntx_p = cntx; \
 \
-	/* Initialize a local context if the one provided is NULL. */ \
-	bli_cntx_init_local_if2( cname, imeth, cntx, cntx_p ); \
+	/* Use the global context if the one provided is NULL. */ \
+	if ( bli_is_null( cntx ) ) \
+	{ \
+		bli_l3_cntx_hold(); \
+		cntx_p = ( cntx_t* )PASTEMAC2(cname,imeth,_cntx_query)( 0 ); \
+	} \
 \
 	/* Invoke the operation's front end with the appropriate control
 	   tree. */ \
@@ -104,8 +160,8 @@ void PASTEMAC(opname,imeth) \
 	  side, alpha, a, b, beta, c, cntx_p, NULL \
 	); \
 \
-	/* Finalize the local context if it was initialized here. */ \
-	bli_cntx_finalize_local_if2( cname, imeth, cntx ); \
+	if ( bli_is_null( cntx ) ) \
+		bli_l3_cntx_release(); \
 }
 
 GENFRONT( hemm, gemm, nat )
@@ -127,10 +183,14 @@ void PASTEMAC(opname,imeth) \
        cntx_t* cntx  \
      ) \
 { \
-	cntx_t* cntx_p; \
+	cntx_t* cntx_p = cntx; \
 \
-	/* Initialize a local context if the one provided is NULL. */ \
-	bli_cntx_init_local_if2( cname, imeth, cntx, cntx_p ); \
+	/* Use the global context if the one provided is NULL. */ \
+	if ( bli_is_null( cntx ) ) \
+	{ \
+		bli_l3_cntx_hold(); \
+		cntx_p = ( cntx_t* )PASTEMAC2(cname,imeth,_cntx_query)( 0 ); \
+	} \
 \
 	/* Invoke the operation's front end with the appropriate control
 	   tree. */ \
@@ -139,8 +199,8 @@ void PASTEMAC(opname,imeth) \
 	  alpha, a, beta, c, cntx_p, NULL \
 	); \
 \
-	/* Finalize the local context if it was initialized here. */ \
-	bli_cntx_finalize_local_if2( cname, imeth, cntx ); \
+	if ( bli_is_null( cntx ) ) \
+		bli_l3_cntx_release(); \
 }
 
 GENFRONT( herk, gemm, nat )
@@ -161,10 +221,14 @@ void PASTEMAC(opname,imeth) \
        cntx_t* cntx  \
      ) \
 { \
-	cntx_t* cntx_p; \
+	cntx_t* cntx_p = cntx; \
 \
-	/* Initialize a local context if the one provided is NULL. */ \
-	bli_cntx_init_local_if2( cname, imeth, cntx, cntx_p ); \
+	/* Use the global context if the one provided is NULL. */ \
+	if ( bli_is_null( cntx ) ) \
+	{ \
+		bli_l3_cntx_hold(); \
+		cntx_p = ( cntx_t* )PASTEMAC2(cname,imeth,_cntx_query)( 0 ); \
+	} \
 \
 	/* Invoke the operation's front end with the appropriate control
 	   tree. */ \
@@ -173,8 +237,8 @@ void PASTEMAC(opname,imeth) \
 	  side, alpha, a, b, cntx_p, NULL \
 	); \
 \
-	/* Finalize the local context if it was initialized here. */ \
-	bli_cntx_finalize_local_if2( cname, imeth, cntx ); \
+	if ( bli_is_null( cntx ) ) \
+		bli_l3_cntx_release(); \
 }
 
 GENFRONT( trmm, gemm, nat )
@@ -194,10 +258,14 @@ void PASTEMAC(opname,imeth) \
        cntx_t* cntx  \
      ) \
 { \
-	cntx_t* cntx_p; \
+	cntx_t* cntx_p = cntx; \
 \
-	/* Initialize a local context if the one provided is NULL. */ \
-	bli_cntx_init_local_if2( cname, imeth, cntx, cntx_p ); \
+	/* Use the global context if the one provided is NULL. */ \
+	if ( bli_is_null( cntx ) ) \
+	{ \
+		bli_l3_cntx_hold(); \
+		cntx_p = ( cntx_t* )PASTEMAC2(cname,imeth,_cntx_query)(); \
+	} \
 \
 	/* Invoke the operation's front end with the appropriate control
 	   tree. */ \
@@ -206,8 +274,8 @@ void PASTEMAC(opname,imeth) \
 	  side, alpha, a, b, cntx_p, NULL \
 	); \
 \
-	/* Finalize the local context if it was initialized here. */ \
-	bli_cntx_finalize_local_if2( cname, imeth, cntx ); \
+	if ( bli_is_null( cntx ) ) \
+		bli_l3_cntx_release(); \
 }
 
 GENFRONT( trsm, trsm, nat )
@@ -0,0 +1,608 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#if defined(__linux__)
+  #define _GNU_SOURCE
+#endif
+
+#include "blis.h"
+
+#if BLIS_OS_LINUX
+  #include <sched.h>
+  #include <unistd.h>
+#endif
+
+// The largest number of logical CPUs that may be described or bound to.
+#define BLIS_TOPO_MAX_CPUS 1024
+
+// The position of one logical CPU within the cache hierarchy. Each domain
+// is identified by the smallest logical CPU it contains, as reported by
+// sysfs.
+typedef struct
+{
+	int cpu;      // logical CPU id
+	int package;  // physical package (socket) id
+	int l3;       // L3 domain, or -1-package if no L3 is reported
+	int l2;       // L2 domain, or the core if no L2 is reported
+	int core;     // core (set of SMT siblings)
+	int smt;      // rank among the SMT siblings of the core
+	int rank;     // rank of the core within its L3 domain
+	int node;     // NUMA node
+} topo_cpu_t;
+
+static topo_cpu_t topo[ BLIS_TOPO_MAX_CPUS ];
+static dim_t      topo_n = 0;
+static dim_t      topo_n_nodes = 1;
+
+// The NUMA node of each logical CPU, indexed by CPU id.
+static int        topo_cpu_node[ BLIS_TOPO_MAX_CPUS ];
+
+// If positive, the number of NUMA nodes to emulate (BLIS_NUM_NODES). The
+// placement slots are then divided evenly among the emulated nodes.
+static dim_t      topo_n_nodes_fake = 0;
+
+// The current placement: thread id i is bound to affinity_cpus[i], which
+// belongs to L3 domain affinity_l3[i], L2 domain affinity_l2[i], and NUMA
+// node affinity_node[i].
+static affinity_t affinity_policy = BLIS_AFFINITY_NONE;
+static int        affinity_cpus[ BLIS_TOPO_MAX_CPUS ];
+static int        affinity_l3[ BLIS_TOPO_MAX_CPUS ];
+static int        affinity_l2[ BLIS_TOPO_MAX_CPUS ];
+static int        affinity_node[ BLIS_TOPO_MAX_CPUS ];
+static dim_t      affinity_n = 0;
+
+// The placement slot of the calling thread while it is bound, or -1.
+static __thread dim_t     bind_slot  = -1;
+
+#if BLIS_OS_LINUX
+static __thread bool_t    bind_saved = FALSE;
+static __thread cpu_set_t bind_mask;
+#endif
+
+static void bli_affinity_topo_discover( void );
+static void bli_affinity_apply( affinity_t policy );
+static void bli_affinity_set_nodes( void );
+
+// -----------------------------------------------------------------------------
+
+void bli_affinity_init( void )
+{
+	char* str;
+
+	bli_affinity_topo_discover();
+
+	affinity_policy = BLIS_AFFINITY_NONE;
+	affinity_n      = 0;
+
+	topo_n_nodes_fake = bli_env_read_nway( "BLIS_NUM_NODES", 0 );
+	if ( topo_n_nodes_fake > BLIS_TOPO_MAX_CPUS )
+		topo_n_nodes_fake = BLIS_TOPO_MAX_CPUS;
+
+	str = getenv( "BLIS_AFFINITY" );
+
+	if ( str == NULL ) return;
+
+	if      ( strcmp( str, "compact" ) == 0 )
+		bli_thread_set_affinity( BLIS_AFFINITY_COMPACT );
+	else if ( strcmp( str, "scatter" ) == 0 )
+		bli_thread_set_affinity( BLIS_AFFINITY_SCATTER );
+	else if ( '0' <= str[0] && str[0] <= '9' )
+	{
+		int   cpus[ BLIS_TOPO_MAX_CPUS ];
+		dim_t n_cpus = bli_affinity_parse_list( str, cpus,
+		                                        BLIS_TOPO_MAX_CPUS );
+
+		bli_thread_set_affinity_cpus( n_cpus, cpus );
+	}
+}
+
+void bli_affinity_finalize( void )
+{
+	affinity_policy   = BLIS_AFFINITY_NONE;
+	affinity_n        = 0;
+	topo_n            = 0;
+	topo_n_nodes      = 1;
+	topo_n_nodes_fake = 0;
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_thread_set_affinity( affinity_t policy )
+{
+	// An explicit placement can only be established from a list of CPUs.
+	if ( policy == BLIS_AFFINITY_EXPLICIT ) return;
+
+	bli_affinity_apply( policy );
+}
+
+void bli_thread_set_affinity_cpus( dim_t n_cpus, const int* cpus )
+{
+	dim_t i, j;
+
+	if ( n_cpus > BLIS_TOPO_MAX_CPUS ) n_cpus = BLIS_TOPO_MAX_CPUS;
+
+	if ( n_cpus < 1 )
+	{
+		bli_affinity_apply( BLIS_AFFINITY_NONE );
+		return;
+	}
+
+	for ( i = 0; i < n_cpus; ++i )
+	{
+		affinity_cpus[ i ] = cpus[ i ];
+
+		// CPUs we know nothing about are treated as a single domain.
+		affinity_l3[ i ] = -1;
+		affinity_l2[ i ] = -1;
+
+		for ( j = 0; j < topo_n; ++j )
+		{
+			if ( topo[ j ].cpu == cpus[ i ] )
+			{
+				affinity_l3[ i ] = topo[ j ].l3;
+				affinity_l2[ i ] = topo[ j ].l2;
+				break;
+			}
+		}
+	}
+
+	affinity_n      = n_cpus;
+	affinity_policy = BLIS_AFFINITY_EXPLICIT;
+
+	bli_affinity_set_nodes();
+}
+
+affinity_t bli_thread_get_affinity( void )
+{
+	return affinity_policy;
+}
+
+int bli_thread_get_affinity_cpu( dim_t id )
+{
+	if ( affinity_policy == BLIS_AFFINITY_NONE || affinity_n == 0 ) return -1;
+
+	return affinity_cpus[ id % affinity_n ];
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_thread_bind( dim_t id )
+{
+#if BLIS_OS_LINUX
+	cpu_set_t set;
+	int       cpu = bli_thread_get_affinity_cpu( id );
+
+	if ( cpu < 0 || cpu >= CPU_SETSIZE ) return;
+
+	if ( sched_getaffinity( 0, sizeof( cpu_set_t ), &bind_mask ) != 0 ) return;
+
+	CPU_ZERO( &set );
+	CPU_SET( cpu, &set );
+
+	if ( sched_setaffinity( 0, sizeof( cpu_set_t ), &set ) != 0 ) return;
+
+	// Only a thread that was actually moved reports the node of its slot
+	// (see bli_thread_topo_current_node()).
+	bind_saved = TRUE;
+	bind_slot  = id % affinity_n;
+#endif
+}
+
+void bli_thread_unbind( void )
+{
+	bind_slot = -1;
+
+#if BLIS_OS_LINUX
+	if ( !bind_saved ) return;
+
+	sched_setaffinity( 0, sizeof( cpu_set_t ), &bind_mask );
+
+	bind_saved = FALSE;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+dim_t bli_thread_topo_num_cpus( void )
+{
+	return topo_n;
+}
+
+dim_t bli_thread_topo_num_nodes( void )
+{
+	if ( topo_n_nodes_fake > 0 ) return topo_n_nodes_fake;
+
+	return topo_n_nodes;
+}
+
+dim_t bli_thread_topo_current_node( void )
+{
+	// A bound thread is on the node of its placement slot, which is also
+	// how emulated nodes are assigned.
+	if ( bind_slot >= 0 ) return affinity_node[ bind_slot ];
+
+	if ( topo_n_nodes_fake > 0 ) return 0;
+
+#if BLIS_OS_LINUX
+	{
+		int cpu = sched_getcpu();
+
+		if ( 0 <= cpu && cpu < BLIS_TOPO_MAX_CPUS )
+			return topo_cpu_node[ cpu ];
+	}
+#endif
+
+	return 0;
+}
+
+// Return the number of domains among the first n entries of dom if each
+// domain occupies exactly one contiguous block of entries and all blocks
+// are of equal size. Otherwise, return 0.
+static dim_t bli_affinity_count_blocks( dim_t n, const int* dom )
+{
+	dim_t n_dom = 1;
+	dim_t bs;
+	dim_t i, j;
+
+	for ( i = 1; i < n; ++i )
+		if ( dom[ i ] != dom[ i - 1 ] ) n_dom++;
+
+	if ( n % n_dom != 0 ) return 0;
+
+	bs = n / n_dom;
+
+	for ( i = 1; i < n; ++i )
+		if ( i % bs != 0 && dom[ i ] != dom[ i - 1 ] ) return 0;
+
+	for ( i = bs; i < n; i += bs )
+		for ( j = 0; j < i; j += bs )
+			if ( dom[ i ] == dom[ j ] ) return 0;
+
+	return n_dom;
+}
+
+void bli_thread_topo_domains( dim_t nthread, dim_t* n_l3, dim_t* n_l2 )
+{
+	dim_t n_node;
+
+	*n_l3 = 0;
+	*n_l2 = 0;
+
+	// Without a placement (or with more threads than placement slots),
+	// consecutive thread ids say nothing about which caches are shared.
+	if ( affinity_policy == BLIS_AFFINITY_NONE ) return;
+	if ( nthread < 1 || affinity_n < nthread ) return;
+
+	n_node = bli_affinity_count_blocks( nthread, affinity_node );
+	*n_l3  = bli_affinity_count_blocks( nthread, affinity_l3 );
+	*n_l2  = bli_affinity_count_blocks( nthread, affinity_l2 );
+
+	// NUMA nodes are the outermost domains. Normally the L3 domains nest
+	// within them, but emulated nodes may be finer than the L3 domains, in
+	// which case the nodes take the place of the L3 domains.
+	if ( n_node == 0 || *n_l3 == 0 || *n_l3 % n_node != 0 ) *n_l3 = n_node;
+
+	// The L2 domains must nest within the L3 domains. If they do not (for
+	// example, with emulated nodes) they are split along with them.
+	if ( *n_l2 == 0 || *n_l2 % *n_l3 != 0 ) *n_l2 = *n_l3;
+
+	if ( *n_l3 == 0 ) *n_l2 = 0;
+}
+
+// -----------------------------------------------------------------------------
+
+dim_t bli_affinity_parse_list( const char* str, int* list, dim_t max )
+{
+	dim_t n = 0;
+
+	while ( *str != '\0' )
+	{
+		char* end;
+		long  lo, hi, i;
+
+		lo = strtol( str, &end, 10 );
+		if ( end == str ) break;
+		str = end;
+		hi  = lo;
+
+		if ( *str == '-' )
+		{
+			hi = strtol( str + 1, &end, 10 );
+			if ( end == str + 1 ) break;
+			str = end;
+		}
+
+		for ( i = lo; i <= hi && n < max; ++i ) list[ n++ ] = i;
+
+		if ( *str != ',' ) break;
+		str++;
+	}
+
+	return n;
+}
+
+#if BLIS_OS_LINUX
+
+// Read the first integer in a sysfs file. This is either the file's only
+// value or, for CPU lists, the smallest CPU in the list.
+static int bli_affinity_read_int( const char* path, int fallback )
+{
+	FILE* fp = fopen( path, "r" );
+	int   val;
+
+	if ( fp == NULL ) return fallback;
+
+	if ( fscanf( fp, "%d", &val ) != 1 ) val = fallback;
+
+	fclose( fp );
+
+	return val;
+}
+
+#endif
+
+static void bli_affinity_topo_discover( void )
+{
+	int   online[ BLIS_TOPO_MAX_CPUS ];
+	dim_t n_online = 0;
+	dim_t i, j, c;
+
+	topo_n       = 0;
+	topo_n_nodes = 1;
+
+	for ( i = 0; i < BLIS_TOPO_MAX_CPUS; ++i ) topo_cpu_node[ i ] = 0;
+
+#if BLIS_OS_LINUX
+	{
+		char      path[ 128 ];
+		char      buf[ 4096 ];
+		FILE*     fp;
+		cpu_set_t mask;
+		bool_t    has_mask;
+		int       nodes[ BLIS_TOPO_MAX_CPUS ];
+		dim_t     n_nodes = 0;
+		int       cpus[ BLIS_TOPO_MAX_CPUS ];
+		dim_t     n_cpus;
+
+		// Record the NUMA node of every CPU. A machine (or kernel) without
+		// NUMA support is treated as a single node.
+		fp = fopen( "/sys/devices/system/node/online", "r" );
+		if ( fp != NULL )
+		{
+			if ( fgets( buf, sizeof( buf ), fp ) != NULL )
+				n_nodes = bli_affinity_parse_list( buf, nodes,
+				                                   BLIS_TOPO_MAX_CPUS );
+			fclose( fp );
+		}
+
+		for ( i = 0; i < n_nodes; ++i )
+		{
+			sprintf( path, "/sys/devices/system/node/node%d/cpulist",
+			         nodes[ i ] );
+			fp = fopen( path, "r" );
+			if ( fp == NULL ) continue;
+
+			n_cpus = 0;
+			if ( fgets( buf, sizeof( buf ), fp ) != NULL )
+				n_cpus = bli_affinity_parse_list( buf, cpus,
+				                                  BLIS_TOPO_MAX_CPUS );
+			fclose( fp );
+
+			for ( j = 0; j < n_cpus; ++j )
+				if ( 0 <= cpus[ j ] && cpus[ j ] < BLIS_TOPO_MAX_CPUS )
+					topo_cpu_node[ cpus[ j ] ] = nodes[ i ];
+
+			if ( nodes[ i ] + 1 > topo_n_nodes ) topo_n_nodes = nodes[ i ] + 1;
+		}
+
+		fp = fopen( "/sys/devices/system/cpu/online", "r" );
+		if ( fp != NULL )
+		{
+			if ( fgets( buf, sizeof( buf ), fp ) != NULL )
+				n_online = bli_affinity_parse_list( buf, online,
+				                                    BLIS_TOPO_MAX_CPUS );
+			fclose( fp );
+		}
+
+		if ( n_online == 0 )
+		{
+			n_online = sysconf( _SC_NPROCESSORS_ONLN );
+			if ( n_online > BLIS_TOPO_MAX_CPUS ) n_online = BLIS_TOPO_MAX_CPUS;
+			for ( i = 0; i < n_online; ++i ) online[ i ] = i;
+		}
+
+		// Only describe the CPUs the process is allowed to run on.
+		has_mask = ( sched_getaffinity( 0, sizeof( cpu_set_t ), &mask ) == 0 );
+
+		for ( i = 0; i < n_online; ++i )
+		{
+			topo_cpu_t* t   = &topo[ topo_n ];
+			int         cpu = online[ i ];
+
+			if ( has_mask && cpu < CPU_SETSIZE && !CPU_ISSET( cpu, &mask ) )
+				continue;
+
+			t->cpu  = cpu;
+			t->node = ( cpu < BLIS_TOPO_MAX_CPUS ? topo_cpu_node[ cpu ] : 0 );
+
+			sprintf( path, "/sys/devices/system/cpu/cpu%d/topology/"
+			               "physical_package_id", cpu );
+			t->package = bli_affinity_read_int( path, 0 );
+
+			sprintf( path, "/sys/devices/system/cpu/cpu%d/topology/"
+			               "thread_siblings_list", cpu );
+			t->core = bli_affinity_read_int( path, cpu );
+
+			t->l2 = t->core;
+			t->l3 = -1 - t->package;
+
+			for ( c = 0; ; ++c )
+			{
+				int level;
+
+				sprintf( path, "/sys/devices/system/cpu/cpu%d/cache/"
+				               "index%d/level", cpu, ( int )c );
+				level = bli_affinity_read_int( path, -1 );
+
+				if ( level < 0 ) break;
+
+				sprintf( path, "/sys/devices/system/cpu/cpu%d/cache/"
+				               "index%d/shared_cpu_list", cpu, ( int )c );
+
+				if      ( level == 2 ) t->l2 = bli_affinity_read_int( path, t->l2 );
+				else if ( level == 3 ) t->l3 = bli_affinity_read_int( path, t->l3 );
+			}
+
+			topo_n++;
+		}
+	}
+#endif
+
+	// If nothing could be discovered, assume a single socket of
+	// single-threaded cores.
+	if ( topo_n == 0 )
+	{
+		topo_n = 1;
+		topo[ 0 ].cpu     = 0;
+		topo[ 0 ].package = 0;
+		topo[ 0 ].l3      = -1;
+		topo[ 0 ].l2      = 0;
+		topo[ 0 ].core    = 0;
+		topo[ 0 ].node    = 0;
+	}
+
+	// Rank each CPU among its SMT siblings, and each core within its L3
+	// domain. These are needed to spread threads for the scatter policy.
+	for ( i = 0; i < topo_n; ++i )
+	{
+		topo[ i ].smt = 0;
+		for ( j = 0; j < topo_n; ++j )
+			if ( topo[ j ].core == topo[ i ].core &&
+			     topo[ j ].cpu  <  topo[ i ].cpu ) topo[ i ].smt++;
+	}
+
+	for ( i = 0; i < topo_n; ++i )
+	{
+		topo[ i ].rank = 0;
+		for ( j = 0; j < topo_n; ++j )
+			if ( topo[ j ].smt  == 0 &&
+			     topo[ j ].l3   == topo[ i ].l3 &&
+			     topo[ j ].core <  topo[ i ].core ) topo[ i ].rank++;
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+#define bli_affinity_cmp_field( x, y, field ) \
+\
+	if ( (x)->field != (y)->field ) return ( (x)->field < (y)->field ? -1 : 1 );
+
+static int bli_affinity_cmp_compact( const void* xv, const void* yv )
+{
+	const topo_cpu_t* x = xv;
+	const topo_cpu_t* y = yv;
+
+	bli_affinity_cmp_field( x, y, node );
+	bli_affinity_cmp_field( x, y, package );
+	bli_affinity_cmp_field( x, y, l3 );
+	bli_affinity_cmp_field( x, y, l2 );
+	bli_affinity_cmp_field( x, y, core );
+	bli_affinity_cmp_field( x, y, cpu );
+
+	return 0;
+}
+
+static int bli_affinity_cmp_scatter( const void* xv, const void* yv )
+{
+	const topo_cpu_t* x = xv;
+	const topo_cpu_t* y = yv;
+
+	bli_affinity_cmp_field( x, y, smt );
+	bli_affinity_cmp_field( x, y, rank );
+	bli_affinity_cmp_field( x, y, node );
+	bli_affinity_cmp_field( x, y, package );
+	bli_affinity_cmp_field( x, y, l3 );
+	bli_affinity_cmp_field( x, y, cpu );
+
+	return 0;
+}
+
+static void bli_affinity_apply( affinity_t policy )
+{
+	topo_cpu_t order[ BLIS_TOPO_MAX_CPUS ];
+	dim_t      i;
+
+	affinity_policy = policy;
+	affinity_n      = 0;
+
+	if ( policy == BLIS_AFFINITY_NONE ) return;
+
+	memcpy( order, topo, topo_n * sizeof( topo_cpu_t ) );
+
+	if ( policy == BLIS_AFFINITY_COMPACT )
+		qsort( order, topo_n, sizeof( topo_cpu_t ), bli_affinity_cmp_compact );
+	else
+		qsort( order, topo_n, sizeof( topo_cpu_t ), bli_affinity_cmp_scatter );
+
+	for ( i = 0; i < topo_n; ++i )
+	{
+		affinity_cpus[ i ] = order[ i ].cpu;
+		affinity_l3[ i ]   = order[ i ].l3;
+		affinity_l2[ i ]   = order[ i ].l2;
+	}
+
+	affinity_n = topo_n;
+
+	bli_affinity_set_nodes();
+}
+
+// Assign a NUMA node to each placement slot, either from the topology or,
+// when emulating nodes, by dividing the slots evenly among them.
+static void bli_affinity_set_nodes( void )
+{
+	dim_t i;
+
+	for ( i = 0; i < affinity_n; ++i )
+	{
+		int cpu = affinity_cpus[ i ];
+
+		if ( topo_n_nodes_fake > 0 )
+			affinity_node[ i ] = ( i * topo_n_nodes_fake ) / affinity_n;
+		else if ( 0 <= cpu && cpu < BLIS_TOPO_MAX_CPUS )
+			affinity_node[ i ] = topo_cpu_node[ cpu ];
+		else
+			affinity_node[ i ] = 0;
+	}
+}
+
@@ -0,0 +1,88 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_AFFINITY_H
+#define BLIS_AFFINITY_H
+
+// Thread placement policies. With BLIS_AFFINITY_COMPACT, consecutive thread
+// ids are placed on SMT siblings first, then on cores sharing an L2 cache,
+// then on cores sharing an L3 cache (or socket). BLIS_AFFINITY_SCATTER
+// spreads consecutive thread ids across sockets and cores before using SMT
+// siblings. BLIS_AFFINITY_EXPLICIT places thread i on the i-th entry of a
+// user-supplied list of logical CPUs.
+typedef enum
+{
+	BLIS_AFFINITY_NONE = 0,
+	BLIS_AFFINITY_COMPACT,
+	BLIS_AFFINITY_SCATTER,
+	BLIS_AFFINITY_EXPLICIT
+} affinity_t;
+
+// Initialization-related prototypes.
+void       bli_affinity_init( void );
+void       bli_affinity_finalize( void );
+
+// Policy query and modification. The initial policy is read from the
+// BLIS_AFFINITY environment variable, which may be set to "none",
+// "compact", "scatter", or a list of logical CPUs such as "0-3,8,10".
+void       bli_thread_set_affinity( affinity_t policy );
+void       bli_thread_set_affinity_cpus( dim_t n_cpus, const int* cpus );
+affinity_t bli_thread_get_affinity( void );
+int        bli_thread_get_affinity_cpu( dim_t id );
+
+// Pin the calling thread to the CPU assigned to thread id, and restore its
+// original mask afterwards. Both are no-ops when no policy is in effect.
+void       bli_thread_bind( dim_t id );
+void       bli_thread_unbind( void );
+
+// Topology queries. bli_thread_topo_domains() reports how many L3 (or NUMA
+// node) and L2 domains the first nthread thread ids are placed on, provided
+// the ids of each domain are contiguous; otherwise (or if no policy is in
+// effect) it reports zero for both.
+dim_t      bli_thread_topo_num_cpus( void );
+void       bli_thread_topo_domains( dim_t nthread, dim_t* n_l3, dim_t* n_l2 );
+
+// NUMA queries. The number of nodes may be overridden with BLIS_NUM_NODES,
+// which emulates that many nodes by dividing the placement slots of the
+// current policy evenly among them (useful for testing on a single node).
+// The current node of a thread bound by bli_thread_bind() is that of its
+// placement slot; otherwise it is the node of the CPU it is running on.
+dim_t      bli_thread_topo_num_nodes( void );
+dim_t      bli_thread_topo_current_node( void );
+
+// Utility for parsing lists of the form "0-3,8,10-11".
+dim_t      bli_affinity_parse_list( const char* str, int* list, dim_t max );
+
+#endif
+
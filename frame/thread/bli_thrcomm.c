@@ -32,8 +32,111 @@
 
 */
 
+#if defined(__linux__)
+  #define _GNU_SOURCE
+#endif
+
 #include "blis.h"
 
+#if BLIS_OS_LINUX
+  #include <limits.h>
+  #include <unistd.h>
+  #include <sys/syscall.h>
+  #include <linux/futex.h>
+#else
+  #include <sched.h>
+#endif
+
+static dim_t bli_thrcomm_spin_count = BLIS_BARRIER_SPIN_COUNT;
+
+void bli_thrcomm_set_spin_count( dim_t spin_count )
+{
+	if ( spin_count < 0 ) spin_count = 0;
+
+	bli_thrcomm_spin_count = spin_count;
+}
+
+dim_t bli_thrcomm_get_spin_count( void )
+{
+	return bli_thrcomm_spin_count;
+}
+
+void bli_thrcomm_relax( void )
+{
+#if defined(__x86_64__) || defined(__i386__)
+	__builtin_ia32_pause();
+#endif
+}
+
+// Return TRUE if the count has reached the target. (The signed difference
+// handles the counter wrapping around.)
+#define bli_thrcomm_reached( count, target ) \
+\
+	( ( int32_t )( (count) - (target) ) >= 0 )
+
+void bli_thrcomm_wait_until
+     (
+       volatile uint32_t* count,
+       volatile uint32_t* waiters,
+       uint32_t           target
+     )
+{
+	dim_t spin_count = bli_thrcomm_spin_count;
+	dim_t i;
+
+	// Poll for a while before going to sleep. The acquire load makes the
+	// writes that preceded the signal visible once it is observed.
+	for ( i = 0; i < spin_count; ++i )
+	{
+		if ( bli_thrcomm_reached( __atomic_load_n( count, __ATOMIC_ACQUIRE ),
+		                          target ) ) return;
+		bli_thrcomm_relax();
+	}
+
+	while ( !bli_thrcomm_reached( __atomic_load_n( count, __ATOMIC_ACQUIRE ),
+	                              target ) )
+	{
+		uint32_t val;
+
+		// Announce that we are about to sleep, and then test the count once
+		// more before sleeping. Either the signaling thread sees us here or
+		// we see its update, so no wake-up can be lost. The futex itself
+		// returns immediately if the count moved since we read it.
+		__atomic_add_fetch( waiters, 1, __ATOMIC_SEQ_CST );
+
+		val = __atomic_load_n( count, __ATOMIC_SEQ_CST );
+		if ( !bli_thrcomm_reached( val, target ) )
+		{
+#if BLIS_OS_LINUX
+			syscall( SYS_futex, count, FUTEX_WAIT_PRIVATE, val, NULL, NULL, 0 );
+#else
+			sched_yield();
+#endif
+		}
+
+		__atomic_sub_fetch( waiters, 1, __ATOMIC_SEQ_CST );
+	}
+}
+
+void bli_thrcomm_advance
+     (
+       volatile uint32_t* count,
+       volatile uint32_t* waiters
+     )
+{
+	// The increment releases the writes that preceded it to the threads
+	// waiting on the count, and cannot be reordered with the test of the
+	// waiters field.
+	__atomic_add_fetch( count, 1, __ATOMIC_SEQ_CST );
+
+	if ( __atomic_load_n( waiters, __ATOMIC_SEQ_CST ) != 0 )
+	{
+#if BLIS_OS_LINUX
+		syscall( SYS_futex, count, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0 );
+#endif
+	}
+}
+
 void* bli_thrcomm_bcast
      (
        thrcomm_t* communicator,
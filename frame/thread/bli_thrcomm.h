@@ -55,5 +55,27 @@ void       bli_thrcomm_cleanup( thrcomm_t* communicator );
 void       bli_thrcomm_barrier( thrcomm_t* communicator, dim_t thread_id );
 void*      bli_thrcomm_bcast( thrcomm_t* communicator, dim_t inside_id, void* to_send );
 
+// The number of times a thread polls before it goes to sleep while waiting
+// at a barrier (for barrier implementations that can sleep). This may be
+// set at runtime via BLIS_BARRIER_SPIN.
+#ifndef BLIS_BARRIER_SPIN_COUNT
+#define BLIS_BARRIER_SPIN_COUNT 50000
+#endif
+
+void       bli_thrcomm_set_spin_count( dim_t spin_count );
+dim_t      bli_thrcomm_get_spin_count( void );
+
+// Waiting on a 32-bit counter that other threads advance. A waiting thread
+// polls for up to the spin count above and then sleeps (on a futex, on
+// Linux) until the counter reaches the target. The waiters field counts the
+// threads asleep on the counter, so that advancing it makes a system call
+// only when someone needs waking.
+void       bli_thrcomm_relax( void );
+void       bli_thrcomm_wait_until( volatile uint32_t* count,
+                                   volatile uint32_t* waiters,
+                                   uint32_t           target );
+void       bli_thrcomm_advance( volatile uint32_t* count,
+                                volatile uint32_t* waiters );
+
 #endif
 
@@ -77,6 +77,8 @@ void bli_thrcomm_barrier( thrcomm_t* communicator, dim_t t_id )
 	bool_t my_sense = communicator->barrier_sense;
 	dim_t my_threads_arrived;
 
+	bli_prof_begin( BLIS_PROF_BARRIER );
+
 	_Pragma( "omp atomic capture" )
 		my_threads_arrived = ++(communicator->barrier_threads_arrived);
 
@@ -90,6 +92,8 @@ void bli_thrcomm_barrier( thrcomm_t* communicator, dim_t t_id )
 		volatile bool_t* listener = &communicator->barrier_sense;
 		while ( *listener == my_sense ) {}
 	}
+
+	bli_prof_end( BLIS_PROF_BARRIER );
 }
 
 #else
@@ -170,7 +174,9 @@ void bli_thrcomm_tree_barrier_free( barrier_t* barrier )
 
 void bli_thrcomm_barrier( thrcomm_t* comm, dim_t t_id )
 {
+	bli_prof_begin( BLIS_PROF_BARRIER );
 	bli_thrcomm_tree_barrier( comm->barriers[t_id] );
+	bli_prof_end( BLIS_PROF_BARRIER );
 }
 
 void bli_thrcomm_tree_barrier( barrier_t* barack )
@@ -210,15 +216,23 @@ void bli_l3_thread_decorator
        obj_t*      beta,
        obj_t*      c,
        cntx_t*     cntx,
+       rntm_t*     rntm,
        cntl_t*     cntl
      )
 {
-	// Query the total number of threads from the context.
-	dim_t       n_threads = bli_cntx_get_num_threads( cntx );
+	// Query the total number of threads from the runtime object.
+	dim_t       n_threads = bli_rntm_get_num_threads( rntm );
 
 	// Allcoate a global communicator for the root thrinfo_t structures.
 	thrcomm_t*  gl_comm   = bli_thrcomm_create( n_threads );
 
+	// Make room in the shared L3 cache for the panels of B of all jc
+	// thread groups.
+	bli_cache_rntm_adjust_nc( rntm, cntx );
+
+	// Record the ways of parallelism in the call log.
+	bli_verbose_set_ways( cntx, rntm );
+
 #ifdef PRINT_THRINFO
 	thrinfo_t** threads   = bli_malloc_intl( n_threads * sizeof( thrinfo_t* ) );
 #endif
@@ -230,11 +244,19 @@ void bli_l3_thread_decorator
 		cntl_t*    cntl_use;
 		thrinfo_t* thread;
 
+		// Pin the thread to its CPU, if a placement policy is in effect.
+		bli_thread_bind( id );
+
+		// Charge this thread's time to its own profiling counters, and keep
+		// any BLIS calls made by this thread out of the call log.
+		bli_prof_begin_thread( id );
+		bli_verbose_suspend();
+
 		// Create a default control tree for the operation, if needed.
-		bli_l3_cntl_create_if( a, b, c, cntx, cntl, &cntl_use );
+		bli_l3_cntl_create_if( a, b, c, rntm, cntl, &cntl_use );
 
 		// Create the root node of the current thread's thrinfo_t structure.
-		bli_l3_thrinfo_create_root( id, gl_comm, cntx, cntl_use, &thread );
+		bli_l3_thrinfo_create_root( id, gl_comm, rntm, cntl_use, &thread );
 
 		func
 		(
@@ -248,8 +270,11 @@ void bli_l3_thread_decorator
 		  thread
 		);
 
+		bli_prof_end_thread();
+		bli_verbose_resume();
+
 		// Free the control tree, if one was created locally.
-		bli_l3_cntl_free_if( a, b, c, cntx, cntl, cntl_use, thread );
+		bli_l3_cntl_free_if( a, b, c, rntm, cntl, cntl_use, thread );
 
 #ifdef PRINT_THRINFO
 		threads[id] = thread;
@@ -257,12 +282,17 @@ void bli_l3_thread_decorator
 		// Free the current thread's thrinfo_t structure.
 		bli_l3_thrinfo_free( thread );
 #endif
+
+		// Restore the thread's original CPU mask.
+		bli_thread_unbind();
 	}
 
 	// We shouldn't free the global communicator since it was already freed
 	// by the global communicator's chief thread in bli_l3_thrinfo_free()
 	// (called above).
 
+	// Summarize the load balance of the operation across threads.
+	bli_prof_end_call( n_threads );
 
 #ifdef PRINT_THRINFO
 	bli_l3_thrinfo_print_paths( threads );
@@ -271,5 +301,27 @@ void bli_l3_thread_decorator
 #endif
 }
 
+void bli_thread_launch
+     (
+       dim_t     n_threads,
+       thrfunc_t func,
+       void*     params
+     )
+{
+	if ( n_threads <= 1 ) { func( 0, 1, params ); return; }
+
+	_Pragma( "omp parallel num_threads(n_threads)" )
+	{
+		dim_t id = omp_get_thread_num();
+		dim_t nt = omp_get_num_threads();
+
+		bli_thread_bind( id );
+
+		func( id, nt, params );
+
+		bli_thread_unbind();
+	}
+}
+
 #endif
 
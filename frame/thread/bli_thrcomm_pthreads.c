@@ -68,10 +68,12 @@ void bli_thrcomm_cleanup( thrcomm_t* communicator )
 
 void bli_thrcomm_barrier( thrcomm_t* communicator, dim_t t_id )
 {
+	bli_prof_begin( BLIS_PROF_BARRIER );
 	pthread_barrier_wait( &communicator->barrier );
+	bli_prof_end( BLIS_PROF_BARRIER );
 }
 
-#else
+#elif defined(BLIS_USE_PTHREAD_MUTEX) || defined(BLIS_USE_CENTRAL_BARRIER)
 
 void bli_thrcomm_init( thrcomm_t* communicator, dim_t n_threads)
 {
@@ -100,6 +102,8 @@ void bli_thrcomm_barrier( thrcomm_t* communicator, dim_t t_id )
 	bool_t my_sense = communicator->sense;
 	dim_t my_threads_arrived;
 
+	bli_prof_begin( BLIS_PROF_BARRIER );
+
 #ifdef BLIS_USE_PTHREAD_MUTEX
 	pthread_mutex_lock( &communicator->mutex );
 	my_threads_arrived = ++(communicator->threads_arrived);
@@ -118,6 +122,123 @@ void bli_thrcomm_barrier( thrcomm_t* communicator, dim_t t_id )
 		volatile bool_t* listener = &communicator->sense;
 		while( *listener == my_sense ) {}
 	}
+
+	bli_prof_end( BLIS_PROF_BARRIER );
+}
+
+#else
+
+// A barrier flag. The count is advanced once per barrier episode by the
+// flag's (single) signaling thread, and is polled by its (single) owner.
+// The owner's episode number, and the last episode it has left, are kept
+// in the flag of its last round.
+struct barflag_s
+{
+	volatile uint32_t count;
+	volatile uint32_t waiters;
+	uint32_t          epoch;
+	volatile uint32_t departed;
+
+	char              pad[ BLIS_CACHE_LINE_SIZE - 4 * sizeof( uint32_t ) ];
+};
+
+void bli_thrcomm_init( thrcomm_t* communicator, dim_t n_threads)
+{
+	dim_t n_rounds = 0;
+	dim_t n_flags;
+	dim_t i;
+
+	if ( communicator == NULL ) return;
+	communicator->sent_object = NULL;
+	communicator->n_threads = n_threads;
+	communicator->flags = NULL;
+	communicator->flags_sys = NULL;
+
+	// A dissemination barrier over n threads takes ceil(log2(n)) rounds.
+	while ( ( ( dim_t )1 << n_rounds ) < n_threads ) n_rounds++;
+
+	communicator->n_rounds = n_rounds;
+
+	if ( n_rounds == 0 ) return;
+
+	// Allocate the flags, aligned to a cache line.
+	n_flags = n_threads * n_rounds;
+
+	communicator->flags_sys = bli_malloc_intl( n_flags * sizeof( barflag_t ) +
+	                                           BLIS_CACHE_LINE_SIZE );
+	communicator->flags     = ( barflag_t* )
+	                          ( ( ( uintptr_t )communicator->flags_sys +
+	                              BLIS_CACHE_LINE_SIZE - 1 ) &
+	                            ~( ( uintptr_t )BLIS_CACHE_LINE_SIZE - 1 ) );
+
+	for ( i = 0; i < n_flags; ++i )
+	{
+		communicator->flags[ i ].count   = 0;
+		communicator->flags[ i ].waiters = 0;
+		communicator->flags[ i ].epoch    = 0;
+		communicator->flags[ i ].departed = 0;
+	}
+}
+
+void bli_thrcomm_cleanup( thrcomm_t* communicator )
+{
+	dim_t n_rounds;
+	dim_t t;
+
+	if ( communicator == NULL ) return;
+
+	// The communicator is freed by its chief as soon as the chief is done
+	// with it, but other threads may still be polling their flags in the
+	// last barrier. Wait until every thread has left it.
+	n_rounds = communicator->n_rounds;
+
+	if ( n_rounds > 0 )
+	{
+		uint32_t epoch = communicator->flags[ n_rounds - 1 ].epoch;
+
+		for ( t = 1; t < communicator->n_threads; ++t )
+		{
+			barflag_t* last = communicator->flags + t * n_rounds + n_rounds - 1;
+
+			while ( last->departed != epoch ) bli_thrcomm_relax();
+		}
+	}
+
+	bli_free_intl( communicator->flags_sys );
+	communicator->flags = NULL;
+	communicator->flags_sys = NULL;
+}
+
+void bli_thrcomm_barrier( thrcomm_t* communicator, dim_t t_id )
+{
+	if ( communicator == NULL || communicator->n_threads == 1 ) return;
+
+	dim_t      n_threads = communicator->n_threads;
+	dim_t      n_rounds  = communicator->n_rounds;
+	barflag_t* my_flags  = communicator->flags + t_id * n_rounds;
+	uint32_t   epoch     = ++( my_flags[ n_rounds - 1 ].epoch );
+	dim_t      r, dist;
+
+	bli_prof_begin( BLIS_PROF_BARRIER );
+
+	// In round r, signal the thread 2^r ahead of us and wait for the thread
+	// 2^r behind us. After the last round, every thread has (transitively)
+	// heard from every other thread.
+	for ( r = 0, dist = 1; r < n_rounds; ++r, dist *= 2 )
+	{
+		dim_t peer = ( t_id + dist ) % n_threads;
+
+		barflag_t* peer_flag = communicator->flags + peer * n_rounds + r;
+
+		bli_thrcomm_advance( &peer_flag->count, &peer_flag->waiters );
+		bli_thrcomm_wait_until( &my_flags[ r ].count, &my_flags[ r ].waiters,
+		                        epoch );
+	}
+
+	// Record that we no longer access the flags for this episode.
+	my_flags[ n_rounds - 1 ].departed = epoch;
+
+	bli_prof_end( BLIS_PROF_BARRIER );
 }
 
 #endif
@@ -135,6 +256,7 @@ typedef struct thread_data
 	obj_t*     beta;
 	obj_t*     c;
 	cntx_t*    cntx;
+	rntm_t*    rntm;
 	cntl_t*    cntl;
 	dim_t      id;
 	thrcomm_t* gl_comm;
@@ -151,6 +273,7 @@ void* bli_l3_thread_entry( void* data_void )
 	obj_t*         beta     = data->beta;
 	obj_t*         c        = data->c;
 	cntx_t*        cntx     = data->cntx;
+	rntm_t*        rntm     = data->rntm;
 	cntl_t*        cntl     = data->cntl;
 	dim_t          id       = data->id;
 	thrcomm_t*     gl_comm  = data->gl_comm;
@@ -158,11 +281,19 @@ void* bli_l3_thread_entry( void* data_void )
 	cntl_t*        cntl_use;
 	thrinfo_t*     thread;
 
+	// Pin the thread to its CPU, if a placement policy is in effect.
+	bli_thread_bind( id );
+
+	// Charge this thread's time to its own profiling counters, and keep
+	// any BLIS calls made by this thread out of the call log.
+	bli_prof_begin_thread( id );
+	bli_verbose_suspend();
+
 	// Create a default control tree for the operation, if needed.
-	bli_l3_cntl_create_if( a, b, c, cntx, cntl, &cntl_use );
+	bli_l3_cntl_create_if( a, b, c, rntm, cntl, &cntl_use );
 
 	// Create the root node of the current thread's thrinfo_t structure.
-	bli_l3_thrinfo_create_root( id, gl_comm, cntx, cntl_use, &thread );
+	bli_l3_thrinfo_create_root( id, gl_comm, rntm, cntl_use, &thread );
 
 	data->func
 	(
@@ -176,12 +307,19 @@ void* bli_l3_thread_entry( void* data_void )
 	  thread
 	);
 
+	bli_prof_end_thread();
+	bli_verbose_resume();
+
 	// Free the control tree, if one was created locally.
-	bli_l3_cntl_free_if( a, b, c, cntx, cntl, cntl_use, thread );
+	bli_l3_cntl_free_if( a, b, c, rntm, cntl, cntl_use, thread );
 
 	// Free the current thread's thrinfo_t structure.
 	bli_l3_thrinfo_free( thread );
 
+	// Restore the thread's original CPU mask. This matters for thread 0,
+	// which is the application's thread.
+	bli_thread_unbind();
+
 	return NULL;
 }
 
@@ -194,11 +332,12 @@ void bli_l3_thread_decorator
        obj_t*      beta,
        obj_t*      c,
        cntx_t*     cntx,
+       rntm_t*     rntm,
        cntl_t*     cntl
      )
 {
-	// Query the total number of threads from the context.
-	dim_t          n_threads = bli_cntx_get_num_threads( cntx );
+	// Query the total number of threads from the runtime object.
+	dim_t          n_threads = bli_rntm_get_num_threads( rntm );
 
 	// Allocate an array of pthread objects and auxiliary data structs to pass
 	// to the thread entry functions.
@@ -208,6 +347,13 @@ void bli_l3_thread_decorator
 	// Allocate a global communicator for the root thrinfo_t structures.
 	thrcomm_t*     gl_comm   = bli_thrcomm_create( n_threads );
 
+	// Make room in the shared L3 cache for the panels of B of all jc
+	// thread groups.
+	bli_cache_rntm_adjust_nc( rntm, cntx );
+
+	// Record the ways of parallelism in the call log.
+	bli_verbose_set_ways( cntx, rntm );
+
 	// NOTE: We must iterate backwards so that the chief thread (thread id 0)
 	// can spawn all other threads before proceeding with its own computation.
 	for ( dim_t id = n_threads - 1; 0 <= id; id-- )
@@ -220,6 +366,7 @@ void bli_l3_thread_decorator
 		datas[id].beta    = beta;
 		datas[id].c       = c;
 		datas[id].cntx    = cntx;
+		datas[id].rntm    = rntm;
 		datas[id].cntl    = cntl;
 		datas[id].id      = id;
 		datas[id].gl_comm = gl_comm;
@@ -241,10 +388,73 @@ void bli_l3_thread_decorator
 		pthread_join( pthreads[id], NULL );
 	}
 
+	// Summarize the load balance of the operation across threads.
+	bli_prof_end_call( n_threads );
+
 	bli_free_intl( pthreads );
 	bli_free_intl( datas );
 }
 
 
+// A data structure to assist in passing a function and its parameters to
+// additional threads in bli_thread_launch().
+typedef struct launch_data
+{
+	thrfunc_t func;
+	void*     params;
+	dim_t     id;
+	dim_t     n_threads;
+} launch_data_t;
+
+// Entry point for threads created by bli_thread_launch()
+static void* bli_thread_launch_entry( void* data_void )
+{
+	launch_data_t* data = data_void;
+
+	bli_thread_bind( data->id );
+
+	data->func( data->id, data->n_threads, data->params );
+
+	bli_thread_unbind();
+
+	return NULL;
+}
+
+void bli_thread_launch
+     (
+       dim_t     n_threads,
+       thrfunc_t func,
+       void*     params
+     )
+{
+	if ( n_threads <= 1 ) { func( 0, 1, params ); return; }
+
+	pthread_t*     pthreads = bli_malloc_intl( sizeof( pthread_t     ) * n_threads );
+	launch_data_t* datas    = bli_malloc_intl( sizeof( launch_data_t ) * n_threads );
+
+	// As in the decorator, thread 0 spawns all other threads before
+	// starting on its own share of the work.
+	for ( dim_t id = n_threads - 1; 0 <= id; id-- )
+	{
+		datas[id].func      = func;
+		datas[id].params    = params;
+		datas[id].id        = id;
+		datas[id].n_threads = n_threads;
+
+		if ( id != 0 )
+			pthread_create( &pthreads[id], NULL, &bli_thread_launch_entry, &datas[id] );
+		else
+			bli_thread_launch_entry( ( void* )(&datas[0]) );
+	}
+
+	for ( dim_t id = 1; id < n_threads; id++ )
+	{
+		pthread_join( pthreads[id], NULL );
+	}
+
+	bli_free_intl( pthreads );
+	bli_free_intl( datas );
+}
+
 #endif
 
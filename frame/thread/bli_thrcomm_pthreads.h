@@ -48,7 +48,7 @@ struct thrcomm_s
 
 	pthread_barrier_t barrier;
 };
-#else
+#elif defined(BLIS_USE_PTHREAD_MUTEX) || defined(BLIS_USE_CENTRAL_BARRIER)
 struct thrcomm_s
 {
 	void*  sent_object;
@@ -61,6 +61,22 @@ struct thrcomm_s
 	volatile bool_t  sense;
 	volatile dim_t   threads_arrived;
 };
+#else
+// By default, we use a dissemination barrier. Each thread owns one flag per
+// round (padded to a cache line) that it polls, and there is no shared
+// counter that every thread must update.
+struct barflag_s;
+typedef struct barflag_s barflag_t;
+
+struct thrcomm_s
+{
+	void*       sent_object;
+	dim_t       n_threads;
+
+	dim_t       n_rounds;
+	barflag_t*  flags;
+	void*       flags_sys;
+};
 #endif
 
 typedef struct thrcomm_s thrcomm_t;
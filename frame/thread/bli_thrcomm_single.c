@@ -80,6 +80,7 @@ void bli_l3_thread_decorator
        obj_t*      beta,
        obj_t*      c,
        cntx_t*     cntx,
+       rntm_t*     rntm,
        cntl_t*     cntl
      )
 {
@@ -90,14 +91,19 @@ void bli_l3_thread_decorator
 	// Allcoate a global communicator for the root thrinfo_t structures.
 	thrcomm_t* gl_comm   = bli_thrcomm_create( n_threads );
 
+	// Record the ways of parallelism in the call log.
+	bli_verbose_set_ways( cntx, rntm );
+
 	cntl_t*    cntl_use;
 	thrinfo_t* thread;
 
 	// Create a default control tree for the operation, if needed.
-	bli_l3_cntl_create_if( a, b, c, cntx, cntl, &cntl_use );
+	bli_l3_cntl_create_if( a, b, c, rntm, cntl, &cntl_use );
 
 	// Create the root node of the thread's thrinfo_t structure.
-	bli_l3_thrinfo_create_root( id, gl_comm, cntx, cntl_use, &thread );
+	bli_l3_thrinfo_create_root( id, gl_comm, rntm, cntl_use, &thread );
+
+	bli_prof_begin_thread( id );
 
 	func
 	(
@@ -111,8 +117,11 @@ void bli_l3_thread_decorator
 	  thread
 	);
 
+	bli_prof_end_thread();
+	bli_prof_end_call( n_threads );
+
 	// Free the control tree, if one was created locally.
-	bli_l3_cntl_free_if( a, b, c, cntx, cntl, cntl_use, thread );
+	bli_l3_cntl_free_if( a, b, c, rntm, cntl, cntl_use, thread );
 
 	// Free the current thread's thrinfo_t structure.
 	bli_l3_thrinfo_free( thread );
@@ -123,5 +132,16 @@ void bli_l3_thread_decorator
 }
 
 
+void bli_thread_launch
+     (
+       dim_t     n_threads,
+       thrfunc_t func,
+       void*     params
+     )
+{
+	// For sequential execution, we use only one thread.
+	func( 0, 1, params );
+}
+
 #endif
 
@@ -40,6 +40,15 @@ thrinfo_t     BLIS_PACKM_SINGLE_THREADED = {};
 thrinfo_t     BLIS_GEMM_SINGLE_THREADED  = {};
 thrcomm_t     BLIS_SINGLE_COMM           = {};
 
+// The parameters that steer the partitioning of threads among the level-3
+// loops when only the total number of threads is given. They start out as
+// the configuration's values and may be changed at runtime (for example,
+// by a tuning file).
+static dim_t  bli_thread_m_ratio         = BLIS_DEFAULT_M_THREAD_RATIO;
+static dim_t  bli_thread_n_ratio         = BLIS_DEFAULT_N_THREAD_RATIO;
+static dim_t  bli_thread_mr_max          = BLIS_DEFAULT_MR_THREAD_MAX;
+static dim_t  bli_thread_nr_max          = BLIS_DEFAULT_NR_THREAD_MAX;
+
 // -----------------------------------------------------------------------------
 
 void bli_thread_init( void )
@@ -51,12 +60,19 @@ void bli_thread_init( void )
 	bli_packm_thrinfo_init_single( &BLIS_PACKM_SINGLE_THREADED );
 	bli_l3_thrinfo_init_single( &BLIS_GEMM_SINGLE_THREADED );
 
+	bli_affinity_init();
+
+	bli_thrcomm_set_spin_count( bli_env_read_nway( "BLIS_BARRIER_SPIN",
+	                                               BLIS_BARRIER_SPIN_COUNT ) );
+
 	// Mark API as initialized.
 	bli_thread_is_init = TRUE;
 }
 
 void bli_thread_finalize( void )
 {
+	bli_affinity_finalize();
+
 	// Mark API as uninitialized.
 	bli_thread_is_init = FALSE;
 }
@@ -68,6 +84,35 @@ bool_t bli_thread_is_initialized( void )
 
 // -----------------------------------------------------------------------------
 
+void bli_thread_set_ratios( dim_t m_ratio, dim_t n_ratio,
+                            dim_t mr_max,  dim_t nr_max )
+{
+	// Values less than one leave the corresponding parameter unchanged.
+	if ( m_ratio > 0 ) bli_thread_m_ratio = m_ratio;
+	if ( n_ratio > 0 ) bli_thread_n_ratio = n_ratio;
+	if ( mr_max  > 0 ) bli_thread_mr_max  = mr_max;
+	if ( nr_max  > 0 ) bli_thread_nr_max  = nr_max;
+}
+
+void bli_thread_get_ratios( dim_t* m_ratio, dim_t* n_ratio,
+                            dim_t* mr_max,  dim_t* nr_max )
+{
+	*m_ratio = bli_thread_m_ratio;
+	*n_ratio = bli_thread_n_ratio;
+	*mr_max  = bli_thread_mr_max;
+	*nr_max  = bli_thread_nr_max;
+}
+
+void bli_thread_reset_ratios( void )
+{
+	bli_thread_m_ratio = BLIS_DEFAULT_M_THREAD_RATIO;
+	bli_thread_n_ratio = BLIS_DEFAULT_N_THREAD_RATIO;
+	bli_thread_mr_max  = BLIS_DEFAULT_MR_THREAD_MAX;
+	bli_thread_nr_max  = BLIS_DEFAULT_NR_THREAD_MAX;
+}
+
+// -----------------------------------------------------------------------------
+
 void bli_thread_get_range_sub
      (
        thrinfo_t* thread,
@@ -649,7 +694,7 @@ siz_t bli_thread_get_range_mdim
      )
 {
 	bszid_t  bszid  = bli_cntl_bszid( cntl );
-	opid_t   family = bli_cntx_get_family( cntx );
+	opid_t   family = bli_rntm_family( bli_thrinfo_rntm( thr ) );
 
 	// This is part of trsm's current implementation, whereby right side
 	// cases are implemented in left-side micro-kernels, which requires
@@ -708,7 +753,7 @@ siz_t bli_thread_get_range_ndim
      )
 {
 	bszid_t  bszid  = bli_cntl_bszid( cntl );
-	opid_t   family = bli_cntx_get_family( cntx );
+	opid_t   family = bli_rntm_family( bli_thrinfo_rntm( thr ) );
 
 	// This is part of trsm's current implementation, whereby right side
 	// cases are implemented in left-side micro-kernels, which requires
@@ -1154,6 +1199,67 @@ void bli_partition_2x2( dim_t nthread, dim_t work1, dim_t work2,
     #endif
 }
 
+void bli_partition_l3_loops( dim_t nthread, dim_t m, dim_t n,
+                             dim_t* jc, dim_t* ic, dim_t* jr, dim_t* ir )
+{
+	dim_t n_l3, n_l2;
+
+	// If the threads are pinned such that consecutive thread ids share
+	// caches, map the loops onto the cache hierarchy: the jc ways are split
+	// across L3 domains (or sockets), so that each group of threads sharing
+	// a packed panel of B also shares an L3; the ic ways are split across
+	// the L2 domains within each of those; and the threads that share an L2
+	// (typically the SMT siblings of one core) go to the jr and ir loops.
+	bli_thread_topo_domains( nthread, &n_l3, &n_l2 );
+
+	if ( n_l2 > 0 )
+	{
+		dim_t n_in = nthread / n_l2;
+
+		bli_partition_2x2( n_l2 / n_l3, m*bli_thread_m_ratio*n_l3,
+		                                n*bli_thread_n_ratio, ic, jc );
+		*jc *= n_l3;
+
+		for ( *jr = bli_thread_nr_max ; *jr > 1 ; (*jr)-- )
+			if ( n_in % *jr == 0 ) break;
+		n_in /= *jr;
+
+		for ( *ir = bli_thread_mr_max ; *ir > 1 ; (*ir)-- )
+			if ( n_in % *ir == 0 ) break;
+		n_in /= *ir;
+
+		// Any threads within an L2 domain that could not be assigned to the
+		// register blocking loops are assigned to ic.
+		*ic *= n_in;
+
+		return;
+	}
+
+	// Otherwise, split the threads between the m and n dimensions, and then
+	// peel off as much of each factor as is allowed for the register
+	// blocking loops (ir and jr, respectively).
+	bli_partition_2x2( nthread, m*bli_thread_m_ratio,
+	                            n*bli_thread_n_ratio, ic, jc );
+
+	for ( *ir = bli_thread_mr_max ; *ir > 1 ; (*ir)-- )
+	{
+		if ( *ic % *ir == 0 )
+		{
+			*ic /= *ir;
+			break;
+		}
+	}
+
+	for ( *jr = bli_thread_nr_max ; *jr > 1 ; (*jr)-- )
+	{
+		if ( *jc % *jr == 0 )
+		{
+			*jc /= *jr;
+			break;
+		}
+	}
+}
+
 // -----------------------------------------------------------------------------
 
 // Some utilities
@@ -1169,6 +1275,20 @@ dim_t bli_env_read_nway( const char* env, dim_t fallback )
 	return num;
 }
 
+// The total number of threads requested with BLIS_NUM_THREADS or, failing
+// that, OMP_NUM_THREADS (one if neither is set).
+dim_t bli_env_read_nthread( void )
+{
+	dim_t nthread = bli_env_read_nway( "BLIS_NUM_THREADS", -1 );
+
+	if ( nthread == -1 )
+	    nthread = bli_env_read_nway( "OMP_NUM_THREADS", -1 );
+
+	if ( nthread < 1 ) nthread = 1;
+
+	return nthread;
+}
+
 dim_t bli_gcd( dim_t x, dim_t y )
 {
 	while ( y != 0 )
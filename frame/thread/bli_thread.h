@@ -47,11 +47,21 @@
 #include "bli_packm_thrinfo.h"
 #include "bli_l3_thrinfo.h"
 
+// Include thread affinity and topology prototypes.
+#include "bli_affinity.h"
+
 // Initialization-related prototypes.
 void    bli_thread_init( void );
 void    bli_thread_finalize( void );
 bool_t  bli_thread_is_initialized( void );
 
+// Prototypes for the parameters of the automatic thread partitioning.
+void    bli_thread_set_ratios( dim_t m_ratio, dim_t n_ratio,
+                               dim_t mr_max,  dim_t nr_max );
+void    bli_thread_get_ratios( dim_t* m_ratio, dim_t* n_ratio,
+                               dim_t* mr_max,  dim_t* nr_max );
+void    bli_thread_reset_ratios( void );
+
 // Thread range-related prototypes.
 void bli_thread_get_range_sub
      (
@@ -161,9 +171,24 @@ void bli_l3_thread_decorator
        obj_t*  beta,
        obj_t*  c,
        cntx_t* cntx,
+       rntm_t* rntm,
        cntl_t* cntl
      );
 
+// Generic thread launcher prototype. The function is called as
+// func( tid, n_threads, params ) on each of n_threads threads, with the
+// calling thread acting as thread 0, and the launcher returns once all of
+// them are done. Under OpenMP the runtime may provide fewer threads than
+// requested; func always receives the actual number.
+typedef void (*thrfunc_t)( dim_t tid, dim_t n_threads, void* params );
+
+void bli_thread_launch
+     (
+       dim_t     n_threads,
+       thrfunc_t func,
+       void*     params
+     );
+
 // Factorization and partitioning prototypes
 typedef struct
 {
@@ -178,8 +203,12 @@ dim_t bli_next_prime_factor(bli_prime_factors_t* factors);
 
 void bli_partition_2x2(dim_t nthread, dim_t work1, dim_t work2, dim_t* nt1, dim_t* nt2);
 
+void bli_partition_l3_loops( dim_t nthread, dim_t m, dim_t n,
+                             dim_t* jc, dim_t* ic, dim_t* jr, dim_t* ir );
+
 // Miscellaneous prototypes
 dim_t bli_env_read_nway( const char* env, dim_t fallback );
+dim_t bli_env_read_nthread( void );
 dim_t bli_gcd( dim_t x, dim_t y );
 dim_t bli_lcm( dim_t x, dim_t y );
 dim_t bli_ipow( dim_t base, dim_t power );
@@ -41,6 +41,7 @@ thrinfo_t* bli_thrinfo_create
        dim_t      n_way,
        dim_t      work_id, 
        bool_t     free_comm,
+       rntm_t*    rntm,
        thrinfo_t* sub_node
      )
 {
@@ -52,6 +53,7 @@ thrinfo_t* bli_thrinfo_create
 	  ocomm, ocomm_id,
 	  n_way, work_id, 
 	  free_comm,
+	  rntm,
 	  sub_node
 	);
 
@@ -66,6 +68,7 @@ void bli_thrinfo_init
        dim_t      n_way,
        dim_t      work_id, 
        bool_t     free_comm,
+       rntm_t*    rntm,
        thrinfo_t* sub_node
      )
 {
@@ -74,6 +77,7 @@ void bli_thrinfo_init
 	thread->n_way     = n_way;
 	thread->work_id   = work_id;
 	thread->free_comm = free_comm;
+	thread->rntm      = rntm;
 
 	thread->sub_node  = sub_node;
 }
@@ -90,6 +94,7 @@ void bli_thrinfo_init_single
 	  1,
 	  0,
 	  FALSE,
+	  NULL,
 	  thread
 	);
 }
@@ -102,7 +107,6 @@ void bli_thrinfo_init_single
 
 thrinfo_t* bli_thrinfo_create_for_cntl
      (
-       cntx_t*    cntx,
        cntl_t*    cntl_par,
        cntl_t*    cntl_chl,
        thrinfo_t* thread_par
@@ -113,6 +117,7 @@ thrinfo_t* bli_thrinfo_create_for_cntl
 
 	thrinfo_t* thread_chl;
 
+	rntm_t* rntm      = bli_thrinfo_rntm( thread_par );
 	bszid_t bszid_chl = bli_cntl_bszid( cntl_chl );
 
 	dim_t parent_nt_in   = bli_thread_num_threads( thread_par );
@@ -134,8 +139,8 @@ thrinfo_t* bli_thrinfo_create_for_cntl
 	// - the current thread's id within the new communicator,
 	// - the current thread's work id, given the ways of parallelism
 	//   to be obtained within the next loop.
-	child_nt_in   = bli_cntx_get_num_threads_in( cntx, cntl_chl );
-	child_n_way   = bli_cntx_way_for_bszid( bszid_chl, cntx );
+	child_nt_in   = bli_rntm_get_num_threads_in( rntm, cntl_chl );
+	child_n_way   = bli_rntm_way_for_bszid( bszid_chl, rntm );
 	child_comm_id = parent_comm_id % child_nt_in;
 	child_work_id = child_comm_id / ( child_nt_in / child_n_way );
 
@@ -170,6 +175,7 @@ thrinfo_t* bli_thrinfo_create_for_cntl
 	  child_n_way,
 	  child_work_id,
 	  TRUE,
+	  rntm,
 	  NULL
 	);
 
@@ -188,7 +194,6 @@ thrinfo_t* bli_thrinfo_create_for_cntl
 
 void bli_thrinfo_grow
      (
-       cntx_t*    cntx,
        cntl_t*    cntl,
        thrinfo_t* thread
      )
@@ -201,7 +206,6 @@ void bli_thrinfo_grow
 	// pointer to the (eldest) child.
 	thrinfo_t* thread_child = bli_thrinfo_rgrow
 	(
-	  cntx,
 	  cntl,
 	  bli_cntl_sub_node( cntl ),
 	  thread
@@ -213,7 +217,6 @@ void bli_thrinfo_grow
 
 thrinfo_t* bli_thrinfo_rgrow
      (
-       cntx_t*    cntx,
        cntl_t*    cntl_par,
        cntl_t*    cntl_cur,
        thrinfo_t* thread_par
@@ -230,7 +233,6 @@ thrinfo_t* bli_thrinfo_rgrow
 		// with cntl_par being the parent.
 		thread_cur = bli_thrinfo_create_for_cntl
 		(
-		  cntx,
 		  cntl_par,
 		  cntl_cur,
 		  thread_par
@@ -242,7 +244,6 @@ thrinfo_t* bli_thrinfo_rgrow
 		// thrinfo_t node of that segment.
 		thrinfo_t* thread_seg = bli_thrinfo_rgrow
 		(
-		  cntx,
 		  cntl_par,
 		  bli_cntl_sub_node( cntl_cur ),
 		  thread_par
@@ -256,9 +257,11 @@ thrinfo_t* bli_thrinfo_rgrow
 		(
 		  bli_thrinfo_ocomm( thread_seg ),
 		  bli_thread_ocomm_id( thread_seg ),
-		  bli_cntx_get_num_threads_in( cntx, cntl_cur ),
+		  bli_rntm_get_num_threads_in( bli_thrinfo_rntm( thread_par ),
+		                               cntl_cur ),
 		  bli_thread_ocomm_id( thread_seg ),
 		  FALSE,
+		  bli_thrinfo_rntm( thread_par ),
 		  thread_seg
 		);
 
@@ -57,6 +57,10 @@ struct thrinfo_s
 	// to false.
 	bool_t             free_comm;
 
+	// The runtime state of the operation (the family and the ways of
+	// parallelism), which is shared by all nodes of all threads.
+	rntm_t*            rntm;
+
 	struct thrinfo_s*  sub_node;
 };
 typedef struct thrinfo_s thrinfo_t;
@@ -77,6 +81,7 @@ typedef struct thrinfo_s thrinfo_t;
 
 #define bli_thrinfo_ocomm( t )             ( (t)->ocomm )
 #define bli_thrinfo_needs_free_comm( t )   ( (t)->free_comm )
+#define bli_thrinfo_rntm( t )              ( (t)->rntm )
 
 #define bli_thrinfo_sub_node( t )          ( (t)->sub_node )
 
@@ -110,6 +115,7 @@ thrinfo_t* bli_thrinfo_create
        dim_t      n_way,
        dim_t      work_id, 
        bool_t     free_comm,
+       rntm_t*    rntm,
        thrinfo_t* sub_node
      );
 
@@ -121,6 +127,7 @@ void bli_thrinfo_init
        dim_t      n_way,
        dim_t      work_id, 
        bool_t     free_comm,
+       rntm_t*    rntm,
        thrinfo_t* sub_node
      );
 
@@ -133,7 +140,6 @@ void bli_thrinfo_init_single
 
 thrinfo_t* bli_thrinfo_create_for_cntl
      (
-       cntx_t*    cntx,
        cntl_t*    cntl_par,
        cntl_t*    cntl_chl,
        thrinfo_t* thread_par
@@ -141,14 +147,12 @@ thrinfo_t* bli_thrinfo_create_for_cntl
 
 void bli_thrinfo_grow
      (
-       cntx_t*    cntx,
        cntl_t*    cntl,
        thrinfo_t* thread
      );
 
 thrinfo_t* bli_thrinfo_rgrow
      (
-       cntx_t*    cntx,
        cntl_t*    cntl_par,
        cntl_t*    cntl_cur,
        thrinfo_t* thread_par
@@ -0,0 +1,276 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include "immintrin.h"
+
+
+// The kernels below apply H with unaligned AVX2/FMA loads and stores when
+// x and y are unit-stride, and fall back to the reference implementation
+// otherwise. Since H is real, the complex kernels reduce to the real case
+// on 2n elements.
+
+void bli_srotmv_opt_var1
+     (
+       dim_t           n,
+       float* restrict h,
+       float* restrict x, inc_t incx,
+       float* restrict y, inc_t incy,
+       cntx_t*         cntx
+     )
+{
+	const dim_t n_elem_per_reg = 8;
+	const dim_t n_iter_unroll  = 4;
+
+	dim_t       i;
+	dim_t       n_run;
+	dim_t       n_left;
+
+	float*      x1;
+	float*      y1;
+
+	float       flag;
+	float       h_full[ 5 ];
+
+	__m256      h11v, h21v, h12v, h22v;
+	__m256      x0v, x1v, x2v, x3v;
+	__m256      y0v, y1v, y2v, y3v;
+	__m256      t0v, t1v, t2v, t3v;
+
+
+	if ( bli_zero_dim1( n ) ) return;
+
+	flag = h[0];
+
+	if ( flag == -2.0F ) return;
+
+	if ( incx != 1 || incy != 1 )
+	{
+		BLIS_SROTMV_KERNEL_REF( n, h, x, incx, y, incy, cntx );
+		return;
+	}
+
+	// Expand H so that the edge case below can use the full form.
+	h_full[0] = -1.0F;
+	if      ( flag < 0.0F )  { h_full[1] = h[1]; h_full[2] = h[2]; h_full[3] = h[3]; h_full[4] = h[4]; }
+	else if ( flag == 0.0F ) { h_full[1] = 1.0F; h_full[2] = h[2]; h_full[3] = h[3]; h_full[4] = 1.0F; }
+	else                     { h_full[1] = h[1]; h_full[2] = -1.0F; h_full[3] = 1.0F; h_full[4] = h[4]; }
+
+	n_run  = n / ( n_elem_per_reg * n_iter_unroll );
+	n_left = n % ( n_elem_per_reg * n_iter_unroll );
+
+	x1 = x;
+	y1 = y;
+
+	h11v = _mm256_broadcast_ss( &h_full[1] );
+	h21v = _mm256_broadcast_ss( &h_full[2] );
+	h12v = _mm256_broadcast_ss( &h_full[3] );
+	h22v = _mm256_broadcast_ss( &h_full[4] );
+
+	for ( i = 0; i < n_run; ++i )
+	{
+		x0v = _mm256_loadu_ps( x1 +  0 );
+		x1v = _mm256_loadu_ps( x1 +  8 );
+		x2v = _mm256_loadu_ps( x1 + 16 );
+		x3v = _mm256_loadu_ps( x1 + 24 );
+		y0v = _mm256_loadu_ps( y1 +  0 );
+		y1v = _mm256_loadu_ps( y1 +  8 );
+		y2v = _mm256_loadu_ps( y1 + 16 );
+		y3v = _mm256_loadu_ps( y1 + 24 );
+
+		// x := h11 * x + h12 * y;
+		t0v = _mm256_fmadd_ps( h11v, x0v, _mm256_mul_ps( h12v, y0v ) );
+		t1v = _mm256_fmadd_ps( h11v, x1v, _mm256_mul_ps( h12v, y1v ) );
+		t2v = _mm256_fmadd_ps( h11v, x2v, _mm256_mul_ps( h12v, y2v ) );
+		t3v = _mm256_fmadd_ps( h11v, x3v, _mm256_mul_ps( h12v, y3v ) );
+
+		// y := h21 * x + h22 * y;
+		y0v = _mm256_fmadd_ps( h21v, x0v, _mm256_mul_ps( h22v, y0v ) );
+		y1v = _mm256_fmadd_ps( h21v, x1v, _mm256_mul_ps( h22v, y1v ) );
+		y2v = _mm256_fmadd_ps( h21v, x2v, _mm256_mul_ps( h22v, y2v ) );
+		y3v = _mm256_fmadd_ps( h21v, x3v, _mm256_mul_ps( h22v, y3v ) );
+
+		_mm256_storeu_ps( x1 +  0, t0v );
+		_mm256_storeu_ps( x1 +  8, t1v );
+		_mm256_storeu_ps( x1 + 16, t2v );
+		_mm256_storeu_ps( x1 + 24, t3v );
+		_mm256_storeu_ps( y1 +  0, y0v );
+		_mm256_storeu_ps( y1 +  8, y1v );
+		_mm256_storeu_ps( y1 + 16, y2v );
+		_mm256_storeu_ps( y1 + 24, y3v );
+
+		x1 += n_elem_per_reg * n_iter_unroll;
+		y1 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	if ( n_left > 0 )
+		BLIS_SROTMV_KERNEL_REF( n_left, h_full, x1, 1, y1, 1, cntx );
+}
+
+
+void bli_drotmv_opt_var1
+     (
+       dim_t            n,
+       double* restrict h,
+       double* restrict x, inc_t incx,
+       double* restrict y, inc_t incy,
+       cntx_t*          cntx
+     )
+{
+	const dim_t n_elem_per_reg = 4;
+	const dim_t n_iter_unroll  = 4;
+
+	dim_t       i;
+	dim_t       n_run;
+	dim_t       n_left;
+
+	double*     x1;
+	double*     y1;
+
+	double      flag;
+	double      h_full[ 5 ];
+
+	__m256d     h11v, h21v, h12v, h22v;
+	__m256d     x0v, x1v, x2v, x3v;
+	__m256d     y0v, y1v, y2v, y3v;
+	__m256d     t0v, t1v, t2v, t3v;
+
+
+	if ( bli_zero_dim1( n ) ) return;
+
+	flag = h[0];
+
+	if ( flag == -2.0 ) return;
+
+	if ( incx != 1 || incy != 1 )
+	{
+		BLIS_DROTMV_KERNEL_REF( n, h, x, incx, y, incy, cntx );
+		return;
+	}
+
+	// Expand H so that the edge case below can use the full form.
+	h_full[0] = -1.0;
+	if      ( flag < 0.0 )  { h_full[1] = h[1]; h_full[2] = h[2]; h_full[3] = h[3]; h_full[4] = h[4]; }
+	else if ( flag == 0.0 ) { h_full[1] = 1.0;  h_full[2] = h[2]; h_full[3] = h[3]; h_full[4] = 1.0;  }
+	else                    { h_full[1] = h[1]; h_full[2] = -1.0; h_full[3] = 1.0;  h_full[4] = h[4]; }
+
+	n_run  = n / ( n_elem_per_reg * n_iter_unroll );
+	n_left = n % ( n_elem_per_reg * n_iter_unroll );
+
+	x1 = x;
+	y1 = y;
+
+	h11v = _mm256_broadcast_sd( &h_full[1] );
+	h21v = _mm256_broadcast_sd( &h_full[2] );
+	h12v = _mm256_broadcast_sd( &h_full[3] );
+	h22v = _mm256_broadcast_sd( &h_full[4] );
+
+	for ( i = 0; i < n_run; ++i )
+	{
+		x0v = _mm256_loadu_pd( x1 +  0 );
+		x1v = _mm256_loadu_pd( x1 +  4 );
+		x2v = _mm256_loadu_pd( x1 +  8 );
+		x3v = _mm256_loadu_pd( x1 + 12 );
+		y0v = _mm256_loadu_pd( y1 +  0 );
+		y1v = _mm256_loadu_pd( y1 +  4 );
+		y2v = _mm256_loadu_pd( y1 +  8 );
+		y3v = _mm256_loadu_pd( y1 + 12 );
+
+		// x := h11 * x + h12 * y;
+		t0v = _mm256_fmadd_pd( h11v, x0v, _mm256_mul_pd( h12v, y0v ) );
+		t1v = _mm256_fmadd_pd( h11v, x1v, _mm256_mul_pd( h12v, y1v ) );
+		t2v = _mm256_fmadd_pd( h11v, x2v, _mm256_mul_pd( h12v, y2v ) );
+		t3v = _mm256_fmadd_pd( h11v, x3v, _mm256_mul_pd( h12v, y3v ) );
+
+		// y := h21 * x + h22 * y;
+		y0v = _mm256_fmadd_pd( h21v, x0v, _mm256_mul_pd( h22v, y0v ) );
+		y1v = _mm256_fmadd_pd( h21v, x1v, _mm256_mul_pd( h22v, y1v ) );
+		y2v = _mm256_fmadd_pd( h21v, x2v, _mm256_mul_pd( h22v, y2v ) );
+		y3v = _mm256_fmadd_pd( h21v, x3v, _mm256_mul_pd( h22v, y3v ) );
+
+		_mm256_storeu_pd( x1 +  0, t0v );
+		_mm256_storeu_pd( x1 +  4, t1v );
+		_mm256_storeu_pd( x1 +  8, t2v );
+		_mm256_storeu_pd( x1 + 12, t3v );
+		_mm256_storeu_pd( y1 +  0, y0v );
+		_mm256_storeu_pd( y1 +  4, y1v );
+		_mm256_storeu_pd( y1 +  8, y2v );
+		_mm256_storeu_pd( y1 + 12, y3v );
+
+		x1 += n_elem_per_reg * n_iter_unroll;
+		y1 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	if ( n_left > 0 )
+		BLIS_DROTMV_KERNEL_REF( n_left, h_full, x1, 1, y1, 1, cntx );
+}
+
+
+void bli_crotmv_opt_var1
+     (
+       dim_t              n,
+       float*    restrict h,
+       scomplex* restrict x, inc_t incx,
+       scomplex* restrict y, inc_t incy,
+       cntx_t*            cntx
+     )
+{
+	if ( incx != 1 || incy != 1 )
+	{
+		BLIS_CROTMV_KERNEL_REF( n, h, x, incx, y, incy, cntx );
+		return;
+	}
+
+	bli_srotmv_opt_var1( 2*n, h, ( float* )x, 1, ( float* )y, 1, cntx );
+}
+
+
+void bli_zrotmv_opt_var1
+     (
+       dim_t              n,
+       double*   restrict h,
+       dcomplex* restrict x, inc_t incx,
+       dcomplex* restrict y, inc_t incy,
+       cntx_t*            cntx
+     )
+{
+	if ( incx != 1 || incy != 1 )
+	{
+		BLIS_ZROTMV_KERNEL_REF( n, h, x, incx, y, incy, cntx );
+		return;
+	}
+
+	bli_drotmv_opt_var1( 2*n, h, ( double* )x, 1, ( double* )y, 1, cntx );
+}
+
@@ -0,0 +1,380 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include "immintrin.h"
+
+
+// The kernels below apply the rotation with unaligned AVX2/FMA loads and
+// stores when x and y are unit-stride, and fall back to the reference
+// implementation otherwise. In the complex domain, a real s reduces the
+// rotation to the real case on 2n elements.
+
+void bli_srotv_opt_var1
+     (
+       dim_t           n,
+       float* restrict c,
+       float* restrict s,
+       float* restrict x, inc_t incx,
+       float* restrict y, inc_t incy,
+       cntx_t*         cntx
+     )
+{
+	const dim_t n_elem_per_reg = 8;
+	const dim_t n_iter_unroll  = 4;
+
+	dim_t       i;
+	dim_t       n_run;
+	dim_t       n_left;
+
+	float*      x1;
+	float*      y1;
+
+	__m256      cv, sv;
+	__m256      x0v, x1v, x2v, x3v;
+	__m256      y0v, y1v, y2v, y3v;
+	__m256      t0v, t1v, t2v, t3v;
+
+
+	if ( bli_zero_dim1( n ) ) return;
+
+	if ( incx != 1 || incy != 1 )
+	{
+		BLIS_SROTV_KERNEL_REF( n, c, s, x, incx, y, incy, cntx );
+		return;
+	}
+
+	n_run  = n / ( n_elem_per_reg * n_iter_unroll );
+	n_left = n % ( n_elem_per_reg * n_iter_unroll );
+
+	x1 = x;
+	y1 = y;
+
+	cv = _mm256_broadcast_ss( c );
+	sv = _mm256_broadcast_ss( s );
+
+	for ( i = 0; i < n_run; ++i )
+	{
+		x0v = _mm256_loadu_ps( x1 +  0 );
+		x1v = _mm256_loadu_ps( x1 +  8 );
+		x2v = _mm256_loadu_ps( x1 + 16 );
+		x3v = _mm256_loadu_ps( x1 + 24 );
+		y0v = _mm256_loadu_ps( y1 +  0 );
+		y1v = _mm256_loadu_ps( y1 +  8 );
+		y2v = _mm256_loadu_ps( y1 + 16 );
+		y3v = _mm256_loadu_ps( y1 + 24 );
+
+		// x := c * x + s * y;
+		t0v = _mm256_fmadd_ps( cv, x0v, _mm256_mul_ps( sv, y0v ) );
+		t1v = _mm256_fmadd_ps( cv, x1v, _mm256_mul_ps( sv, y1v ) );
+		t2v = _mm256_fmadd_ps( cv, x2v, _mm256_mul_ps( sv, y2v ) );
+		t3v = _mm256_fmadd_ps( cv, x3v, _mm256_mul_ps( sv, y3v ) );
+
+		// y := c * y - s * x;
+		y0v = _mm256_fnmadd_ps( sv, x0v, _mm256_mul_ps( cv, y0v ) );
+		y1v = _mm256_fnmadd_ps( sv, x1v, _mm256_mul_ps( cv, y1v ) );
+		y2v = _mm256_fnmadd_ps( sv, x2v, _mm256_mul_ps( cv, y2v ) );
+		y3v = _mm256_fnmadd_ps( sv, x3v, _mm256_mul_ps( cv, y3v ) );
+
+		_mm256_storeu_ps( x1 +  0, t0v );
+		_mm256_storeu_ps( x1 +  8, t1v );
+		_mm256_storeu_ps( x1 + 16, t2v );
+		_mm256_storeu_ps( x1 + 24, t3v );
+		_mm256_storeu_ps( y1 +  0, y0v );
+		_mm256_storeu_ps( y1 +  8, y1v );
+		_mm256_storeu_ps( y1 + 16, y2v );
+		_mm256_storeu_ps( y1 + 24, y3v );
+
+		x1 += n_elem_per_reg * n_iter_unroll;
+		y1 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	if ( n_left > 0 )
+		BLIS_SROTV_KERNEL_REF( n_left, c, s, x1, 1, y1, 1, cntx );
+}
+
+
+void bli_drotv_opt_var1
+     (
+       dim_t            n,
+       double* restrict c,
+       double* restrict s,
+       double* restrict x, inc_t incx,
+       double* restrict y, inc_t incy,
+       cntx_t*          cntx
+     )
+{
+	const dim_t n_elem_per_reg = 4;
+	const dim_t n_iter_unroll  = 4;
+
+	dim_t       i;
+	dim_t       n_run;
+	dim_t       n_left;
+
+	double*     x1;
+	double*     y1;
+
+	__m256d     cv, sv;
+	__m256d     x0v, x1v, x2v, x3v;
+	__m256d     y0v, y1v, y2v, y3v;
+	__m256d     t0v, t1v, t2v, t3v;
+
+
+	if ( bli_zero_dim1( n ) ) return;
+
+	if ( incx != 1 || incy != 1 )
+	{
+		BLIS_DROTV_KERNEL_REF( n, c, s, x, incx, y, incy, cntx );
+		return;
+	}
+
+	n_run  = n / ( n_elem_per_reg * n_iter_unroll );
+	n_left = n % ( n_elem_per_reg * n_iter_unroll );
+
+	x1 = x;
+	y1 = y;
+
+	cv = _mm256_broadcast_sd( c );
+	sv = _mm256_broadcast_sd( s );
+
+	for ( i = 0; i < n_run; ++i )
+	{
+		x0v = _mm256_loadu_pd( x1 +  0 );
+		x1v = _mm256_loadu_pd( x1 +  4 );
+		x2v = _mm256_loadu_pd( x1 +  8 );
+		x3v = _mm256_loadu_pd( x1 + 12 );
+		y0v = _mm256_loadu_pd( y1 +  0 );
+		y1v = _mm256_loadu_pd( y1 +  4 );
+		y2v = _mm256_loadu_pd( y1 +  8 );
+		y3v = _mm256_loadu_pd( y1 + 12 );
+
+		// x := c * x + s * y;
+		t0v = _mm256_fmadd_pd( cv, x0v, _mm256_mul_pd( sv, y0v ) );
+		t1v = _mm256_fmadd_pd( cv, x1v, _mm256_mul_pd( sv, y1v ) );
+		t2v = _mm256_fmadd_pd( cv, x2v, _mm256_mul_pd( sv, y2v ) );
+		t3v = _mm256_fmadd_pd( cv, x3v, _mm256_mul_pd( sv, y3v ) );
+
+		// y := c * y - s * x;
+		y0v = _mm256_fnmadd_pd( sv, x0v, _mm256_mul_pd( cv, y0v ) );
+		y1v = _mm256_fnmadd_pd( sv, x1v, _mm256_mul_pd( cv, y1v ) );
+		y2v = _mm256_fnmadd_pd( sv, x2v, _mm256_mul_pd( cv, y2v ) );
+		y3v = _mm256_fnmadd_pd( sv, x3v, _mm256_mul_pd( cv, y3v ) );
+
+		_mm256_storeu_pd( x1 +  0, t0v );
+		_mm256_storeu_pd( x1 +  4, t1v );
+		_mm256_storeu_pd( x1 +  8, t2v );
+		_mm256_storeu_pd( x1 + 12, t3v );
+		_mm256_storeu_pd( y1 +  0, y0v );
+		_mm256_storeu_pd( y1 +  4, y1v );
+		_mm256_storeu_pd( y1 +  8, y2v );
+		_mm256_storeu_pd( y1 + 12, y3v );
+
+		x1 += n_elem_per_reg * n_iter_unroll;
+		y1 += n_elem_per_reg * n_iter_unroll;
+	}
+
+	if ( n_left > 0 )
+		BLIS_DROTV_KERNEL_REF( n_left, c, s, x1, 1, y1, 1, cntx );
+}
+
+
+void bli_crotv_opt_var1
+     (
+       dim_t              n,
+       float*    restrict c,
+       scomplex* restrict s,
+       scomplex* restrict x, inc_t incx,
+       scomplex* restrict y, inc_t incy,
+       cntx_t*            cntx
+     )
+{
+	const dim_t n_elem_per_reg = 4;
+	const dim_t n_iter_unroll  = 2;
+
+	dim_t       i;
+	dim_t       n_run;
+	dim_t       n_left;
+
+	float*      x1;
+	float*      y1;
+
+	__m256      cv, srv, siv;
+	__m256      x0v, x1v, y0v, y1v;
+	__m256      t0v, t1v, u0v, u1v;
+
+
+	if ( bli_zero_dim1( n ) ) return;
+
+	if ( incx != 1 || incy != 1 )
+	{
+		BLIS_CROTV_KERNEL_REF( n, c, s, x, incx, y, incy, cntx );
+		return;
+	}
+
+	// A real s gives the same rotation on the real and imaginary parts.
+	if ( bli_cimag( *s ) == 0.0F )
+	{
+		float s_r = bli_creal( *s );
+
+		bli_srotv_opt_var1( 2*n, c, &s_r, ( float* )x, 1, ( float* )y, 1, cntx );
+		return;
+	}
+
+	n_run  = n / ( n_elem_per_reg * n_iter_unroll );
+	n_left = n % ( n_elem_per_reg * n_iter_unroll );
+
+	x1 = ( float* )x;
+	y1 = ( float* )y;
+
+	cv  = _mm256_broadcast_ss( c );
+	srv = _mm256_broadcast_ss( &bli_creal( *s ) );
+	siv = _mm256_broadcast_ss( &bli_cimag( *s ) );
+
+	for ( i = 0; i < n_run; ++i )
+	{
+		x0v = _mm256_loadu_ps( x1 + 0 );
+		x1v = _mm256_loadu_ps( x1 + 8 );
+		y0v = _mm256_loadu_ps( y1 + 0 );
+		y1v = _mm256_loadu_ps( y1 + 8 );
+
+		// t := s * y; u := conj(s) * x;
+		t0v = _mm256_fmaddsub_ps( srv, y0v, _mm256_mul_ps( siv, _mm256_permute_ps( y0v, 0xB1 ) ) );
+		t1v = _mm256_fmaddsub_ps( srv, y1v, _mm256_mul_ps( siv, _mm256_permute_ps( y1v, 0xB1 ) ) );
+		u0v = _mm256_fmsubadd_ps( srv, x0v, _mm256_mul_ps( siv, _mm256_permute_ps( x0v, 0xB1 ) ) );
+		u1v = _mm256_fmsubadd_ps( srv, x1v, _mm256_mul_ps( siv, _mm256_permute_ps( x1v, 0xB1 ) ) );
+
+		// x := c * x + t; y := c * y - u;
+		x0v = _mm256_fmadd_ps( cv, x0v, t0v );
+		x1v = _mm256_fmadd_ps( cv, x1v, t1v );
+		y0v = _mm256_fmsub_ps( cv, y0v, u0v );
+		y1v = _mm256_fmsub_ps( cv, y1v, u1v );
+
+		_mm256_storeu_ps( x1 + 0, x0v );
+		_mm256_storeu_ps( x1 + 8, x1v );
+		_mm256_storeu_ps( y1 + 0, y0v );
+		_mm256_storeu_ps( y1 + 8, y1v );
+
+		x1 += 2 * n_elem_per_reg * n_iter_unroll;
+		y1 += 2 * n_elem_per_reg * n_iter_unroll;
+	}
+
+	if ( n_left > 0 )
+		BLIS_CROTV_KERNEL_REF( n_left, c, s, ( scomplex* )x1, 1, ( scomplex* )y1, 1, cntx );
+}
+
+
+void bli_zrotv_opt_var1
+     (
+       dim_t              n,
+       double*   restrict c,
+       dcomplex* restrict s,
+       dcomplex* restrict x, inc_t incx,
+       dcomplex* restrict y, inc_t incy,
+       cntx_t*            cntx
+     )
+{
+	const dim_t n_elem_per_reg = 2;
+	const dim_t n_iter_unroll  = 2;
+
+	dim_t       i;
+	dim_t       n_run;
+	dim_t       n_left;
+
+	double*     x1;
+	double*     y1;
+
+	__m256d     cv, srv, siv;
+	__m256d     x0v, x1v, y0v, y1v;
+	__m256d     t0v, t1v, u0v, u1v;
+
+
+	if ( bli_zero_dim1( n ) ) return;
+
+	if ( incx != 1 || incy != 1 )
+	{
+		BLIS_ZROTV_KERNEL_REF( n, c, s, x, incx, y, incy, cntx );
+		return;
+	}
+
+	// A real s gives the same rotation on the real and imaginary parts.
+	if ( bli_zimag( *s ) == 0.0 )
+	{
+		double s_r = bli_zreal( *s );
+
+		bli_drotv_opt_var1( 2*n, c, &s_r, ( double* )x, 1, ( double* )y, 1, cntx );
+		return;
+	}
+
+	n_run  = n / ( n_elem_per_reg * n_iter_unroll );
+	n_left = n % ( n_elem_per_reg * n_iter_unroll );
+
+	x1 = ( double* )x;
+	y1 = ( double* )y;
+
+	cv  = _mm256_broadcast_sd( c );
+	srv = _mm256_broadcast_sd( &bli_zreal( *s ) );
+	siv = _mm256_broadcast_sd( &bli_zimag( *s ) );
+
+	for ( i = 0; i < n_run; ++i )
+	{
+		x0v = _mm256_loadu_pd( x1 + 0 );
+		x1v = _mm256_loadu_pd( x1 + 4 );
+		y0v = _mm256_loadu_pd( y1 + 0 );
+		y1v = _mm256_loadu_pd( y1 + 4 );
+
+		// t := s * y; u := conj(s) * x;
+		t0v = _mm256_fmaddsub_pd( srv, y0v, _mm256_mul_pd( siv, _mm256_permute_pd( y0v, 0x5 ) ) );
+		t1v = _mm256_fmaddsub_pd( srv, y1v, _mm256_mul_pd( siv, _mm256_permute_pd( y1v, 0x5 ) ) );
+		u0v = _mm256_fmsubadd_pd( srv, x0v, _mm256_mul_pd( siv, _mm256_permute_pd( x0v, 0x5 ) ) );
+		u1v = _mm256_fmsubadd_pd( srv, x1v, _mm256_mul_pd( siv, _mm256_permute_pd( x1v, 0x5 ) ) );
+
+		// x := c * x + t; y := c * y - u;
+		x0v = _mm256_fmadd_pd( cv, x0v, t0v );
+		x1v = _mm256_fmadd_pd( cv, x1v, t1v );
+		y0v = _mm256_fmsub_pd( cv, y0v, u0v );
+		y1v = _mm256_fmsub_pd( cv, y1v, u1v );
+
+		_mm256_storeu_pd( x1 + 0, x0v );
+		_mm256_storeu_pd( x1 + 4, x1v );
+		_mm256_storeu_pd( y1 + 0, y0v );
+		_mm256_storeu_pd( y1 + 4, y1v );
+
+		x1 += 2 * n_elem_per_reg * n_iter_unroll;
+		y1 += 2 * n_elem_per_reg * n_iter_unroll;
+	}
+
+	if ( n_left > 0 )
+		BLIS_ZROTV_KERNEL_REF( n_left, c, s, ( dcomplex* )x1, 1, ( dcomplex* )y1, 1, cntx );
+}
+
@@ -0,0 +1,227 @@
+/*
+
+   BLIS    
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include "immintrin.h"
+
+
+// A 16x4 gemmsup kernel for single-precision real operands. A and B are
+// read in place: columns of A are loaded with (masked) AVX2 loads and
+// elements of B are broadcast, so any stride of B is acceptable. If A does
+// not have unit row stride, it is first copied into a small column-stored
+// buffer on the stack; if that buffer is too small, the reference kernel
+// is used instead.
+
+#define BLIS_SGEMMSUP_OPT_MR      16
+#define BLIS_SGEMMSUP_OPT_NR      4
+#define BLIS_SGEMMSUP_OPT_A_ELEMS ( 64 * 64 )
+
+// Lane masks for m_cur < MR: loading from sgemmsup_mask + MR - m_cur sets
+// the first m_cur lanes.
+static const int32_t sgemmsup_mask[ 2 * BLIS_SGEMMSUP_OPT_MR ] =
+{
+	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+};
+
+void bli_sgemmsup_opt_16x4
+     (
+       conj_t            conja,
+       conj_t            conjb,
+       dim_t             m,
+       dim_t             n,
+       dim_t             k,
+       float*   restrict alpha,
+       float*   restrict a, inc_t rs_a, inc_t cs_a,
+       float*   restrict b, inc_t rs_b, inc_t cs_b,
+       float*   restrict beta,
+       float*   restrict c, inc_t rs_c, inc_t cs_c
+     )
+{
+	const dim_t mr = BLIS_SGEMMSUP_OPT_MR;
+	const dim_t nr = BLIS_SGEMMSUP_OPT_NR;
+
+	float       a_local[ BLIS_SGEMMSUP_OPT_A_ELEMS ];
+	float       ab[ BLIS_SGEMMSUP_OPT_MR * BLIS_SGEMMSUP_OPT_NR ];
+
+	dim_t       i, j, ii, jj, l;
+
+	if ( rs_a != 1 )
+	{
+		if ( m * k > BLIS_SGEMMSUP_OPT_A_ELEMS )
+		{
+			bli_sgemmsup_ref( conja, conjb, m, n, k,
+			                  alpha, a, rs_a, cs_a, b, rs_b, cs_b,
+			                  beta, c, rs_c, cs_c );
+			return;
+		}
+
+		for ( l = 0; l < k; ++l )
+		for ( i = 0; i < m; ++i )
+			a_local[ i + l*m ] = a[ i*rs_a + l*cs_a ];
+
+		a    = a_local;
+		rs_a = 1;
+		cs_a = m;
+	}
+
+	const bool_t  beta_is_zero = bli_seq0( *beta );
+	const __m256 alphav       = _mm256_broadcast_ss( alpha );
+	const __m256 betav        = _mm256_broadcast_ss( beta );
+
+	for ( j = 0; j < n; j += nr )
+	{
+		const dim_t n_cur = bli_min( nr, n - j );
+
+		// Columns of B beyond n_cur alias the first column so that the
+		// broadcasts below stay in bounds; their results are discarded.
+		const float* restrict b0 = b + ( j + 0 )*cs_b;
+		const float* restrict b1 = b + ( j + ( n_cur > 1 ? 1 : 0 ) )*cs_b;
+		const float* restrict b2 = b + ( j + ( n_cur > 2 ? 2 : 0 ) )*cs_b;
+		const float* restrict b3 = b + ( j + ( n_cur > 3 ? 3 : 0 ) )*cs_b;
+
+		for ( i = 0; i < m; i += mr )
+		{
+			const dim_t m_cur = bli_min( mr, m - i );
+
+			const float* restrict ap = a + i;
+
+			__m256 c00 = _mm256_setzero_ps(), c80 = _mm256_setzero_ps();
+			__m256 c01 = _mm256_setzero_ps(), c81 = _mm256_setzero_ps();
+			__m256 c02 = _mm256_setzero_ps(), c82 = _mm256_setzero_ps();
+			__m256 c03 = _mm256_setzero_ps(), c83 = _mm256_setzero_ps();
+			__m256 a0, a8, bv;
+
+			if ( m_cur == mr )
+			{
+				for ( l = 0; l < k; ++l )
+				{
+					a0 = _mm256_loadu_ps( ap + l*cs_a + 0 );
+					a8 = _mm256_loadu_ps( ap + l*cs_a + 8 );
+
+					bv  = _mm256_broadcast_ss( b0 + l*rs_b );
+					c00 = _mm256_fmadd_ps( a0, bv, c00 );
+					c80 = _mm256_fmadd_ps( a8, bv, c80 );
+					bv  = _mm256_broadcast_ss( b1 + l*rs_b );
+					c01 = _mm256_fmadd_ps( a0, bv, c01 );
+					c81 = _mm256_fmadd_ps( a8, bv, c81 );
+					bv  = _mm256_broadcast_ss( b2 + l*rs_b );
+					c02 = _mm256_fmadd_ps( a0, bv, c02 );
+					c82 = _mm256_fmadd_ps( a8, bv, c82 );
+					bv  = _mm256_broadcast_ss( b3 + l*rs_b );
+					c03 = _mm256_fmadd_ps( a0, bv, c03 );
+					c83 = _mm256_fmadd_ps( a8, bv, c83 );
+				}
+			}
+			else
+			{
+				const __m256i m0 = _mm256_loadu_si256( ( __m256i* )( sgemmsup_mask + mr - m_cur ) );
+				const __m256i m8 = _mm256_loadu_si256( ( __m256i* )( sgemmsup_mask + mr - m_cur + 8 ) );
+
+				for ( l = 0; l < k; ++l )
+				{
+					a0 = _mm256_maskload_ps( ap + l*cs_a + 0, m0 );
+					a8 = _mm256_maskload_ps( ap + l*cs_a + 8, m8 );
+
+					bv  = _mm256_broadcast_ss( b0 + l*rs_b );
+					c00 = _mm256_fmadd_ps( a0, bv, c00 );
+					c80 = _mm256_fmadd_ps( a8, bv, c80 );
+					bv  = _mm256_broadcast_ss( b1 + l*rs_b );
+					c01 = _mm256_fmadd_ps( a0, bv, c01 );
+					c81 = _mm256_fmadd_ps( a8, bv, c81 );
+					bv  = _mm256_broadcast_ss( b2 + l*rs_b );
+					c02 = _mm256_fmadd_ps( a0, bv, c02 );
+					c82 = _mm256_fmadd_ps( a8, bv, c82 );
+					bv  = _mm256_broadcast_ss( b3 + l*rs_b );
+					c03 = _mm256_fmadd_ps( a0, bv, c03 );
+					c83 = _mm256_fmadd_ps( a8, bv, c83 );
+				}
+			}
+
+			c00 = _mm256_mul_ps( alphav, c00 ); c80 = _mm256_mul_ps( alphav, c80 );
+			c01 = _mm256_mul_ps( alphav, c01 ); c81 = _mm256_mul_ps( alphav, c81 );
+			c02 = _mm256_mul_ps( alphav, c02 ); c82 = _mm256_mul_ps( alphav, c82 );
+			c03 = _mm256_mul_ps( alphav, c03 ); c83 = _mm256_mul_ps( alphav, c83 );
+
+			float* restrict cp = c + i*rs_c + j*cs_c;
+
+			if ( rs_c == 1 && m_cur == mr && n_cur == nr )
+			{
+				if ( !beta_is_zero )
+				{
+					c00 = _mm256_fmadd_ps( betav, _mm256_loadu_ps( cp + 0*cs_c + 0 ), c00 );
+					c80 = _mm256_fmadd_ps( betav, _mm256_loadu_ps( cp + 0*cs_c + 8 ), c80 );
+					c01 = _mm256_fmadd_ps( betav, _mm256_loadu_ps( cp + 1*cs_c + 0 ), c01 );
+					c81 = _mm256_fmadd_ps( betav, _mm256_loadu_ps( cp + 1*cs_c + 8 ), c81 );
+					c02 = _mm256_fmadd_ps( betav, _mm256_loadu_ps( cp + 2*cs_c + 0 ), c02 );
+					c82 = _mm256_fmadd_ps( betav, _mm256_loadu_ps( cp + 2*cs_c + 8 ), c82 );
+					c03 = _mm256_fmadd_ps( betav, _mm256_loadu_ps( cp + 3*cs_c + 0 ), c03 );
+					c83 = _mm256_fmadd_ps( betav, _mm256_loadu_ps( cp + 3*cs_c + 8 ), c83 );
+				}
+
+				_mm256_storeu_ps( cp + 0*cs_c + 0, c00 );
+				_mm256_storeu_ps( cp + 0*cs_c + 8, c80 );
+				_mm256_storeu_ps( cp + 1*cs_c + 0, c01 );
+				_mm256_storeu_ps( cp + 1*cs_c + 8, c81 );
+				_mm256_storeu_ps( cp + 2*cs_c + 0, c02 );
+				_mm256_storeu_ps( cp + 2*cs_c + 8, c82 );
+				_mm256_storeu_ps( cp + 3*cs_c + 0, c03 );
+				_mm256_storeu_ps( cp + 3*cs_c + 8, c83 );
+			}
+			else
+			{
+				// Edge tiles and non-unit row strides of C are updated
+				// element-wise from a copy of the accumulators.
+				_mm256_storeu_ps( ab + 0*mr + 0, c00 );
+				_mm256_storeu_ps( ab + 0*mr + 8, c80 );
+				_mm256_storeu_ps( ab + 1*mr + 0, c01 );
+				_mm256_storeu_ps( ab + 1*mr + 8, c81 );
+				_mm256_storeu_ps( ab + 2*mr + 0, c02 );
+				_mm256_storeu_ps( ab + 2*mr + 8, c82 );
+				_mm256_storeu_ps( ab + 3*mr + 0, c03 );
+				_mm256_storeu_ps( ab + 3*mr + 8, c83 );
+
+				for ( jj = 0; jj < n_cur; ++jj )
+				for ( ii = 0; ii < m_cur; ++ii )
+				{
+					float* restrict cij = cp + ii*rs_c + jj*cs_c;
+
+					if ( beta_is_zero ) *cij = ab[ ii + jj*mr ];
+					else                *cij = ab[ ii + jj*mr ] + (*beta) * (*cij);
+				}
+			}
+		}
+	}
+}
+
@@ -0,0 +1 @@
+../../haswell/1/bli_rotv_opt_var1.c
\ No newline at end of file
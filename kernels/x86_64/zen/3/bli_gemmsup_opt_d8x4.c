@@ -0,0 +1 @@
+../../haswell/3/bli_gemmsup_opt_d8x4.c
\ No newline at end of file
@@ -0,0 +1,172 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <pthread.h>
+#include "blis.h"
+
+// This driver measures the latency of the thread communicator barrier. For
+// each thread count, a team of pthreads executes a sequence of barriers on
+// a single communicator, and the average time per barrier is reported for
+// several spin counts (the number of polls a waiting thread makes before it
+// goes to sleep). A spin count of zero always sleeps. For example:
+//
+//   ./test_barrier.x [n_iter]
+//
+// The barrier implementation is chosen when BLIS is configured; building
+// BLIS with -DBLIS_USE_CENTRAL_BARRIER gives the previous centralized
+// barrier for comparison. The thread counts are most meaningful when they
+// do not exceed the number of available cores.
+
+#ifndef P_BEGIN
+#define P_BEGIN 2
+#endif
+#ifndef P_END
+#define P_END   16
+#endif
+#ifndef P_INC
+#define P_INC   1
+#endif
+#ifndef N_ITER
+#define N_ITER  10000
+#endif
+
+#ifdef BLIS_ENABLE_PTHREADS
+
+typedef struct
+{
+	thrcomm_t* comm;
+	dim_t      id;
+	dim_t      n_iter;
+	double     dtime;
+} barrier_data_t;
+
+static void* barrier_loop( void* data_void )
+{
+	barrier_data_t* data = data_void;
+	thrcomm_t*      comm = data->comm;
+	dim_t           id   = data->id;
+	dim_t           i;
+	double          dtime;
+
+	// Line the threads up before starting the clock.
+	bli_thrcomm_barrier( comm, id );
+
+	dtime = bli_clock();
+
+	for ( i = 0; i < data->n_iter; ++i )
+		bli_thrcomm_barrier( comm, id );
+
+	data->dtime = bli_clock() - dtime;
+
+	return NULL;
+}
+
+int main( int argc, char** argv )
+{
+	dim_t           spins[] = { 0, 1000, BLIS_BARRIER_SPIN_COUNT };
+	dim_t           n_spins = sizeof( spins ) / sizeof( spins[0] );
+	dim_t           spin_save;
+	dim_t           p, s, t;
+	dim_t           n_iter;
+	thrcomm_t*      comm;
+	pthread_t*      threads;
+	barrier_data_t* data;
+
+	bli_init();
+
+	n_iter    = ( argc > 1 ? atol( argv[1] ) : N_ITER );
+	spin_save = bli_thrcomm_get_spin_count();
+
+	printf( "%% columns: threads, spin count, usec per barrier\n" );
+
+	for ( s = 0; s < n_spins; ++s )
+	{
+		bli_thrcomm_set_spin_count( spins[s] );
+
+		for ( p = P_BEGIN; p <= P_END; p += P_INC )
+		{
+			double dtime_max = 0.0;
+
+			comm    = bli_thrcomm_create( p );
+			threads = bli_malloc_user( p * sizeof( pthread_t ) );
+			data    = bli_malloc_user( p * sizeof( barrier_data_t ) );
+
+			for ( t = 0; t < p; ++t )
+			{
+				data[t].comm   = comm;
+				data[t].id     = t;
+				data[t].n_iter = n_iter;
+			}
+
+			for ( t = 1; t < p; ++t )
+				pthread_create( &threads[t], NULL, barrier_loop, &data[t] );
+
+			barrier_loop( &data[0] );
+
+			for ( t = 1; t < p; ++t )
+				pthread_join( threads[t], NULL );
+
+			for ( t = 0; t < p; ++t )
+				dtime_max = bli_max( dtime_max, data[t].dtime );
+
+			printf( "data_barrier( %2lu, 1:3 ) = [ %3lu %7lu  %10.3f ];\n",
+			        ( unsigned long )( s * ( ( P_END - P_BEGIN ) / P_INC + 1 ) +
+			                           ( p - P_BEGIN ) / P_INC + 1 ),
+			        ( unsigned long )p,
+			        ( unsigned long )spins[s],
+			        1.0e6 * dtime_max / n_iter );
+
+			bli_free_user( data );
+			bli_free_user( threads );
+			bli_thrcomm_free( comm );
+		}
+	}
+
+	bli_thrcomm_set_spin_count( spin_save );
+
+	bli_finalize();
+
+	return 0;
+}
+
+#else
+
+int main( int argc, char** argv )
+{
+	printf( "test_barrier.x requires BLIS to be configured with pthreads.\n" );
+
+	return 0;
+}
+
+#endif
@@ -0,0 +1,910 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <unistd.h>
+#include "blis.h"
+
+// This driver benchmarks the level-1v, level-2 and level-3 operations over
+// sweeps of problem size, aspect ratio, storage and thread count, and
+// writes one CSV or JSON record per measurement. For example:
+//
+//   ./test_bench.x -l gemm,trsm,gemv -d dz -S col,row -t 1,2,4 > run.csv
+//   ./test_bench.x ... -b baseline.csv -T 5
+//
+// Options (defaults in brackets):
+//   -l  operations, or l1, l2, l3 or all                        [all]
+//   -d  datatypes, as a string of s, d, c and z characters      [d]
+//   -s  aspect ratios: square (m = n = k = p), tall (n = p/8),
+//       wide (m = p/8) and smallk (k = p/8)                      [all]
+//   -S  storage: col, row or gen (non-unit row and column strides) [col]
+//   -t  thread counts, applied through BLIS_NUM_THREADS     [environment]
+//   -p  problem sizes as begin:end:inc                    [P_BEGIN..P_END]
+//   -r  number of repeats; the best time is reported             [N_REPEATS]
+//   -o  output format, csv or json                                [csv]
+//   -g  clock rate in GHz used by the peak model   [BLIS_BENCH_GHZ or
+//                                                   /proc/cpuinfo]
+//   -b  baseline CSV file written by an earlier run
+//   -T  regression threshold in percent                           [5]
+//   -c  also count hardware events (Linux perf_event_open)
+//
+// Each record gives the best time, GFLOPS, the percentage of theoretical
+// peak and the parallel efficiency relative to the first thread count of
+// the sweep. The peak is threads * GHz * 2 * BLIS_SIMD_FMA_PER_CYCLE *
+// BLIS_SIMD_SIZE / sizeof( real datatype ), as set by the configuration.
+// Level-1v operations run on vectors of length p * p (the footprint of the
+// level-2 matrices) and only in the square shape. Aspect ratios that do
+// not change the dimensions of an operation are skipped.
+//
+// With -b, every record that also appears in the baseline (same operation,
+// datatype, shape, storage, threads and dimensions) is compared against it.
+// A record whose GFLOPS fall more than the threshold below the baseline is
+// marked as a regression, and the driver exits with status 2 if any were
+// found.
+//
+// With -c, each record also gives the cycles, instructions, instructions
+// per cycle, and L1D, L2, LLC and dTLB misses per execution, averaged over
+// the repeats and summed over threads. The counters are inherited by the
+// threads that BLIS creates with pthreads, but not by threads of an OpenMP
+// pool that already exist; for those (and for a breakdown by phase and by
+// thread) configure with --enable-profiling and set BLIS_PROF_PERF and
+// BLIS_PROF_DUMP. Events that cannot be counted are left empty (null).
+
+#ifndef P_BEGIN
+#define P_BEGIN   200
+#endif
+#ifndef P_END
+#define P_END     2000
+#endif
+#ifndef P_INC
+#define P_INC     200
+#endif
+#ifndef N_REPEATS
+#define N_REPEATS 3
+#endif
+
+#define BENCH_ASPECT   8
+#define MAX_THREADS    32
+#define MAX_LINE       1024
+
+typedef enum
+{
+	OP_AXPYV = 0, OP_DOTV, OP_SCALV,
+	OP_GEMV, OP_GER, OP_HEMV, OP_SYMV, OP_HER, OP_SYR, OP_HER2, OP_SYR2,
+	OP_TRMV, OP_TRSV,
+	OP_GEMM, OP_HEMM, OP_SYMM, OP_HERK, OP_SYRK, OP_HER2K, OP_SYR2K,
+	OP_TRMM, OP_TRSM,
+	OP_NUM
+} op_t;
+
+typedef struct
+{
+	char*  name;
+	dim_t  level;
+	bool_t uses_n;
+	bool_t uses_k;
+} op_info_t;
+
+static op_info_t op_info[ OP_NUM ] =
+{
+	{ "axpyv", 1, FALSE, FALSE },
+	{ "dotv",  1, FALSE, FALSE },
+	{ "scalv", 1, FALSE, FALSE },
+	{ "gemv",  2, TRUE,  FALSE },
+	{ "ger",   2, TRUE,  FALSE },
+	{ "hemv",  2, FALSE, FALSE },
+	{ "symv",  2, FALSE, FALSE },
+	{ "her",   2, FALSE, FALSE },
+	{ "syr",   2, FALSE, FALSE },
+	{ "her2",  2, FALSE, FALSE },
+	{ "syr2",  2, FALSE, FALSE },
+	{ "trmv",  2, FALSE, FALSE },
+	{ "trsv",  2, FALSE, FALSE },
+	{ "gemm",  3, TRUE,  TRUE  },
+	{ "hemm",  3, TRUE,  FALSE },
+	{ "symm",  3, TRUE,  FALSE },
+	{ "herk",  3, FALSE, TRUE  },
+	{ "syrk",  3, FALSE, TRUE  },
+	{ "her2k", 3, FALSE, TRUE  },
+	{ "syr2k", 3, FALSE, TRUE  },
+	{ "trmm",  3, TRUE,  FALSE },
+	{ "trsm",  3, TRUE,  FALSE },
+};
+
+typedef enum { SHAPE_SQUARE = 0, SHAPE_TALL, SHAPE_WIDE, SHAPE_SMALLK, SHAPE_NUM } shape_t;
+typedef enum { STOR_COL = 0, STOR_ROW, STOR_GEN, STOR_NUM } stor_t;
+
+static char* shape_str[ SHAPE_NUM ] = { "square", "tall", "wide", "smallk" };
+static char* stor_str[ STOR_NUM ]   = { "col", "row", "gen" };
+
+typedef struct
+{
+	obj_t  a, b, c, x, y;
+	obj_t  alpha, rho;
+	obj_t  out_save;
+	obj_t* out;
+	double flops;
+} bench_data_t;
+
+typedef struct
+{
+	char   key[ 128 ];
+	double gflops;
+} base_rec_t;
+
+typedef struct
+{
+	bool_t      json;
+	bool_t      first;
+	double      ghz;
+	base_rec_t* base;
+	dim_t       n_base;
+	double      thresh;
+	dim_t       n_compared;
+	dim_t       n_regress;
+	bool_t      count;
+	perfctr_t   ctr;
+} bench_out_t;
+
+
+static void create_matrix( num_t dt, dim_t m, dim_t n, stor_t stor, obj_t* a )
+{
+	if      ( stor == STOR_ROW ) bli_obj_create( dt, m, n, n, 1, a );
+	else if ( stor == STOR_GEN ) bli_obj_create( dt, m, n, 2, 2 * m, a );
+	else                         bli_obj_create( dt, m, n, 1, m, a );
+
+	bli_randm( a );
+}
+
+static void create_vector( num_t dt, dim_t n, stor_t stor, obj_t* x )
+{
+	if ( stor == STOR_GEN ) bli_obj_create( dt, n, 1, 2, 2 * n, x );
+	else                    bli_obj_create( dt, n, 1, 1, n, x );
+
+	bli_randv( x );
+}
+
+// Make a a lower triangular matrix that stays well-conditioned for solves.
+static void make_triangular( obj_t* a )
+{
+	obj_t scale;
+
+	bli_obj_scalar_init_detached( bli_obj_datatype( *a ), &scale );
+	bli_setsc( 1.0 / bli_obj_length( *a ), 0.0, &scale );
+	bli_scalm( &scale, a );
+	bli_setd( &BLIS_ONE, a );
+
+	bli_obj_set_struc( BLIS_TRIANGULAR, *a );
+	bli_obj_set_uplo( BLIS_LOWER, *a );
+}
+
+static void make_struc( struc_t struc, obj_t* a )
+{
+	bli_obj_set_struc( struc, *a );
+	bli_obj_set_uplo( BLIS_LOWER, *a );
+}
+
+static void bench_create( op_t op, num_t dt, dim_t m, dim_t n, dim_t k,
+                          stor_t stor, bench_data_t* d )
+{
+	bli_obj_scalar_init_detached( dt, &d->alpha );
+	bli_obj_scalar_init_detached( dt, &d->rho );
+	bli_setsc( ( op == OP_SCALV ? 0.5 : 1.0 ), 0.0, &d->alpha );
+
+	switch ( op )
+	{
+		case OP_AXPYV:
+		case OP_DOTV:
+		create_vector( dt, m, stor, &d->x );
+		create_vector( dt, m, stor, &d->y );
+		d->out   = ( op == OP_AXPYV ? &d->y : NULL );
+		d->flops = 2.0 * m;
+		break;
+
+		case OP_SCALV:
+		create_vector( dt, m, stor, &d->x );
+		d->out   = &d->x;
+		d->flops = 1.0 * m;
+		break;
+
+		case OP_GEMV:
+		create_matrix( dt, m, n, stor, &d->a );
+		create_vector( dt, n, stor, &d->x );
+		create_vector( dt, m, stor, &d->y );
+		d->out   = &d->y;
+		d->flops = 2.0 * m * n;
+		break;
+
+		case OP_GER:
+		create_vector( dt, m, stor, &d->x );
+		create_vector( dt, n, stor, &d->y );
+		create_matrix( dt, m, n, stor, &d->a );
+		d->out   = &d->a;
+		d->flops = 2.0 * m * n;
+		break;
+
+		case OP_HEMV:
+		case OP_SYMV:
+		create_matrix( dt, m, m, stor, &d->a );
+		create_vector( dt, m, stor, &d->x );
+		create_vector( dt, m, stor, &d->y );
+		make_struc( ( op == OP_HEMV ? BLIS_HERMITIAN : BLIS_SYMMETRIC ), &d->a );
+		d->out   = &d->y;
+		d->flops = 2.0 * m * m;
+		break;
+
+		case OP_HER:
+		case OP_SYR:
+		case OP_HER2:
+		case OP_SYR2:
+		create_vector( dt, m, stor, &d->x );
+		create_vector( dt, m, stor, &d->y );
+		create_matrix( dt, m, m, stor, &d->a );
+		make_struc( ( op == OP_HER || op == OP_HER2 ? BLIS_HERMITIAN
+		                                            : BLIS_SYMMETRIC ), &d->a );
+		d->out   = &d->a;
+		d->flops = ( op == OP_HER2 || op == OP_SYR2 ? 2.0 : 1.0 ) * m * m;
+		break;
+
+		case OP_TRMV:
+		case OP_TRSV:
+		create_matrix( dt, m, m, stor, &d->a );
+		create_vector( dt, m, stor, &d->x );
+		make_triangular( &d->a );
+		d->out   = &d->x;
+		d->flops = 1.0 * m * m;
+		break;
+
+		case OP_GEMM:
+		create_matrix( dt, m, k, stor, &d->a );
+		create_matrix( dt, k, n, stor, &d->b );
+		create_matrix( dt, m, n, stor, &d->c );
+		d->out   = &d->c;
+		d->flops = 2.0 * m * n * k;
+		break;
+
+		case OP_HEMM:
+		case OP_SYMM:
+		create_matrix( dt, m, m, stor, &d->a );
+		create_matrix( dt, m, n, stor, &d->b );
+		create_matrix( dt, m, n, stor, &d->c );
+		make_struc( ( op == OP_HEMM ? BLIS_HERMITIAN : BLIS_SYMMETRIC ), &d->a );
+		d->out   = &d->c;
+		d->flops = 2.0 * m * m * n;
+		break;
+
+		case OP_HERK:
+		case OP_SYRK:
+		case OP_HER2K:
+		case OP_SYR2K:
+		create_matrix( dt, m, k, stor, &d->a );
+		create_matrix( dt, m, k, stor, &d->b );
+		create_matrix( dt, m, m, stor, &d->c );
+		make_struc( ( op == OP_HERK || op == OP_HER2K ? BLIS_HERMITIAN
+		                                              : BLIS_SYMMETRIC ), &d->c );
+		d->out   = &d->c;
+		d->flops = ( op == OP_HER2K || op == OP_SYR2K ? 2.0 : 1.0 ) * m * m * k;
+		break;
+
+		case OP_TRMM:
+		case OP_TRSM:
+		default:
+		create_matrix( dt, m, m, stor, &d->a );
+		create_matrix( dt, m, n, stor, &d->b );
+		make_triangular( &d->a );
+		d->out   = &d->b;
+		d->flops = 1.0 * m * m * n;
+		break;
+	}
+
+	if ( bli_is_complex( dt ) ) d->flops *= 4.0;
+
+	if ( d->out != NULL )
+	{
+		bli_obj_create( dt, bli_obj_length( *d->out ),
+		                    bli_obj_width( *d->out ), 0, 0, &d->out_save );
+		bli_copym( d->out, &d->out_save );
+	}
+}
+
+static void bench_free( op_t op, bench_data_t* d )
+{
+	dim_t level = op_info[ op ].level;
+
+	if ( level == 1 || level == 2 ) bli_obj_free( &d->x );
+	if ( level == 1 && op != OP_SCALV ) bli_obj_free( &d->y );
+	if ( level == 2 && op != OP_TRMV && op != OP_TRSV ) bli_obj_free( &d->y );
+	if ( level == 2 || level == 3 ) bli_obj_free( &d->a );
+	if ( level == 3 ) bli_obj_free( &d->b );
+	if ( level == 3 && op != OP_TRMM && op != OP_TRSM ) bli_obj_free( &d->c );
+	if ( d->out != NULL ) bli_obj_free( &d->out_save );
+}
+
+static void bench_exec( op_t op, bench_data_t* d )
+{
+	obj_t* alpha = &d->alpha;
+	obj_t* beta  = &BLIS_ONE;
+
+	switch ( op )
+	{
+		case OP_AXPYV: bli_axpyv( alpha, &d->x, &d->y ); break;
+		case OP_DOTV:  bli_dotv( &d->x, &d->y, &d->rho ); break;
+		case OP_SCALV: bli_scalv( alpha, &d->x ); break;
+		case OP_GEMV:  bli_gemv( alpha, &d->a, &d->x, beta, &d->y ); break;
+		case OP_GER:   bli_ger( alpha, &d->x, &d->y, &d->a ); break;
+		case OP_HEMV:  bli_hemv( alpha, &d->a, &d->x, beta, &d->y ); break;
+		case OP_SYMV:  bli_symv( alpha, &d->a, &d->x, beta, &d->y ); break;
+		case OP_HER:   bli_her( alpha, &d->x, &d->a ); break;
+		case OP_SYR:   bli_syr( alpha, &d->x, &d->a ); break;
+		case OP_HER2:  bli_her2( alpha, &d->x, &d->y, &d->a ); break;
+		case OP_SYR2:  bli_syr2( alpha, &d->x, &d->y, &d->a ); break;
+		case OP_TRMV:  bli_trmv( alpha, &d->a, &d->x ); break;
+		case OP_TRSV:  bli_trsv( alpha, &d->a, &d->x ); break;
+		case OP_GEMM:  bli_gemm( alpha, &d->a, &d->b, beta, &d->c ); break;
+		case OP_HEMM:  bli_hemm( BLIS_LEFT, alpha, &d->a, &d->b, beta, &d->c ); break;
+		case OP_SYMM:  bli_symm( BLIS_LEFT, alpha, &d->a, &d->b, beta, &d->c ); break;
+		case OP_HERK:  bli_herk( alpha, &d->a, beta, &d->c ); break;
+		case OP_SYRK:  bli_syrk( alpha, &d->a, beta, &d->c ); break;
+		case OP_HER2K: bli_her2k( alpha, &d->a, &d->b, beta, &d->c ); break;
+		case OP_SYR2K: bli_syr2k( alpha, &d->a, &d->b, beta, &d->c ); break;
+		case OP_TRMM:  bli_trmm( BLIS_LEFT, alpha, &d->a, &d->b ); break;
+		case OP_TRSM:
+		default:       bli_trsm( BLIS_LEFT, alpha, &d->a, &d->b ); break;
+	}
+}
+
+// Return the best time of n_repeats executions. The overwritten operand
+// is restored before each execution, outside of the timed region. If ctr
+// is not NULL, the hardware events per execution are returned in events.
+static double bench_time( op_t op, bench_data_t* d, int n_repeats,
+                          perfctr_t* ctr, double* events )
+{
+	double   dtime_best = DBL_MAX;
+	double   dtime;
+	uint64_t ev0[ BLIS_NUM_PERF_EVENTS ];
+	uint64_t ev1[ BLIS_NUM_PERF_EVENTS ];
+	int      r, i;
+
+	for ( i = 0; i < BLIS_NUM_PERF_EVENTS; ++i ) events[ i ] = 0.0;
+
+	for ( r = 0; r < n_repeats; ++r )
+	{
+		if ( d->out != NULL ) bli_copym( &d->out_save, d->out );
+
+		if ( ctr != NULL ) bli_perfctr_read( ctr, ev0 );
+
+		dtime = bli_clock();
+
+		bench_exec( op, d );
+
+		dtime_best = bli_clock_min_diff( dtime_best, dtime );
+
+		if ( ctr != NULL )
+		{
+			bli_perfctr_read( ctr, ev1 );
+
+			for ( i = 0; i < BLIS_NUM_PERF_EVENTS; ++i )
+				events[ i ] += ( double )( ev1[ i ] - ev0[ i ] ) / n_repeats;
+		}
+	}
+
+	return dtime_best;
+}
+
+// Compute the dimensions of an operation for problem size p and the given
+// aspect ratio. Dimensions that the operation does not have follow m.
+static void bench_dims( op_t op, shape_t shape, dim_t p,
+                        dim_t* m, dim_t* n, dim_t* k )
+{
+	dim_t d = bli_max( p / BENCH_ASPECT, 1 );
+
+	*m = ( shape == SHAPE_WIDE   ? d : p );
+	*n = ( shape == SHAPE_TALL   ? d : p );
+	*k = ( shape == SHAPE_SMALLK ? d : p );
+
+	if ( op_info[ op ].level == 1 )
+	{
+		*m = p * p;
+		*n = 1;
+		*k = 1;
+		return;
+	}
+
+	if ( !op_info[ op ].uses_n ) *n = *m;
+	if ( !op_info[ op ].uses_k ) *k = ( op_info[ op ].level == 3 ? *m : 1 );
+}
+
+// Peak floating-point rate per core per cycle for a datatype.
+static double peak_flops_per_cycle( num_t dt )
+{
+	dim_t dt_size = bli_datatype_size( bli_datatype_proj_to_real( dt ) );
+
+	return 2.0 * BLIS_SIMD_FMA_PER_CYCLE * BLIS_SIMD_SIZE / dt_size;
+}
+
+static double read_ghz( void )
+{
+	char*  str = getenv( "BLIS_BENCH_GHZ" );
+	FILE*  file;
+	char   line[ MAX_LINE ];
+	double mhz;
+
+	if ( str != NULL ) return atof( str );
+
+	file = fopen( "/proc/cpuinfo", "r" );
+
+	if ( file != NULL )
+	{
+		while ( fgets( line, MAX_LINE, file ) != NULL )
+		{
+			if ( sscanf( line, "cpu MHz : %lf", &mhz ) == 1 )
+			{
+				fclose( file );
+				return mhz / 1000.0;
+			}
+		}
+		fclose( file );
+	}
+
+	return 1.0;
+}
+
+// The number of threads used when the thread count is left to the
+// environment.
+static dim_t env_threads( void )
+{
+	dim_t nt = bli_env_read_nway( "BLIS_NUM_THREADS", -1 );
+
+	if ( nt < 1 ) nt = bli_env_read_nway( "OMP_NUM_THREADS", -1 );
+	if ( nt < 1 ) nt = bli_env_read_nway( "BLIS_JC_NT", 1 ) *
+	                   bli_env_read_nway( "BLIS_IC_NT", 1 ) *
+	                   bli_env_read_nway( "BLIS_JR_NT", 1 ) *
+	                   bli_env_read_nway( "BLIS_IR_NT", 1 );
+
+	return nt;
+}
+
+static void set_threads( dim_t nt )
+{
+	char str[ 32 ];
+
+	if ( nt < 1 ) return;
+
+	sprintf( str, "%ld", ( long )nt );
+	setenv( "BLIS_NUM_THREADS", str, 1 );
+	unsetenv( "BLIS_JC_NT" );
+	unsetenv( "BLIS_IC_NT" );
+	unsetenv( "BLIS_JR_NT" );
+	unsetenv( "BLIS_IR_NT" );
+}
+
+static void make_key( char* key, op_t op, char dt_ch, shape_t shape,
+                      stor_t stor, dim_t nt, dim_t m, dim_t n, dim_t k )
+{
+	sprintf( key, "%s,%c,%s,%s,%ld,%ld,%ld,%ld",
+	         op_info[ op ].name, dt_ch, shape_str[ shape ], stor_str[ stor ],
+	         ( long )nt, ( long )m, ( long )n, ( long )k );
+}
+
+// Read a baseline CSV file. The key of each record is its first eight
+// fields; the GFLOPS are the tenth.
+static void read_baseline( char* path, bench_out_t* out )
+{
+	FILE*  file = fopen( path, "r" );
+	char   line[ MAX_LINE ];
+	dim_t  n_alloc = 0;
+	char*  p;
+	dim_t  i;
+
+	if ( file == NULL )
+	{
+		fprintf( stderr, "test_bench: cannot open baseline '%s'\n", path );
+		exit( 1 );
+	}
+
+	while ( fgets( line, MAX_LINE, file ) != NULL )
+	{
+		if ( line[0] == '#' || strncmp( line, "op,", 3 ) == 0 ) continue;
+
+		for ( i = 0, p = line; *p != '\0' && i < 9; ++p )
+		{
+			if ( *p == ',' && ++i == 8 ) *p = '\0';
+		}
+
+		if ( i < 9 || strlen( line ) >= sizeof( out->base[0].key ) ) continue;
+
+		if ( out->n_base == n_alloc )
+		{
+			n_alloc   = ( n_alloc == 0 ? 256 : 2 * n_alloc );
+			out->base = realloc( out->base, n_alloc * sizeof( base_rec_t ) );
+		}
+
+		strcpy( out->base[ out->n_base ].key, line );
+		out->base[ out->n_base ].gflops = atof( p );
+		out->n_base += 1;
+	}
+
+	fclose( file );
+}
+
+static void print_header( bench_out_t* out )
+{
+	if ( out->json )
+	{
+		printf( "{\n" );
+		printf( "  \"version\": \"%s\",\n", bli_info_get_version_str() );
+		printf( "  \"ghz\": %.3f,\n", out->ghz );
+		printf( "  \"peak_flops_per_cycle\": { \"s\": %.1f, \"d\": %.1f },\n",
+		        peak_flops_per_cycle( BLIS_FLOAT ),
+		        peak_flops_per_cycle( BLIS_DOUBLE ) );
+		printf( "  \"results\": [\n" );
+	}
+	else
+	{
+		printf( "# blis %s, %.3f GHz, peak %.1f sflops and %.1f dflops "
+		        "per cycle per core\n",
+		        bli_info_get_version_str(), out->ghz,
+		        peak_flops_per_cycle( BLIS_FLOAT ),
+		        peak_flops_per_cycle( BLIS_DOUBLE ) );
+		printf( "op,dt,shape,storage,threads,m,n,k,time,gflops,peak_pct,par_eff%s%s\n",
+		        ( out->base != NULL ? ",base_gflops,ratio,status" : "" ),
+		        ( out->count ? ",cycles,instructions,ipc,l1d_misses,l2_misses,"
+		                       "llc_misses,dtlb_misses" : "" ) );
+	}
+}
+
+static void print_record( bench_out_t* out, char* key, op_t op, char dt_ch,
+                          shape_t shape, stor_t stor, dim_t nt,
+                          dim_t m, dim_t n, dim_t k, double dtime,
+                          double gflops, double peak_pct, double par_eff,
+                          double* events )
+{
+	char*  ev_name[ BLIS_NUM_PERF_EVENTS ] =
+	       { "cycles", "instructions", "l1d_misses", "l2_misses",
+	         "llc_misses", "dtlb_misses" };
+	double ipc = ( events[ BLIS_PERF_CYCLES ] > 0.0 &&
+	               bli_perfctr_is_avail( &out->ctr, BLIS_PERF_INSTRUCTIONS )
+	               ? events[ BLIS_PERF_INSTRUCTIONS ] / events[ BLIS_PERF_CYCLES ]
+	               : -1.0 );
+	double base_gflops = -1.0;
+	double ratio       = 0.0;
+	char*  status      = "";
+	dim_t  i;
+
+	if ( out->base != NULL )
+	{
+		status = "new";
+
+		for ( i = 0; i < out->n_base; ++i )
+		{
+			if ( strcmp( out->base[ i ].key, key ) != 0 ) continue;
+
+			base_gflops = out->base[ i ].gflops;
+			ratio       = ( base_gflops > 0.0 ? gflops / base_gflops : 0.0 );
+			status      = ( ratio < 1.0 - out->thresh / 100.0 ? "regress" : "ok" );
+
+			out->n_compared += 1;
+			if ( status[0] == 'r' ) out->n_regress += 1;
+			break;
+		}
+	}
+
+	if ( out->json )
+	{
+		printf( "%s    { \"op\": \"%s\", \"dt\": \"%c\", \"shape\": \"%s\", "
+		        "\"storage\": \"%s\", \"threads\": %ld, "
+		        "\"m\": %ld, \"n\": %ld, \"k\": %ld, "
+		        "\"time\": %.6e, \"gflops\": %.3f, \"peak_pct\": %.2f, "
+		        "\"par_eff\": %.3f",
+		        ( out->first ? "" : ",\n" ),
+		        op_info[ op ].name, dt_ch, shape_str[ shape ], stor_str[ stor ],
+		        ( long )nt, ( long )m, ( long )n, ( long )k,
+		        dtime, gflops, peak_pct, par_eff );
+
+		if ( out->base != NULL && base_gflops >= 0.0 )
+			printf( ", \"base_gflops\": %.3f, \"ratio\": %.3f", base_gflops, ratio );
+		if ( out->base != NULL )
+			printf( ", \"status\": \"%s\"", status );
+
+		for ( i = 0; out->count && i < BLIS_NUM_PERF_EVENTS; ++i )
+		{
+			if ( bli_perfctr_is_avail( &out->ctr, i ) )
+				printf( ", \"%s\": %.0f", ev_name[ i ], events[ i ] );
+			else
+				printf( ", \"%s\": null", ev_name[ i ] );
+
+			if ( i == BLIS_PERF_INSTRUCTIONS )
+			{
+				if ( ipc >= 0.0 ) printf( ", \"ipc\": %.3f", ipc );
+				else              printf( ", \"ipc\": null" );
+			}
+		}
+
+		printf( " }" );
+	}
+	else
+	{
+		printf( "%s,%.6e,%.3f,%.2f,%.3f", key, dtime, gflops, peak_pct, par_eff );
+
+		if ( out->base != NULL && base_gflops >= 0.0 )
+			printf( ",%.3f,%.3f,%s", base_gflops, ratio, status );
+		else if ( out->base != NULL )
+			printf( ",,,%s", status );
+
+		for ( i = 0; out->count && i < BLIS_NUM_PERF_EVENTS; ++i )
+		{
+			if ( bli_perfctr_is_avail( &out->ctr, i ) ) printf( ",%.0f", events[ i ] );
+			else                                        printf( "," );
+
+			if ( i == BLIS_PERF_INSTRUCTIONS )
+			{
+				if ( ipc >= 0.0 ) printf( ",%.3f", ipc );
+				else              printf( "," );
+			}
+		}
+
+		printf( "\n" );
+	}
+
+	out->first = FALSE;
+
+	fflush( stdout );
+}
+
+static void print_footer( bench_out_t* out )
+{
+	if ( out->json ) printf( "\n  ]\n}\n" );
+
+	if ( out->base != NULL )
+		fprintf( stderr, "test_bench: %ld of %ld records compared against the "
+		                 "baseline regressed by more than %.1f%%\n",
+		         ( long )out->n_regress, ( long )out->n_compared, out->thresh );
+}
+
+static void usage( void )
+{
+	fprintf( stderr, "usage: test_bench.x [-l ops] [-d dts] [-s shapes] "
+	                 "[-S storage] [-t nt,...] [-p begin:end:inc]\n"
+	                 "                    [-r n_repeats] [-o csv|json] "
+	                 "[-g ghz] [-b baseline.csv] [-T percent] [-c]\n" );
+	exit( 1 );
+}
+
+int main( int argc, char** argv )
+{
+	bool_t       op_on[ OP_NUM ];
+	bool_t       shape_on[ SHAPE_NUM ];
+	bool_t       stor_on[ STOR_NUM ];
+	char*        dt_chs    = "d";
+	dim_t        nts[ MAX_THREADS ];
+	dim_t        n_nts     = 0;
+	long         p_begin   = P_BEGIN;
+	long         p_end     = P_END;
+	long         p_inc     = P_INC;
+	int          n_repeats = N_REPEATS;
+	bench_out_t  out;
+	bench_data_t data;
+	char*        tok;
+	int          opt;
+
+	op_t         op;
+	shape_t      shape, sh;
+	stor_t       stor;
+	char*        dt_ch;
+	dim_t        p, t, m, n, k, m_s, n_s, k_s;
+	char         key[ 128 ];
+
+	memset( &out, 0, sizeof( out ) );
+	out.first  = TRUE;
+	out.thresh = 5.0;
+	out.ghz    = 0.0;
+
+	for ( op = 0; op < OP_NUM; ++op )             op_on[ op ]       = TRUE;
+	for ( shape = 0; shape < SHAPE_NUM; ++shape ) shape_on[ shape ] = TRUE;
+	for ( stor = 0; stor < STOR_NUM; ++stor )     stor_on[ stor ]   = ( stor == STOR_COL );
+
+	while ( ( opt = getopt( argc, argv, "l:d:s:S:t:p:r:o:g:b:T:c" ) ) != -1 )
+	{
+		switch ( opt )
+		{
+			case 'l':
+			for ( op = 0; op < OP_NUM; ++op ) op_on[ op ] = FALSE;
+			for ( tok = strtok( optarg, "," ); tok; tok = strtok( NULL, "," ) )
+			{
+				bool_t found = FALSE;
+
+				for ( op = 0; op < OP_NUM; ++op )
+				{
+					if ( strcmp( tok, "all" ) == 0 ||
+					     strcmp( tok, op_info[ op ].name ) == 0 ||
+					     ( tok[0] == 'l' && tok[2] == '\0' &&
+					       tok[1] - '0' == op_info[ op ].level ) )
+					{
+						op_on[ op ] = TRUE;
+						found       = TRUE;
+					}
+				}
+				if ( !found ) usage();
+			}
+			break;
+
+			case 'd':
+			dt_chs = optarg;
+			if ( strspn( dt_chs, "sdcz" ) != strlen( dt_chs ) ) usage();
+			break;
+
+			case 's':
+			for ( shape = 0; shape < SHAPE_NUM; ++shape ) shape_on[ shape ] = FALSE;
+			for ( tok = strtok( optarg, "," ); tok; tok = strtok( NULL, "," ) )
+			{
+				for ( shape = 0; shape < SHAPE_NUM; ++shape )
+					if ( strcmp( tok, shape_str[ shape ] ) == 0 ) break;
+				if ( shape == SHAPE_NUM ) usage();
+				shape_on[ shape ] = TRUE;
+			}
+			break;
+
+			case 'S':
+			for ( stor = 0; stor < STOR_NUM; ++stor ) stor_on[ stor ] = FALSE;
+			for ( tok = strtok( optarg, "," ); tok; tok = strtok( NULL, "," ) )
+			{
+				for ( stor = 0; stor < STOR_NUM; ++stor )
+					if ( strcmp( tok, stor_str[ stor ] ) == 0 ) break;
+				if ( stor == STOR_NUM ) usage();
+				stor_on[ stor ] = TRUE;
+			}
+			break;
+
+			case 't':
+			for ( tok = strtok( optarg, "," ); tok; tok = strtok( NULL, "," ) )
+				if ( n_nts < MAX_THREADS && atol( tok ) > 0 ) nts[ n_nts++ ] = atol( tok );
+			break;
+
+			case 'p':
+			if ( sscanf( optarg, "%ld:%ld:%ld", &p_begin, &p_end, &p_inc ) != 3 ||
+			     p_begin < 1 || p_inc < 1 ) usage();
+			break;
+
+			case 'r': n_repeats = atoi( optarg ); break;
+			case 'o': out.json  = ( strcmp( optarg, "json" ) == 0 ); break;
+			case 'g': out.ghz   = atof( optarg ); break;
+			case 'b': read_baseline( optarg, &out );
+			          if ( out.base == NULL ) out.base = malloc( sizeof( base_rec_t ) );
+			          break;
+			case 'T': out.thresh = atof( optarg ); break;
+			case 'c': out.count  = TRUE; break;
+			default:  usage();
+		}
+	}
+
+	if ( optind != argc || n_repeats < 1 ) usage();
+
+	bli_init();
+
+	if ( out.ghz <= 0.0 ) out.ghz = read_ghz();
+
+	// Open the counters before BLIS creates any threads, so that those
+	// threads inherit them.
+	if ( out.count && bli_perfctr_open( TRUE, &out.ctr ) == 0 )
+		fprintf( stderr, "test_bench: no hardware events can be counted\n" );
+
+	// Without -t, use whatever the environment specifies.
+	if ( n_nts == 0 ) nts[ n_nts++ ] = 0;
+
+	print_header( &out );
+
+	for ( op = 0; op < OP_NUM; ++op )
+	{
+		if ( !op_on[ op ] ) continue;
+
+		for ( dt_ch = dt_chs; *dt_ch != '\0'; ++dt_ch )
+		{
+			num_t dt = ( *dt_ch == 's' ? BLIS_FLOAT    :
+			             *dt_ch == 'd' ? BLIS_DOUBLE   :
+			             *dt_ch == 'c' ? BLIS_SCOMPLEX : BLIS_DCOMPLEX );
+
+			for ( shape = 0; shape < SHAPE_NUM; ++shape )
+			for ( stor = 0; stor < STOR_NUM; ++stor )
+			{
+				if ( !shape_on[ shape ] || !stor_on[ stor ] ) continue;
+
+				// Vectors have no row storage and no aspect ratio.
+				if ( op_info[ op ].level == 1 &&
+				     ( stor == STOR_ROW || shape != SHAPE_SQUARE ) ) continue;
+
+				for ( p = p_begin; p <= p_end; p += p_inc )
+				{
+					double dtime_first = 0.0;
+					dim_t  nt_first    = 1;
+					bool_t dup         = FALSE;
+
+					bench_dims( op, shape, p, &m, &n, &k );
+
+					// Skip aspect ratios whose dimensions repeat those of
+					// an earlier (enabled) aspect ratio.
+					for ( sh = 0; sh < shape; ++sh )
+					{
+						if ( !shape_on[ sh ] ) continue;
+
+						bench_dims( op, sh, p, &m_s, &n_s, &k_s );
+
+						if ( m_s == m && n_s == n && k_s == k ) dup = TRUE;
+					}
+					if ( dup ) continue;
+
+					bench_create( op, dt, m, n, k, stor, &data );
+
+					for ( t = 0; t < n_nts; ++t )
+					{
+						dim_t  nt = ( nts[ t ] > 0 ? nts[ t ] : env_threads() );
+						double dtime, gflops, peak, par_eff;
+						double events[ BLIS_NUM_PERF_EVENTS ];
+
+						set_threads( nts[ t ] );
+
+						dtime  = bench_time( op, &data, n_repeats,
+						                     ( out.count ? &out.ctr : NULL ),
+						                     events );
+						gflops = data.flops / dtime / 1.0e9;
+						peak   = nt * out.ghz * peak_flops_per_cycle( dt );
+
+						if ( t == 0 )
+						{
+							dtime_first = dtime;
+							nt_first    = nt;
+						}
+
+						par_eff = ( dtime_first * nt_first ) / ( dtime * nt );
+
+						make_key( key, op, *dt_ch, shape, stor, nt, m, n, k );
+
+						print_record( &out, key, op, *dt_ch, shape, stor, nt,
+						              m, n, k, dtime, gflops,
+						              100.0 * gflops / peak, par_eff, events );
+					}
+
+					bench_free( op, &data );
+				}
+			}
+		}
+	}
+
+	print_footer( &out );
+
+	if ( out.count ) bli_perfctr_close( &out.ctr );
+
+	bli_finalize();
+
+	return ( out.n_regress > 0 ? 2 : 0 );
+}
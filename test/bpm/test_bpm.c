@@ -0,0 +1,856 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <math.h>
+#include "blis.h"
+
+// This driver checks the banded and packed level-2 BLAS routines (gbmv,
+// sbmv/hbmv, spmv/hpmv, tbmv/tbsv, tpmv/tpsv, spr/hpr and spr2/hpr2) in
+// all four datatypes against a straightforward reference computed in
+// double-precision complex arithmetic. It covers every combination of
+// uplo, trans and diag, bandwidths of zero and of at least n, negative
+// vector increments, beta equal to zero and one, and problems large
+// enough to be split among threads. Elements that BLAS does not reference
+// (outside the band, unit diagonals, and the imaginary parts of Hermitian
+// diagonals) are set to NaN, and the gaps between strided vector elements
+// must be left untouched. The checks are repeated with one and with
+// N_THREADS threads:
+//
+//   ./test_bpm.x
+//
+// The driver prints the number of cases and failures per routine, and
+// exits with a nonzero status if any case failed.
+
+#ifndef N_THREADS
+#define N_THREADS "3"
+#endif
+
+#define SHAPE_GE 0
+#define SHAPE_SY 1
+#define SHAPE_HE 2
+#define SHAPE_TR 3
+
+#define GAP_VAL  1234.5
+
+// A test matrix. The stored part (the band of a general matrix, or one
+// triangle of the band of a symmetric, Hermitian or triangular matrix)
+// spans kl subdiagonals and ku superdiagonals; lda is zero for packed
+// storage. ref holds the exact values at the same offsets as buf.
+typedef struct
+{
+	num_t     dt;
+	int       shape;
+	uplo_t    uplo;
+	diag_t    diag;
+	dim_t     m, n, kl, ku;
+	dim_t     lda;
+	dim_t     len;
+	void*     buf;
+	dcomplex* ref;
+} tmat_t;
+
+static const char dt_chars[ 4 ] =
+{
+	[ BLIS_FLOAT ] = 's', [ BLIS_DOUBLE ] = 'd', [ BLIS_SCOMPLEX ] = 'c', [ BLIS_DCOMPLEX ] = 'z'
+};
+
+static unsigned long long rnd_state = 88172645463325252ULL;
+
+static double rnd1( void )
+{
+	rnd_state ^= rnd_state << 13;
+	rnd_state ^= rnd_state >> 7;
+	rnd_state ^= rnd_state << 17;
+
+	return 2.0 * ( double )( rnd_state >> 11 ) / 9007199254740992.0 - 1.0;
+}
+
+static dcomplex zmake( double re, double im ) { dcomplex z; z.real = re; z.imag = im; return z; }
+static dcomplex zadd( dcomplex a, dcomplex b ) { return zmake( a.real + b.real, a.imag + b.imag ); }
+static dcomplex zsub( dcomplex a, dcomplex b ) { return zmake( a.real - b.real, a.imag - b.imag ); }
+static dcomplex zconj( dcomplex a ) { return zmake( a.real, -a.imag ); }
+static double   zabs( dcomplex a ) { return sqrt( a.real * a.real + a.imag * a.imag ); }
+static dcomplex zmul( dcomplex a, dcomplex b )
+{
+	return zmake( a.real * b.real - a.imag * b.imag,
+	              a.real * b.imag + a.imag * b.real );
+}
+
+static double eps_of( num_t dt )
+{
+	return ( dt == BLIS_FLOAT || dt == BLIS_SCOMPLEX ? 1.2e-7 : 2.3e-16 );
+}
+
+static dcomplex rnd_of( num_t dt )
+{
+	return zmake( rnd1(), bli_is_complex( dt ) ? rnd1() : 0.0 );
+}
+
+static void* alloc_of( num_t dt, dim_t n )
+{
+	return malloc( bli_max( n, 1 ) * bli_datatype_size( dt ) );
+}
+
+static dcomplex get_of( num_t dt, void* buf, dim_t i )
+{
+	switch ( dt )
+	{
+		case BLIS_FLOAT:    return zmake( ( ( float*  )buf )[ i ], 0.0 );
+		case BLIS_DOUBLE:   return zmake( ( ( double* )buf )[ i ], 0.0 );
+		case BLIS_SCOMPLEX: return zmake( ( ( scomplex* )buf )[ i ].real,
+		                                  ( ( scomplex* )buf )[ i ].imag );
+		default:            return ( ( dcomplex* )buf )[ i ];
+	}
+}
+
+static void set_of( num_t dt, void* buf, dim_t i, dcomplex v )
+{
+	switch ( dt )
+	{
+		case BLIS_FLOAT:    ( ( float*  )buf )[ i ] = v.real; break;
+		case BLIS_DOUBLE:   ( ( double* )buf )[ i ] = v.real; break;
+		case BLIS_SCOMPLEX: ( ( scomplex* )buf )[ i ].real = v.real;
+		                    ( ( scomplex* )buf )[ i ].imag = v.imag; break;
+		default:            ( ( dcomplex* )buf )[ i ] = v; break;
+	}
+}
+
+// -- Matrices -----------------------------------------------------------------
+
+static bool_t tmat_in_store( tmat_t* a, dim_t i, dim_t j )
+{
+	return ( 0 <= i && i < a->m && 0 <= j && j < a->n &&
+	         j - a->ku <= i && i <= j + a->kl );
+}
+
+static dim_t tmat_off( tmat_t* a, dim_t i, dim_t j )
+{
+	if ( a->lda != 0 )  return ( a->ku + i - j ) + j * a->lda;
+	else if ( a->kl == 0 ) return i + ( j * ( j + 1 ) ) / 2;
+	else                return ( i - j ) + ( j * ( 2 * a->n - j + 1 ) ) / 2;
+}
+
+// Create a test matrix. For the symmetric, Hermitian and triangular shapes,
+// k is the bandwidth of the stored triangle, and a negative k requests
+// packed storage.
+static void tmat_create( num_t dt, int shape, uplo_t uplo, diag_t diag,
+                         dim_t m, dim_t n, dim_t kl, dim_t ku, dim_t k,
+                         tmat_t* a )
+{
+	const double nan_val = NAN;
+	bool_t       packed  = ( shape != SHAPE_GE && k < 0 );
+	dim_t        i, j, kd;
+
+	a->dt    = dt;
+	a->shape = shape;
+	a->uplo  = uplo;
+	a->diag  = diag;
+	a->m     = m;
+	a->n     = n;
+
+	if ( shape == SHAPE_GE )
+	{
+		a->kl  = kl;
+		a->ku  = ku;
+		a->lda = kl + ku + 2;
+	}
+	else
+	{
+		kd     = ( packed ? bli_max( n - 1, 0 ) : k );
+		a->m   = n;
+		a->kl  = ( bli_is_lower( uplo ) ? kd : 0 );
+		a->ku  = ( bli_is_upper( uplo ) ? kd : 0 );
+		a->lda = ( packed ? 0 : kd + 2 );
+	}
+
+	a->len = ( packed ? ( n * ( n + 1 ) ) / 2 : a->lda * n );
+	a->buf = alloc_of( dt, a->len );
+	a->ref = malloc( bli_max( a->len, 1 ) * sizeof( dcomplex ) );
+
+	for ( i = 0; i < a->len; ++i )
+	{
+		set_of( dt, a->buf, i, zmake( nan_val, nan_val ) );
+		a->ref[ i ] = zmake( nan_val, nan_val );
+	}
+
+	kd = bli_max( a->kl, a->ku );
+
+	for ( j = 0; j < a->n; ++j )
+	for ( i = 0; i < a->m; ++i )
+	{
+		dcomplex v, s;
+		dim_t    off;
+
+		if ( !tmat_in_store( a, i, j ) ) continue;
+
+		off = tmat_off( a, i, j );
+		v   = rnd_of( dt );
+		s   = v;
+
+		if ( shape == SHAPE_TR )
+		{
+			// Keep the triangular matrices well conditioned: the diagonal
+			// dominates the off-diagonal elements of each row and column.
+			if ( i != j )
+			{
+				v = zmake( 0.5 * v.real / ( bli_min( kd, n - 1 ) + 1 ),
+				           0.5 * v.imag / ( bli_min( kd, n - 1 ) + 1 ) );
+				s = v;
+			}
+			else if ( bli_is_unit_diag( diag ) )
+			{
+				v = zmake( 1.0, 0.0 );
+				s = zmake( nan_val, nan_val );
+			}
+			else
+			{
+				v = zmake( ( v.real < 0.0 ? -1.0 : 1.0 ) + 0.5 * v.real, 0.5 * v.imag );
+				s = v;
+			}
+		}
+		else if ( shape == SHAPE_HE && i == j )
+		{
+			v = zmake( v.real, 0.0 );
+			s = zmake( v.real, nan_val );
+		}
+
+		a->ref[ off ] = v;
+		set_of( dt, a->buf, off, s );
+	}
+}
+
+static void tmat_free( tmat_t* a )
+{
+	free( a->buf );
+	free( a->ref );
+}
+
+// Return element (i,j) of the full matrix that a represents.
+static dcomplex tmat_elem( tmat_t* a, dim_t i, dim_t j )
+{
+	if ( tmat_in_store( a, i, j ) ) return a->ref[ tmat_off( a, i, j ) ];
+
+	if ( ( a->shape == SHAPE_SY || a->shape == SHAPE_HE ) &&
+	     tmat_in_store( a, j, i ) )
+	{
+		dcomplex v = a->ref[ tmat_off( a, j, i ) ];
+
+		return ( a->shape == SHAPE_HE ? zconj( v ) : v );
+	}
+
+	return zmake( 0.0, 0.0 );
+}
+
+// -- Vectors ------------------------------------------------------------------
+
+// A vector of n elements with increment inc, whose gaps hold GAP_VAL.
+static void* tvec_create( num_t dt, dim_t n, dim_t inc, dcomplex* v )
+{
+	dim_t  len = ( n == 0 ? 1 : 1 + ( n - 1 ) * bli_abs( inc ) );
+	void*  buf = alloc_of( dt, len );
+	dim_t  i;
+
+	for ( i = 0; i < len; ++i ) set_of( dt, buf, i, zmake( GAP_VAL, GAP_VAL ) );
+
+	for ( i = 0; i < n; ++i )
+	{
+		dim_t ii = ( inc > 0 ? i * inc : ( n - 1 - i ) * ( -inc ) );
+
+		set_of( dt, buf, ii, v[ i ] );
+	}
+
+	return buf;
+}
+
+static void tvec_read( num_t dt, void* buf, dim_t n, dim_t inc, dcomplex* v )
+{
+	dim_t i;
+
+	for ( i = 0; i < n; ++i )
+		v[ i ] = get_of( dt, buf, ( inc > 0 ? i * inc : ( n - 1 - i ) * ( -inc ) ) );
+}
+
+// Return FALSE if a gap of the strided vector in buf was overwritten.
+static bool_t tvec_gaps_ok( num_t dt, void* buf, dim_t n, dim_t inc )
+{
+	dim_t len = ( n == 0 ? 1 : 1 + ( n - 1 ) * bli_abs( inc ) );
+	dim_t i;
+
+	for ( i = 0; i < len; ++i )
+	{
+		dcomplex v = get_of( dt, buf, i );
+
+		if ( n > 0 && i % bli_abs( inc ) == 0 ) continue;
+
+		if ( v.real != GAP_VAL ) return FALSE;
+		if ( bli_is_complex( dt ) && v.imag != GAP_VAL ) return FALSE;
+	}
+
+	return TRUE;
+}
+
+// Return TRUE if every element of v is within a few rounding errors of
+// ref, given a bound on the magnitude of the terms that were summed.
+static bool_t check_close( num_t dt, dim_t n, dcomplex* v, dcomplex* ref,
+                           double* bound, dim_t n_terms )
+{
+	double tol = 32.0 * eps_of( dt ) * ( n_terms + 2 );
+	dim_t  i;
+
+	for ( i = 0; i < n; ++i )
+	{
+		double err = zabs( zsub( v[ i ], ref[ i ] ) );
+
+		if ( !( err <= tol * bound[ i ] ) ) return FALSE;
+	}
+
+	return TRUE;
+}
+
+// Compute y := beta * y + alpha * transa(A) * x, and a bound on the
+// magnitude of the terms of each element.
+static void ref_mv( tmat_t* a, trans_t transa, dcomplex alpha, dcomplex* x,
+                    dcomplex beta, dcomplex* y, double* bound )
+{
+	dim_t kl = a->kl, ku = a->ku;
+	dim_t n_y = ( bli_does_trans( transa ) ? a->n : a->m );
+	dim_t i, j;
+
+	if ( a->shape == SHAPE_SY || a->shape == SHAPE_HE )
+		kl = ku = bli_max( a->kl, a->ku );
+
+	// As in the reference BLAS, y is not referenced if A is empty.
+	if ( a->m == 0 || a->n == 0 )
+	{
+		for ( i = 0; i < n_y; ++i ) bound[ i ] = zabs( y[ i ] );
+		return;
+	}
+
+	for ( i = 0; i < n_y; ++i )
+	{
+		bool_t beta_zero = ( beta.real == 0.0 && beta.imag == 0.0 );
+
+		y[ i ]     = ( beta_zero ? zmake( 0.0, 0.0 ) : zmul( beta, y[ i ] ) );
+		bound[ i ] = ( beta_zero ? 0.0 : zabs( y[ i ] ) );
+	}
+
+	for ( j = 0; j < a->n; ++j )
+	for ( i = bli_max( 0, j - ku ); i <= bli_min( a->m - 1, j + kl ); ++i )
+	{
+		dcomplex v = tmat_elem( a, i, j );
+		dim_t    r = i, c = j;
+		dcomplex t;
+
+		if ( bli_does_trans( transa ) ) { r = j; c = i; }
+		if ( bli_does_conj( transa ) )  v = zconj( v );
+
+		t = zmul( alpha, zmul( v, x[ c ] ) );
+
+		y[ r ]      = zadd( y[ r ], t );
+		bound[ r ] += zabs( alpha ) * zabs( v ) * zabs( x[ c ] );
+	}
+}
+
+// -- BLAS calls ---------------------------------------------------------------
+
+typedef void (*gbmv_fp)( const f77_char*, const f77_int*, const f77_int*,
+                         const f77_int*, const f77_int*, const void*,
+                         const void*, const f77_int*, const void*,
+                         const f77_int*, const void*, void*, const f77_int* );
+typedef void (*sbmv_fp)( const f77_char*, const f77_int*, const f77_int*,
+                         const void*, const void*, const f77_int*,
+                         const void*, const f77_int*, const void*, void*,
+                         const f77_int* );
+typedef void (*spmv_fp)( const f77_char*, const f77_int*, const void*,
+                         const void*, const void*, const f77_int*,
+                         const void*, void*, const f77_int* );
+typedef void (*tbmv_fp)( const f77_char*, const f77_char*, const f77_char*,
+                         const f77_int*, const f77_int*, const void*,
+                         const f77_int*, void*, const f77_int* );
+typedef void (*tpmv_fp)( const f77_char*, const f77_char*, const f77_char*,
+                         const f77_int*, const void*, void*, const f77_int* );
+typedef void (*spr_fp) ( const f77_char*, const f77_int*, const void*,
+                         const void*, const f77_int*, void* );
+typedef void (*spr2_fp)( const f77_char*, const f77_int*, const void*,
+                         const void*, const f77_int*, const void*,
+                         const f77_int*, void* );
+
+static gbmv_fp gbmv_fps[ 4 ] =
+{
+	[ BLIS_FLOAT    ] = ( gbmv_fp )sgbmv_,
+	[ BLIS_DOUBLE   ] = ( gbmv_fp )dgbmv_,
+	[ BLIS_SCOMPLEX ] = ( gbmv_fp )cgbmv_,
+	[ BLIS_DCOMPLEX ] = ( gbmv_fp )zgbmv_
+};
+
+static sbmv_fp sbmv_fps[ 4 ] =
+{
+	[ BLIS_FLOAT    ] = ( sbmv_fp )ssbmv_,
+	[ BLIS_DOUBLE   ] = ( sbmv_fp )dsbmv_,
+	[ BLIS_SCOMPLEX ] = ( sbmv_fp )chbmv_,
+	[ BLIS_DCOMPLEX ] = ( sbmv_fp )zhbmv_
+};
+
+static spmv_fp spmv_fps[ 4 ] =
+{
+	[ BLIS_FLOAT    ] = ( spmv_fp )sspmv_,
+	[ BLIS_DOUBLE   ] = ( spmv_fp )dspmv_,
+	[ BLIS_SCOMPLEX ] = ( spmv_fp )chpmv_,
+	[ BLIS_DCOMPLEX ] = ( spmv_fp )zhpmv_
+};
+
+static tbmv_fp tbmv_fps[ 4 ] =
+{
+	[ BLIS_FLOAT    ] = ( tbmv_fp )stbmv_,
+	[ BLIS_DOUBLE   ] = ( tbmv_fp )dtbmv_,
+	[ BLIS_SCOMPLEX ] = ( tbmv_fp )ctbmv_,
+	[ BLIS_DCOMPLEX ] = ( tbmv_fp )ztbmv_
+};
+
+static tbmv_fp tbsv_fps[ 4 ] =
+{
+	[ BLIS_FLOAT    ] = ( tbmv_fp )stbsv_,
+	[ BLIS_DOUBLE   ] = ( tbmv_fp )dtbsv_,
+	[ BLIS_SCOMPLEX ] = ( tbmv_fp )ctbsv_,
+	[ BLIS_DCOMPLEX ] = ( tbmv_fp )ztbsv_
+};
+
+static tpmv_fp tpmv_fps[ 4 ] =
+{
+	[ BLIS_FLOAT    ] = ( tpmv_fp )stpmv_,
+	[ BLIS_DOUBLE   ] = ( tpmv_fp )dtpmv_,
+	[ BLIS_SCOMPLEX ] = ( tpmv_fp )ctpmv_,
+	[ BLIS_DCOMPLEX ] = ( tpmv_fp )ztpmv_
+};
+
+static tpmv_fp tpsv_fps[ 4 ] =
+{
+	[ BLIS_FLOAT    ] = ( tpmv_fp )stpsv_,
+	[ BLIS_DOUBLE   ] = ( tpmv_fp )dtpsv_,
+	[ BLIS_SCOMPLEX ] = ( tpmv_fp )ctpsv_,
+	[ BLIS_DCOMPLEX ] = ( tpmv_fp )ztpsv_
+};
+
+static spr_fp spr_fps[ 4 ] =
+{
+	[ BLIS_FLOAT    ] = ( spr_fp )sspr_,
+	[ BLIS_DOUBLE   ] = ( spr_fp )dspr_,
+	[ BLIS_SCOMPLEX ] = ( spr_fp )chpr_,
+	[ BLIS_DCOMPLEX ] = ( spr_fp )zhpr_
+};
+
+static spr2_fp spr2_fps[ 4 ] =
+{
+	[ BLIS_FLOAT    ] = ( spr2_fp )sspr2_,
+	[ BLIS_DOUBLE   ] = ( spr2_fp )dspr2_,
+	[ BLIS_SCOMPLEX ] = ( spr2_fp )chpr2_,
+	[ BLIS_DCOMPLEX ] = ( spr2_fp )zhpr2_
+};
+
+static f77_char uplo_char( uplo_t uplo )  { return ( bli_is_upper( uplo ) ? 'U' : 'L' ); }
+static f77_char diag_char( diag_t diag )  { return ( bli_is_unit_diag( diag ) ? 'U' : 'N' ); }
+static f77_char trans_char( trans_t t )
+{
+	return ( t == BLIS_NO_TRANSPOSE ? 'N' : t == BLIS_TRANSPOSE ? 'T' : 'C' );
+}
+
+// -- Tallies ------------------------------------------------------------------
+
+#define N_OPS 9
+
+// The names of the operations for the real and complex domains.
+static const char* op_names[ 2 ][ N_OPS ] =
+{
+	{ "gbmv", "sbmv", "spmv", "tbmv", "tbsv", "tpmv", "tpsv", "spr", "spr2" },
+	{ "gbmv", "hbmv", "hpmv", "tbmv", "tbsv", "tpmv", "tpsv", "hpr", "hpr2" }
+};
+
+#define op_name( dt, op ) ( op_names[ bli_is_complex( dt ) ][ op ] )
+
+static long n_cases[ 4 ][ N_OPS ];
+static long n_fails[ 4 ][ N_OPS ];
+
+static void tally( num_t dt, int op, bool_t ok, const char* desc )
+{
+	n_cases[ dt ][ op ] += 1;
+
+	if ( !ok )
+	{
+		n_fails[ dt ][ op ] += 1;
+
+		if ( n_fails[ dt ][ op ] <= 5 )
+			printf( "FAIL: %c%s %s\n", dt_chars[ dt ], op_name( dt, op ), desc );
+	}
+}
+
+// -- Tests --------------------------------------------------------------------
+
+static void test_mv( num_t dt, int op, tmat_t* a, trans_t transa,
+                     dcomplex alpha, dcomplex beta, dim_t incx, dim_t incy )
+{
+	dim_t     n_x = ( bli_does_trans( transa ) ? a->m : a->n );
+	dim_t     n_y = ( bli_does_trans( transa ) ? a->n : a->m );
+	dcomplex* x   = malloc( ( n_x + 1 ) * sizeof( dcomplex ) );
+	dcomplex* y   = malloc( ( n_y + 1 ) * sizeof( dcomplex ) );
+	dcomplex* yr  = malloc( ( n_y + 1 ) * sizeof( dcomplex ) );
+	double*   bnd = malloc( ( n_y + 1 ) * sizeof( double ) );
+	char      alpha_t[ 16 ], beta_t[ 16 ];
+	void*     xb;
+	void*     yb;
+	f77_int   m = a->m, n = a->n, kl = a->kl, ku = a->ku, k, lda = a->lda;
+	f77_int   incx_f = incx, incy_f = incy;
+	f77_char  uplo = uplo_char( a->uplo ), trans = trans_char( transa );
+	bool_t    beta_zero = ( beta.real == 0.0 && beta.imag == 0.0 &&
+	                        a->m > 0 && a->n > 0 );
+	char      desc[ 128 ];
+	dim_t     i;
+
+	for ( i = 0; i < n_x; ++i ) x[ i ] = rnd_of( dt );
+	for ( i = 0; i < n_y; ++i ) y[ i ] = ( beta_zero ? zmake( NAN, NAN ) : rnd_of( dt ) );
+	for ( i = 0; i < n_y; ++i ) yr[ i ] = y[ i ];
+
+	xb = tvec_create( dt, n_x, incx, x );
+	yb = tvec_create( dt, n_y, incy, y );
+
+	set_of( dt, alpha_t, 0, alpha );
+	set_of( dt, beta_t,  0, beta );
+
+	k = bli_max( a->kl, a->ku );
+
+	if      ( op == 0 ) gbmv_fps[ dt ]( &trans, &m, &n, &kl, &ku, alpha_t, a->buf, &lda,
+	                                    xb, &incx_f, beta_t, yb, &incy_f );
+	else if ( op == 1 ) sbmv_fps[ dt ]( &uplo, &n, &k, alpha_t, a->buf, &lda,
+	                                    xb, &incx_f, beta_t, yb, &incy_f );
+	else                spmv_fps[ dt ]( &uplo, &n, alpha_t, a->buf,
+	                                    xb, &incx_f, beta_t, yb, &incy_f );
+
+	ref_mv( a, transa, alpha, x, beta, yr, bnd );
+	tvec_read( dt, yb, n_y, incy, y );
+
+	sprintf( desc, "m=%ld n=%ld kl=%ld ku=%ld uplo=%c trans=%c incx=%ld incy=%ld beta=%g",
+	         ( long )a->m, ( long )a->n, ( long )a->kl, ( long )a->ku,
+	         uplo, trans, ( long )incx, ( long )incy, beta.real );
+
+	tally( dt, op, check_close( dt, n_y, y, yr, bnd, a->kl + a->ku + 1 ) &&
+	               tvec_gaps_ok( dt, yb, n_y, incy ), desc );
+
+	free( xb ); free( yb );
+	free( x ); free( y ); free( yr ); free( bnd );
+}
+
+static void test_tr( num_t dt, int op, tmat_t* a, trans_t transa, dim_t incx )
+{
+	const bool_t solve = ( op == 4 || op == 6 );
+	dim_t     n   = a->n;
+	dcomplex* b   = malloc( ( n + 1 ) * sizeof( dcomplex ) );
+	dcomplex* x   = malloc( ( n + 1 ) * sizeof( dcomplex ) );
+	dcomplex* r   = malloc( ( n + 1 ) * sizeof( dcomplex ) );
+	double*   bnd = malloc( ( n + 1 ) * sizeof( double ) );
+	void*     xb;
+	f77_int   n_f = n, k = bli_max( a->kl, a->ku ), lda = a->lda, incx_f = incx;
+	f77_char  uplo = uplo_char( a->uplo ), trans = trans_char( transa );
+	f77_char  diag = diag_char( a->diag );
+	char      desc[ 128 ];
+	dim_t     i;
+	bool_t    ok;
+
+	for ( i = 0; i < n; ++i ) b[ i ] = rnd_of( dt );
+
+	xb = tvec_create( dt, n, incx, b );
+
+	switch ( op )
+	{
+		case 3: tbmv_fps[ dt ]( &uplo, &trans, &diag, &n_f, &k, a->buf, &lda, xb, &incx_f ); break;
+		case 4: tbsv_fps[ dt ]( &uplo, &trans, &diag, &n_f, &k, a->buf, &lda, xb, &incx_f ); break;
+		case 5: tpmv_fps[ dt ]( &uplo, &trans, &diag, &n_f, a->buf, xb, &incx_f ); break;
+		case 6: tpsv_fps[ dt ]( &uplo, &trans, &diag, &n_f, a->buf, xb, &incx_f ); break;
+	}
+
+	tvec_read( dt, xb, n, incx, x );
+
+	if ( !solve )
+	{
+		// Compare x with transa(A) * b.
+		ref_mv( a, transa, zmake( 1.0, 0.0 ), b, zmake( 0.0, 0.0 ), r, bnd );
+		ok = check_close( dt, n, x, r, bnd, k + 1 );
+	}
+	else
+	{
+		// Compare the residual transa(A) * x with b.
+		ref_mv( a, transa, zmake( 1.0, 0.0 ), x, zmake( 0.0, 0.0 ), r, bnd );
+		for ( i = 0; i < n; ++i ) bnd[ i ] += zabs( b[ i ] );
+		ok = check_close( dt, n, r, b, bnd, k + 1 );
+	}
+
+	sprintf( desc, "n=%ld k=%ld uplo=%c trans=%c diag=%c incx=%ld",
+	         ( long )n, ( long )k, uplo, trans, diag, ( long )incx );
+
+	tally( dt, op, ok && tvec_gaps_ok( dt, xb, n, incx ), desc );
+
+	free( xb );
+	free( b ); free( x ); free( r ); free( bnd );
+}
+
+static void test_r( num_t dt, int op, tmat_t* a, dcomplex alpha, dim_t incx, dim_t incy )
+{
+	const bool_t her = ( a->shape == SHAPE_HE );
+	dim_t     n   = a->n;
+	dcomplex* x   = malloc( ( n + 1 ) * sizeof( dcomplex ) );
+	dcomplex* y   = malloc( ( n + 1 ) * sizeof( dcomplex ) );
+	dcomplex* av  = malloc( ( a->len + 1 ) * sizeof( dcomplex ) );
+	double*   bnd = malloc( ( a->len + 1 ) * sizeof( double ) );
+	char      alpha_t[ 16 ];
+	void*     xb;
+	void*     yb;
+	f77_int   n_f = n, incx_f = incx, incy_f = incy;
+	f77_char  uplo = uplo_char( a->uplo );
+	char      desc[ 128 ];
+	bool_t    ok = TRUE;
+	dim_t     i, j;
+
+	for ( i = 0; i < n; ++i ) x[ i ] = rnd_of( dt );
+	for ( i = 0; i < n; ++i ) y[ i ] = rnd_of( dt );
+
+	xb = tvec_create( dt, n, incx, x );
+	yb = tvec_create( dt, n, incy, y );
+
+	// The Hermitian rank-1 update takes a real alpha.
+	if ( op == 7 && her ) alpha.imag = 0.0;
+
+	if ( op == 7 && her ) set_of( bli_datatype_proj_to_real( dt ), alpha_t, 0, alpha );
+	else                  set_of( dt, alpha_t, 0, alpha );
+
+	if ( op == 7 ) spr_fps [ dt ]( &uplo, &n_f, alpha_t, xb, &incx_f, a->buf );
+	else           spr2_fps[ dt ]( &uplo, &n_f, alpha_t, xb, &incx_f, yb, &incy_f, a->buf );
+
+	for ( j = 0; j < n; ++j )
+	for ( i = 0; i < n; ++i )
+	{
+		dim_t    off;
+		dcomplex t, v, yj, xj;
+
+		if ( !tmat_in_store( a, i, j ) ) continue;
+
+		off = tmat_off( a, i, j );
+		xj  = ( her ? zconj( x[ j ] ) : x[ j ] );
+		yj  = ( her ? zconj( y[ j ] ) : y[ j ] );
+
+		if ( op == 7 )
+		{
+			t        = zmul( alpha, zmul( x[ i ], xj ) );
+			bnd[ 0 ] = zabs( alpha ) * zabs( x[ i ] ) * zabs( x[ j ] );
+		}
+		else
+		{
+			dcomplex alpha2 = ( her ? zconj( alpha ) : alpha );
+
+			t        = zadd( zmul( alpha,  zmul( x[ i ], yj ) ),
+			                 zmul( alpha2, zmul( y[ i ], xj ) ) );
+			bnd[ 0 ] = 2.0 * zabs( alpha ) * zabs( x[ i ] ) * zabs( y[ j ] ) +
+			           2.0 * zabs( alpha ) * zabs( y[ i ] ) * zabs( x[ j ] );
+		}
+
+		av[ 0 ]  = zadd( a->ref[ off ], t );
+		bnd[ 0 ] += zabs( a->ref[ off ] );
+		if ( her && i == j ) av[ 0 ].imag = 0.0;
+
+		v = get_of( dt, a->buf, off );
+
+		if ( !check_close( dt, 1, &v, av, bnd, 2 ) ) ok = FALSE;
+
+		// The imaginary parts of a Hermitian diagonal are set to zero.
+		if ( her && i == j && v.imag != 0.0 ) ok = FALSE;
+	}
+
+	sprintf( desc, "n=%ld uplo=%c incx=%ld incy=%ld",
+	         ( long )n, uplo, ( long )incx, ( long )incy );
+
+	tally( dt, op, ok && tvec_gaps_ok( dt, xb, n, incx ) &&
+	                     tvec_gaps_ok( dt, yb, n, incy ), desc );
+
+	free( xb ); free( yb );
+	free( x ); free( y ); free( av ); free( bnd );
+}
+
+static void test_all( num_t dt, dim_t n, bool_t large )
+{
+	static const dim_t incs[ 3 ][ 2 ] = { { 1, 1 }, { 2, -3 }, { -1, 2 } };
+	static const trans_t transs[ 3 ] = { BLIS_NO_TRANSPOSE, BLIS_TRANSPOSE,
+	                                     BLIS_CONJ_TRANSPOSE };
+
+	const int    sym = ( bli_is_complex( dt ) ? SHAPE_HE : SHAPE_SY );
+	const dim_t  n_inc = ( large ? 1 : 3 );
+	dim_t        ks[ 5 ];
+	dim_t        n_k;
+	dim_t        ik, jk, ii, it, iu, id, ib;
+	tmat_t       a;
+
+	// Bandwidths of zero, one, a few, n - 1 and beyond n, or a single
+	// bandwidth large enough to engage the threads.
+	if ( large ) { ks[ 0 ] = 64; n_k = 1; }
+	else
+	{
+		ks[ 0 ] = 0; ks[ 1 ] = 1; ks[ 2 ] = 3;
+		ks[ 3 ] = bli_max( n - 1, 0 ); ks[ 4 ] = n + 2; n_k = 5;
+	}
+
+	// gbmv, with m < n, m = n and m > n.
+	for ( ik = 0; ik < n_k; ++ik )
+	for ( jk = 0; jk < n_k; ++jk )
+	for ( ii = 0; ii < 3; ++ii )
+	{
+		dim_t m = ( ii == 0 ? n : ii == 1 ? n / 2 : n + 3 );
+
+		tmat_create( dt, SHAPE_GE, BLIS_UPPER, BLIS_NONUNIT_DIAG,
+		             m, n, ks[ ik ], ks[ jk ], 0, &a );
+
+		for ( it = 0; it < 3; ++it )
+		for ( iu = 0; iu < n_inc; ++iu )
+		for ( ib = 0; ib < 3; ++ib )
+		{
+			dcomplex beta = ( ib == 0 ? rnd_of( dt ) : zmake( ( double )( ib - 1 ), 0.0 ) );
+
+			test_mv( dt, 0, &a, transs[ it ], rnd_of( dt ), beta,
+			         incs[ iu ][ 0 ], incs[ iu ][ 1 ] );
+		}
+
+		tmat_free( &a );
+	}
+
+	for ( iu = 0; iu < 2; ++iu )
+	{
+		uplo_t uplo = ( iu == 0 ? BLIS_UPPER : BLIS_LOWER );
+
+		// sbmv/hbmv and spmv/hpmv.
+		for ( ik = -1; ik < n_k; ++ik )
+		{
+			tmat_create( dt, sym, uplo, BLIS_NONUNIT_DIAG,
+			             n, n, 0, 0, ( ik < 0 ? -1 : ks[ ik ] ), &a );
+
+			for ( ii = 0; ii < n_inc; ++ii )
+			for ( ib = 0; ib < 3; ++ib )
+			{
+				dcomplex beta = ( ib == 0 ? rnd_of( dt ) : zmake( ( double )( ib - 1 ), 0.0 ) );
+
+				test_mv( dt, ( ik < 0 ? 2 : 1 ), &a, BLIS_NO_TRANSPOSE,
+				         rnd_of( dt ), beta, incs[ ii ][ 0 ], incs[ ii ][ 1 ] );
+			}
+
+			tmat_free( &a );
+		}
+
+		// tbmv/tbsv and tpmv/tpsv.
+		for ( ik = -1; ik < n_k; ++ik )
+		for ( id = 0; id < 2; ++id )
+		{
+			diag_t diag = ( id == 0 ? BLIS_NONUNIT_DIAG : BLIS_UNIT_DIAG );
+
+			tmat_create( dt, SHAPE_TR, uplo, diag,
+			             n, n, 0, 0, ( ik < 0 ? -1 : ks[ ik ] ), &a );
+
+			for ( it = 0; it < 3; ++it )
+			for ( ii = 0; ii < n_inc; ++ii )
+			{
+				test_tr( dt, ( ik < 0 ? 5 : 3 ), &a, transs[ it ], incs[ ii ][ 0 ] );
+				test_tr( dt, ( ik < 0 ? 6 : 4 ), &a, transs[ it ], incs[ ii ][ 1 ] );
+			}
+
+			tmat_free( &a );
+		}
+
+		// spr/hpr and spr2/hpr2. Each update gets a fresh matrix.
+		for ( ii = 0; ii < n_inc; ++ii )
+		{
+			tmat_create( dt, sym, uplo, BLIS_NONUNIT_DIAG, n, n, 0, 0, -1, &a );
+			test_r( dt, 7, &a, rnd_of( dt ), incs[ ii ][ 0 ], incs[ ii ][ 1 ] );
+			tmat_free( &a );
+
+			tmat_create( dt, sym, uplo, BLIS_NONUNIT_DIAG, n, n, 0, 0, -1, &a );
+			test_r( dt, 8, &a, rnd_of( dt ), incs[ ii ][ 0 ], incs[ ii ][ 1 ] );
+			tmat_free( &a );
+		}
+	}
+}
+
+int main( int argc, char** argv )
+{
+	static const dim_t ns[] = { 0, 1, 2, 5, 17, 40 };
+
+	const char* nt_list[ 2 ] = { "1", N_THREADS };
+	long        n_fail_total = 0;
+	int         it, op;
+	num_t       dt;
+	dim_t       i;
+
+	bli_init();
+
+	for ( it = 0; it < 2; ++it )
+	{
+		// The banded and packed routines read the thread count at each call.
+		setenv( "BLIS_NUM_THREADS", nt_list[ it ], 1 );
+
+		memset( n_cases, 0, sizeof( n_cases ) );
+		memset( n_fails, 0, sizeof( n_fails ) );
+
+		for ( dt = BLIS_FLOAT; dt <= BLIS_DCOMPLEX; ++dt )
+		{
+			for ( i = 0; i < sizeof( ns ) / sizeof( ns[ 0 ] ); ++i )
+				test_all( dt, ns[ i ], FALSE );
+
+			// With a bandwidth of 64, this size gives at least two threads
+			// 64K stored elements each in every banded and packed case.
+			test_all( dt, 2100, TRUE );
+		}
+
+		printf( "\nBLIS_NUM_THREADS=%s\n", nt_list[ it ] );
+		printf( "%-12s %10s %10s\n", "routine", "cases", "failures" );
+
+		for ( op = 0; op < N_OPS; ++op )
+		for ( dt = BLIS_FLOAT; dt <= BLIS_DCOMPLEX; ++dt )
+		{
+			char name[ 32 ];
+
+			sprintf( name, "%c%s", dt_chars[ dt ], op_name( dt, op ) );
+			printf( "%-12s %10ld %10ld\n", name, n_cases[ dt ][ op ], n_fails[ dt ][ op ] );
+
+			n_fail_total += n_fails[ dt ][ op ];
+		}
+	}
+
+	printf( "\n%s\n", ( n_fail_total == 0 ? "PASS" : "FAIL" ) );
+
+	bli_finalize();
+
+	return ( n_fail_total == 0 ? 0 : 1 );
+}
@@ -0,0 +1,211 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <unistd.h>
+#include "blis.h"
+
+// This driver measures the call rate of gemm on small square problems
+// (m = n = k = p) through three entry points:
+//
+//   blas    the BLAS interface (?gemm_)
+//   typed   the BLIS typed API (bli_?gemm)
+//   object  the BLIS object API (bli_gemm), which always goes through
+//           the blocked algorithm and serves as a baseline
+//
+// The first two take the gemmsup path for problems within the threshold
+// in bli_gemm_sup.h. For each size, calls are repeated until MIN_TIME
+// seconds have passed, and the best of N_REPEATS such runs is reported in
+// calls per second, along with the GFLOPS of the typed API.
+
+#ifndef DT
+#define DT        BLIS_DOUBLE
+#endif
+#ifndef P_BEGIN
+#define P_BEGIN   2
+#endif
+#ifndef P_END
+#define P_END     64
+#endif
+#ifndef P_INC
+#define P_INC     2
+#endif
+#ifndef MIN_TIME
+#define MIN_TIME  0.05
+#endif
+#ifndef N_REPEATS
+#define N_REPEATS 3
+#endif
+
+typedef enum
+{
+	CALL_BLAS = 0,
+	CALL_TYPED,
+	CALL_OBJECT,
+	N_CALLS
+} call_t;
+
+static char* call_names[ N_CALLS ] = { "blas", "typed", "object" };
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname)( call_t call, obj_t* a, obj_t* b, obj_t* c ) \
+{ \
+	ctype*  one  = bli_obj_buffer_for_const( PASTEMAC(ch,type), BLIS_ONE ); \
+	ctype*  ap   = bli_obj_buffer( *a ); \
+	ctype*  bp   = bli_obj_buffer( *b ); \
+	ctype*  cp   = bli_obj_buffer( *c ); \
+	f77_int m    = bli_obj_length( *c ); \
+	f77_int n    = bli_obj_width( *c ); \
+	f77_int k    = bli_obj_width( *a ); \
+	f77_int lda  = bli_obj_col_stride( *a ); \
+	f77_int ldb  = bli_obj_col_stride( *b ); \
+	f77_int ldc  = bli_obj_col_stride( *c ); \
+\
+	if ( call == CALL_BLAS ) \
+		PASTEF77(ch,gemm)( "N", "N", &m, &n, &k, one, ap, &lda, \
+		                   bp, &ldb, one, cp, &ldc ); \
+	else if ( call == CALL_TYPED ) \
+		PASTEMAC(ch,gemm)( BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, m, n, k, \
+		                   one, ap, 1, lda, bp, 1, ldb, one, cp, 1, ldc, \
+		                   NULL ); \
+	else \
+		bli_gemm( &BLIS_ONE, a, b, &BLIS_ONE, c ); \
+}
+
+INSERT_GENTFUNC_BASIC0( call_gemm )
+
+
+static void call_gemm( call_t call, obj_t* a, obj_t* b, obj_t* c )
+{
+	switch ( bli_obj_datatype( *c ) )
+	{
+		case BLIS_FLOAT:    bli_scall_gemm( call, a, b, c ); break;
+		case BLIS_DOUBLE:   bli_dcall_gemm( call, a, b, c ); break;
+		case BLIS_SCOMPLEX: bli_ccall_gemm( call, a, b, c ); break;
+		case BLIS_DCOMPLEX: bli_zcall_gemm( call, a, b, c ); break;
+		default: break;
+	}
+}
+
+static int sup_max( num_t dt )
+{
+	switch ( dt )
+	{
+		case BLIS_FLOAT:    return BLIS_SGEMMSUP_MAX;
+		case BLIS_DOUBLE:   return BLIS_DGEMMSUP_MAX;
+		case BLIS_SCOMPLEX: return BLIS_CGEMMSUP_MAX;
+		case BLIS_DCOMPLEX: return BLIS_ZGEMMSUP_MAX;
+		default:            return 0;
+	}
+}
+
+// Return the best rate, in calls per second, of N_REPEATS runs of at least
+// MIN_TIME seconds each.
+static double time_calls( call_t call, obj_t* a, obj_t* b, obj_t* c )
+{
+	double best = 0.0;
+	int    r;
+
+	for ( r = 0; r < N_REPEATS; ++r )
+	{
+		double t_start = bli_clock();
+		double t       = 0.0;
+		long   n_calls = 0;
+		long   batch   = 16;
+		long   i;
+
+		while ( t < MIN_TIME )
+		{
+			for ( i = 0; i < batch; ++i ) call_gemm( call, a, b, c );
+
+			n_calls += batch;
+			batch   *= 2;
+			t        = bli_clock() - t_start;
+		}
+
+		best = bli_max( best, n_calls / t );
+	}
+
+	return best;
+}
+
+int main( int argc, char** argv )
+{
+	num_t  dt    = DT;
+	double flops = ( bli_is_complex( dt ) ? 8.0 : 2.0 );
+	obj_t  a, b, c;
+	dim_t  p;
+	call_t call;
+
+	bli_init();
+
+	printf( "%% gemm calls/s, dt = %d, gemmsup threshold = %d\n",
+	        ( int )dt, sup_max( dt ) );
+	printf( "%%    p" );
+	for ( call = 0; call < N_CALLS; ++call )
+		printf( " %12s", call_names[ call ] );
+	printf( " %12s\n", "typed_gflops" );
+
+	for ( p = P_BEGIN; p <= P_END; p += P_INC )
+	{
+		double rate[ N_CALLS ];
+
+		bli_obj_create( dt, p, p, 0, 0, &a );
+		bli_obj_create( dt, p, p, 0, 0, &b );
+		bli_obj_create( dt, p, p, 0, 0, &c );
+
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_setm( &BLIS_ZERO, &c );
+
+		for ( call = 0; call < N_CALLS; ++call )
+			rate[ call ] = time_calls( call, &a, &b, &c );
+
+		printf( "%6ld", ( long )p );
+		for ( call = 0; call < N_CALLS; ++call )
+			printf( " %12.0f", rate[ call ] );
+		printf( " %12.3f\n", flops * p * p * p * rate[ CALL_TYPED ] / 1.0e9 );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+	}
+
+	bli_finalize();
+
+	return 0;
+}
+
@@ -0,0 +1,384 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <math.h>
+#include "blis.h"
+
+// This driver checks the gemmsup path, including the tiny kernels for
+// square problems, against the conventional path. For each datatype, it
+// runs every problem whose dimensions m, n and k are drawn from a set of
+// sizes on both sides of BLIS_?GEMMTINY_MAX and BLIS_?GEMMSUP_MAX through
+//
+//   typed   the BLIS typed API (bli_?gemm), with every combination of
+//           transa and transb and of row and column storage for a, b
+//           and c
+//   blas    the BLAS interface (?gemm_), with every combination of
+//           transa and transb that BLAS can express
+//
+// and with alpha and beta each zero and nonzero. The result is compared
+// against that of the object API (bli_gemm), which always goes through the
+// blocked algorithm. When beta is zero, c is filled with NaN beforehand,
+// since BLAS does not read c in that case. Running
+//
+//   ./test_gemmsup.x
+//
+// prints the number of cases and failures per datatype and interface, and
+// exits with a nonzero status if any case failed.
+
+// Each failure beyond this many is counted but not printed.
+#define N_PRINT   10
+
+// The padding added to the leading dimension of every matrix.
+#define LD_PAD    3
+
+typedef enum
+{
+	API_TYPED = 0,
+	API_BLAS,
+	N_APIS
+} api_t;
+
+static char* api_names[ N_APIS ] = { "typed", "blas" };
+
+static trans_t transs[] = { BLIS_NO_TRANSPOSE,
+                            BLIS_TRANSPOSE,
+                            BLIS_CONJ_NO_TRANSPOSE,
+                            BLIS_CONJ_TRANSPOSE };
+
+#define N_TRANSS  ( ( int )( sizeof( transs ) / sizeof( transs[0] ) ) )
+
+static num_t dts[] = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+static char  dt_chars[] = { 's', 'd', 'c', 'z' };
+
+#define N_DTS     ( ( int )( sizeof( dts ) / sizeof( dts[0] ) ) )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static void PASTEMAC(ch,opname)( api_t   api, \
+                                 trans_t transa, \
+                                 trans_t transb, \
+                                 dim_t   m, \
+                                 dim_t   n, \
+                                 dim_t   k, \
+                                 obj_t*  alpha, \
+                                 obj_t*  a, \
+                                 obj_t*  b, \
+                                 obj_t*  beta, \
+                                 obj_t*  c ) \
+{ \
+	num_t   dt     = PASTEMAC(ch,type); \
+	ctype*  alphap = bli_obj_buffer_for_1x1( dt, *alpha ); \
+	ctype*  betap  = bli_obj_buffer_for_1x1( dt, *beta ); \
+	ctype*  ap     = bli_obj_buffer_at_off( *a ); \
+	ctype*  bp     = bli_obj_buffer_at_off( *b ); \
+	ctype*  cp     = bli_obj_buffer_at_off( *c ); \
+\
+	if ( api == API_TYPED ) \
+	{ \
+		PASTEMAC(ch,gemm)( transa, transb, m, n, k, \
+		                   alphap, \
+		                   ap, bli_obj_row_stride( *a ), bli_obj_col_stride( *a ), \
+		                   bp, bli_obj_row_stride( *b ), bli_obj_col_stride( *b ), \
+		                   betap, \
+		                   cp, bli_obj_row_stride( *c ), bli_obj_col_stride( *c ), \
+		                   NULL ); \
+	} \
+	else \
+	{ \
+		f77_char ta, tb; \
+		f77_int  m_f  = m; \
+		f77_int  n_f  = n; \
+		f77_int  k_f  = k; \
+		f77_int  lda  = bli_obj_col_stride( *a ); \
+		f77_int  ldb  = bli_obj_col_stride( *b ); \
+		f77_int  ldc  = bli_obj_col_stride( *c ); \
+\
+		bli_param_map_blis_to_netlib_trans( transa, &ta ); \
+		bli_param_map_blis_to_netlib_trans( transb, &tb ); \
+\
+		PASTEF77(ch,gemm)( &ta, &tb, &m_f, &n_f, &k_f, \
+		                   alphap, ap, &lda, bp, &ldb, \
+		                   betap, cp, &ldc ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( call_gemm )
+
+
+static void call_gemm( api_t   api,
+                       trans_t transa,
+                       trans_t transb,
+                       dim_t   m,
+                       dim_t   n,
+                       dim_t   k,
+                       obj_t*  alpha,
+                       obj_t*  a,
+                       obj_t*  b,
+                       obj_t*  beta,
+                       obj_t*  c )
+{
+	switch ( bli_obj_datatype( *c ) )
+	{
+		case BLIS_FLOAT:    bli_scall_gemm( api, transa, transb, m, n, k, alpha, a, b, beta, c ); break;
+		case BLIS_DOUBLE:   bli_dcall_gemm( api, transa, transb, m, n, k, alpha, a, b, beta, c ); break;
+		case BLIS_SCOMPLEX: bli_ccall_gemm( api, transa, transb, m, n, k, alpha, a, b, beta, c ); break;
+		case BLIS_DCOMPLEX: bli_zcall_gemm( api, transa, transb, m, n, k, alpha, a, b, beta, c ); break;
+		default: break;
+	}
+}
+
+// Fill p with the sizes to test for datatype dt, in increasing order and
+// without repeats, and return how many there are.
+static int test_sizes( num_t dt, dim_t* p )
+{
+	dim_t tiny, sup;
+	dim_t cand[ 7 ];
+	int   n_cand = 0;
+	int   n_p    = 0;
+	int   i;
+
+	switch ( dt )
+	{
+		case BLIS_FLOAT:    tiny = BLIS_SGEMMTINY_MAX; sup = BLIS_SGEMMSUP_MAX; break;
+		case BLIS_DOUBLE:   tiny = BLIS_DGEMMTINY_MAX; sup = BLIS_DGEMMSUP_MAX; break;
+		case BLIS_SCOMPLEX: tiny = BLIS_CGEMMTINY_MAX; sup = BLIS_CGEMMSUP_MAX; break;
+		default:            tiny = BLIS_ZGEMMTINY_MAX; sup = BLIS_ZGEMMSUP_MAX; break;
+	}
+
+	// The tiny and gemmsup thresholds may come in either order, so sort
+	// the candidates before dropping repeats.
+	cand[ n_cand++ ] = 0;
+	cand[ n_cand++ ] = 1;
+	cand[ n_cand++ ] = 2;
+	cand[ n_cand++ ] = tiny;
+	cand[ n_cand++ ] = tiny + 1;
+	cand[ n_cand++ ] = sup;
+	cand[ n_cand++ ] = sup + 1;
+
+	for ( i = 1; i < n_cand; ++i )
+	{
+		dim_t x = cand[ i ];
+		int   j = i;
+
+		for ( ; j > 0 && cand[ j - 1 ] > x; --j ) cand[ j ] = cand[ j - 1 ];
+		cand[ j ] = x;
+	}
+
+	for ( i = 0; i < n_cand; ++i )
+		if ( n_p == 0 || cand[ i ] > p[ n_p - 1 ] ) p[ n_p++ ] = cand[ i ];
+
+	return n_p;
+}
+
+// Create an m x n matrix, stored by rows if row_stored is set and by
+// columns otherwise, with its leading dimension padded by LD_PAD.
+static void create_matrix( num_t dt, dim_t m, dim_t n, bool_t row_stored,
+                           obj_t* x )
+{
+	if ( row_stored ) bli_obj_create( dt, m, n, n + LD_PAD, 1, x );
+	else              bli_obj_create( dt, m, n, 1, m + LD_PAD, x );
+}
+
+// Return the Frobenius norm of x.
+static double normfm( obj_t* x )
+{
+	obj_t  norm;
+	double r, i;
+
+	bli_obj_scalar_init_detached( bli_obj_datatype_proj_to_real( *x ), &norm );
+	bli_normfm( x, &norm );
+	bli_getsc( &norm, &r, &i );
+
+	return r;
+}
+
+// Run one problem through api and the object API, and return whether the
+// two results agree.
+static bool_t test_case( api_t   api,
+                         num_t   dt,
+                         trans_t transa,
+                         trans_t transb,
+                         dim_t   m,
+                         dim_t   n,
+                         dim_t   k,
+                         bool_t  row_a,
+                         bool_t  row_b,
+                         bool_t  row_c,
+                         obj_t*  alpha,
+                         obj_t*  beta )
+{
+	obj_t  a, b, c, c_ref, nan;
+	double eps  = ( bli_is_double_prec( dt ) ? 2.2e-16 : 1.2e-7 );
+	double alpha_r, alpha_i, beta_r, beta_i;
+	double bound, diff;
+
+	bli_getsc( alpha, &alpha_r, &alpha_i );
+	bli_getsc( beta,  &beta_r,  &beta_i );
+
+	if ( bli_does_trans( transa ) ) create_matrix( dt, k, m, row_a, &a );
+	else                            create_matrix( dt, m, k, row_a, &a );
+	if ( bli_does_trans( transb ) ) create_matrix( dt, n, k, row_b, &b );
+	else                            create_matrix( dt, k, n, row_b, &b );
+	create_matrix( dt, m, n, row_c, &c );
+	create_matrix( dt, m, n, row_c, &c_ref );
+
+	bli_randm( &a );
+	bli_randm( &b );
+	bli_randm( &c_ref );
+
+	if ( beta_r == 0.0 && beta_i == 0.0 )
+	{
+		bli_obj_scalar_init_detached( dt, &nan );
+		bli_setsc( NAN, NAN, &nan );
+		bli_setm( &nan, &c );
+	}
+	else
+	{
+		bli_copym( &c_ref, &c );
+	}
+
+	// Bound the difference by the error each of the two computations may
+	// incur, taken generously.
+	bound = 16.0 * eps * ( k + 2 ) *
+	        ( sqrt( alpha_r * alpha_r + alpha_i * alpha_i ) *
+	          normfm( &a ) * normfm( &b ) +
+	          sqrt( beta_r * beta_r + beta_i * beta_i ) * normfm( &c_ref ) );
+
+	call_gemm( api, transa, transb, m, n, k, alpha, &a, &b, beta, &c );
+
+	bli_obj_set_conjtrans( transa, a );
+	bli_obj_set_conjtrans( transb, b );
+	bli_gemm( alpha, &a, &b, beta, &c_ref );
+
+	bli_subm( &c_ref, &c );
+	diff = normfm( &c );
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+	bli_obj_free( &c_ref );
+
+	// The comparison fails for a NaN difference as well.
+	return ( diff <= bound );
+}
+
+int main( int argc, char** argv )
+{
+	int    n_fail_total = 0;
+	int    i;
+
+	bli_init();
+
+	for ( i = 0; i < N_DTS; ++i )
+	{
+		num_t  dt = dts[ i ];
+		char   ch = dt_chars[ i ];
+		dim_t  p[ 7 ];
+		int    n_p = test_sizes( dt, p );
+		int    n_trans = ( bli_is_complex( dt ) ? N_TRANSS : 2 );
+		obj_t  alphas[ 2 ], betas[ 2 ];
+		api_t  api;
+
+		bli_obj_scalar_init_detached( dt, &alphas[ 0 ] );
+		bli_obj_scalar_init_detached( dt, &alphas[ 1 ] );
+		bli_obj_scalar_init_detached( dt, &betas[ 0 ] );
+		bli_obj_scalar_init_detached( dt, &betas[ 1 ] );
+		bli_setsc( 0.0,  0.0, &alphas[ 0 ] );
+		bli_setsc( 1.2, -0.8, &alphas[ 1 ] );
+		bli_setsc( 0.0,  0.0, &betas[ 0 ] );
+		bli_setsc( 0.9,  1.0, &betas[ 1 ] );
+
+		for ( api = 0; api < N_APIS; ++api )
+		{
+			int n_case = 0;
+			int n_fail = 0;
+			int im, in, ik, ta, tb, st, ia, ib;
+
+			for ( im = 0; im < n_p; ++im )
+			for ( in = 0; in < n_p; ++in )
+			for ( ik = 0; ik < n_p; ++ik )
+			for ( ta = 0; ta < n_trans; ++ta )
+			for ( tb = 0; tb < n_trans; ++tb )
+			for ( st = 0; st < 8; ++st )
+			for ( ia = 0; ia < 2; ++ia )
+			for ( ib = 0; ib < 2; ++ib )
+			{
+				trans_t transa = transs[ ta ];
+				trans_t transb = transs[ tb ];
+				bool_t  row_a  = ( st >> 0 ) & 1;
+				bool_t  row_b  = ( st >> 1 ) & 1;
+				bool_t  row_c  = ( st >> 2 ) & 1;
+
+				// BLAS takes column-stored matrices only, and has no way
+				// to conjugate without transposing.
+				if ( api == API_BLAS &&
+				     ( st != 0 ||
+				       transa == BLIS_CONJ_NO_TRANSPOSE ||
+				       transb == BLIS_CONJ_NO_TRANSPOSE ) ) continue;
+
+				++n_case;
+
+				if ( !test_case( api, dt, transa, transb,
+				                 p[ im ], p[ in ], p[ ik ],
+				                 row_a, row_b, row_c,
+				                 &alphas[ ia ], &betas[ ib ] ) )
+				{
+					if ( n_fail < N_PRINT )
+						printf( "FAIL %c %-5s m = %ld n = %ld k = %ld "
+						        "transa = %d transb = %d storage (a,b,c) = %c%c%c "
+						        "alpha %s beta %s\n",
+						        ch, api_names[ api ],
+						        ( long )p[ im ], ( long )p[ in ], ( long )p[ ik ],
+						        ( int )ta, ( int )tb,
+						        row_a ? 'r' : 'c', row_b ? 'r' : 'c', row_c ? 'r' : 'c',
+						        ia ? "nonzero" : "zero", ib ? "nonzero" : "zero" );
+					++n_fail;
+				}
+			}
+
+			printf( "%c %-5s %7d cases %5d failures\n",
+			        ch, api_names[ api ], n_case, n_fail );
+
+			n_fail_total += n_fail;
+		}
+	}
+
+	bli_finalize();
+
+	printf( "%s\n", n_fail_total == 0 ? "PASS" : "FAIL" );
+
+	return ( n_fail_total == 0 ? 0 : 1 );
+}
@@ -0,0 +1,175 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <unistd.h>
+#include "blis.h"
+
+// This driver measures gemm performance in a "two-socket" configuration,
+// where the threads are split into two jc groups, one per NUMA node, and
+// reports how the packing buffers were distributed among the per-node
+// memory pools. For example, on a two-node machine:
+//
+//   BLIS_NUM_THREADS=16 BLIS_AFFINITY=compact ./test_numa.x
+//
+// The node layout can be emulated on a single-node machine by requesting
+// a number of nodes and a placement, e.g.
+//
+//   BLIS_NUM_NODES=2 BLIS_AFFINITY=0-3,0-3 BLIS_NUM_THREADS=8 ./test_numa.x
+//
+// optionally under numactl (e.g. "numactl --interleave=all") to compare
+// against a placement policy that ignores first touch.
+
+#ifndef P_BEGIN
+#define P_BEGIN 400
+#endif
+#ifndef P_END
+#define P_END   4000
+#endif
+#ifndef P_INC
+#define P_INC   400
+#endif
+#ifndef DT
+#define DT      BLIS_DOUBLE
+#endif
+
+int main( int argc, char** argv )
+{
+	obj_t     a, b, c;
+	obj_t     c_save;
+	obj_t     alpha, beta;
+	dim_t     m, n, k;
+	dim_t     p;
+	dim_t     p_begin, p_end, p_inc;
+	num_t     dt;
+	int       r, n_repeats;
+	dim_t     node, n_nodes;
+	membrk_t* membrk;
+
+	double    dtime;
+	double    dtime_save;
+	double    gflops;
+
+	bli_init();
+
+	n_repeats = 3;
+
+	p_begin = P_BEGIN;
+	p_end   = P_END;
+	p_inc   = P_INC;
+
+	dt      = DT;
+
+	membrk  = bli_memsys_global_membrk();
+	n_nodes = bli_membrk_num_nodes( membrk );
+
+	printf( "%% nodes: %ld (topology: %ld)  affinity: %d\n",
+	        ( long )n_nodes, ( long )bli_thread_topo_num_nodes(),
+	        ( int )bli_thread_get_affinity() );
+
+	for ( p = p_begin; p <= p_end; p += p_inc )
+	{
+		m = p;
+		n = p;
+		k = p;
+
+		bli_obj_create( dt, 1, 1, 0, 0, &alpha );
+		bli_obj_create( dt, 1, 1, 0, 0, &beta );
+
+		bli_obj_create( dt, m, k, 0, 0, &a );
+		bli_obj_create( dt, k, n, 0, 0, &b );
+		bli_obj_create( dt, m, n, 0, 0, &c );
+		bli_obj_create( dt, m, n, 0, 0, &c_save );
+
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_randm( &c );
+
+		bli_setsc(  (0.9/1.0), 0.2, &alpha );
+		bli_setsc( -(1.1/1.0), 0.3, &beta );
+
+		bli_copym( &c, &c_save );
+
+		dtime_save = DBL_MAX;
+
+		for ( r = 0; r < n_repeats; ++r )
+		{
+			bli_copym( &c_save, &c );
+
+			dtime = bli_clock();
+
+			bli_gemm( &alpha,
+			          &a,
+			          &b,
+			          &beta,
+			          &c );
+
+			dtime_save = bli_clock_min_diff( dtime_save, dtime );
+		}
+
+		gflops = ( 2.0 * m * k * n ) / ( dtime_save * 1.0e9 );
+
+		if ( bli_is_complex( dt ) ) gflops *= 4.0;
+
+		printf( "data_numa_gemm_blis" );
+		printf( "( %2lu, 1:5 ) = [ %4lu %4lu %4lu  %10.3e  %6.3f ];\n",
+		        ( unsigned long )(p - p_begin + 1)/p_inc + 1,
+		        ( unsigned long )m,
+		        ( unsigned long )k,
+		        ( unsigned long )n, dtime_save, gflops );
+
+		bli_obj_free( &alpha );
+		bli_obj_free( &beta );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &c_save );
+	}
+
+	// Report the amount of packing memory held by each node's pools.
+	for ( node = 0; node < n_nodes; ++node )
+	{
+		printf( "%% node %ld: A blocks %8lu KB  B panels %8lu KB\n",
+		        ( long )node,
+		        ( unsigned long )bli_membrk_node_pool_size( membrk, node,
+		                             BLIS_BUFFER_FOR_A_BLOCK ) / 1024,
+		        ( unsigned long )bli_membrk_node_pool_size( membrk, node,
+		                             BLIS_BUFFER_FOR_B_PANEL ) / 1024 );
+	}
+
+	bli_finalize();
+
+	return 0;
+}
+
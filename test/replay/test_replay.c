@@ -0,0 +1,614 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <unistd.h>
+#include "blis.h"
+
+// This driver replays a recorded trace of level-3 calls with synthetic data.
+// The trace is the call log that BLIS writes when BLIS_VERBOSE is set (see
+// bli_verbose.h), one "BLIS_VERBOSE op=... m=... n=... k=..." line per call;
+// other lines, and level-1v/level-2 records, are skipped. Each call is
+// re-executed in the recorded order with the recorded datatype, parameters,
+// dimensions and strides, and the time spent on each distinct shape is
+// accumulated. The whole trace is replayed once per configuration, where
+// the configurations are all combinations of the requested thread counts
+// and induced methods. For example:
+//
+//   BLIS_VERBOSE=1 BLIS_VERBOSE_FILE=app.trace ./app
+//   ./test_replay.x -t 1,4,8 -i native,4m1a -r 3 app.trace
+//
+// The thread count is applied by setting BLIS_NUM_THREADS (and clearing
+// the per-loop BLIS_??_NT variables); without -t the environment is left
+// as it is. Induced methods apply only to complex shapes; without -i the
+// default method selection is used. For each configuration and shape, the
+// best time over the repeats is reported along with the total time of the
+// replay and the speedup relative to the first configuration.
+
+#ifndef N_REPEATS
+#define N_REPEATS   3
+#endif
+
+#define MAX_CONFIGS 32
+#define MAX_LINE    1024
+
+typedef enum
+{
+	OP_GEMM = 0,
+	OP_HEMM,
+	OP_SYMM,
+	OP_HERK,
+	OP_SYRK,
+	OP_HER2K,
+	OP_SYR2K,
+	OP_TRMM,
+	OP_TRMM3,
+	OP_TRSM,
+	OP_NUM
+} op_t;
+
+static char* op_str[ OP_NUM ] =
+{
+	"gemm", "hemm", "symm", "herk", "syrk",
+	"her2k", "syr2k", "trmm", "trmm3", "trsm"
+};
+
+typedef struct
+{
+	dim_t  nt;
+	ind_t  method;
+} config_t;
+
+typedef struct
+{
+	// The shape, as recorded in the trace.
+	op_t   op;
+	num_t  dt;
+	char   side;
+	char   uplo;
+	char   transa;
+	char   transb;
+	char   diag;
+	dim_t  m, n, k;
+	inc_t  rs_a, cs_a, rs_b, cs_b, rs_c, cs_c;
+
+	// The operands used to replay the shape. For trmm and trsm, which
+	// overwrite b, b_save holds the original contents of b.
+	obj_t  a, b, c, b_save;
+
+	dim_t  n_calls;
+	double flops;
+	double dtime_rep;
+	double dtime[ MAX_CONFIGS ];
+} shape_t;
+
+static trans_t trans_from_ch( char ch )
+{
+	if      ( ch == 't' ) return BLIS_TRANSPOSE;
+	else if ( ch == 'c' ) return BLIS_CONJ_NO_TRANSPOSE;
+	else if ( ch == 'h' ) return BLIS_CONJ_TRANSPOSE;
+	else                  return BLIS_NO_TRANSPOSE;
+}
+
+static num_t dt_from_ch( char ch )
+{
+	if      ( ch == 's' ) return BLIS_FLOAT;
+	else if ( ch == 'd' ) return BLIS_DOUBLE;
+	else if ( ch == 'c' ) return BLIS_SCOMPLEX;
+	else                  return BLIS_DCOMPLEX;
+}
+
+static char dt_to_ch( num_t dt )
+{
+	if      ( bli_is_float( dt ) )    return 's';
+	else if ( bli_is_double( dt ) )   return 'd';
+	else if ( bli_is_scomplex( dt ) ) return 'c';
+	else                              return 'z';
+}
+
+// Parse one trace line into a shape. Returns FALSE if the line is not a
+// level-3 record of an operation that can be replayed.
+static bool_t parse_record( char* line, shape_t* s )
+{
+	char*  tok;
+	char*  val;
+	op_t   op;
+	bool_t have_op = FALSE;
+
+	if ( strncmp( line, "BLIS_VERBOSE ", 13 ) != 0 ) return FALSE;
+
+	memset( s, 0, sizeof( shape_t ) );
+
+	for ( tok = strtok( line + 13, " \t\n" ); tok != NULL;
+	      tok = strtok( NULL, " \t\n" ) )
+	{
+		val = strchr( tok, '=' );
+
+		if ( val == NULL ) continue;
+
+		*val++ = '\0';
+
+		if ( strcmp( tok, "op" ) == 0 )
+		{
+			for ( op = 0; op < OP_NUM; ++op )
+				if ( strcmp( val, op_str[ op ] ) == 0 ) break;
+
+			if ( op == OP_NUM ) return FALSE;
+
+			s->op   = op;
+			have_op = TRUE;
+		}
+		else if ( strcmp( tok, "params" ) == 0 ) return FALSE;
+		else if ( strcmp( tok, "dt" ) == 0 )     s->dt     = dt_from_ch( val[0] );
+		else if ( strcmp( tok, "side" ) == 0 )   s->side   = val[0];
+		else if ( strcmp( tok, "uplo" ) == 0 )   s->uplo   = val[0];
+		else if ( strcmp( tok, "transa" ) == 0 ) s->transa = val[0];
+		else if ( strcmp( tok, "transb" ) == 0 ) s->transb = val[0];
+		else if ( strcmp( tok, "diag" ) == 0 )   s->diag   = val[0];
+		else if ( strcmp( tok, "m" ) == 0 )      s->m      = atol( val );
+		else if ( strcmp( tok, "n" ) == 0 )      s->n      = atol( val );
+		else if ( strcmp( tok, "k" ) == 0 )      s->k      = atol( val );
+		else if ( strcmp( tok, "rs_a" ) == 0 )   s->rs_a   = atol( val );
+		else if ( strcmp( tok, "cs_a" ) == 0 )   s->cs_a   = atol( val );
+		else if ( strcmp( tok, "rs_b" ) == 0 )   s->rs_b   = atol( val );
+		else if ( strcmp( tok, "cs_b" ) == 0 )   s->cs_b   = atol( val );
+		else if ( strcmp( tok, "rs_c" ) == 0 )   s->rs_c   = atol( val );
+		else if ( strcmp( tok, "cs_c" ) == 0 )   s->cs_c   = atol( val );
+	}
+
+	return have_op && s->m > 0 && s->n > 0 && s->k > 0;
+}
+
+static bool_t shape_is_equal( shape_t* x, shape_t* y )
+{
+	return x->op     == y->op     && x->dt     == y->dt     &&
+	       x->side   == y->side   && x->uplo   == y->uplo   &&
+	       x->transa == y->transa && x->transb == y->transb &&
+	       x->diag   == y->diag   &&
+	       x->m      == y->m      && x->n      == y->n      &&
+	       x->k      == y->k      &&
+	       x->rs_a   == y->rs_a   && x->cs_a   == y->cs_a   &&
+	       x->rs_b   == y->rs_b   && x->cs_b   == y->cs_b   &&
+	       x->rs_c   == y->rs_c   && x->cs_c   == y->cs_c;
+}
+
+// Create an operand that is m x n after the transposition given by trans_ch,
+// using the recorded strides when they describe a valid row- or column-
+// stored matrix, and default (column) storage otherwise.
+static void create_operand( num_t dt, char trans_ch, dim_t m, dim_t n,
+                            inc_t rs, inc_t cs, obj_t* x )
+{
+	trans_t trans = trans_from_ch( trans_ch );
+	dim_t   m_s   = ( bli_does_trans( trans ) ? n : m );
+	dim_t   n_s   = ( bli_does_trans( trans ) ? m : n );
+
+	if ( !( ( rs == 1 && cs >= bli_max( m_s, 1 ) ) ||
+	        ( cs == 1 && rs >= bli_max( n_s, 1 ) ) ) )
+	{
+		rs = 0;
+		cs = 0;
+	}
+
+	bli_obj_create( dt, m_s, n_s, rs, cs, x );
+	bli_randm( x );
+	bli_obj_set_conjtrans( trans, *x );
+}
+
+static void shape_create( shape_t* s )
+{
+	num_t  dt   = s->dt;
+	uplo_t uplo = ( s->uplo == 'u' ? BLIS_UPPER : BLIS_LOWER );
+	diag_t diag = ( s->diag == 'u' ? BLIS_UNIT_DIAG : BLIS_NONUNIT_DIAG );
+	double mult = ( bli_is_complex( dt ) ? 4.0 : 1.0 );
+	obj_t  kinv;
+
+	switch ( s->op )
+	{
+		case OP_GEMM:
+		create_operand( dt, s->transa, s->m, s->k, s->rs_a, s->cs_a, &s->a );
+		create_operand( dt, s->transb, s->k, s->n, s->rs_b, s->cs_b, &s->b );
+		create_operand( dt, 'n',       s->m, s->n, s->rs_c, s->cs_c, &s->c );
+		s->flops = 2.0 * s->m * s->n * s->k;
+		break;
+
+		case OP_HEMM:
+		case OP_SYMM:
+		case OP_TRMM3:
+		create_operand( dt, s->transa, s->k, s->k, s->rs_a, s->cs_a, &s->a );
+		create_operand( dt, s->transb, s->m, s->n, s->rs_b, s->cs_b, &s->b );
+		create_operand( dt, 'n',       s->m, s->n, s->rs_c, s->cs_c, &s->c );
+		s->flops = ( s->op == OP_TRMM3 ? 1.0 : 2.0 ) * s->m * s->n * s->k;
+		break;
+
+		case OP_HERK:
+		case OP_SYRK:
+		create_operand( dt, s->transa, s->m, s->k, s->rs_a, s->cs_a, &s->a );
+		create_operand( dt, 'n',       s->m, s->m, s->rs_c, s->cs_c, &s->c );
+		s->flops = 1.0 * s->m * s->m * s->k;
+		break;
+
+		case OP_HER2K:
+		case OP_SYR2K:
+		create_operand( dt, s->transa, s->m, s->k, s->rs_a, s->cs_a, &s->a );
+		create_operand( dt, s->transb, s->m, s->k, s->rs_b, s->cs_b, &s->b );
+		create_operand( dt, 'n',       s->m, s->m, s->rs_c, s->cs_c, &s->c );
+		s->flops = 2.0 * s->m * s->m * s->k;
+		break;
+
+		case OP_TRMM:
+		case OP_TRSM:
+		default:
+		create_operand( dt, s->transa, s->k, s->k, s->rs_a, s->cs_a, &s->a );
+		create_operand( dt, 'n',       s->m, s->n, s->rs_b, s->cs_b, &s->b );
+		bli_obj_create( dt, s->m, s->n, 0, 0, &s->b_save );
+		bli_copym( &s->b, &s->b_save );
+		s->flops = 1.0 * s->m * s->n * s->k;
+		break;
+	}
+
+	s->flops *= mult;
+
+	// Give the structured operands their structure. Triangular matrices
+	// are scaled so that repeated solves stay well-conditioned.
+	if ( s->op == OP_HEMM || s->op == OP_SYMM )
+	{
+		bli_obj_set_struc( ( s->op == OP_HEMM ? BLIS_HERMITIAN
+		                                      : BLIS_SYMMETRIC ), s->a );
+		bli_obj_set_uplo( uplo, s->a );
+	}
+	else if ( s->op == OP_HERK  || s->op == OP_SYRK ||
+	          s->op == OP_HER2K || s->op == OP_SYR2K )
+	{
+		bli_obj_set_struc( ( s->op == OP_HERK || s->op == OP_HER2K
+		                     ? BLIS_HERMITIAN : BLIS_SYMMETRIC ), s->c );
+		bli_obj_set_uplo( uplo, s->c );
+	}
+	else if ( s->op == OP_TRMM || s->op == OP_TRMM3 || s->op == OP_TRSM )
+	{
+		bli_obj_scalar_init_detached( dt, &kinv );
+		bli_setsc( 1.0 / s->k, 0.0, &kinv );
+		bli_scalm( &kinv, &s->a );
+		bli_setd( &BLIS_ONE, &s->a );
+
+		bli_obj_set_struc( BLIS_TRIANGULAR, s->a );
+		bli_obj_set_uplo( uplo, s->a );
+		bli_obj_set_diag( diag, s->a );
+	}
+}
+
+static void shape_free( shape_t* s )
+{
+	bli_obj_free( &s->a );
+
+	if ( s->op != OP_HERK && s->op != OP_SYRK )
+		bli_obj_free( &s->b );
+
+	if ( s->op == OP_TRMM || s->op == OP_TRSM )
+		bli_obj_free( &s->b_save );
+	else
+		bli_obj_free( &s->c );
+}
+
+static void shape_exec( shape_t* s )
+{
+	side_t side = ( s->side == 'r' ? BLIS_RIGHT : BLIS_LEFT );
+
+	switch ( s->op )
+	{
+		case OP_GEMM:
+		bli_gemm( &BLIS_ONE, &s->a, &s->b, &BLIS_ONE, &s->c ); break;
+		case OP_HEMM:
+		bli_hemm( side, &BLIS_ONE, &s->a, &s->b, &BLIS_ONE, &s->c ); break;
+		case OP_SYMM:
+		bli_symm( side, &BLIS_ONE, &s->a, &s->b, &BLIS_ONE, &s->c ); break;
+		case OP_HERK:
+		bli_herk( &BLIS_ONE, &s->a, &BLIS_ONE, &s->c ); break;
+		case OP_SYRK:
+		bli_syrk( &BLIS_ONE, &s->a, &BLIS_ONE, &s->c ); break;
+		case OP_HER2K:
+		bli_her2k( &BLIS_ONE, &s->a, &s->b, &BLIS_ONE, &s->c ); break;
+		case OP_SYR2K:
+		bli_syr2k( &BLIS_ONE, &s->a, &s->b, &BLIS_ONE, &s->c ); break;
+		case OP_TRMM:
+		bli_trmm( side, &BLIS_ONE, &s->a, &s->b ); break;
+		case OP_TRMM3:
+		bli_trmm3( side, &BLIS_ONE, &s->a, &s->b, &BLIS_ONE, &s->c ); break;
+		case OP_TRSM:
+		default:
+		bli_trsm( side, &BLIS_ONE, &s->a, &s->b ); break;
+	}
+}
+
+static void config_apply( config_t* cfg )
+{
+	char str[ 32 ];
+
+	if ( cfg->nt > 0 )
+	{
+		sprintf( str, "%ld", ( long )cfg->nt );
+		setenv( "BLIS_NUM_THREADS", str, 1 );
+		unsetenv( "BLIS_JC_NT" );
+		unsetenv( "BLIS_IC_NT" );
+		unsetenv( "BLIS_JR_NT" );
+		unsetenv( "BLIS_IR_NT" );
+	}
+
+	if ( cfg->method != BLIS_NUM_IND_METHODS )
+	{
+		bli_ind_disable_all_dt( BLIS_SCOMPLEX );
+		bli_ind_disable_all_dt( BLIS_DCOMPLEX );
+		bli_ind_enable_dt( cfg->method, BLIS_SCOMPLEX );
+		bli_ind_enable_dt( cfg->method, BLIS_DCOMPLEX );
+	}
+}
+
+static char* config_ind_str( config_t* cfg )
+{
+	if ( cfg->method == BLIS_NUM_IND_METHODS ) return "default";
+	else                                       return bli_ind_get_impl_string( cfg->method );
+}
+
+static void usage( char* prog )
+{
+	fprintf( stderr, "usage: %s [-t nt[,nt...]] [-i ind[,ind...]] "
+	                 "[-r n_repeats] trace_file\n", prog );
+	exit( 1 );
+}
+
+int main( int argc, char** argv )
+{
+	config_t cfgs[ MAX_CONFIGS ];
+	dim_t    nts[ MAX_CONFIGS ];
+	ind_t    methods[ MAX_CONFIGS ];
+	dim_t    n_nts     = 0;
+	dim_t    n_methods = 0;
+	dim_t    n_cfgs;
+	int      n_repeats = N_REPEATS;
+	char*    t_arg     = NULL;
+	char*    i_arg     = NULL;
+	char*    tok;
+	int      opt;
+
+	FILE*    file;
+	char     line[ MAX_LINE ];
+	shape_t  rec;
+	shape_t* shapes    = NULL;
+	dim_t    n_shapes  = 0;
+	dim_t    m_shapes  = 0;
+	dim_t*   calls     = NULL;
+	dim_t    n_calls   = 0;
+	dim_t    m_calls   = 0;
+	dim_t    n_skipped = 0;
+
+	double   flops     = 0.0;
+	double   dtime_tot[ MAX_CONFIGS ];
+	double   dtime, dtime_rep;
+	dim_t    c, r, i, s;
+
+	while ( ( opt = getopt( argc, argv, "t:i:r:" ) ) != -1 )
+	{
+		if      ( opt == 't' ) t_arg     = optarg;
+		else if ( opt == 'i' ) i_arg     = optarg;
+		else if ( opt == 'r' ) n_repeats = atoi( optarg );
+		else                   usage( argv[0] );
+	}
+
+	if ( optind != argc - 1 || n_repeats < 1 ) usage( argv[0] );
+
+	bli_init();
+
+	// Build the list of configurations.
+	for ( tok = ( t_arg ? strtok( t_arg, "," ) : NULL ); tok != NULL;
+	      tok = strtok( NULL, "," ) )
+		if ( n_nts < MAX_CONFIGS ) nts[ n_nts++ ] = atol( tok );
+
+	for ( tok = ( i_arg ? strtok( i_arg, "," ) : NULL ); tok != NULL;
+	      tok = strtok( NULL, "," ) )
+	{
+		ind_t im;
+
+		for ( im = 0; im < BLIS_NUM_IND_METHODS; ++im )
+			if ( strcmp( tok, bli_ind_get_impl_string( im ) ) == 0 ) break;
+
+		if ( im == BLIS_NUM_IND_METHODS )
+		{
+			fprintf( stderr, "%s: unknown induced method '%s'\n", argv[0], tok );
+			exit( 1 );
+		}
+
+		if ( n_methods < MAX_CONFIGS ) methods[ n_methods++ ] = im;
+	}
+
+	if ( n_nts     == 0 ) nts[ n_nts++ ]         = 0;
+	if ( n_methods == 0 ) methods[ n_methods++ ] = BLIS_NUM_IND_METHODS;
+
+	for ( n_cfgs = 0, i = 0; i < n_nts; ++i )
+	for ( s = 0; s < n_methods && n_cfgs < MAX_CONFIGS; ++s, ++n_cfgs )
+	{
+		cfgs[ n_cfgs ].nt     = nts[ i ];
+		cfgs[ n_cfgs ].method = methods[ s ];
+	}
+
+	// Read the trace, mapping each call to a distinct shape.
+	file = fopen( argv[ optind ], "r" );
+
+	if ( file == NULL )
+	{
+		fprintf( stderr, "%s: cannot open '%s'\n", argv[0], argv[ optind ] );
+		exit( 1 );
+	}
+
+	while ( fgets( line, MAX_LINE, file ) != NULL )
+	{
+		if ( !parse_record( line, &rec ) )
+		{
+			if ( strncmp( line, "BLIS_VERBOSE ", 13 ) == 0 ) ++n_skipped;
+			continue;
+		}
+
+		for ( s = 0; s < n_shapes; ++s )
+			if ( shape_is_equal( &shapes[ s ], &rec ) ) break;
+
+		if ( s == n_shapes )
+		{
+			if ( n_shapes == m_shapes )
+			{
+				m_shapes = ( m_shapes == 0 ? 64 : 2 * m_shapes );
+				shapes   = realloc( shapes, m_shapes * sizeof( shape_t ) );
+			}
+			shapes[ n_shapes++ ] = rec;
+		}
+
+		if ( n_calls == m_calls )
+		{
+			m_calls = ( m_calls == 0 ? 1024 : 2 * m_calls );
+			calls   = realloc( calls, m_calls * sizeof( dim_t ) );
+		}
+		calls[ n_calls++ ] = s;
+
+		shapes[ s ].n_calls += 1;
+	}
+
+	fclose( file );
+
+	for ( s = 0; s < n_shapes; ++s )
+	{
+		shape_create( &shapes[ s ] );
+
+		flops += shapes[ s ].n_calls * shapes[ s ].flops;
+
+		for ( c = 0; c < n_cfgs; ++c )
+			shapes[ s ].dtime[ c ] = DBL_MAX;
+	}
+
+	// Replay the trace once per repeat for each configuration.
+	for ( c = 0; c < n_cfgs; ++c )
+	{
+		config_apply( &cfgs[ c ] );
+
+		dtime_tot[ c ] = DBL_MAX;
+
+		for ( r = 0; r < n_repeats; ++r )
+		{
+			for ( s = 0; s < n_shapes; ++s )
+				shapes[ s ].dtime_rep = 0.0;
+
+			dtime_rep = 0.0;
+
+			for ( i = 0; i < n_calls; ++i )
+			{
+				shape_t* sh = &shapes[ calls[ i ] ];
+
+				// trmm and trsm overwrite b; start each call from the
+				// same data so that the values neither grow nor vanish.
+				if ( sh->op == OP_TRMM || sh->op == OP_TRSM )
+					bli_copym( &sh->b_save, &sh->b );
+
+				dtime = bli_clock();
+
+				shape_exec( sh );
+
+				dtime = bli_clock() - dtime;
+
+				sh->dtime_rep += dtime;
+				dtime_rep     += dtime;
+			}
+
+			dtime_tot[ c ] = bli_min( dtime_tot[ c ], dtime_rep );
+
+			for ( s = 0; s < n_shapes; ++s )
+				shapes[ s ].dtime[ c ] = bli_min( shapes[ s ].dtime[ c ],
+				                                  shapes[ s ].dtime_rep );
+		}
+	}
+
+	// Report the totals for each configuration, followed by the per-shape
+	// performance.
+	printf( "%% trace %s: %lu calls, %lu distinct shapes, %lu records skipped, "
+	        "best of %d\n",
+	        argv[ optind ], ( unsigned long )n_calls, ( unsigned long )n_shapes,
+	        ( unsigned long )n_skipped, n_repeats );
+	printf( "%%\n" );
+	printf( "%% config  threads  ind         time (s)    gflops  speedup\n" );
+
+	for ( c = 0; c < n_cfgs; ++c )
+	{
+		char nt_str[ 32 ];
+
+		if ( cfgs[ c ].nt > 0 ) sprintf( nt_str, "%lu", ( unsigned long )cfgs[ c ].nt );
+		else                    sprintf( nt_str, "env" );
+
+		printf( "%% %6lu  %7s  %-8s %11.6f  %8.3f  %7.3f\n",
+		        ( unsigned long )c, nt_str, config_ind_str( &cfgs[ c ] ),
+		        dtime_tot[ c ],
+		        ( dtime_tot[ c ] > 0.0 ? flops / dtime_tot[ c ] / 1.0e9 : 0.0 ),
+		        ( dtime_tot[ c ] > 0.0 ? dtime_tot[ 0 ] / dtime_tot[ c ] : 0.0 ) );
+	}
+
+	printf( "%%\n" );
+	printf( "%% op     dt side uplo ta tb diag      m      n      k    calls"
+	        "   time (s)" );
+	for ( c = 0; c < n_cfgs; ++c )
+		printf( "  gflops[%lu]", ( unsigned long )c );
+	printf( "\n" );
+
+	for ( s = 0; s < n_shapes; ++s )
+	{
+		shape_t* sh = &shapes[ s ];
+
+		printf( "  %-6s %c  %c    %c    %c  %c  %c    %6lu %6lu %6lu %8lu %10.6f",
+		        op_str[ sh->op ], dt_to_ch( sh->dt ),
+		        sh->side, sh->uplo, sh->transa, sh->transb, sh->diag,
+		        ( unsigned long )sh->m, ( unsigned long )sh->n,
+		        ( unsigned long )sh->k, ( unsigned long )sh->n_calls,
+		        sh->dtime[ 0 ] );
+
+		for ( c = 0; c < n_cfgs; ++c )
+			printf( "  %9.3f",
+			        ( sh->dtime[ c ] > 0.0
+			          ? sh->n_calls * sh->flops / sh->dtime[ c ] / 1.0e9
+			          : 0.0 ) );
+		printf( "\n" );
+	}
+
+	for ( s = 0; s < n_shapes; ++s )
+		shape_free( &shapes[ s ] );
+
+	free( shapes );
+	free( calls );
+
+	bli_finalize();
+
+	return 0;
+}
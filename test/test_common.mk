@@ -0,0 +1,122 @@
+#!/bin/bash
+#
+#  BLIS    
+#  An object-based framework for developing high-performance BLAS-like
+#  libraries.
+#
+#  Copyright (C) 2014, The University of Texas at Austin
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#   - Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#   - Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#   - Neither the name of The University of Texas at Austin nor the names
+#     of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+#  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+#  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+#  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+#  HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+#  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+#  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+#  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+#  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+#  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+#  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#
+# test_common.mk
+#
+# Definitions and rules shared by the standalone BLIS test drivers in the
+# subdirectories of test. A driver's Makefile sets its own compile-time
+# definitions in TEST_DEFS, includes this file, and then lists its targets.
+# Each test_foo.c is built into test_foo.x and linked against the installed
+# BLIS library (override BLIS_LIB and BLIS_INC_PATH on the make command line
+# to use another one).
+#
+
+# Only include this block of code once
+ifndef TEST_COMMON_MK_INCLUDED
+TEST_COMMON_MK_INCLUDED := yes
+
+# The Makefile's own targets come first.
+.DEFAULT_GOAL := all
+
+.PHONY: all clean cleanx
+
+
+
+#
+# --- Include the common makefile definitions ----------------------------------
+#
+
+# The drivers live two levels below the top of the source distribution. The
+# common definitions read the configuration (config.mk and make_defs.mk) and
+# add the flags for the configured threading model to CFLAGS and LDFLAGS.
+RELPATH        := ../..
+
+-include $(RELPATH)/common.mk
+
+
+
+#
+# --- BLIS library and header path ---------------------------------------------
+#
+
+# This is simply wherever BLIS was installed.
+BLIS_LIB_PATH  := $(INSTALL_PREFIX)/lib
+BLIS_INC_PATH  := $(INSTALL_PREFIX)/include/blis
+
+BLIS_LIB       := $(BLIS_LIB_PATH)/libblis.a
+
+
+
+#
+# --- General build definitions ------------------------------------------------
+#
+
+# Add installed and local header paths to CFLAGS
+CFLAGS         += -I$(BLIS_INC_PATH) -I.
+
+LINKER         := $(CC)
+
+# Datatype
+DT_S     := -DDT=BLIS_FLOAT
+DT_D     := -DDT=BLIS_DOUBLE
+DT_C     := -DDT=BLIS_SCOMPLEX
+DT_Z     := -DDT=BLIS_DCOMPLEX
+
+
+
+#
+# --- Targets/rules ------------------------------------------------------------
+#
+
+# -- Object file rules --
+
+%.o: %.c
+	$(CC) $(CFLAGS) $(TEST_DEFS) -c $< -o $@
+
+
+# -- Executable file rules --
+
+%.x: %.o $(BLIS_LIB)
+	$(LINKER) $< $(BLIS_LIB) $(LDFLAGS) -o $@
+
+
+# -- Clean rules --
+
+clean: cleanx
+
+cleanx:
+	- $(RM_F) *.o *.x
+
+# end of ifndef TEST_COMMON_MK_INCLUDED conditional block
+endif
+
@@ -0,0 +1,523 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <unistd.h>
+#include "blis.h"
+
+// This driver searches the cache blocksizes (MC, KC and NC) of the native
+// gemm micro-kernels and the parameters of the automatic thread
+// partitioning on the running machine, and writes the best values found to
+// a tuning file. Point BLIS_TUNE_FILE at the file to have bli_init() load
+// it (see frame/base/bli_tune.h). For example:
+//
+//   ./test_tune.x -d sd -t 8 -o $HOME/.blis.tune
+//   export BLIS_TUNE_FILE=$HOME/.blis.tune
+//
+// Options (defaults in brackets):
+//   -d  datatypes, as a string of s, d, c and z characters      [d]
+//   -p  problem size: m = n = k = p for MC and KC, and n is widened
+//       to twice the largest NC candidate when searching NC        [P_SIZE]
+//   -t  number of threads; if greater than one, the thread partitioning
+//       parameters are searched as well, with the first datatype   [1]
+//   -r  number of repeats; the best time is used             [N_REPEATS]
+//   -R  number of rounds of the search                       [N_ROUNDS]
+//   -o  tuning file to write                                 [stdout]
+//
+// The search is a coordinate descent that starts from the current values
+// (those of the configuration, or of a tuning file already loaded). In
+// each round, KC, MC and NC are visited in turn, and each is set to the
+// best of a few multiples of its current value, rounded to KR (and 8),
+// MR and NR, respectively. A candidate must beat the current value by
+// MIN_GAIN to replace it, so that timing noise does not move the result.
+// Problem sizes that are multiples of all registered micro-tile sizes keep
+// the default micro-kernel selected while searching.
+//
+// Finally, the parameters of the level-3 cost model are calibrated with the
+// chosen blocksizes (see calibrate_model()) and written to the tuning file
+// along with them.
+
+#ifndef P_SIZE
+#define P_SIZE    960
+#endif
+#ifndef N_REPEATS
+#define N_REPEATS 3
+#endif
+#ifndef N_ROUNDS
+#define N_ROUNDS  2
+#endif
+
+#define MIN_GAIN  0.01
+#define MAX_CANDS 8
+#define MAX_LINE  1024
+
+static double scales[] = { 0.5, 0.75, 1.0, 1.25, 1.5, 2.0 };
+
+#define N_SCALES  ( sizeof( scales ) / sizeof( scales[0] ) )
+
+
+static dim_t get_blksz( bszid_t bs_id, num_t dt )
+{
+	blksz_t blksz;
+
+	bli_gks_get_blksz( bs_id, &blksz );
+
+	return bli_blksz_get_def( dt, &blksz );
+}
+
+// Set a cache blocksize, keeping the maximum at the same distance from the
+// default (as bli_tune_load() does).
+static void set_blksz( bszid_t bs_id, num_t dt, dim_t val )
+{
+	blksz_t blksz;
+	dim_t   def, max;
+
+	bli_gks_get_blksz( bs_id, &blksz );
+
+	def = bli_blksz_get_def( dt, &blksz );
+	max = bli_blksz_get_max( dt, &blksz );
+
+	bli_gks_set_blksz_dt( bs_id, dt, val, val + ( max - def ) );
+}
+
+// Return the GFLOPS of the best of n_repeats gemm executions.
+static double time_gemm( num_t dt, dim_t m, dim_t n, dim_t k, int n_repeats )
+{
+	obj_t  a, b, c;
+	double dtime = DBL_MAX;
+	double flops = ( bli_is_complex( dt ) ? 8.0 : 2.0 ) * m * n * k;
+	double t;
+	int    r;
+
+	bli_obj_create( dt, m, k, 0, 0, &a );
+	bli_obj_create( dt, k, n, 0, 0, &b );
+	bli_obj_create( dt, m, n, 0, 0, &c );
+
+	bli_randm( &a );
+	bli_randm( &b );
+	bli_setm( &BLIS_ZERO, &c );
+
+	for ( r = 0; r < n_repeats; ++r )
+	{
+		t = bli_clock();
+
+		bli_gemm( &BLIS_ONE, &a, &b, &BLIS_ONE, &c );
+
+		dtime = bli_clock_min_diff( dtime, t );
+	}
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+
+	return flops / dtime / 1.0e9;
+}
+
+// Return the distinct multiples of mult nearest to cur * scales[].
+static dim_t candidates( dim_t cur, dim_t mult, dim_t* cands )
+{
+	dim_t n = 0;
+	dim_t i, j;
+
+	for ( i = 0; i < N_SCALES; ++i )
+	{
+		dim_t v = ( ( dim_t )( cur * scales[ i ] + mult / 2 ) / mult ) * mult;
+
+		if ( v < mult ) v = mult;
+
+		for ( j = 0; j < n; ++j ) if ( cands[ j ] == v ) break;
+
+		if ( j == n && n < MAX_CANDS ) cands[ n++ ] = v;
+	}
+
+	return n;
+}
+
+static void tune_blksz( num_t dt, char dt_ch, bszid_t bs_id, char* name,
+                        dim_t mult, dim_t p, int n_repeats )
+{
+	dim_t  cands[ MAX_CANDS ];
+	dim_t  cur   = get_blksz( bs_id, dt );
+	dim_t  n_c   = candidates( cur, mult, cands );
+	dim_t  m     = p;
+	dim_t  n     = p;
+	dim_t  k     = p;
+	dim_t  best  = cur;
+	double base, best_gf;
+	dim_t  i;
+
+	// NC only matters when n spans several blocks of columns.
+	if ( bs_id == BLIS_NC )
+		for ( i = 0; i < n_c; ++i ) n = bli_max( n, 2 * cands[ i ] );
+
+	base    = time_gemm( dt, m, n, k, n_repeats );
+	best_gf = base;
+
+	fprintf( stderr, "%c %s: %5ld  %8.3f GFLOPS (current)\n",
+	         dt_ch, name, ( long )cur, base );
+
+	for ( i = 0; i < n_c; ++i )
+	{
+		double gf;
+
+		if ( cands[ i ] == cur ) continue;
+
+		set_blksz( bs_id, dt, cands[ i ] );
+
+		gf = time_gemm( dt, m, n, k, n_repeats );
+
+		fprintf( stderr, "%c %s: %5ld  %8.3f GFLOPS\n",
+		         dt_ch, name, ( long )cands[ i ], gf );
+
+		if ( gf > best_gf && gf > base * ( 1.0 + MIN_GAIN ) )
+		{
+			best    = cands[ i ];
+			best_gf = gf;
+		}
+	}
+
+	set_blksz( bs_id, dt, best );
+
+	fprintf( stderr, "%c %s: chose %ld\n", dt_ch, name, ( long )best );
+}
+
+static void tune_threads( num_t dt, dim_t p, int n_repeats )
+{
+	dim_t  vals[ 4 ][ 4 ] = { { 1, 2, 3, 4 }, { 1, 2, 3, 4 },
+	                          { 1, 2, 4, 0 }, { 1, 2, 4, 0 } };
+	char*  names[ 4 ] = { "m_thread_ratio", "n_thread_ratio",
+	                      "mr_thread_max",  "nr_thread_max" };
+	dim_t  cur[ 4 ];
+	dim_t  i, j;
+
+	bli_thread_get_ratios( &cur[0], &cur[1], &cur[2], &cur[3] );
+
+	for ( i = 0; i < 4; ++i )
+	{
+		double base    = time_gemm( dt, p, p, p, n_repeats );
+		double best_gf = base;
+		dim_t  best    = cur[ i ];
+
+		fprintf( stderr, "%s: %ld  %8.3f GFLOPS (current)\n",
+		         names[ i ], ( long )cur[ i ], base );
+
+		for ( j = 0; j < 4 && vals[ i ][ j ] > 0; ++j )
+		{
+			dim_t  try[ 4 ] = { 0, 0, 0, 0 };
+			double gf;
+
+			if ( vals[ i ][ j ] == cur[ i ] ) continue;
+
+			try[ i ] = vals[ i ][ j ];
+			bli_thread_set_ratios( try[0], try[1], try[2], try[3] );
+
+			gf = time_gemm( dt, p, p, p, n_repeats );
+
+			fprintf( stderr, "%s: %ld  %8.3f GFLOPS\n",
+			         names[ i ], ( long )vals[ i ][ j ], gf );
+
+			if ( gf > best_gf && gf > base * ( 1.0 + MIN_GAIN ) )
+			{
+				best    = vals[ i ][ j ];
+				best_gf = gf;
+			}
+		}
+
+		cur[ i ] = best;
+		bli_thread_set_ratios( cur[0], cur[1], cur[2], cur[3] );
+
+		fprintf( stderr, "%s: chose %ld\n", names[ i ], ( long )best );
+	}
+}
+
+// Return the best time, in microseconds, of n_repeats executions of a gemm
+// that is small enough for the overheads to be measurable.
+static double time_gemm_us( num_t dt, dim_t m, dim_t n, dim_t k, int n_repeats )
+{
+	obj_t  a, b, c;
+	double dtime = DBL_MAX;
+	double t;
+	int    r;
+
+	bli_obj_create( dt, m, k, 0, 0, &a );
+	bli_obj_create( dt, k, n, 0, 0, &b );
+	bli_obj_create( dt, m, n, 0, 0, &c );
+
+	bli_randm( &a );
+	bli_randm( &b );
+	bli_setm( &BLIS_ZERO, &c );
+
+	for ( r = 0; r < n_repeats; ++r )
+	{
+		t = bli_clock();
+
+		bli_gemm( &BLIS_ONE, &a, &b, &BLIS_ONE, &c );
+
+		dtime = bli_clock_min_diff( dtime, t );
+	}
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+
+	return dtime * 1.0e6;
+}
+
+// Measure the parameters of the level-3 cost model (see bli_l3_model.h) in
+// the same terms as the model charges them: the fixed cost of a call, the
+// rate of packing (approximated by a transposing copy of a p x p matrix),
+// the rate of the micro-kernel once the packing is accounted for, and, if
+// nt is greater than one, the costs of starting a thread and of a barrier.
+// The latter two come from a problem with a single micro-tile, which only
+// one thread computes and packs, at two depths: one block of k and 64.
+static void calibrate_model( char* dt_chs, dim_t p, dim_t nt, int n_repeats )
+{
+	l3model_t model;
+	obj_t     a, b;
+	double    dtime = DBL_MAX;
+	double    t;
+	char*     dt_ch;
+	char      nt_str[ 32 ];
+	int       r;
+
+	bli_l3_model_get( &model );
+
+	setenv( "BLIS_NUM_THREADS", "1", 1 );
+
+	model.call_us = time_gemm_us( BLIS_DOUBLE, 1, 1, 1, 100 * n_repeats );
+
+	bli_obj_create( BLIS_DOUBLE, p, p, 0, 0, &a );
+	bli_obj_create( BLIS_DOUBLE, p, p, 0, 0, &b );
+	bli_randm( &a );
+	bli_obj_toggle_trans( a );
+
+	for ( r = 0; r < n_repeats; ++r )
+	{
+		t = bli_clock();
+
+		bli_copym( &a, &b );
+
+		dtime = bli_clock_min_diff( dtime, t );
+	}
+
+	model.pack_gbps = p * p * sizeof( double ) / dtime / 1.0e9;
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+
+	fprintf( stderr, "model: call %.3f us, packing %.3f GB/s\n",
+	         model.call_us, model.pack_gbps );
+
+	for ( dt_ch = dt_chs; *dt_ch != '\0'; ++dt_ch )
+	{
+		num_t  dt    = ( *dt_ch == 's' ? BLIS_FLOAT    :
+		                 *dt_ch == 'd' ? BLIS_DOUBLE   :
+		                 *dt_ch == 'c' ? BLIS_SCOMPLEX : BLIS_DCOMPLEX );
+		double flops = ( bli_is_complex( dt ) ? 8.0 : 2.0 ) * p * p * p;
+		double bytes = 3.0 * p * p * bli_datatype_size( dt );
+		double t_us  = time_gemm_us( dt, p, p, p, n_repeats );
+
+		t_us -= model.call_us + bytes / ( 1.0e3 * model.pack_gbps );
+
+		if ( t_us > 0.0 ) model.gflops[ dt ] = flops / ( 1.0e3 * t_us );
+
+		fprintf( stderr, "model: %c micro-kernel %.3f GFLOPS\n",
+		         *dt_ch, model.gflops[ dt ] );
+	}
+
+	if ( nt > 1 )
+	{
+		dim_t  mr = get_blksz( BLIS_MR, BLIS_DOUBLE );
+		dim_t  nr = get_blksz( BLIS_NR, BLIS_DOUBLE );
+		dim_t  kc = get_blksz( BLIS_KC, BLIS_DOUBLE );
+		double t1[ 2 ], tn[ 2 ], extra[ 2 ];
+		dim_t  log_nt;
+
+		for ( log_nt = 0; ( ( dim_t )1 << log_nt ) < nt; ++log_nt ) ;
+
+		t1[0] = time_gemm_us( BLIS_DOUBLE, mr, nr, kc,      10 * n_repeats );
+		t1[1] = time_gemm_us( BLIS_DOUBLE, mr, nr, 64 * kc, 10 * n_repeats );
+
+		sprintf( nt_str, "%ld", ( long )nt );
+		setenv( "BLIS_NUM_THREADS", nt_str, 1 );
+		tn[0] = time_gemm_us( BLIS_DOUBLE, mr, nr, kc,      10 * n_repeats );
+		tn[1] = time_gemm_us( BLIS_DOUBLE, mr, nr, 64 * kc, 10 * n_repeats );
+
+		// Each block of k is packed between four barriers.
+		extra[0] = bli_max( tn[0] - t1[0], 0.0 );
+		extra[1] = bli_max( tn[1] - t1[1], extra[0] );
+
+		model.barrier_us = ( extra[1] - extra[0] ) / ( 4.0 * 63 * log_nt );
+		model.thread_us  = bli_max( extra[0] - 4.0 * log_nt * model.barrier_us,
+		                            0.0 ) / ( nt - 1 );
+
+		fprintf( stderr, "model: thread %.3f us, barrier %.3f us\n",
+		         model.thread_us, model.barrier_us );
+	}
+
+	bli_l3_model_set( &model );
+}
+
+static void cpu_model( char* str, size_t len )
+{
+	FILE* file = fopen( "/proc/cpuinfo", "r" );
+	char  line[ MAX_LINE ];
+	char* p;
+
+	snprintf( str, len, "unknown" );
+
+	if ( file == NULL ) return;
+
+	while ( fgets( line, MAX_LINE, file ) != NULL )
+	{
+		if ( strncmp( line, "model name", 10 ) != 0 ) continue;
+		if ( ( p = strchr( line, ':' ) ) == NULL ) continue;
+
+		p += strspn( p + 1, " \t" ) + 1;
+		p[ strcspn( p, "\n" ) ] = '\0';
+		snprintf( str, len, "%s", p );
+		break;
+	}
+
+	fclose( file );
+}
+
+static void usage( void )
+{
+	fprintf( stderr, "usage: test_tune.x [-d dts] [-p size] [-t threads] "
+	                 "[-r n_repeats] [-R n_rounds] [-o file]\n" );
+	exit( 1 );
+}
+
+int main( int argc, char** argv )
+{
+	char*  dt_chs    = "d";
+	long   p         = P_SIZE;
+	long   nt        = 1;
+	int    n_repeats = N_REPEATS;
+	int    n_rounds  = N_ROUNDS;
+	char*  path      = NULL;
+	FILE*  file      = stdout;
+	char   nt_str[ 32 ];
+	char   model[ 256 ];
+	char*  dt_ch;
+	int    opt, round;
+
+	while ( ( opt = getopt( argc, argv, "d:p:t:r:R:o:" ) ) != -1 )
+	{
+		switch ( opt )
+		{
+			case 'd': dt_chs    = optarg;          break;
+			case 'p': p         = atol( optarg );  break;
+			case 't': nt        = atol( optarg );  break;
+			case 'r': n_repeats = atoi( optarg );  break;
+			case 'R': n_rounds  = atoi( optarg );  break;
+			case 'o': path      = optarg;          break;
+			default:  usage();
+		}
+	}
+
+	if ( optind != argc || p < 1 || nt < 1 || n_repeats < 1 || n_rounds < 1 ||
+	     strspn( dt_chs, "sdcz" ) != strlen( dt_chs ) ) usage();
+
+	// Search the blocksizes single-threaded, and the thread partitioning
+	// with the requested number of threads, letting BLIS choose the ways of
+	// parallelism in each loop.
+	unsetenv( "BLIS_JC_NT" );
+	unsetenv( "BLIS_IC_NT" );
+	unsetenv( "BLIS_JR_NT" );
+	unsetenv( "BLIS_IR_NT" );
+	setenv( "BLIS_NUM_THREADS", "1", 1 );
+
+	bli_init();
+
+	// Use all of the threads for every problem while measuring.
+	bli_l3_model_disable();
+
+	// The search starts from the blocksizes derived from the cache hierarchy
+	// (or from the configuration's, if that is disabled).
+	bli_cache_fprint( stderr );
+
+	for ( dt_ch = dt_chs; *dt_ch != '\0'; ++dt_ch )
+	{
+		num_t   dt = ( *dt_ch == 's' ? BLIS_FLOAT    :
+		               *dt_ch == 'd' ? BLIS_DOUBLE   :
+		               *dt_ch == 'c' ? BLIS_SCOMPLEX : BLIS_DCOMPLEX );
+		dim_t   kmult = bli_lcm( get_blksz( BLIS_KR, dt ), 8 );
+
+		for ( round = 0; round < n_rounds; ++round )
+		{
+			tune_blksz( dt, *dt_ch, BLIS_KC, "kc", kmult, p, n_repeats );
+			tune_blksz( dt, *dt_ch, BLIS_MC, "mc", get_blksz( BLIS_MR, dt ),
+			            p, n_repeats );
+			tune_blksz( dt, *dt_ch, BLIS_NC, "nc", get_blksz( BLIS_NR, dt ),
+			            p, n_repeats );
+		}
+	}
+
+	if ( nt > 1 )
+	{
+		num_t dt = ( dt_chs[0] == 's' ? BLIS_FLOAT    :
+		             dt_chs[0] == 'd' ? BLIS_DOUBLE   :
+		             dt_chs[0] == 'c' ? BLIS_SCOMPLEX : BLIS_DCOMPLEX );
+
+		sprintf( nt_str, "%ld", nt );
+		setenv( "BLIS_NUM_THREADS", nt_str, 1 );
+
+		tune_threads( dt, p, n_repeats );
+	}
+
+	calibrate_model( dt_chs, p, nt, n_repeats );
+
+	if ( path != NULL && ( file = fopen( path, "w" ) ) == NULL )
+	{
+		fprintf( stderr, "test_tune: cannot write '%s'\n", path );
+		return 1;
+	}
+
+	cpu_model( model, sizeof( model ) );
+
+	fprintf( file, "# BLIS tuning file written by test_tune.x\n" );
+	fprintf( file, "# blis %s, cpu: %s\n", bli_info_get_version_str(), model );
+	fprintf( file, "# datatypes %s, gemm with p = %ld, %ld thread(s), "
+	               "best of %d, %d round(s)\n",
+	         dt_chs, p, nt, n_repeats, n_rounds );
+	bli_tune_fprint( file );
+
+	if ( path != NULL ) fclose( file );
+
+	bli_finalize();
+
+	return 0;
+}
@@ -0,0 +1,606 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas at Austin nor the names
+      of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include <unistd.h>
+#include "blis.h"
+
+// This driver measures the level-3 micro-kernels and packing kernels of the
+// current configuration in isolation from the macro-kernels. Each kernel is
+// called repeatedly on the same packed micro-panels, which stay resident in
+// the L1 cache for small k, and the best rate over several repeats is
+// reported. For example:
+//
+//   ./test_ukr.x [-d sdcz] [-k 4,16,64,256,kc] [-P] [-g ghz]
+//
+// The kernels are taken from the contexts that the level-3 operations use:
+// the gemm micro-kernel (plus every variant registered for the datatype
+// with BLIS_?GEMM_UKERNEL_VARIANTS), the fused gemmtrsm micro-kernels, the
+// trsm micro-kernels, and the packm kernels for an MR x k micro-panel of A
+// (unit stride along the panel) and an NR x k micro-panel of B (unit stride
+// along k). By default, the next_a/next_b prefetch addresses in auxinfo_t
+// point to the current micro-panels; with -P they point to a second pair
+// of micro-panels that is used by the next call, as in the macro-kernel.
+//
+// For each kernel, the driver reports the bytes of packed input per call,
+// the arithmetic intensity (flops per byte), GFLOPS, GB/s of packed input,
+// cycles per call and per k iteration, and the percentage of the peak of
+// one core. Cycles are derived from the clock rate given by -g,
+// BLIS_BENCH_GHZ or /proc/cpuinfo; the peak is GHz * 2 *
+// BLIS_SIMD_FMA_PER_CYCLE * BLIS_SIMD_SIZE / sizeof( real datatype ), so
+// cores that run above their nominal clock may report more than 100%.
+
+#ifndef N_REPEATS
+#define N_REPEATS 3
+#endif
+#ifndef N_FLOPS
+#define N_FLOPS   1.0e8
+#endif
+
+#define MAX_K     32
+#define MAX_LINE  1024
+
+typedef void (*gemm_ukr_vft)
+     (
+       dim_t      k,
+       void*      alpha,
+       void*      a,
+       void*      b,
+       void*      beta,
+       void*      c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* data,
+       cntx_t*    cntx
+     );
+
+typedef void (*gemmtrsm_ukr_vft)
+     (
+       dim_t      k,
+       void*      alpha,
+       void*      a1x,
+       void*      a11,
+       void*      bx1,
+       void*      b11,
+       void*      c11, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* data,
+       cntx_t*    cntx
+     );
+
+typedef void (*trsm_ukr_vft)
+     (
+       void*      a,
+       void*      b,
+       void*      c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* data,
+       cntx_t*    cntx
+     );
+
+typedef void (*packm_cxk_vft)
+     (
+       conj_t  conja,
+       dim_t   panel_dim,
+       dim_t   panel_len,
+       void*   kappa,
+       void*   a, inc_t inca, inc_t lda,
+       void*   p,             inc_t ldp,
+       cntx_t* cntx
+     );
+
+typedef enum
+{
+	KER_GEMM = 0,
+	KER_GEMMTRSM_L,
+	KER_GEMMTRSM_U,
+	KER_TRSM_L,
+	KER_TRSM_U,
+	KER_PACKM_A,
+	KER_PACKM_B,
+} ker_t;
+
+typedef struct
+{
+	ker_t   ker;
+	num_t   dt;
+	dim_t   mr, nr;
+	dim_t   packmr, packnr;
+	dim_t   k;
+	void*   f;
+	cntx_t* cntx;
+
+	// Two sets of micro-panels: the current set and the set that the
+	// prefetch addresses point to.
+	void*   a[ 2 ];
+	void*   b[ 2 ];
+	void*   c;
+	void*   src;
+	bool_t  prefetch;
+} ukr_data_t;
+
+
+static double peak_flops_per_cycle( num_t dt )
+{
+	dim_t dt_size = bli_datatype_size( bli_datatype_proj_to_real( dt ) );
+
+	return 2.0 * BLIS_SIMD_FMA_PER_CYCLE * BLIS_SIMD_SIZE / dt_size;
+}
+
+static double read_ghz( void )
+{
+	char*  str = getenv( "BLIS_BENCH_GHZ" );
+	FILE*  file;
+	char   line[ MAX_LINE ];
+	double mhz;
+
+	if ( str != NULL ) return atof( str );
+
+	file = fopen( "/proc/cpuinfo", "r" );
+
+	if ( file != NULL )
+	{
+		while ( fgets( line, MAX_LINE, file ) != NULL )
+		{
+			if ( sscanf( line, "cpu MHz : %lf", &mhz ) == 1 )
+			{
+				fclose( file );
+				return mhz / 1000.0;
+			}
+		}
+		fclose( file );
+	}
+
+	return 1.0;
+}
+
+// Fill a buffer of n elements with small values that neither overflow nor
+// underflow when the kernels accumulate into them repeatedly.
+static void fill_buf( num_t dt, void* buf, dim_t n )
+{
+	dim_t n_real = n * ( bli_is_complex( dt ) ? 2 : 1 );
+	dim_t i;
+
+	for ( i = 0; i < n_real; ++i )
+	{
+		double v = 0.01 * ( ( i * 7 ) % 13 - 6 );
+
+		if ( bli_is_single_prec( dt ) ) ( ( float*  )buf )[ i ] = v;
+		else                            ( ( double* )buf )[ i ] = v;
+	}
+}
+
+// Overwrite the packed mr x mr triangular block at a11 (column-stored with
+// leading dimension packmr) with the identity, so that repeated solves
+// leave the right-hand side bounded. The inverted diagonal of the identity
+// is the identity.
+static void set_identity( num_t dt, void* a11, dim_t mr, dim_t packmr )
+{
+	dim_t elem = bli_datatype_size( dt );
+	dim_t i;
+
+	memset( a11, 0, mr * packmr * elem );
+
+	for ( i = 0; i < mr; ++i )
+	{
+		char* p = ( char* )a11 + ( i + i * packmr ) * elem;
+
+		if ( bli_is_single_prec( dt ) ) *( float*  )p = 1.0f;
+		else                            *( double* )p = 1.0;
+	}
+}
+
+static void ukr_create( ukr_data_t* d )
+{
+	dim_t  elem = bli_datatype_size( d->dt );
+	dim_t  k    = d->k;
+	dim_t  a_len, b_len;
+	dim_t  s;
+
+	// Leave room for the triangular block after (or before) the panels
+	// that feed the gemmtrsm and trsm kernels.
+	a_len = ( k + d->mr ) * d->packmr;
+	b_len = ( k + d->mr ) * d->packnr;
+
+	for ( s = 0; s < 2; ++s )
+	{
+		d->a[ s ] = bli_malloc_user( a_len * elem );
+		d->b[ s ] = bli_malloc_user( b_len * elem );
+
+		fill_buf( d->dt, d->a[ s ], a_len );
+		fill_buf( d->dt, d->b[ s ], b_len );
+
+		if ( d->ker == KER_GEMMTRSM_L )
+			set_identity( d->dt, ( char* )d->a[ s ] + k * d->packmr * elem,
+			              d->mr, d->packmr );
+		else if ( d->ker != KER_GEMM )
+			set_identity( d->dt, d->a[ s ], d->mr, d->packmr );
+	}
+
+	d->c   = bli_malloc_user( d->mr * d->nr * elem );
+	d->src = bli_malloc_user( bli_max( d->mr, d->nr ) * bli_max( k, 1 ) * elem );
+
+	fill_buf( d->dt, d->c, d->mr * d->nr );
+	fill_buf( d->dt, d->src, bli_max( d->mr, d->nr ) * bli_max( k, 1 ) );
+}
+
+static void ukr_free( ukr_data_t* d )
+{
+	dim_t s;
+
+	for ( s = 0; s < 2; ++s )
+	{
+		bli_free_user( d->a[ s ] );
+		bli_free_user( d->b[ s ] );
+	}
+
+	bli_free_user( d->c );
+	bli_free_user( d->src );
+}
+
+// Invoke the kernel n_iter times.
+static void ukr_run( ukr_data_t* d, dim_t n_iter )
+{
+	dim_t     elem  = bli_datatype_size( d->dt );
+	void*     one   = bli_obj_buffer_for_const( d->dt, BLIS_ONE );
+	dim_t     k     = d->k;
+	dcomplex  beta;
+	auxinfo_t aux;
+	dim_t     i, s, s_next;
+
+	// The micro-kernels do not allow alpha and beta to alias.
+	memcpy( &beta, one, elem );
+
+	bli_auxinfo_set_schema_a( BLIS_PACKED_ROW_PANELS, aux );
+	bli_auxinfo_set_schema_b( BLIS_PACKED_COL_PANELS, aux );
+	bli_auxinfo_set_is_a( 1, aux );
+	bli_auxinfo_set_is_b( 1, aux );
+
+	for ( i = 0; i < n_iter; ++i )
+	{
+		s      = ( d->prefetch ? i & 1 : 0 );
+		s_next = ( d->prefetch ? s ^ 1 : s );
+
+		bli_auxinfo_set_next_a( d->a[ s_next ], aux );
+		bli_auxinfo_set_next_b( d->b[ s_next ], aux );
+
+		switch ( d->ker )
+		{
+			case KER_GEMM:
+			( ( gemm_ukr_vft )d->f )
+			( k, one, d->a[ s ], d->b[ s ], &beta, d->c, 1, d->mr, &aux, d->cntx );
+			break;
+
+			case KER_GEMMTRSM_L:
+			( ( gemmtrsm_ukr_vft )d->f )
+			( k, one,
+			  d->a[ s ], ( char* )d->a[ s ] + k * d->packmr * elem,
+			  d->b[ s ], ( char* )d->b[ s ] + k * d->packnr * elem,
+			  d->c, 1, d->mr, &aux, d->cntx );
+			break;
+
+			case KER_GEMMTRSM_U:
+			( ( gemmtrsm_ukr_vft )d->f )
+			( k, one,
+			  ( char* )d->a[ s ] + d->mr * d->packmr * elem, d->a[ s ],
+			  ( char* )d->b[ s ] + d->mr * d->packnr * elem, d->b[ s ],
+			  d->c, 1, d->mr, &aux, d->cntx );
+			break;
+
+			case KER_TRSM_L:
+			case KER_TRSM_U:
+			( ( trsm_ukr_vft )d->f )
+			( d->a[ s ], d->b[ s ], d->c, 1, d->mr, &aux, d->cntx );
+			break;
+
+			case KER_PACKM_A:
+			( ( packm_cxk_vft )d->f )
+			( BLIS_NO_CONJUGATE, d->mr, k, one,
+			  d->src, 1, d->mr, d->a[ s ], d->packmr, d->cntx );
+			break;
+
+			case KER_PACKM_B:
+			default:
+			( ( packm_cxk_vft )d->f )
+			( BLIS_NO_CONJUGATE, d->nr, k, one,
+			  d->src, k, 1, d->b[ s ], d->packnr, d->cntx );
+			break;
+		}
+	}
+}
+
+static void ukr_measure( char* name, ukr_data_t* d, double ghz, int n_repeats )
+{
+	dim_t  mr      = d->mr;
+	dim_t  nr      = d->nr;
+	dim_t  k       = d->k;
+	double mult    = ( bli_is_complex( d->dt ) ? 4.0 : 1.0 );
+	double elem    = bli_datatype_size( d->dt );
+	double flops   = 0.0;
+	double bytes   = 0.0;
+	double dtime   = DBL_MAX;
+	double t_call, gflops, gbytes, cyc_call, cyc_iter, eff;
+	dim_t  n_iter;
+	int    r;
+
+	switch ( d->ker )
+	{
+		case KER_GEMM:
+		flops = mult * 2.0 * mr * nr * k;
+		bytes = elem * ( mr + nr ) * k;
+		break;
+
+		case KER_GEMMTRSM_L:
+		case KER_GEMMTRSM_U:
+		flops = mult * ( 2.0 * mr * nr * k + 1.0 * mr * mr * nr );
+		bytes = elem * ( ( mr + nr ) * k + mr * mr + mr * nr );
+		break;
+
+		case KER_TRSM_L:
+		case KER_TRSM_U:
+		flops = mult * 1.0 * mr * mr * nr;
+		bytes = elem * ( mr * mr + mr * nr );
+		break;
+
+		case KER_PACKM_A:
+		bytes = elem * mr * k;
+		break;
+
+		case KER_PACKM_B:
+		default:
+		bytes = elem * nr * k;
+		break;
+	}
+
+	ukr_create( d );
+
+	// Choose the number of calls so that each timing covers about N_FLOPS
+	// flops (or N_FLOPS bytes for the packing kernels).
+	n_iter = ( dim_t )( N_FLOPS / bli_max( flops, bytes ) ) + 1;
+
+	// Warm up the caches before timing.
+	ukr_run( d, bli_min( n_iter, 100 ) );
+
+	for ( r = 0; r < n_repeats; ++r )
+	{
+		double t = bli_clock();
+
+		ukr_run( d, n_iter );
+
+		dtime = bli_clock_min_diff( dtime, t );
+	}
+
+	ukr_free( d );
+
+	t_call   = dtime / n_iter;
+	gflops   = flops / t_call / 1.0e9;
+	gbytes   = bytes / t_call / 1.0e9;
+	cyc_call = t_call * ghz * 1.0e9;
+	cyc_iter = cyc_call / bli_max( k, 1 );
+	eff      = 100.0 * gflops / ( ghz * peak_flops_per_cycle( d->dt ) );
+
+	printf( "  %-16s %c  %3lu %3lu %5lu %8.1f %7.3f %8.3f %8.3f %10.1f %8.2f %6.1f\n",
+	        name,
+	        ( bli_is_float( d->dt )    ? 's' :
+	          bli_is_double( d->dt )   ? 'd' :
+	          bli_is_scomplex( d->dt ) ? 'c' : 'z' ),
+	        ( unsigned long )mr, ( unsigned long )nr, ( unsigned long )k,
+	        bytes / 1024.0, ( bytes > 0.0 ? flops / bytes : 0.0 ),
+	        gflops, gbytes, cyc_call, cyc_iter, eff );
+}
+
+static packm_cxk_vft packm_cxk_func( num_t dt )
+{
+	if      ( bli_is_float( dt ) )    return ( packm_cxk_vft )bli_spackm_cxk;
+	else if ( bli_is_double( dt ) )   return ( packm_cxk_vft )bli_dpackm_cxk;
+	else if ( bli_is_scomplex( dt ) ) return ( packm_cxk_vft )bli_cpackm_cxk;
+	else                              return ( packm_cxk_vft )bli_zpackm_cxk;
+}
+
+static void usage( void )
+{
+	fprintf( stderr, "usage: test_ukr.x [-d dts] [-k k,...] [-P] [-g ghz] "
+	                 "[-r n_repeats]\n" );
+	exit( 1 );
+}
+
+int main( int argc, char** argv )
+{
+	char*      dt_chs    = "sdcz";
+	char*      k_arg     = "4,16,64,256,kc";
+	bool_t     prefetch  = FALSE;
+	double     ghz       = 0.0;
+	int        n_repeats = N_REPEATS;
+	char*      dt_ch;
+	char*      tok;
+	char       k_str[ MAX_LINE ];
+	char       name[ 64 ];
+	int        opt;
+
+	cntx_t     cntx_gemm;
+	cntx_t     cntx_trsm;
+	ukr_data_t d;
+	dim_t      ks[ MAX_K ];
+	dim_t      n_ks;
+	dim_t      i, v, n_vars;
+
+	while ( ( opt = getopt( argc, argv, "d:k:Pg:r:" ) ) != -1 )
+	{
+		switch ( opt )
+		{
+			case 'd': dt_chs    = optarg;          break;
+			case 'k': k_arg     = optarg;          break;
+			case 'P': prefetch  = TRUE;            break;
+			case 'g': ghz       = atof( optarg );  break;
+			case 'r': n_repeats = atoi( optarg );  break;
+			default:  usage();
+		}
+	}
+
+	if ( optind != argc || n_repeats < 1 ||
+	     strspn( dt_chs, "sdcz" ) != strlen( dt_chs ) ) usage();
+
+	bli_init();
+
+	if ( ghz <= 0.0 ) ghz = read_ghz();
+
+	printf( "%% blis %s, %.3f GHz, peak %.1f sflops and %.1f dflops per cycle, "
+	        "prefetch of next panels %s\n",
+	        bli_info_get_version_str(), ghz,
+	        peak_flops_per_cycle( BLIS_FLOAT ),
+	        peak_flops_per_cycle( BLIS_DOUBLE ),
+	        ( prefetch ? "on" : "off" ) );
+	printf( "%%\n" );
+	printf( "%% kernel           dt   mr  nr     k   kbytes  flop/B   gflops"
+	        "     GB/s   cyc/call cyc/iter  %%peak\n" );
+
+	for ( dt_ch = dt_chs; *dt_ch != '\0'; ++dt_ch )
+	{
+		num_t dt = ( *dt_ch == 's' ? BLIS_FLOAT    :
+		             *dt_ch == 'd' ? BLIS_DOUBLE   :
+		             *dt_ch == 'c' ? BLIS_SCOMPLEX : BLIS_DCOMPLEX );
+
+		bli_gemm_cntx_init( &cntx_gemm );
+		bli_trsm_cntx_init( &cntx_trsm );
+
+		// Parse the k values; "kc" stands for the KC blocksize.
+		strncpy( k_str, k_arg, MAX_LINE - 1 );
+		k_str[ MAX_LINE - 1 ] = '\0';
+
+		for ( n_ks = 0, tok = strtok( k_str, "," ); tok != NULL && n_ks < MAX_K;
+		      tok = strtok( NULL, "," ) )
+		{
+			dim_t k = ( strcmp( tok, "kc" ) == 0
+			            ? bli_cntx_get_blksz_def_dt( dt, BLIS_KC, &cntx_gemm )
+			            : atol( tok ) );
+
+			for ( i = 0; i < n_ks; ++i ) if ( ks[ i ] == k ) break;
+
+			if ( k > 0 && i == n_ks ) ks[ n_ks++ ] = k;
+		}
+
+		memset( &d, 0, sizeof( d ) );
+		d.dt       = dt;
+		d.prefetch = prefetch;
+
+		// The gemm micro-kernel of the context, and each registered variant.
+		n_vars = bli_gks_gemm_ukr_num_vars( dt );
+
+		for ( v = -1; v < n_vars; ++v )
+		{
+			cntx_t* cntx = &cntx_gemm;
+			cntx_t  cntx_var;
+
+			if ( v >= 0 )
+			{
+				cntx_var = cntx_gemm;
+				bli_gks_cntx_set_gemm_ukr_var( dt, v, &cntx_var );
+				cntx = &cntx_var;
+			}
+
+			d.ker    = KER_GEMM;
+			d.cntx   = cntx;
+			d.f      = bli_cntx_get_l3_ukr_dt( dt, BLIS_GEMM_UKR, cntx );
+			d.mr     = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+			d.nr     = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+			d.packmr = bli_cntx_get_blksz_max_dt( dt, BLIS_MR, cntx );
+			d.packnr = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, cntx );
+
+			if ( v < 0 ) sprintf( name, "gemm" );
+			else         sprintf( name, "gemm[var%lu]", ( unsigned long )v );
+
+			for ( i = 0; i < n_ks; ++i )
+			{
+				d.k = ks[ i ];
+				ukr_measure( name, &d, ghz, n_repeats );
+			}
+		}
+
+		// The fused gemmtrsm micro-kernels and the trsm micro-kernels.
+		d.cntx   = &cntx_trsm;
+		d.mr     = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, &cntx_trsm );
+		d.nr     = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, &cntx_trsm );
+		d.packmr = bli_cntx_get_blksz_max_dt( dt, BLIS_MR, &cntx_trsm );
+		d.packnr = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, &cntx_trsm );
+
+		for ( i = 0; i < n_ks; ++i )
+		{
+			d.k   = ks[ i ];
+			d.ker = KER_GEMMTRSM_L;
+			d.f   = bli_cntx_get_l3_ukr_dt( dt, BLIS_GEMMTRSM_L_UKR, &cntx_trsm );
+			ukr_measure( "gemmtrsm_l", &d, ghz, n_repeats );
+		}
+		for ( i = 0; i < n_ks; ++i )
+		{
+			d.k   = ks[ i ];
+			d.ker = KER_GEMMTRSM_U;
+			d.f   = bli_cntx_get_l3_ukr_dt( dt, BLIS_GEMMTRSM_U_UKR, &cntx_trsm );
+			ukr_measure( "gemmtrsm_u", &d, ghz, n_repeats );
+		}
+
+		d.k   = 0;
+		d.ker = KER_TRSM_L;
+		d.f   = bli_cntx_get_l3_ukr_dt( dt, BLIS_TRSM_L_UKR, &cntx_trsm );
+		ukr_measure( "trsm_l", &d, ghz, n_repeats );
+
+		d.ker = KER_TRSM_U;
+		d.f   = bli_cntx_get_l3_ukr_dt( dt, BLIS_TRSM_U_UKR, &cntx_trsm );
+		ukr_measure( "trsm_u", &d, ghz, n_repeats );
+
+		// The packing kernels for micro-panels of A and B, using the
+		// register blocksizes of the gemm context.
+		d.cntx   = &cntx_gemm;
+		d.f      = packm_cxk_func( dt );
+		d.mr     = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, &cntx_gemm );
+		d.nr     = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, &cntx_gemm );
+		d.packmr = bli_cntx_get_blksz_max_dt( dt, BLIS_MR, &cntx_gemm );
+		d.packnr = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, &cntx_gemm );
+
+		for ( i = 0; i < n_ks; ++i )
+		{
+			d.k   = ks[ i ];
+			d.ker = KER_PACKM_A;
+			ukr_measure( "packm_a", &d, ghz, n_repeats );
+		}
+		for ( i = 0; i < n_ks; ++i )
+		{
+			d.k   = ks[ i ];
+			d.ker = KER_PACKM_B;
+			ukr_measure( "packm_b", &d, ghz, n_repeats );
+		}
+
+		bli_trsm_cntx_finalize( &cntx_trsm );
+		bli_gemm_cntx_finalize( &cntx_gemm );
+	}
+
+	bli_finalize();
+
+	return 0;
+}
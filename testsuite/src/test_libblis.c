@@ -120,6 +120,7 @@ void libblis_test_level1v_ops( test_params_t* params, test_ops_t* ops )
 	libblis_test_dotv( params, &(ops->dotv) );
 	libblis_test_dotxv( params, &(ops->dotxv) );
 	libblis_test_normfv( params, &(ops->normfv) );
+	libblis_test_rotv( params, &(ops->rotv) );
 	libblis_test_scalv( params, &(ops->scalv) );
 	libblis_test_scal2v( params, &(ops->scal2v) );
 	libblis_test_setv( params, &(ops->setv) );
@@ -230,6 +231,7 @@ void libblis_test_read_ops_file( char* input_filename, test_ops_t* ops )
 	libblis_test_read_op_info( ops, input_stream, BLIS_NOID, BLIS_TEST_DIMS_M,   2, &(ops->dotv) );
 	libblis_test_read_op_info( ops, input_stream, BLIS_NOID, BLIS_TEST_DIMS_M,   2, &(ops->dotxv) );
 	libblis_test_read_op_info( ops, input_stream, BLIS_NOID, BLIS_TEST_DIMS_M,   0, &(ops->normfv) );
+	libblis_test_read_op_info( ops, input_stream, BLIS_NOID, BLIS_TEST_DIMS_M,   0, &(ops->rotv) );
 	libblis_test_read_op_info( ops, input_stream, BLIS_NOID, BLIS_TEST_DIMS_M,   1, &(ops->scalv) );
 	libblis_test_read_op_info( ops, input_stream, BLIS_NOID, BLIS_TEST_DIMS_M,   1, &(ops->scal2v) );
 	libblis_test_read_op_info( ops, input_stream, BLIS_NOID, BLIS_TEST_DIMS_M,   0, &(ops->setv) );
@@ -641,10 +643,14 @@ void libblis_test_output_params_struct( FILE* os, test_params_t* params )
 	libblis_test_fprintf_c( os, "BLAS compatibility layer         \n" );
 	libblis_test_fprintf_c( os, "  enabled?                     %d\n", ( int )bli_info_get_enable_blas2blis() );
 	libblis_test_fprintf_c( os, "  integer type size (bits)     %d\n", ( int )bli_info_get_blas2blis_int_type_size() );
+	libblis_test_fprintf_c( os, "  ILP64 (_64) symbols?         %d\n", ( int )bli_info_get_enable_blas_ilp64() );
 	libblis_test_fprintf_c( os, "\n" );
 	libblis_test_fprintf_c( os, "CBLAS compatibility layer        \n" );
 	libblis_test_fprintf_c( os, "  enabled?                     %d\n", ( int )bli_info_get_enable_cblas() );
 	libblis_test_fprintf_c( os, "\n" );
+	libblis_test_fprintf_c( os, "level-3 profiling                \n" );
+	libblis_test_fprintf_c( os, "  enabled?                     %d\n", ( int )bli_info_get_enable_profiling() );
+	libblis_test_fprintf_c( os, "\n" );
 	libblis_test_fprintf_c( os, "floating-point types           s       d       c       z \n" );
 	libblis_test_fprintf_c( os, "  sizes (bytes)          %7u %7u %7u %7u\n", sizeof(float),
 	                                                                          sizeof(double),
@@ -1278,8 +1284,12 @@ void libblis_test_op_driver( test_params_t* params,
 	char          funcname_str[64];
 	char          dims_str[64];
 	char          label_str[128];
+	char          perf_str[512];
 	unsigned int  n_spaces;
 	unsigned int  n_dims_print;
+	dim_t         ev0[ BLIS_NUM_PERF_EVENTS ];
+	dim_t         cyc_phase0[ BLIS_NUM_PROF_PHASES ];
+	bool_t        count_perf;
 
 	FILE*         output_stream = NULL;
 
@@ -1530,6 +1540,15 @@ void libblis_test_op_driver( test_params_t* params,
 					// Loop over the requested problem sizes.
 					for ( p_cur = p_first, pi = 1; p_cur <= p_max; p_cur += p_inc, ++pi )
 					{
+						// If the level-3 profile counts hardware events, take
+						// a snapshot so that we can report the events of this
+						// experiment.
+						count_perf = ( bli_opid_is_level3( op->opid ) &&
+						               bli_prof_get_perf_enabled() );
+
+						if ( count_perf )
+							libblis_test_get_perf_counts( ev0, cyc_phase0 );
+
 						f_exp( params,
 						       op,
 						       iface,
@@ -1609,6 +1628,20 @@ void libblis_test_op_driver( test_params_t* params,
 							                      pass_str );
 						}
 
+						// Output the hardware events of the timed calls, if
+						// they were counted.
+						if ( count_perf )
+						{
+							libblis_test_build_perf_string( ev0, cyc_phase0,
+							                                params->n_repeats,
+							                                perf_str );
+
+							libblis_test_fprintf( stdout, "%s\n", perf_str );
+
+							if ( output_stream )
+							libblis_test_fprintf( output_stream, "%s\n", perf_str );
+						}
+
 						// If we need to check whether to do something on failure,
 						// do so now.
 						if ( reaction_to_failure == ON_FAILURE_SLEEP_CHAR )
@@ -1801,6 +1834,67 @@ void libblis_test_build_col_labels_string( test_params_t* params, test_op_t* op,
 
 
 
+void libblis_test_get_perf_counts( dim_t* ev, dim_t* cyc_phase )
+{
+	dim_t i;
+
+	for ( i = 0; i < BLIS_NUM_PERF_EVENTS; ++i )
+		ev[i] = bli_prof_get_perf( BLIS_PROF_ALL_THREADS, BLIS_PROF_ALL_PHASES, i );
+
+	for ( i = 0; i < BLIS_NUM_PROF_PHASES; ++i )
+		cyc_phase[i] = bli_prof_get_perf( BLIS_PROF_ALL_THREADS, i, BLIS_PERF_CYCLES );
+}
+
+
+
+// %   perf per call: cycles 1.23e+06  instructions 2.46e+06 ...  ipc 2.00  cycles: packm_a 2.1% ...
+void libblis_test_build_perf_string( dim_t*       ev0,
+                                     dim_t*       cyc_phase0,
+                                     unsigned int n_repeats,
+                                     char*        perf_str )
+{
+	dim_t  ev[ BLIS_NUM_PERF_EVENTS ];
+	dim_t  cyc_phase[ BLIS_NUM_PROF_PHASES ];
+	double cyc, ins;
+	dim_t  i;
+
+	// The experiment times n_repeats calls of the operation, and the events
+	// of all of them (summed over threads) were charged to the profile.
+	libblis_test_get_perf_counts( ev, cyc_phase );
+
+	if ( n_repeats == 0 ) n_repeats = 1;
+
+	sprintf( perf_str, "%c   perf per call:", OUTPUT_COMMENT_CHAR );
+
+	for ( i = 0; i < BLIS_NUM_PERF_EVENTS; ++i )
+	{
+		if ( bli_prof_perf_is_avail( i ) )
+			sprintf( &perf_str[strlen(perf_str)], " %s %.3le",
+			         bli_perfctr_event_string( i ),
+			         ( double )( ev[i] - ev0[i] ) / n_repeats );
+		else
+			sprintf( &perf_str[strlen(perf_str)], " %s n/a",
+			         bli_perfctr_event_string( i ) );
+	}
+
+	cyc = ( double )( ev[ BLIS_PERF_CYCLES ] - ev0[ BLIS_PERF_CYCLES ] );
+	ins = ( double )( ev[ BLIS_PERF_INSTRUCTIONS ] - ev0[ BLIS_PERF_INSTRUCTIONS ] );
+
+	if ( cyc <= 0.0 ) return;
+
+	if ( bli_prof_perf_is_avail( BLIS_PERF_INSTRUCTIONS ) )
+		sprintf( &perf_str[strlen(perf_str)], "  ipc %.2lf", ins / cyc );
+
+	sprintf( &perf_str[strlen(perf_str)], "  cycles:" );
+
+	for ( i = 0; i < BLIS_NUM_PROF_PHASES; ++i )
+		sprintf( &perf_str[strlen(perf_str)], " %s %.1lf%%",
+		         bli_prof_phase_string( i ),
+		         100.0 * ( double )( cyc_phase[i] - cyc_phase0[i] ) / cyc );
+}
+
+
+
 void libblis_test_build_filename_string( char*        prefix_str,
                                          char*        op_str,
                                          char*        funcname_str )
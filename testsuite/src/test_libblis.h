@@ -222,6 +222,7 @@ typedef struct test_ops_s
 	test_op_t dotv;
 	test_op_t dotxv;
 	test_op_t normfv;
+	test_op_t rotv;
 	test_op_t scalv;
 	test_op_t scal2v;
 	test_op_t setv;
@@ -378,6 +379,13 @@ void libblis_test_build_filename_string( char*        prefix_str,
 
 void libblis_test_build_col_labels_string( test_params_t* params, test_op_t* op, char* l_str );
 
+void libblis_test_get_perf_counts( dim_t* ev, dim_t* cyc_phase );
+
+void libblis_test_build_perf_string( dim_t*       ev0,
+                                     dim_t*       cyc_phase0,
+                                     unsigned int n_repeats,
+                                     char*        perf_str );
+
 void fill_string_with_n_spaces( char* str, unsigned int n_spaces );
 
 // --- Create object ---
@@ -443,6 +451,7 @@ void libblis_test_check_empty_problem( obj_t* c, double* perf, double* resid );
 #include "test_dotv.h"
 #include "test_dotxv.h"
 #include "test_normfv.h"
+#include "test_rotv.h"
 #include "test_scalv.h"
 #include "test_scal2v.h"
 #include "test_setv.h"